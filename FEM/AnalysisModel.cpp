@@ -52,6 +52,9 @@
 
 
 #include <MapOfTaggedObjects.h>
+#include <ID.h>
+#include <iostream>
+using std::nothrow;
 
 #define START_EQN_NUM 0
 #define START_VERTEX_NUM 0
@@ -63,7 +66,8 @@ AnalysisModel::AnalysisModel(int theClassTag)
 :MovableObject(theClassTag),
  myDomain(0), myHandler(0),
  myDOFGraph(0), myGroupGraph(0),
- numFE_Ele(0), numDOF_Grp(0), numEqn(0)
+ numFE_Ele(0), numDOF_Grp(0), numEqn(0),
+ myFE_Colouring(0), myColourStart(0), numColours(-1), lastColourShared(false)
 {
     theFEs     = new ArrayOfTaggedObjects(1024);
     theDOFs    =  new ArrayOfTaggedObjects(1024);
@@ -77,7 +81,8 @@ AnalysisModel::AnalysisModel()
 :MovableObject(AnaMODEL_TAGS_AnalysisModel),
  myDomain(0), myHandler(0),
  myDOFGraph(0), myGroupGraph(0),
- numFE_Ele(0), numDOF_Grp(0), numEqn(0)
+ numFE_Ele(0), numDOF_Grp(0), numEqn(0),
+ myFE_Colouring(0), myColourStart(0), numColours(-1), lastColourShared(false)
 {
   theFEs     = new ArrayOfTaggedObjects(256);
   theDOFs    = new ArrayOfTaggedObjects(256);
@@ -90,7 +95,8 @@ AnalysisModel::AnalysisModel(TaggedObjectStorage &theFes, TaggedObjectStorage &t
 :MovableObject(AnaMODEL_TAGS_AnalysisModel),
  myDomain(0), myHandler(0),
  myDOFGraph(0), myGroupGraph(0),
- numFE_Ele(0), numDOF_Grp(0), numEqn(0)
+ numFE_Ele(0), numDOF_Grp(0), numEqn(0),
+ myFE_Colouring(0), myColourStart(0), numColours(-1), lastColourShared(false)
 {
   theFEs     = &theFes;
   theDOFs    = &theDofs;
@@ -125,6 +131,8 @@ AnalysisModel::~AnalysisModel()
   if (myDOFGraph != 0) {
     delete myDOFGraph;
   }
+
+  this->clearFE_Colouring();
 }    
 
 void
@@ -219,6 +227,8 @@ AnalysisModel::clearAll(void)
     numFE_Ele =0;
     numDOF_Grp = 0;
     numEqn = 0;    
+
+    this->clearFE_Colouring();
 }
 
 void
@@ -279,6 +289,9 @@ void
 AnalysisModel::setNumEqn(int theNumEqn)
 {
     numEqn = theNumEqn;
+
+    // the FE_Elements have been renumbered, the colouring is no longer valid
+    this->clearFE_Colouring();
 }
 
 int 
@@ -428,6 +441,170 @@ AnalysisModel::getDOFGroupGraph(void)
   return *myGroupGraph;
 }
 
+int
+AnalysisModel::getNumFE_Colours(void)
+{
+    if (numColours < 0)
+	if (this->buildFE_Colouring() < 0)
+	    return -1;
+
+    return numColours;
+}
+
+int
+AnalysisModel::getFE_Colour(int colour, FE_Element **&theColourFEs, bool &threadSafe)
+{
+    if (numColours < 0 || colour < 0 || colour >= numColours) {
+	opserr << "WARNING AnalysisModel::getFE_Colour - no colour " << colour << endln;
+	theColourFEs = 0;
+	threadSafe = false;
+	return -1;
+    }
+
+    theColourFEs = &myFE_Colouring[myColourStart[colour]];
+    threadSafe = (lastColourShared == false || colour < numColours-1);
+
+    return myColourStart[colour+1] - myColourStart[colour];
+}
+
+
+// int buildFE_Colouring(void);
+//	Greedy colouring of the FE_Elements in the order of the FE_EleIter,
+//	keeping a bit mask of the colours used at each equation. The colours
+//	are tried in passes of as many as there are bits in the mask, an
+//	FE_Element that does not fit in a pass is left for the next one. The
+//	FE_Elements that are not thread safe are all put in the last colour.
+
+int
+AnalysisModel::buildFE_Colouring(void)
+{
+    this->clearFE_Colouring();
+
+    int numFE = theFEs->getNumComponents();
+    int *feColour = new (nothrow) int[numFE+1];
+    FE_Element **theList = new (nothrow) FE_Element *[numFE+1];
+    unsigned int *eqnMask = new (nothrow) unsigned int[numEqn+1];
+    myFE_Colouring = new (nothrow) FE_Element *[numFE+1];
+
+    if (feColour == 0 || theList == 0 || eqnMask == 0 || myFE_Colouring == 0) {
+	opserr << "WARNING AnalysisModel::buildFE_Colouring - out of memory\n";
+	if (feColour != 0)
+	    delete [] feColour;
+	if (theList != 0)
+	    delete [] theList;
+	if (eqnMask != 0)
+	    delete [] eqnMask;
+	this->clearFE_Colouring();
+	return -1;
+    }
+
+    // collect the FE_Elements, -2 marks those still to be coloured and
+    // -1 those that are not thread safe
+    int numList = 0;
+    int numToColour = 0;
+    FE_Element *elePtr;
+    FE_EleIter &theEles = this->getFEs();
+    while ((elePtr = theEles()) != 0 && numList < numFE) {
+	if (elePtr->isThreadSafe() == true) {
+	    feColour[numList] = -2;
+	    numToColour++;
+	} else {
+	    feColour[numList] = -1;
+	    lastColourShared = true;
+	}
+	theList[numList++] = elePtr;
+    }
+
+    const int numBits = 8*sizeof(unsigned int);
+    const unsigned int allUsed = ~0u;
+    int firstColour = 0;
+    int maxColour = -1;
+
+    while (numToColour > 0) {
+	for (int j=0; j<numEqn; j++)
+	    eqnMask[j] = 0;
+
+	for (int i=0; i<numList; i++) {
+	    if (feColour[i] != -2)
+		continue;
+
+	    // find the colours used by the FE_Elements sharing an equation
+	    const ID &id = theList[i]->getID();
+	    unsigned int used = 0;
+	    for (int j=0; j<id.Size(); j++)
+		if (id(j) >= 0 && id(j) < numEqn)
+		    used |= eqnMask[id(j)];
+
+	    if (used == allUsed)
+		continue;
+
+	    int colour = 0;
+	    while (colour < numBits-1 && (used & (1u << colour)) != 0)
+		colour++;
+
+	    for (int j=0; j<id.Size(); j++)
+		if (id(j) >= 0 && id(j) < numEqn)
+		    eqnMask[id(j)] |= (1u << colour);
+
+	    feColour[i] = firstColour + colour;
+	    if (feColour[i] > maxColour)
+		maxColour = feColour[i];
+	    numToColour--;
+	}
+
+	firstColour += numBits;
+    }
+
+    numColours = maxColour + 1;
+    if (lastColourShared == true)
+	numColours++;
+
+    myColourStart = new (nothrow) int[numColours+1];
+    if (myColourStart == 0) {
+	opserr << "WARNING AnalysisModel::buildFE_Colouring - out of memory\n";
+	delete [] feColour;
+	delete [] theList;
+	delete [] eqnMask;
+	this->clearFE_Colouring();
+	return -1;
+    }
+
+    // order the FE_Elements by colour, keeping the FE_EleIter order in a colour
+    int loc = 0;
+    for (int c=0; c<numColours; c++) {
+	int theColour = c;
+	if (lastColourShared == true && c == numColours-1)
+	    theColour = -1;
+
+	myColourStart[c] = loc;
+	for (int i=0; i<numList; i++)
+	    if (feColour[i] == theColour)
+		myFE_Colouring[loc++] = theList[i];
+    }
+    myColourStart[numColours] = loc;
+
+    delete [] feColour;
+    delete [] theList;
+    delete [] eqnMask;
+
+    return 0;
+}
+
+void
+AnalysisModel::clearFE_Colouring(void)
+{
+    if (myFE_Colouring != 0)
+	delete [] myFE_Colouring;
+
+    if (myColourStart != 0)
+	delete [] myColourStart;
+
+    myFE_Colouring = 0;
+    myColourStart = 0;
+    numColours = -1;
+    lastColourShared = false;
+}
+
 
 
 
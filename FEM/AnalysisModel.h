@@ -79,6 +79,12 @@ class AnalysisModel: public MovableObject
     virtual int getNumEqn(void) const ; 
     virtual Graph &getDOFGraph(void);
     virtual Graph &getDOFGroupGraph(void);
+
+    // methods to access a colouring of the FE_Elements, no two FE_Elements
+    // of the same colour share an equation, so that the FE_Elements of a
+    // colour can add their contributions to a SOE concurrently
+    virtual int getNumFE_Colours(void);
+    virtual int getFE_Colour(int colour, FE_Element **&theColourFEs, bool &threadSafe);
     
     // methods to update the response quantities at the DOF_Groups,
     // which in turn set the new nodal trial response quantities.
@@ -125,6 +131,9 @@ class AnalysisModel: public MovableObject
 
     
   private:
+    int buildFE_Colouring(void);
+    void clearFE_Colouring(void);
+
     Domain *myDomain;
     ConstraintHandler *myHandler;
 
@@ -135,6 +144,11 @@ class AnalysisModel: public MovableObject
     int numDOF_Grp;            // number of DOF_Group objects added
     int numEqn;                // numEqn set by the ConstraintHandler typically
 
+    FE_Element **myFE_Colouring; // the FE_Elements ordered by colour
+    int *myColourStart;        // location of each colour in myFE_Colouring
+    int numColours;            // number of colours, -1 if not yet coloured
+    bool lastColourShared;     // true if the last colour is FE_Elements that are not thread safe
+
     TaggedObjectStorage  *theFEs;
     TaggedObjectStorage  *theDOFs;
     
@@ -0,0 +1,476 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/handler/AsyncStream.cpp
+//
+// Written: fmk
+//
+// Description: This file contains the implementation of AsyncStream and
+// AsyncStreamWriter.
+//
+// What: "@(#) AsyncStream.cpp, revA"
+
+#include <AsyncStream.h>
+#include <classTags.h>
+
+#include <chrono>
+
+AsyncStreamWriter::AsyncStreamWriter()
+  :stop(false)
+{
+  theThread = std::thread(&AsyncStreamWriter::run, this);
+}
+
+AsyncStreamWriter::~AsyncStreamWriter()
+{
+  {
+    std::lock_guard<std::mutex> lock(wakeMutex);
+    stop = true;
+  }
+  wakeCondition.notify_one();
+  theThread.join();
+}
+
+void
+AsyncStreamWriter::addStream(AsyncStream *theStream)
+{
+  std::lock_guard<std::mutex> lock(streamsMutex);
+  theStreams.push_back(theStream);
+}
+
+void
+AsyncStreamWriter::removeStream(AsyncStream *theStream)
+{
+  std::lock_guard<std::mutex> lock(streamsMutex);
+  for (unsigned int i=0; i<theStreams.size(); i++)
+    if (theStreams[i] == theStream) {
+      theStreams.erase(theStreams.begin() + i);
+      break;
+    }
+}
+
+void
+AsyncStreamWriter::wakeUp(void)
+{
+  wakeCondition.notify_one();
+}
+
+void
+AsyncStreamWriter::run(void)
+{
+  while (true) {
+    int numRows = 0;
+    {
+      std::lock_guard<std::mutex> lock(streamsMutex);
+      for (unsigned int i=0; i<theStreams.size(); i++)
+	numRows += theStreams[i]->drain();
+    }
+
+    // sleep until a ring is half full, or a while
+    std::unique_lock<std::mutex> lock(wakeMutex);
+    if (stop == true)
+      break;
+    if (numRows == 0)
+      wakeCondition.wait_for(lock, std::chrono::milliseconds(5));
+  }
+}
+
+AsyncStream::AsyncStream(OPS_Stream *stream, AsyncStreamWriter &writer, int rows)
+  :OPS_Stream(OPS_STREAM_TAGS_AsyncStream),
+   theStream(stream), theWriter(writer),
+   rowsInRing(rows), numColumns(0), head(0), tail(0)
+{
+  if (rowsInRing < 2)
+    rowsInRing = 2;
+
+  theWriter.addStream(this);
+}
+
+AsyncStream::~AsyncStream()
+{
+  theWriter.removeStream(this);
+
+  {
+    std::lock_guard<std::mutex> lock(streamMutex);
+    this->drainLocked();
+  }
+
+  delete theStream;
+}
+
+int
+AsyncStream::drain(void)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  return this->drainLocked();
+}
+
+int
+AsyncStream::drainLocked(void)
+{
+  unsigned long h = head.load(std::memory_order_acquire);
+  unsigned long t = tail.load(std::memory_order_relaxed);
+  int numRows = 0;
+
+  for (; t != h; t++, numRows++) {
+    const double *slot = &ring[(t % rowsInRing)*numColumns];
+    for (int i=0; i<numColumns; i++)
+      row(i) = slot[i];
+    theStream->write(row);
+    tail.store(t+1, std::memory_order_release);
+  }
+
+  return numRows;
+}
+
+int
+AsyncStream::write(Vector &data)
+{
+  int size = data.Size();
+
+  // the first row sets the size of the ring
+  if (numColumns == 0 && size != 0) {
+    std::lock_guard<std::mutex> lock(streamMutex);
+    numColumns = size;
+    ring.resize(rowsInRing*numColumns);
+    row.resize(numColumns);
+  }
+
+  if (size != numColumns) {
+    std::lock_guard<std::mutex> lock(streamMutex);
+    this->drainLocked();
+    return theStream->write(data);
+  }
+
+  // ring full, write it here
+  unsigned long h = head.load(std::memory_order_relaxed);
+  if (h - tail.load(std::memory_order_acquire) >= (unsigned long)rowsInRing) {
+    std::lock_guard<std::mutex> lock(streamMutex);
+    this->drainLocked();
+  }
+
+  double *slot = &ring[(h % rowsInRing)*numColumns];
+  for (int i=0; i<numColumns; i++)
+    slot[i] = data(i);
+  head.store(h+1, std::memory_order_release);
+
+  if (h+1 - tail.load(std::memory_order_relaxed) == (unsigned long)(rowsInRing/2))
+    theWriter.wakeUp();
+
+  return 0;
+}
+
+int
+AsyncStream::setFile(const char *fileName, openMode mode, bool echo)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  return theStream->setFile(fileName, mode, echo);
+}
+
+int
+AsyncStream::setPrecision(int prec)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  return theStream->setPrecision(prec);
+}
+
+int
+AsyncStream::setFloatField(floatField field)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  return theStream->setFloatField(field);
+}
+
+int
+AsyncStream::precision(int prec)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  return theStream->precision(prec);
+}
+
+int
+AsyncStream::width(int w)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  return theStream->width(w);
+}
+
+void
+AsyncStream::flush(void)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  theStream->flush();
+}
+
+int
+AsyncStream::tag(const char *tagName)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  return theStream->tag(tagName);
+}
+
+int
+AsyncStream::tag(const char *tagName, const char *value)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  return theStream->tag(tagName, value);
+}
+
+int
+AsyncStream::endTag()
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  return theStream->endTag();
+}
+
+int
+AsyncStream::attr(const char *name, int value)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  return theStream->attr(name, value);
+}
+
+int
+AsyncStream::attr(const char *name, double value)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  return theStream->attr(name, value);
+}
+
+int
+AsyncStream::attr(const char *name, const char *value)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  return theStream->attr(name, value);
+}
+
+OPS_Stream &
+AsyncStream::write(const char *s, int n)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::write(const unsigned char *s, int n)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::write(const signed char *s, int n)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::write(const void *s, int n)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::write(const double *s, int n)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(char c)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  *theStream << c;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(unsigned char c)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  *theStream << c;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(signed char c)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  *theStream << c;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(const char *s)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  *theStream << s;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(const unsigned char *s)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  *theStream << s;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(const signed char *s)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  *theStream << s;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(const void *p)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  *theStream << p;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(int n)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  *theStream << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(unsigned int n)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  *theStream << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(long n)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  *theStream << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(unsigned long n)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  *theStream << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(short n)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  *theStream << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(unsigned short n)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  *theStream << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(bool b)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  *theStream << b;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(double n)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  *theStream << n;
+  return *this;
+}
+
+OPS_Stream &
+AsyncStream::operator<<(float n)
+{
+  std::lock_guard<std::mutex> lock(streamMutex);
+  this->drainLocked();
+  *theStream << n;
+  return *this;
+}
+
+int
+AsyncStream::sendSelf(int commitTag, Channel &theChannel)
+{
+  return 0;
+}
+
+int
+AsyncStream::recvSelf(int commitTag, Channel &theChannel, 
+		      FEM_ObjectBroker &theBroker)
+{
+  return 0;
+}
@@ -0,0 +1,147 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/handler/AsyncStream.h
+//
+// Written: fmk
+//
+// Description: This file contains the class definitions for AsyncStream
+// and AsyncStreamWriter. An AsyncStream is put between a recorder and the
+// stream it writes to (a DataFileStream or a ChunkedBinaryStream). The
+// rows the recorder writes are copied into a ring buffer and written to
+// the stream by the thread of an AsyncStreamWriter, which serves all the
+// AsyncStreams given to it. The ring has one producer, the analysis, and
+// is emptied by whoever holds the lock of the stream, so the analysis
+// only waits when the ring is full: it then writes the rows itself.
+//
+// Anything else sent to the stream (the tags and attributes describing
+// the columns, text, flush) first writes the rows in the ring, on the
+// calling thread, so the output is in the same order as without the
+// AsyncStream. The AsyncStream deletes the stream it is given.
+//
+// What: "@(#) AsyncStream.h, revA"
+
+#ifndef _AsyncStream
+#define _AsyncStream
+
+#include <OPS_Stream.h>
+#include <Vector.h>
+
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+
+class AsyncStream;
+
+class AsyncStreamWriter
+{
+ public:
+  AsyncStreamWriter();
+  ~AsyncStreamWriter();
+
+  void addStream(AsyncStream *theStream);
+  void removeStream(AsyncStream *theStream);
+  void wakeUp(void);
+
+ private:
+  void run(void);
+
+  std::vector<AsyncStream *> theStreams;
+  std::mutex streamsMutex;
+  std::mutex wakeMutex;
+  std::condition_variable wakeCondition;
+  bool stop;
+  std::thread theThread;
+};
+
+class AsyncStream : public OPS_Stream
+{
+ public:
+  AsyncStream(OPS_Stream *theStream, AsyncStreamWriter &theWriter, int rowsInRing = 1024);
+  ~AsyncStream();
+
+  int setFile(const char *fileName, openMode mode = OVERWRITE, bool echo = false);
+  int setPrecision(int precision);
+  int setFloatField(floatField);
+  int precision(int precision);
+  int width(int width);
+  void flush(void);
+
+  // writes the rows in the ring to the stream, returns the number of rows
+  int drain(void);
+
+  // xml stuff
+  int tag(const char *);
+  int tag(const char *, const char *);
+  int endTag();
+  int attr(const char *name, int value);
+  int attr(const char *name, double value);
+  int attr(const char *name, const char *value);
+  int write(Vector &data);
+
+  // regular stuff
+  OPS_Stream& write(const char *s, int n);
+  OPS_Stream& write(const unsigned char *s, int n);
+  OPS_Stream& write(const signed char *s, int n);
+  OPS_Stream& write(const void *s, int n);
+  OPS_Stream& write(const double *s, int n);
+
+  OPS_Stream& operator<<(char c);
+  OPS_Stream& operator<<(unsigned char c);
+  OPS_Stream& operator<<(signed char c);
+  OPS_Stream& operator<<(const char *s);
+  OPS_Stream& operator<<(const unsigned char *s);
+  OPS_Stream& operator<<(const signed char *s);
+  OPS_Stream& operator<<(const void *p);
+  OPS_Stream& operator<<(int n);
+  OPS_Stream& operator<<(unsigned int n);
+  OPS_Stream& operator<<(long n);
+  OPS_Stream& operator<<(unsigned long n);
+  OPS_Stream& operator<<(short n);
+  OPS_Stream& operator<<(unsigned short n);
+  OPS_Stream& operator<<(bool b);
+  OPS_Stream& operator<<(double n);
+  OPS_Stream& operator<<(float n);
+
+  // parallel stuff
+  int sendSelf(int commitTag, Channel &theChannel);  
+  int recvSelf(int commitTag, Channel &theChannel, 
+	       FEM_ObjectBroker &theBroker);
+
+ private:
+  int drainLocked(void);
+
+  OPS_Stream *theStream;
+  AsyncStreamWriter &theWriter;
+  std::mutex streamMutex;
+
+  // the ring, rowsInRing rows of numColumns doubles. head counts the rows
+  // put in by the analysis and tail the rows written to the stream.
+  int rowsInRing;
+  int numColumns;
+  std::vector<double> ring;
+  std::atomic<unsigned long> head;
+  std::atomic<unsigned long> tail;
+  Vector row;
+};
+
+#endif
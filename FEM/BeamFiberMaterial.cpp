@@ -37,8 +37,8 @@
 #include <FEM_ObjectBroker.h>
 #include <string.h>
 
-Vector BeamFiberMaterial::stress(3);
-Matrix BeamFiberMaterial::tangent(3,3);
+thread_local Vector BeamFiberMaterial::stress(3);
+thread_local Matrix BeamFiberMaterial::tangent(3,3);
 
 BeamFiberMaterial::BeamFiberMaterial(void)
 : NDMaterial(0, ND_TAG_BeamFiberMaterial),
@@ -163,14 +163,14 @@ BeamFiberMaterial::setTrialStrain(const Vector &strainFromElement)
   //newton loop to solve for out-of-plane strains
 
   double norm;
-  static Vector condensedStress(3);
-  static Vector strainIncrement(3);
-  static Vector threeDstress(6);
-  static Vector threeDstrain(6);
-  static Matrix threeDtangent(6,6);
-  static Vector threeDstressCopy(6); 
-  static Matrix threeDtangentCopy(6,6);
-  static Matrix dd22(3,3);
+  static thread_local Vector condensedStress(3);
+  static thread_local Vector strainIncrement(3);
+  static thread_local Vector threeDstress(6);
+  static thread_local Vector threeDstrain(6);
+  static thread_local Matrix threeDtangent(6,6);
+  static thread_local Vector threeDstressCopy(6); 
+  static thread_local Matrix threeDtangentCopy(6,6);
+  static thread_local Matrix dd22(3,3);
 
   int i, j;
   int ii, jj;
@@ -252,7 +252,7 @@ const Vector&
 BeamFiberMaterial::getStress()
 {
   const Vector &threeDstress = theMaterial->getStress();
-  static Vector threeDstressCopy(6);
+  static thread_local Vector threeDstressCopy(6);
 
   int i, ii;
   //swap matrix indices to sort out-of-plane components 
@@ -272,12 +272,12 @@ BeamFiberMaterial::getStress()
 const Matrix&  
 BeamFiberMaterial::getTangent()
 {
-  static Matrix dd11(3,3);
-  static Matrix dd12(3,3);
-  static Matrix dd21(3,3);
-  static Matrix dd22(3,3);
-  static Matrix dd22invdd21(3,3);
-  static Matrix threeDtangentCopy(6,6);
+  static thread_local Matrix dd11(3,3);
+  static thread_local Matrix dd12(3,3);
+  static thread_local Matrix dd21(3,3);
+  static thread_local Matrix dd22(3,3);
+  static thread_local Matrix dd22invdd21(3,3);
+  static thread_local Matrix threeDtangentCopy(6,6);
 
   const Matrix &threeDtangent = theMaterial->getTangent();
 
@@ -321,12 +321,12 @@ BeamFiberMaterial::getTangent()
 const Matrix&  
 BeamFiberMaterial::getInitialTangent()
 {
-  static Matrix dd11(3,3);
-  static Matrix dd12(3,3);
-  static Matrix dd21(3,3);
-  static Matrix dd22(3,3);
-  static Matrix dd22invdd21(3,3);
-  static Matrix threeDtangentCopy(6,6);
+  static thread_local Matrix dd11(3,3);
+  static thread_local Matrix dd12(3,3);
+  static thread_local Matrix dd21(3,3);
+  static thread_local Matrix dd22(3,3);
+  static thread_local Matrix dd22invdd21(3,3);
+  static thread_local Matrix threeDtangentCopy(6,6);
 
   const Matrix &threeDtangent = theMaterial->getInitialTangent();
 
@@ -405,7 +405,7 @@ BeamFiberMaterial::sendSelf(int commitTag, Channel &theChannel)
   int res = 0;
 
   // put tag and assocaited materials class and database tags into an id and send it
-  static ID idData(3);
+  static thread_local ID idData(3);
   idData(0) = this->getTag();
   idData(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -422,7 +422,7 @@ BeamFiberMaterial::sendSelf(int commitTag, Channel &theChannel)
   }
 
   // put the strains in a vector and send it
-  static Vector vecData(3);
+  static thread_local Vector vecData(3);
   vecData(0) = Cstrain22;
   vecData(1) = Cstrain33;
   vecData(2) = Cgamma23;
@@ -447,7 +447,7 @@ BeamFiberMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
   int res = 0;
 
   // recv an id containg the tag and associated materials class and db tags
-  static ID idData(3);
+  static thread_local ID idData(3);
   res = theChannel.sendID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
     opserr << "BeamFiberMaterial::sendSelf() - failed to send id data\n";
@@ -471,7 +471,7 @@ BeamFiberMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
   theMaterial->setDbTag(idData(2));
 
   // recv a vector containing strains and set the strains
-  static Vector vecData(3);
+  static thread_local Vector vecData(3);
   res = theChannel.recvVector(this->getDbTag(), commitTag, vecData);
   if (res < 0) {
     opserr << "BeamFiberMaterial::sendSelf() - failed to send vector data\n";
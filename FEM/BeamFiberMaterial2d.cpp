@@ -37,8 +37,8 @@
 #include <FEM_ObjectBroker.h>
 #include <string.h>
 
-Vector BeamFiberMaterial2d::stress(2);
-Matrix BeamFiberMaterial2d::tangent(2,2);
+thread_local Vector BeamFiberMaterial2d::stress(2);
+thread_local Matrix BeamFiberMaterial2d::tangent(2,2);
 
 BeamFiberMaterial2d::BeamFiberMaterial2d(void)
   :NDMaterial(0, ND_TAG_BeamFiberMaterial2d),
@@ -168,14 +168,14 @@ BeamFiberMaterial2d::setTrialStrain(const Vector &strainFromElement)
   //newton loop to solve for out-of-plane strains
 
   double norm;
-  static Vector condensedStress(4);
-  static Vector strainIncrement(4);
-  static Vector threeDstress(6);
-  static Vector threeDstrain(6);
-  static Matrix threeDtangent(6,6);
-  static Vector threeDstressCopy(6); 
-  static Matrix threeDtangentCopy(6,6);
-  static Matrix dd22(4,4);
+  static thread_local Vector condensedStress(4);
+  static thread_local Vector strainIncrement(4);
+  static thread_local Vector threeDstress(6);
+  static thread_local Vector threeDstrain(6);
+  static thread_local Matrix threeDtangent(6,6);
+  static thread_local Vector threeDstressCopy(6); 
+  static thread_local Matrix threeDtangentCopy(6,6);
+  static thread_local Matrix dd22(4,4);
 
   int i, j;
   int ii, jj;
@@ -258,7 +258,7 @@ const Vector&
 BeamFiberMaterial2d::getStress()
 {
   const Vector &threeDstress = theMaterial->getStress();
-  static Vector threeDstressCopy(6);
+  static thread_local Vector threeDstressCopy(6);
 
   int i, ii;
   //swap matrix indices to sort out-of-plane components 
@@ -278,12 +278,12 @@ BeamFiberMaterial2d::getStress()
 const Matrix&  
 BeamFiberMaterial2d::getTangent()
 {
-  static Matrix dd11(2,2);
-  static Matrix dd12(2,4);
-  static Matrix dd21(4,2);
-  static Matrix dd22(4,4);
-  static Matrix dd22invdd21(4,4);
-  static Matrix threeDtangentCopy(6,6);
+  static thread_local Matrix dd11(2,2);
+  static thread_local Matrix dd12(2,4);
+  static thread_local Matrix dd21(4,2);
+  static thread_local Matrix dd22(4,4);
+  static thread_local Matrix dd22invdd21(4,4);
+  static thread_local Matrix threeDtangentCopy(6,6);
 
   const Matrix &threeDtangent = theMaterial->getTangent();
 
@@ -342,12 +342,12 @@ BeamFiberMaterial2d::getTangent()
 const Matrix&  
 BeamFiberMaterial2d::getInitialTangent()
 {
-  static Matrix dd11(2,2);
-  static Matrix dd12(2,4);
-  static Matrix dd21(4,2);
-  static Matrix dd22(4,4);
-  static Matrix dd22invdd21(4,4);
-  static Matrix threeDtangentCopy(6,6);
+  static thread_local Matrix dd11(2,2);
+  static thread_local Matrix dd12(2,4);
+  static thread_local Matrix dd21(4,2);
+  static thread_local Matrix dd22(4,4);
+  static thread_local Matrix dd22invdd21(4,4);
+  static thread_local Matrix threeDtangentCopy(6,6);
 
   const Matrix &threeDtangent = theMaterial->getInitialTangent();
 
@@ -455,7 +455,7 @@ BeamFiberMaterial2d::sendSelf(int commitTag, Channel &theChannel)
   int res = 0;
 
   // put tag and assocaited materials class and database tags into an id and send it
-  static ID idData(3);
+  static thread_local ID idData(3);
   idData(0) = this->getTag();
   idData(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -472,7 +472,7 @@ BeamFiberMaterial2d::sendSelf(int commitTag, Channel &theChannel)
   }
 
   // put the strains in a vector and send it
-  static Vector vecData(4);
+  static thread_local Vector vecData(4);
   vecData(0) = Cstrain22;
   vecData(1) = Cstrain33;
   vecData(2) = Cgamma31;
@@ -498,7 +498,7 @@ BeamFiberMaterial2d::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBrok
   int res = 0;
 
   // recv an id containg the tag and associated materials class and db tags
-  static ID idData(3);
+  static thread_local ID idData(3);
   res = theChannel.sendID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
     opserr << "BeamFiberMaterial2d::sendSelf() - failed to send id data\n";
@@ -522,7 +522,7 @@ BeamFiberMaterial2d::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBrok
   theMaterial->setDbTag(idData(2));
 
   // recv a vector containing strains and set the strains
-  static Vector vecData(4);
+  static thread_local Vector vecData(4);
   res = theChannel.recvVector(this->getDbTag(), commitTag, vecData);
   if (res < 0) {
     opserr << "BeamFiberMaterial2d::sendSelf() - failed to send vector data\n";
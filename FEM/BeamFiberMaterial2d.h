@@ -85,8 +85,8 @@ class BeamFiberMaterial2d: public NDMaterial {
 
     Vector strain;
 
-    static Vector stress;
-    static Matrix tangent;
+    static thread_local Vector stress;
+    static thread_local Matrix tangent;
 
     int indexMap(int i);
 
@@ -0,0 +1,429 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/database/BinaryFileDatastore.cpp
+//
+// Written: fmk
+//
+// Description: This file contains the class implementation for
+// BinaryFileDatastore. BinaryFileDatastore writes and restores a binary
+// checkpoint of the committed state of the Domain.
+//
+// What: "@(#) BinaryFileDatastore.cpp, revA"
+
+#include <BinaryFileDatastore.h>
+#include <Domain.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <Element.h>
+#include <ElementIter.h>
+#include <FEM_ObjectBroker.h>
+#include <Message.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <string.h>
+#include <stdio.h>
+
+#define BINARYFILEDATASTORE_MAGIC   0x4b50434f   // "OCPK"
+#define BINARYFILEDATASTORE_VERSION 1
+
+#define RECORD_ID      1
+#define RECORD_VECTOR  2
+#define RECORD_MATRIX  3
+#define RECORD_MESSAGE 4
+
+BinaryFileDatastore::BinaryFileDatastore(const char *theFileName,
+					 Domain &aDomain,
+					 FEM_ObjectBroker &theBroker)
+  :FE_Datastore(aDomain, theBroker),
+   theDomain(&aDomain), fileName(0), fileOpen(false)
+{
+  fileName = new char[strlen(theFileName)+1];
+  strcpy(fileName, theFileName);
+}
+
+BinaryFileDatastore::~BinaryFileDatastore()
+{
+  if (fileOpen == true)
+    theFile.close();
+
+  if (fileName != 0)
+    delete [] fileName;
+}
+
+int
+BinaryFileDatastore::sendRecord(int type, int dbTag, int n1, int n2,
+				const void *data, int numBytes)
+{
+  if (fileOpen == false) {
+    opserr << "WARNING BinaryFileDatastore::sendRecord - no checkpoint is being written\n";
+    return -1;
+  }
+
+  int header[4];
+  header[0] = type;
+  header[1] = dbTag;
+  header[2] = n1;
+  header[3] = n2;
+
+  theFile.write((const char *)header, 4*sizeof(int));
+  if (numBytes > 0)
+    theFile.write((const char *)data, numBytes);
+
+  if (theFile.bad()) {
+    opserr << "WARNING BinaryFileDatastore::sendRecord - failed to write to file " << fileName << endln;
+    return -2;
+  }
+
+  return 0;
+}
+
+int
+BinaryFileDatastore::recvRecord(int type, int dbTag, int n1, int n2,
+				void *data, int numBytes)
+{
+  if (fileOpen == false) {
+    opserr << "WARNING BinaryFileDatastore::recvRecord - no checkpoint is being read\n";
+    return -1;
+  }
+
+  int header[4];
+  theFile.read((char *)header, 4*sizeof(int));
+  if (!theFile) {
+    opserr << "WARNING BinaryFileDatastore::recvRecord - unexpected end of file " << fileName << endln;
+    return -2;
+  }
+
+  // the objects must ask for the same data as was sent
+  if (header[0] != type || header[2] != n1 || header[3] != n2) {
+    opserr << "WARNING BinaryFileDatastore::recvRecord - record in " << fileName;
+    opserr << " does not match, expected type " << type << " of size " << n1 << "x" << n2;
+    opserr << ", found type " << header[0] << " of size " << header[2] << "x" << header[3] << endln;
+    return -3;
+  }
+
+  if (numBytes > 0)
+    theFile.read((char *)data, numBytes);
+  if (!theFile) {
+    opserr << "WARNING BinaryFileDatastore::recvRecord - unexpected end of file " << fileName << endln;
+    return -2;
+  }
+
+  return 0;
+}
+
+int
+BinaryFileDatastore::sendMsg(int dataTag, int commitTag,
+			     const Message &theMessage,
+			     ChannelAddress *theAddress)
+{
+  return this->sendRecord(RECORD_MESSAGE, dataTag, theMessage.length, 1,
+			  theMessage.data, theMessage.length);
+}
+
+int
+BinaryFileDatastore::recvMsg(int dataTag, int commitTag,
+			     Message &theMessage,
+			     ChannelAddress *theAddress)
+{
+  return this->recvRecord(RECORD_MESSAGE, dataTag, theMessage.length, 1,
+			  theMessage.data, theMessage.length);
+}
+
+int
+BinaryFileDatastore::recvMsgUnknownSize(int dataTag, int commitTag,
+					Message &theMessage,
+					ChannelAddress *theAddress)
+{
+  opserr << "BinaryFileDatastore::recvMsgUnknownSize - not implemented\n";
+  return -1;
+}
+
+int
+BinaryFileDatastore::sendMatrix(int dataTag, int commitTag,
+				const Matrix &theMatrix,
+				ChannelAddress *theAddress)
+{
+  return this->sendRecord(RECORD_MATRIX, dataTag, theMatrix.numRows, theMatrix.numCols,
+			  theMatrix.data, theMatrix.dataSize*sizeof(double));
+}
+
+int
+BinaryFileDatastore::recvMatrix(int dataTag, int commitTag,
+				Matrix &theMatrix,
+				ChannelAddress *theAddress)
+{
+  return this->recvRecord(RECORD_MATRIX, dataTag, theMatrix.numRows, theMatrix.numCols,
+			  theMatrix.data, theMatrix.dataSize*sizeof(double));
+}
+
+int
+BinaryFileDatastore::sendVector(int dataTag, int commitTag,
+				const Vector &theVector,
+				ChannelAddress *theAddress)
+{
+  return this->sendRecord(RECORD_VECTOR, dataTag, theVector.sz, 1,
+			  theVector.theData, theVector.sz*sizeof(double));
+}
+
+int
+BinaryFileDatastore::recvVector(int dataTag, int commitTag,
+				Vector &theVector,
+				ChannelAddress *theAddress)
+{
+  return this->recvRecord(RECORD_VECTOR, dataTag, theVector.sz, 1,
+			  theVector.theData, theVector.sz*sizeof(double));
+}
+
+int
+BinaryFileDatastore::sendID(int dataTag, int commitTag,
+			    const ID &theID,
+			    ChannelAddress *theAddress)
+{
+  return this->sendRecord(RECORD_ID, dataTag, theID.sz, 1,
+			  theID.data, theID.sz*sizeof(int));
+}
+
+int
+BinaryFileDatastore::recvID(int dataTag, int commitTag,
+			    ID &theID,
+			    ChannelAddress *theAddress)
+{
+  return this->recvRecord(RECORD_ID, dataTag, theID.sz, 1,
+			  theID.data, theID.sz*sizeof(int));
+}
+
+int
+BinaryFileDatastore::commitState(int commitTag)
+{
+  // write to a temporary file first, the old checkpoint stays valid
+  // until the new one is complete
+  char *tmpName = new char[strlen(fileName)+5];
+  strcpy(tmpName, fileName);
+  strcat(tmpName, ".tmp");
+
+  theFile.open(tmpName, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!theFile) {
+    opserr << "WARNING BinaryFileDatastore::commitState - could not open file " << tmpName << endln;
+    delete [] tmpName;
+    return -1;
+  }
+  fileOpen = true;
+
+  int header[3];
+  header[0] = BINARYFILEDATASTORE_MAGIC;
+  header[1] = BINARYFILEDATASTORE_VERSION;
+  header[2] = commitTag;
+  theFile.write((const char *)header, 3*sizeof(int));
+
+  // the tags of the nodes and elements, the class tags of the elements
+  // and the committed time
+  int numNod = theDomain->getNumNodes();
+  int numEle = theDomain->getNumElements();
+  ID domainData(2 + numNod + 2*numEle);
+  domainData(0) = numNod;
+  domainData(1) = numEle;
+  int loc = 2;
+
+  Node *theNode;
+  NodeIter &theNodes = theDomain->getNodes();
+  while ((theNode = theNodes()) != 0) {
+    domainData(loc++) = theNode->getTag();
+    if (theNode->getDbTag() == 0)
+      theNode->setDbTag(this->getDbTag());
+  }
+
+  Element *theEle;
+  ElementIter &theElements = theDomain->getElements();
+  while ((theEle = theElements()) != 0) {
+    domainData(loc++) = theEle->getTag();
+    domainData(loc++) = theEle->getClassTag();
+    if (theEle->getDbTag() == 0)
+      theEle->setDbTag(this->getDbTag());
+  }
+
+  Vector domainTime(1);
+  domainTime(0) = theDomain->getCurrentTime();
+
+  int res = 0;
+  if (this->sendID(0, commitTag, domainData) < 0 ||
+      this->sendVector(0, commitTag, domainTime) < 0)
+    res = -2;
+
+  // now the objects themselves
+  NodeIter &theNodes2 = theDomain->getNodes();
+  while (res == 0 && (theNode = theNodes2()) != 0) {
+    if (theNode->sendSelf(commitTag, *this) < 0) {
+      opserr << "WARNING BinaryFileDatastore::commitState - node with tag " << theNode->getTag() << " failed in sendSelf\n";
+      res = -3;
+    }
+  }
+
+  ElementIter &theElements2 = theDomain->getElements();
+  while (res == 0 && (theEle = theElements2()) != 0) {
+    if (theEle->sendSelf(commitTag, *this) < 0) {
+      opserr << "WARNING BinaryFileDatastore::commitState - element with tag " << theEle->getTag() << " failed in sendSelf\n";
+      res = -4;
+    }
+  }
+
+  theFile.close();
+  fileOpen = false;
+
+  if (res == 0 && theFile.fail()) {
+    opserr << "WARNING BinaryFileDatastore::commitState - failed to write file " << tmpName << endln;
+    res = -5;
+  }
+
+  if (res == 0) {
+#ifdef _WIN32
+    remove(fileName);
+#endif
+    if (rename(tmpName, fileName) != 0) {
+      opserr << "WARNING BinaryFileDatastore::commitState - could not rename " << tmpName;
+      opserr << " to " << fileName << endln;
+      res = -6;
+    }
+  } else
+    remove(tmpName);
+
+  delete [] tmpName;
+  return res;
+}
+
+int
+BinaryFileDatastore::readHeader(int &commitTag)
+{
+  theFile.open(fileName, std::ios::in | std::ios::binary);
+  if (!theFile) {
+    theFile.clear();
+    return -1;
+  }
+  fileOpen = true;
+
+  int header[3];
+  theFile.read((char *)header, 3*sizeof(int));
+  if (!theFile || header[0] != BINARYFILEDATASTORE_MAGIC) {
+    opserr << "WARNING BinaryFileDatastore::readHeader - " << fileName << " is not a checkpoint file\n";
+    return -2;
+  }
+  if (header[1] != BINARYFILEDATASTORE_VERSION) {
+    opserr << "WARNING BinaryFileDatastore::readHeader - " << fileName << " has version " << header[1];
+    opserr << ", expected " << BINARYFILEDATASTORE_VERSION << endln;
+    return -2;
+  }
+
+  commitTag = header[2];
+  return 0;
+}
+
+int
+BinaryFileDatastore::getCommitTag(void)
+{
+  int commitTag = -1;
+  if (this->readHeader(commitTag) < 0)
+    commitTag = -1;
+
+  if (fileOpen == true)
+    theFile.close();
+  theFile.clear();
+  fileOpen = false;
+
+  return commitTag;
+}
+
+int
+BinaryFileDatastore::restoreState(int commitTag)
+{
+  int fileCommitTag = -1;
+  int res = this->readHeader(fileCommitTag);
+  if (res == -1)
+    opserr << "WARNING BinaryFileDatastore::restoreState - could not open file " << fileName << endln;
+  else if (res == 0 && fileCommitTag != commitTag) {
+    opserr << "WARNING BinaryFileDatastore::restoreState - " << fileName << " holds commitTag ";
+    opserr << fileCommitTag << ", not " << commitTag << endln;
+    res = -3;
+  }
+
+  // check the domain has the same nodes and elements
+  int numNod = theDomain->getNumNodes();
+  int numEle = theDomain->getNumElements();
+  ID domainData(2 + numNod + 2*numEle);
+  Vector domainTime(1);
+  if (res == 0) {
+    if (this->recvID(0, commitTag, domainData) < 0 ||
+	this->recvVector(0, commitTag, domainTime) < 0) {
+      opserr << "WARNING BinaryFileDatastore::restoreState - the checkpoint in " << fileName;
+      opserr << " is not for a domain with " << numNod << " nodes and " << numEle << " elements\n";
+      res = -4;
+    }
+  }
+
+  Node *theNode;
+  Element *theEle;
+  if (res == 0) {
+    int loc = 2;
+    NodeIter &theNodes = theDomain->getNodes();
+    while (res == 0 && (theNode = theNodes()) != 0) {
+      if (domainData(loc++) != theNode->getTag())
+	res = -5;
+    }
+    ElementIter &theElements = theDomain->getElements();
+    while (res == 0 && (theEle = theElements()) != 0) {
+      if (domainData(loc++) != theEle->getTag() || domainData(loc++) != theEle->getClassTag())
+	res = -5;
+    }
+    if (res != 0)
+      opserr << "WARNING BinaryFileDatastore::restoreState - the nodes and elements in " << fileName << " do not match the domain\n";
+  }
+
+  // now the objects themselves
+  FEM_ObjectBroker *theBroker = this->getObjectBroker();
+  if (res == 0) {
+    NodeIter &theNodes = theDomain->getNodes();
+    while (res == 0 && (theNode = theNodes()) != 0) {
+      if (theNode->recvSelf(commitTag, *this, *theBroker) < 0) {
+	opserr << "WARNING BinaryFileDatastore::restoreState - node with tag " << theNode->getTag() << " failed in recvSelf\n";
+	res = -6;
+      }
+    }
+
+    ElementIter &theElements = theDomain->getElements();
+    while (res == 0 && (theEle = theElements()) != 0) {
+      if (theEle->recvSelf(commitTag, *this, *theBroker) < 0) {
+	opserr << "WARNING BinaryFileDatastore::restoreState - element with tag " << theEle->getTag() << " failed in recvSelf\n";
+	res = -7;
+      }
+    }
+  }
+
+  if (fileOpen == true)
+    theFile.close();
+  theFile.clear();
+  fileOpen = false;
+
+  if (res == 0) {
+    theDomain->setCurrentTime(domainTime(0));
+    theDomain->setCommittedTime(domainTime(0));
+  }
+
+  return res;
+}
@@ -0,0 +1,111 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/database/BinaryFileDatastore.h
+//
+// Written: fmk
+//
+// Description: This file contains the class definition for
+// BinaryFileDatastore. BinaryFileDatastore is a concrete subclass of
+// FE_Datastore. It writes a binary checkpoint of the committed state of
+// the Domain to a single file, and restores it again.
+//
+// The file starts with a header (magic number, version and commitTag),
+// followed by the tags of the nodes and elements, the committed time and
+// then the data sent by sendSelf() on every node and element, in the
+// order of the Domain iterators. Every ID, Vector, Matrix and Message is
+// stored as a record of its type, size and raw data. The object data is
+// received by invoking recvSelf() on the objects in the same order, so
+// restoreState() needs a Domain built with the same nodes and elements
+// (e.g. by running the same model builder again); it checks this against
+// the tags in the file. commitState() writes to a temporary file which
+// then replaces the old checkpoint, so a crash while writing does not
+// destroy the last good checkpoint.
+//
+// What: "@(#) BinaryFileDatastore.h, revA"
+
+#ifndef BinaryFileDatastore_h
+#define BinaryFileDatastore_h
+
+#include <FE_Datastore.h>
+#include <fstream>
+
+class BinaryFileDatastore: public FE_Datastore
+{
+  public:
+    BinaryFileDatastore(const char *fileName,
+			Domain &theDomain,
+			FEM_ObjectBroker &theBroker);
+    ~BinaryFileDatastore();
+
+    // methods defined in the Channel class interface
+    int sendMsg(int dbTag, int commitTag,
+		const Message &theMessage,
+		ChannelAddress *theAddress =0);
+    int recvMsg(int dbTag, int commitTag,
+		Message &theMessage,
+		ChannelAddress *theAddress =0);
+    int recvMsgUnknownSize(int dbTag, int commitTag,
+		Message &theMessage,
+		ChannelAddress *theAddress =0);
+
+    int sendMatrix(int dbTag, int commitTag,
+		   const Matrix &theMatrix,
+		   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag,
+		   Matrix &theMatrix,
+		   ChannelAddress *theAddress =0);
+
+    int sendVector(int dbTag, int commitTag,
+		   const Vector &theVector,
+		   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag,
+		   Vector &theVector,
+		   ChannelAddress *theAddress =0);
+
+    int sendID(int dbTag, int commitTag,
+	       const ID &theID,
+	       ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag,
+	       ID &theID,
+	       ChannelAddress *theAddress =0);
+
+    // methods defined in the FE_Datastore class interface
+    int commitState(int commitTag);
+    int restoreState(int commitTag);
+
+    // commitTag of the checkpoint in the file, -1 if there is none
+    int getCommitTag(void);
+
+  protected:
+
+  private:
+    int sendRecord(int type, int dbTag, int n1, int n2, const void *data, int numBytes);
+    int recvRecord(int type, int dbTag, int n1, int n2, void *data, int numBytes);
+    int readHeader(int &commitTag);
+
+    Domain *theDomain;
+    char *fileName;
+    std::fstream theFile;
+    bool fileOpen;
+};
+
+#endif
+
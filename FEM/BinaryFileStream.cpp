@@ -64,7 +64,7 @@ BinaryFileStream::~BinaryFileStream()
 
   if (theChannels != 0) {
 
-    static ID lastMsg(1);
+    static thread_local ID lastMsg(1);
     if (sendSelfCount > 0) {
       for (int i=0; i<sendSelfCount; i++) 
 	theChannels[i]->sendID(0, 0, lastMsg);
@@ -503,7 +503,7 @@ BinaryFileStream::sendSelf(int commitTag, Channel &theChannel)
     delete [] theChannels;
   theChannels = theNextChannels;
 
-  static ID idData(3);
+  static thread_local ID idData(3);
   int fileNameLength = 0;
   if (fileName != 0)
     fileNameLength = strlen(fileName);
@@ -536,7 +536,7 @@ BinaryFileStream::sendSelf(int commitTag, Channel &theChannel)
 int 
 BinaryFileStream::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
-  static ID idData(3);
+  static thread_local ID idData(3);
 
   sendSelfCount = -1;
   theChannels = new Channel *[1];
@@ -767,7 +767,7 @@ int
 BinaryFileStream::setOrder(const ID &orderData)
 {
   if (sendSelfCount < 0) {
-    static ID numColumnID(1);
+    static thread_local ID numColumnID(1);
     int numColumn = orderData.Size();
     numColumnID(0) = numColumn;
     theChannels[0]->sendID(0, 0, numColumnID);
@@ -799,7 +799,7 @@ BinaryFileStream::setOrder(const ID &orderData)
 
     // now receive orderData from the other channels
     for (int i=0; i<sendSelfCount; i++) { 
-      static ID numColumnID(1);	  
+      static thread_local ID numColumnID(1);	  
       if (theChannels[i]->recvID(0, 0, numColumnID) < 0) {
 	opserr << "BinaryFileStream::setOrder - failed to recv column size for process: " << i+1 << endln;
 	return -1;
@@ -0,0 +1,252 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+// File: ~/system_of_eqn/linearSOE/blockTriDiag/BlockTriDiagLinLapackSolver.cpp
+//
+// Written: fmk
+//
+// Description: This file contains the implementation of
+// BlockTriDiagLinLapackSolver. It solves the BlockTriDiagLinSOE object
+// by calling Lapack and Blas routines on the blocks.
+//
+// What: "@(#) BlockTriDiagLinLapackSolver.cpp, revA"
+
+#include <BlockTriDiagLinLapackSolver.h>
+#include <BlockTriDiagLinSOE.h>
+#include <math.h>
+#include <iostream>
+using std::nothrow;
+
+void* OPS_BlockTriDiagLinLapack()
+{
+    BlockTriDiagLinSolver *theSolver = new BlockTriDiagLinLapackSolver();
+    BlockTriDiagLinSOE *theSOE = new BlockTriDiagLinSOE(*theSolver);
+    return theSOE;
+}
+
+BlockTriDiagLinLapackSolver::BlockTriDiagLinLapackSolver()
+:BlockTriDiagLinSolver(SOLVER_TAGS_BlockTriDiagLinLapackSolver),
+ iPiv(0), iPivSize(0), work(0), workSize(0)
+{
+
+}
+
+BlockTriDiagLinLapackSolver::~BlockTriDiagLinLapackSolver()
+{
+    if (iPiv != 0)
+	delete [] iPiv;
+    if (work != 0)
+	delete [] work;
+}
+
+#ifdef _WIN32
+
+extern "C" int DGETRF(int *M, int *N, double *A, int *LDA,
+		      int *iPiv, int *INFO);
+
+extern "C" int DGETRS(char *TRANS, int *N, int *NRHS, double *A, int *LDA,
+		      int *iPiv, double *B, int *LDB, int *INFO);
+
+extern "C" int DGEMM(char *TRANSA, char *TRANSB, int *M, int *N, int *K,
+		     double *ALPHA, double *A, int *LDA, double *B, int *LDB,
+		     double *BETA, double *C, int *LDC);
+
+extern "C" int DGEMV(char *TRANS, int *M, int *N, double *ALPHA, double *A,
+		     int *LDA, double *X, int *INCX, double *BETA, double *Y,
+		     int *INCY);
+
+#define dgetrf_ DGETRF
+#define dgetrs_ DGETRS
+#define dgemm_ DGEMM
+#define dgemv_ DGEMV
+
+#else
+
+extern "C" int dgetrf_(int *M, int *N, double *A, int *LDA,
+		       int *iPiv, int *INFO);
+
+extern "C" int dgetrs_(char *TRANS, int *N, int *NRHS, double *A, int *LDA,
+		       int *iPiv, double *B, int *LDB, int *INFO);
+
+extern "C" int dgemm_(char *TRANSA, char *TRANSB, int *M, int *N, int *K,
+		      double *ALPHA, double *A, int *LDA, double *B, int *LDB,
+		      double *BETA, double *C, int *LDC);
+
+extern "C" int dgemv_(char *TRANS, int *M, int *N, double *ALPHA, double *A,
+		      int *LDA, double *X, int *INCX, double *BETA, double *Y,
+		      int *INCY);
+#endif
+
+int
+BlockTriDiagLinLapackSolver::solve(void)
+{
+    if (theSOE == 0) {
+	opserr << "WARNING BlockTriDiagLinLapackSolver::solve(void)- ";
+	opserr << " No LinearSOE object has been set\n";
+	return -1;
+    }
+
+    int n = theSOE->size;
+    // check iPiv is large enough
+    if (iPivSize < n || workSize < n) {
+	opserr << "WARNING BlockTriDiagLinLapackSolver::solve(void)- ";
+	opserr << " iPiv not large enough - has setSize() been called?\n";
+	return -1;
+    }
+
+    int numBlocks = theSOE->numBlocks;
+    int *blockStart = theSOE->blockStart;
+    int *blockEqn = theSOE->blockEqn;
+    double *Aptr = theSOE->A;
+    double *Xptr = theSOE->X;
+    double *Bptr = theSOE->B;
+
+    char trans[] = "N";
+    int one = 1;
+    double plusOne = 1.0;
+    double minusOne = -1.0;
+    int info = 0;
+
+    // factor: S_k = D_k - L_{k-1} W_{k-1},  W_k = S_k^{-1} U_k
+    if (theSOE->factored == false) {
+	for (int k=0; k<numBlocks; k++) {
+	    int sk = blockStart[k+1] - blockStart[k];
+	    double *Dk = Aptr + theSOE->dOff[k];
+	    int *iPivk = iPiv + blockStart[k];
+
+	    if (k > 0) {
+		int skm1 = blockStart[k] - blockStart[k-1];
+		double *Lkm1 = Aptr + theSOE->lOff[k-1];
+		double *Wkm1 = Aptr + theSOE->uOff[k-1];
+		dgemm_(trans, trans, &sk, &sk, &skm1, &minusOne, Lkm1, &sk,
+		       Wkm1, &skm1, &plusOne, Dk, &sk);
+	    }
+
+	    dgetrf_(&sk, &sk, Dk, &sk, iPivk, &info);
+	    if (info != 0) {
+		opserr << "WARNING BlockTriDiagLinLapackSolver::solve() -";
+		opserr << "LAPACK routine dgetrf returned " << info;
+		opserr << " for block " << k << endln;
+		return -abs(info);
+	    }
+
+	    if (k < numBlocks-1) {
+		int skp1 = blockStart[k+2] - blockStart[k+1];
+		double *Uk = Aptr + theSOE->uOff[k];
+		dgetrs_(trans, &sk, &skp1, Dk, &sk, iPivk, Uk, &sk, &info);
+		if (info != 0) {
+		    opserr << "WARNING BlockTriDiagLinLapackSolver::solve() -";
+		    opserr << "LAPACK routine dgetrs returned " << info << endln;
+		    return -abs(info);
+		}
+	    }
+	}
+	theSOE->factored = true;
+    }
+
+    // gather B in block order
+    for (int p=0; p<n; p++)
+	work[p] = Bptr[blockEqn[p]];
+
+    // forward substitution: y_k = S_k^{-1} (b_k - L_{k-1} y_{k-1})
+    for (int k=0; k<numBlocks; k++) {
+	int sk = blockStart[k+1] - blockStart[k];
+	double *yk = work + blockStart[k];
+
+	if (k > 0) {
+	    int skm1 = blockStart[k] - blockStart[k-1];
+	    double *Lkm1 = Aptr + theSOE->lOff[k-1];
+	    dgemv_(trans, &sk, &skm1, &minusOne, Lkm1, &sk, work + blockStart[k-1], &one,
+		   &plusOne, yk, &one);
+	}
+
+	dgetrs_(trans, &sk, &one, Aptr + theSOE->dOff[k], &sk, iPiv + blockStart[k],
+		yk, &sk, &info);
+    }
+
+    // backward substitution: x_k = y_k - W_k x_{k+1}
+    for (int k=numBlocks-2; k>=0; k--) {
+	int sk = blockStart[k+1] - blockStart[k];
+	int skp1 = blockStart[k+2] - blockStart[k+1];
+	dgemv_(trans, &sk, &skp1, &minusOne, Aptr + theSOE->uOff[k], &sk,
+	       work + blockStart[k+1], &one, &plusOne, work + blockStart[k], &one);
+    }
+
+    // scatter into X
+    for (int p=0; p<n; p++)
+	Xptr[blockEqn[p]] = work[p];
+
+    return 0;
+}
+
+
+
+int
+BlockTriDiagLinLapackSolver::setSize()
+{
+    // if iPiv not big enough, free it and get one large enough
+    if (iPivSize < theSOE->size) {
+	if (iPiv != 0)
+	    delete [] iPiv;
+
+	iPiv = new (nothrow) int[theSOE->size];
+	if (iPiv == 0) {
+	    opserr << "WARNING BlockTriDiagLinLapackSolver::setSize() ";
+	    opserr << " - ran out of memory for iPiv of size ";
+	    opserr << theSOE->size << endln;
+	    iPivSize = 0;
+	    return -1;
+	} else
+	    iPivSize = theSOE->size;
+    }
+
+    if (workSize < theSOE->size) {
+	if (work != 0)
+	    delete [] work;
+
+	work = new (nothrow) double[theSOE->size];
+	if (work == 0) {
+	    opserr << "WARNING BlockTriDiagLinLapackSolver::setSize() ";
+	    opserr << " - ran out of memory for work of size ";
+	    opserr << theSOE->size << endln;
+	    workSize = 0;
+	    return -1;
+	} else
+	    workSize = theSOE->size;
+    }
+
+    return 0;
+}
+
+int
+BlockTriDiagLinLapackSolver::sendSelf(int commitTag, Channel &theChannel)
+{
+    return 0;
+}
+
+int
+BlockTriDiagLinLapackSolver::recvSelf(int commitTag,
+				      Channel &theChannel,
+				      FEM_ObjectBroker &theBroker)
+{
+    // nothing to do
+    return 0;
+}
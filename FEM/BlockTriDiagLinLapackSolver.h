@@ -0,0 +1,68 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+// File: ~/system_of_eqn/linearSOE/blockTriDiag/BlockTriDiagLinLapackSolver.h
+//
+// Written: fmk
+//
+// Description: This file contains the class definition for
+// BlockTriDiagLinLapackSolver. It solves the BlockTriDiagLinSOE object
+// with the block Thomas algorithm:
+//
+//   S_0 = D_0,   S_k = D_k - L_{k-1} S_{k-1}^{-1} U_{k-1}
+//
+// where each S_k is factored by the Lapack routine dgetrf (LU with
+// partial pivoting within the block). The diagonal blocks are overwritten
+// by the factors of S_k and the upper blocks by S_k^{-1} U_k, so that
+// further solves with the same A only need the block substitutions.
+// The work is of order n*b^2 for a block size b.
+//
+// What: "@(#) BlockTriDiagLinLapackSolver.h, revA"
+
+#ifndef BlockTriDiagLinLapackSolver_h
+#define BlockTriDiagLinLapackSolver_h
+
+#include <BlockTriDiagLinSolver.h>
+
+class BlockTriDiagLinLapackSolver : public BlockTriDiagLinSolver
+{
+  public:
+    BlockTriDiagLinLapackSolver();
+    ~BlockTriDiagLinLapackSolver();
+
+    int solve(void);
+    int setSize(void);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
+
+  protected:
+
+  private:
+    int *iPiv;
+    int iPivSize;
+    double *work;
+    int workSize;
+};
+
+#endif
+
@@ -0,0 +1,610 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+// Written: fmk
+//
+// Description: This file contains the implementation for BlockTriDiagLinSOE
+
+#include <stdlib.h>
+
+#include <BlockTriDiagLinSOE.h>
+#include <BlockTriDiagLinSolver.h>
+#include <Matrix.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <VertexIter.h>
+#include <math.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <iostream>
+using std::nothrow;
+
+// breadth first search from root over the vertices not yet marked with
+// stamp; on return queue holds the vertices level by level and
+// levelStart[l] the position in queue of the first vertex of level l.
+// returns the number of levels.
+static int
+levelStructure(int root, const int *adjStart, const int *adj,
+	       int *mark, int stamp, int *queue, int *levelStart)
+{
+    int numLevels = 0;
+    int head = 0;
+    int tail = 0;
+
+    queue[tail++] = root;
+    mark[root] = stamp;
+
+    while (head < tail) {
+	levelStart[numLevels++] = head;
+	int levelEnd = tail;
+	for ( ; head < levelEnd; head++) {
+	    int v = queue[head];
+	    for (int p=adjStart[v]; p<adjStart[v+1]; p++) {
+		int w = adj[p];
+		if (mark[w] != stamp) {
+		    mark[w] = stamp;
+		    queue[tail++] = w;
+		}
+	    }
+	}
+    }
+    levelStart[numLevels] = tail;
+
+    return numLevels;
+}
+
+BlockTriDiagLinSOE::BlockTriDiagLinSOE(BlockTriDiagLinSolver &theSolvr)
+:LinearSOE(theSolvr, LinSOE_TAGS_BlockTriDiagLinSOE),
+ size(0), numBlocks(0), maxBlockSize(0), A(0), B(0), X(0),
+ blockStart(0), blockEqn(0), eqnBlock(0), eqnLoc(0), dOff(0), lOff(0), uOff(0),
+ vectX(0), vectB(0), Asize(0), Bsize(0), factored(false)
+{
+    theSolvr.setLinearSOE(*this);
+}
+
+BlockTriDiagLinSOE::BlockTriDiagLinSOE()
+:LinearSOE(LinSOE_TAGS_BlockTriDiagLinSOE),
+ size(0), numBlocks(0), maxBlockSize(0), A(0), B(0), X(0),
+ blockStart(0), blockEqn(0), eqnBlock(0), eqnLoc(0), dOff(0), lOff(0), uOff(0),
+ vectX(0), vectB(0), Asize(0), Bsize(0), factored(false)
+{
+
+}
+
+BlockTriDiagLinSOE::BlockTriDiagLinSOE(int classTag)
+:LinearSOE(classTag),
+ size(0), numBlocks(0), maxBlockSize(0), A(0), B(0), X(0),
+ blockStart(0), blockEqn(0), eqnBlock(0), eqnLoc(0), dOff(0), lOff(0), uOff(0),
+ vectX(0), vectB(0), Asize(0), Bsize(0), factored(false)
+{
+
+}
+
+int
+BlockTriDiagLinSOE::getNumEqn(void) const
+{
+    return size;
+}
+
+BlockTriDiagLinSOE::~BlockTriDiagLinSOE()
+{
+    if (A != 0) delete [] A;
+    if (B != 0) delete [] B;
+    if (X != 0) delete [] X;
+    if (blockStart != 0) delete [] blockStart;
+    if (blockEqn != 0) delete [] blockEqn;
+    if (eqnBlock != 0) delete [] eqnBlock;
+    if (eqnLoc != 0) delete [] eqnLoc;
+    if (dOff != 0) delete [] dOff;
+    if (lOff != 0) delete [] lOff;
+    if (uOff != 0) delete [] uOff;
+    if (vectX != 0) delete vectX;
+    if (vectB != 0) delete vectB;
+}
+
+
+int
+BlockTriDiagLinSOE::setSize(Graph &theGraph)
+{
+    int result = 0;
+    int oldSize = size;
+    size = theGraph.getNumVertex();
+
+    if (size > Bsize || blockStart == 0) { // we have to get space for the vectors
+
+	// delete the old
+	if (B != 0) delete [] B;
+	if (X != 0) delete [] X;
+	if (blockStart != 0) delete [] blockStart;
+	if (blockEqn != 0) delete [] blockEqn;
+	if (eqnBlock != 0) delete [] eqnBlock;
+	if (eqnLoc != 0) delete [] eqnLoc;
+	if (dOff != 0) delete [] dOff;
+	if (lOff != 0) delete [] lOff;
+	if (uOff != 0) delete [] uOff;
+
+	// create the new
+	B = new (nothrow) double[size];
+	X = new (nothrow) double[size];
+	blockStart = new (nothrow) int[size+1];
+	blockEqn = new (nothrow) int[size];
+	eqnBlock = new (nothrow) int[size];
+	eqnLoc = new (nothrow) int[size];
+	dOff = new (nothrow) int[size];
+	lOff = new (nothrow) int[size];
+	uOff = new (nothrow) int[size];
+
+        if (B == 0 || X == 0 || blockStart == 0 || blockEqn == 0 || eqnBlock == 0 ||
+	    eqnLoc == 0 || dOff == 0 || lOff == 0 || uOff == 0) {
+            opserr << "WARNING BlockTriDiagLinSOE::setSize :";
+	    opserr << " ran out of memory for vectors (size) (";
+	    opserr << size << ") \n";
+	    Bsize = 0; size = 0; numBlocks = 0;
+	    return -1;
+        }
+	else
+	    Bsize = size;
+    }
+
+    /*
+     * get the adjacency of the graph in compressed form
+     */
+
+    int numAdj = 0;
+    Vertex *vertexPtr;
+    VertexIter &theVertices = theGraph.getVertices();
+    while ((vertexPtr = theVertices()) != 0)
+	numAdj += vertexPtr->getAdjacency().Size();
+
+    int *adjStart = new (nothrow) int[size+1];
+    int *adj = new (nothrow) int[numAdj];
+    int *mark = new (nothrow) int[size];
+    int *queue = new (nothrow) int[size];
+    int *levelStart = new (nothrow) int[size+1];
+    if (adjStart == 0 || (adj == 0 && numAdj != 0) || mark == 0 || queue == 0 || levelStart == 0) {
+	opserr << "WARNING BlockTriDiagLinSOE::setSize :";
+	opserr << " ran out of memory for graph of size " << size << endln;
+	if (adjStart != 0) delete [] adjStart;
+	if (adj != 0) delete [] adj;
+	if (mark != 0) delete [] mark;
+	if (queue != 0) delete [] queue;
+	if (levelStart != 0) delete [] levelStart;
+	size = 0; numBlocks = 0;
+	return -1;
+    }
+
+    for (int i=0; i<=size; i++)
+	adjStart[i] = 0;
+
+    VertexIter &theVertices2 = theGraph.getVertices();
+    while ((vertexPtr = theVertices2()) != 0) {
+	int eqn = vertexPtr->getTag();
+	if (eqn < 0 || eqn >= size) {
+	    opserr << "WARNING BlockTriDiagLinSOE::setSize :";
+	    opserr << " vertex " << eqn << " outside range 0 to " << size-1 << endln;
+	    result = -1;
+	    continue;
+	}
+	adjStart[eqn+1] = vertexPtr->getAdjacency().Size();
+    }
+    for (int i=0; i<size; i++)
+	adjStart[i+1] += adjStart[i];
+
+    VertexIter &theVertices3 = theGraph.getVertices();
+    while ((vertexPtr = theVertices3()) != 0 && result == 0) {
+	int eqn = vertexPtr->getTag();
+	const ID &theAdjacency = vertexPtr->getAdjacency();
+	for (int i=0; i<theAdjacency.Size(); i++)
+	    adj[adjStart[eqn]+i] = theAdjacency(i);
+    }
+
+    /*
+     * determine the blocks from the level structure of each component,
+     * rooted at a pseudo-peripheral vertex (the one found at the far end
+     * of repeated searches) so that the levels are as narrow as possible
+     */
+
+    numBlocks = 0;
+    maxBlockSize = 0;
+    blockStart[0] = 0;
+
+    for (int i=0; i<size; i++) {
+	mark[i] = -1;
+	eqnBlock[i] = -1;
+    }
+
+    int stamp = 0;
+    for (int start=0; start<size && result == 0; start++) {
+	if (eqnBlock[start] != -1)
+	    continue;
+
+	int root = start;
+	int numLevels = levelStructure(root, adjStart, adj, mark, stamp++, queue, levelStart);
+	for (int iter=0; iter<8; iter++) {
+	    // minimum degree vertex in the last level
+	    int candidate = queue[levelStart[numLevels-1]];
+	    for (int p=levelStart[numLevels-1]; p<levelStart[numLevels]; p++) {
+		int v = queue[p];
+		if (adjStart[v+1]-adjStart[v] < adjStart[candidate+1]-adjStart[candidate])
+		    candidate = v;
+	    }
+	    int candLevels = levelStructure(candidate, adjStart, adj, mark, stamp++, queue, levelStart);
+	    if (candLevels <= numLevels) {
+		// no deeper structure found, rebuild the one from root
+		numLevels = levelStructure(root, adjStart, adj, mark, stamp++, queue, levelStart);
+		break;
+	    }
+	    root = candidate;
+	    numLevels = candLevels;
+	}
+
+	// each level becomes a block
+	for (int l=0; l<numLevels; l++) {
+	    int first = blockStart[numBlocks];
+	    int num = levelStart[l+1] - levelStart[l];
+	    for (int p=0; p<num; p++) {
+		int eqn = queue[levelStart[l]+p];
+		blockEqn[first+p] = eqn;
+		eqnBlock[eqn] = numBlocks;
+		eqnLoc[eqn] = p;
+	    }
+	    if (num > maxBlockSize)
+		maxBlockSize = num;
+	    numBlocks++;
+	    blockStart[numBlocks] = first + num;
+	}
+    }
+
+    delete [] adjStart;
+    delete [] adj;
+    delete [] mark;
+    delete [] queue;
+    delete [] levelStart;
+
+    if (result < 0) {
+	size = 0; numBlocks = 0;
+	return result;
+    }
+
+    /*
+     * location of the blocks in A
+     */
+
+    int newSize = 0;
+    for (int k=0; k<numBlocks; k++) {
+	int sk = this->blockSize(k);
+	dOff[k] = newSize;
+	newSize += sk*sk;
+	if (k < numBlocks-1) {
+	    int sk1 = this->blockSize(k+1);
+	    lOff[k] = newSize;
+	    newSize += sk1*sk;
+	    uOff[k] = newSize;
+	    newSize += sk*sk1;
+	}
+    }
+
+    if (newSize > Asize) { // we have to get another space for A
+
+	if (A != 0)
+	    delete [] A;
+
+	A = new (nothrow) double[newSize];
+
+        if (A == 0) {
+            opserr << "WARNING BlockTriDiagLinSOE::setSize :";
+	    opserr << " ran out of memory for A (size,blocks,maxBlock) (";
+	    opserr << size <<", " << numBlocks << ", " << maxBlockSize << ") \n";
+	    Asize = 0; size = 0; numBlocks = 0;
+	    return -1;
+        }
+	else
+	    Asize = newSize;
+    }
+
+    // zero the matrix
+    for (int i=0; i<Asize; i++)
+	A[i] = 0;
+
+    factored = false;
+
+    // zero the vectors
+    for (int j=0; j<size; j++) {
+	B[j] = 0;
+	X[j] = 0;
+    }
+
+    // get new Vector objects if size has changes
+    if (oldSize != size) {
+	if (vectX != 0)
+	    delete vectX;
+
+	if (vectB != 0)
+	    delete vectB;
+
+	vectX = new Vector(X,size);
+	vectB = new Vector(B,size);
+    }
+
+    // invoke setSize() on the Solver
+    LinearSOESolver *theSolvr = this->getSolver();
+    int solverOK = theSolvr->setSize();
+    if (solverOK < 0) {
+	opserr << "WARNING:BlockTriDiagLinSOE::setSize :";
+	opserr << " solver failed setSize()\n";
+	return solverOK;
+    }
+
+    return result;
+}
+
+
+int
+BlockTriDiagLinSOE::addEntry(int row, int col, double value)
+{
+    int br = eqnBlock[row];
+    int bc = eqnBlock[col];
+    int lr = eqnLoc[row];
+    int lc = eqnLoc[col];
+
+    if (br == bc)
+	A[dOff[br] + lc*this->blockSize(br) + lr] += value;
+    else if (br == bc+1)
+	A[lOff[bc] + lc*this->blockSize(br) + lr] += value;
+    else if (bc == br+1)
+	A[uOff[br] + lc*this->blockSize(br) + lr] += value;
+    else
+	return -1;
+
+    return 0;
+}
+
+
+int
+BlockTriDiagLinSOE::addA(const Matrix &m, const ID &id, double fact)
+{
+    // check for a quick return
+    if (fact == 0.0)  return 0;
+
+    // check that m and id are of similar size
+    int idSize = id.Size();
+    if (idSize != m.noRows() && idSize != m.noCols()) {
+	opserr << "BlockTriDiagLinSOE::addA()	- Matrix and ID not of similar sizes\n";
+	return -1;
+    }
+
+    int result = 0;
+    for (int i=0; i<idSize; i++) {
+	int col = id(i);
+	if (col < size && col >= 0) {
+	    for (int j=0; j<idSize; j++) {
+		int row = id(j);
+		if (row < size && row >= 0) {
+		    double value = (fact == 1.0) ? m(j,i) : m(j,i) * fact;
+		    if (this->addEntry(row, col, value) < 0)
+			result = -1;
+		}
+	    }  // for j
+	}
+    }  // for i
+
+    if (result < 0)
+	opserr << "BlockTriDiagLinSOE::addA() - entries outside the block tridiagonal pattern ignored\n";
+
+    return result;
+}
+
+
+int
+BlockTriDiagLinSOE::addColA(const Vector &colData, int col, double fact)
+{
+    if (fact == 0.0)  return 0;
+
+    if (colData.Size() != size) {
+	opserr << "BlockTriDiagLinSOE::addColA() - colData size not equal to n\n";
+	return -1;
+    }
+
+    if (col >= size || col < 0) {
+	opserr << "BlockTriDiagLinSOE::addColA() - col " << col << "outside range 0 to " << size << endln;
+	return -1;
+    }
+
+    // only the blocks in the pattern can be added to
+    int bc = eqnBlock[col];
+    int first = (bc > 0) ? blockStart[bc-1] : blockStart[bc];
+    int last = (bc < numBlocks-1) ? blockStart[bc+2] : blockStart[bc+1];
+    for (int p=first; p<last; p++) {
+	int row = blockEqn[p];
+	this->addEntry(row, col, colData(row) * fact);
+    }
+
+    return 0;
+}
+
+
+int
+BlockTriDiagLinSOE::addB(const Vector &v, const ID &id, double fact)
+{
+    // check for a quick return
+    if (fact == 0.0)  return 0;
+
+    // check that m and id are of similar size
+    int idSize = id.Size();
+    if (idSize != v.Size() ) {
+	opserr << "BlockTriDiagLinSOE::addB()	- Vector and ID not of similar sizes\n";
+	return -1;
+    }
+
+    if (fact == 1.0) { // do not need to multiply if fact == 1.0
+	for (int i=0; i<idSize; i++) {
+	    int pos = id(i);
+	    if (pos <size && pos >= 0)
+		B[pos] += v(i);
+	}
+    } else if (fact == -1.0) {
+	for (int i=0; i<idSize; i++) {
+	    int pos = id(i);
+	    if (pos <size && pos >= 0)
+		B[pos] -= v(i);
+	}
+    } else {
+	for (int i=0; i<idSize; i++) {
+	    int pos = id(i);
+	    if (pos <size && pos >= 0)
+		B[pos] += v(i) * fact;
+	}
+    }
+    return 0;
+}
+
+
+int
+BlockTriDiagLinSOE::setB(const Vector &v, double fact)
+{
+    // check for a quick return
+    if (fact == 0.0)  return 0;
+
+    if (v.Size() != size) {
+	opserr << "WARNING BlockTriDiagLinSOE::setB() -";
+	opserr << " incomptable sizes " << size << " and " << v.Size() << endln;
+	return -1;
+    }
+
+    if (fact == 1.0) { // do not need to multiply if fact == 1.0
+	for (int i=0; i<size; i++) {
+	    B[i] = v(i);
+	}
+    } else if (fact == -1.0) {
+	for (int i=0; i<size; i++) {
+	    B[i] = -v(i);
+	}
+    } else {
+	for (int i=0; i<size; i++) {
+	    B[i] = v(i) * fact;
+	}
+    }
+    return 0;
+}
+
+
+void
+BlockTriDiagLinSOE::zeroA(void)
+{
+    double *Aptr = A;
+    int theSize = Asize;
+    for (int i=0; i<theSize; i++)
+	*Aptr++ = 0;
+
+    factored = false;
+}
+
+void
+BlockTriDiagLinSOE::zeroB(void)
+{
+    double *Bptr = B;
+    for (int i=0; i<size; i++)
+	*Bptr++ = 0;
+}
+
+
+const Vector &
+BlockTriDiagLinSOE::getX(void)
+{
+    if (vectX == 0) {
+	opserr << "FATAL BlockTriDiagLinSOE::getX - vectX == 0!";
+	exit(-1);
+    }
+
+    return *vectX;
+}
+
+
+const Vector &
+BlockTriDiagLinSOE::getB(void)
+{
+    if (vectB == 0) {
+	opserr << "FATAL BlockTriDiagLinSOE::getB - vectB == 0!";
+	exit(-1);
+    }
+
+    return *vectB;
+}
+
+
+double
+BlockTriDiagLinSOE::normRHS(void)
+{
+    double norm =0.0;
+    double *Bptr = B;
+    for (int i=0; i<size; i++) {
+	double Yi = *Bptr++;
+	norm += Yi*Yi;
+    }
+    return sqrt(norm);
+}
+
+
+void
+BlockTriDiagLinSOE::setX(int loc, double value)
+{
+    if (loc < size && loc >= 0)
+	X[loc] = value;
+}
+
+void
+BlockTriDiagLinSOE::setX(const Vector &x)
+{
+    if (x.Size() == size && vectX != 0)
+      *vectX = x;
+}
+
+
+int
+BlockTriDiagLinSOE::setBlockTriDiagSolver(BlockTriDiagLinSolver &newSolver)
+{
+    newSolver.setLinearSOE(*this);
+
+    if (size != 0) {
+	int solverOK = newSolver.setSize();
+	if (solverOK < 0) {
+	    opserr << "WARNING:BlockTriDiagLinSOE::setSolver :";
+	    opserr << "the new solver could not setSeize() - staying with old\n";
+	    return solverOK;
+	}
+    }
+
+    return this->setSolver(newSolver);
+}
+
+
+int
+BlockTriDiagLinSOE::sendSelf(int commitTag, Channel &theChannel)
+{
+    return 0;
+}
+
+
+int
+BlockTriDiagLinSOE::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+    return 0;
+}
@@ -0,0 +1,105 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+#ifndef BlockTriDiagLinSOE_h
+#define BlockTriDiagLinSOE_h
+
+// Written: fmk
+//
+// Description: This file contains the class definition for BlockTriDiagLinSOE
+// BlockTriDiagLinSOE is a subclass of LinearSOE. It stores the A matrix as
+// a block tridiagonal matrix: a sequence of dense diagonal blocks D_k and
+// the dense blocks L_k and U_k coupling block k to block k+1.
+//
+// The blocks are determined in setSize() from a level structure of the
+// Graph, rooted at a pseudo-peripheral vertex of each connected component.
+// As vertices in a level are only adjacent to vertices in the same or in
+// the neighbouring levels, the levels always give a block tridiagonal
+// matrix. For the vertical soil columns built by SiteResponseModel the
+// levels are the rows of nodes, so the block size does not grow with the
+// depth of the column. All storage is column major, as used by LAPACK.
+//
+// What: "@(#) BlockTriDiagLinSOE.h, revA"
+
+
+#include <LinearSOE.h>
+#include <Vector.h>
+
+class BlockTriDiagLinSolver;
+
+class BlockTriDiagLinSOE : public LinearSOE
+{
+  public:
+    BlockTriDiagLinSOE();
+    BlockTriDiagLinSOE(int classTag);
+    BlockTriDiagLinSOE(BlockTriDiagLinSolver &theSolver);
+
+    virtual ~BlockTriDiagLinSOE();
+
+    virtual int getNumEqn(void) const;
+    virtual int setSize(Graph &theGraph);
+
+    virtual int addA(const Matrix &, const ID &, double fact = 1.0);
+    virtual int addColA(const Vector &col, int colIndex, double fact = 1.0);
+    virtual int addB(const Vector &, const ID &, double fact = 1.0);
+    virtual int setB(const Vector &, double fact = 1.0);
+
+    virtual void zeroA(void);
+    virtual void zeroB(void);
+
+    virtual const Vector &getX(void);
+    virtual const Vector &getB(void);
+    virtual double normRHS(void);
+
+    virtual void setX(int loc, double value);
+    virtual void setX(const Vector &x);
+
+    virtual int setBlockTriDiagSolver(BlockTriDiagLinSolver &newSolver);
+
+    int getNumBlocks(void) const {return numBlocks;};
+    int getMaxBlockSize(void) const {return maxBlockSize;};
+
+    virtual int sendSelf(int commitTag, Channel &theChannel);
+    virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+    friend class BlockTriDiagLinLapackSolver;
+
+  protected:
+    int addEntry(int row, int col, double value);
+
+    int size, numBlocks, maxBlockSize;
+    double *A, *B, *X;
+    int *blockStart;       // first position of each block, size numBlocks+1
+    int *blockEqn;         // equations ordered by block
+    int *eqnBlock;         // block of each equation
+    int *eqnLoc;           // position of each equation within its block
+    int *dOff, *lOff, *uOff; // location of D_k, L_k and U_k in A
+    Vector *vectX;
+    Vector *vectB;
+    int Asize, Bsize;
+    bool factored;
+
+  private:
+    int blockSize(int k) const {return blockStart[k+1] - blockStart[k];};
+};
+
+
+#endif
+
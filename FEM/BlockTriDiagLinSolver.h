@@ -0,0 +1,57 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+
+// File: ~/system_of_eqn/linearSOE/blockTriDiag/BlockTriDiagLinSolver.h
+//
+// Written: fmk 
+//
+// Description: This file contains the class definition for BlockTriDiagLinSolver.
+// BlockTriDiagLinSolver is an abstract base class and thus no objects of it's type
+// can be instantiated. It has pure virtual functions which must be
+// implemented in it's derived classes.  Instances of BlockTriDiagLinSolver 
+// are used to solve a system of equations of type BlockTriDiagLinSOE.
+//
+// What: "@(#) BlockTriDiagLinSolver.h, revA"
+
+#ifndef BlockTriDiagLinSolver_h
+#define BlockTriDiagLinSolver_h
+
+#include <LinearSOESolver.h>
+class BlockTriDiagLinSOE;
+
+class BlockTriDiagLinSolver : public LinearSOESolver
+{
+  public:
+    BlockTriDiagLinSolver(int classTag);    
+    virtual ~BlockTriDiagLinSolver();
+
+    virtual int solve(void) = 0;
+    virtual int setLinearSOE(BlockTriDiagLinSOE &theSOE);
+    
+  protected:
+    BlockTriDiagLinSOE *theSOE;
+
+  private:
+
+};
+
+#endif
+
@@ -37,7 +37,7 @@
 #include <Message.h>
 #include <MovableObject.h>
 #include <FEM_ObjectBroker.h>
-int Channel::numChannel = 0;
+thread_local int Channel::numChannel = 0;
 
 Channel::Channel ()
 {
@@ -112,7 +112,7 @@ class Channel
   protected:
     
   private:
-    static int numChannel;
+    static thread_local int numChannel;
     int tag;
 };
 
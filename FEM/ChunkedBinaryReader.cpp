@@ -0,0 +1,429 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/handler/ChunkedBinaryReader.cpp
+//
+// Written: fmk
+//
+// Description: This file contains the implementation of
+// ChunkedBinaryReader.
+//
+// What: "@(#) ChunkedBinaryReader.cpp, revA"
+
+#include <ChunkedBinaryReader.h>
+#include <OPS_Globals.h>
+#include <ID.h>
+#include <Vector.h>
+#include <Matrix.h>
+
+#include <string.h>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+using std::nothrow;
+using std::ios;
+
+#ifdef _WIN32
+#include <stdio.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+ChunkedBinaryReader::ChunkedBinaryReader()
+:theMap(0), mapSize(0), headerSize(0), isMapped(false),
+ numColumns(0), columnInfo(0),
+ numRows(0), numChunks(0), chunkOffset(0), chunkFirstRow(0), complete(true)
+{
+
+}
+
+ChunkedBinaryReader::~ChunkedBinaryReader()
+{
+  this->close();
+}
+
+int
+ChunkedBinaryReader::open(const char *fileName)
+{
+  this->close();
+
+#ifdef _WIN32
+  // no mmap, read the file into memory
+  std::ifstream theFile(fileName, ios::in | ios::binary | ios::ate);
+  if (!theFile.is_open())
+    return -1;
+
+  mapSize = theFile.tellg();
+  char *theData = new (nothrow) char[mapSize+1];
+  if (theData == 0) {
+    opserr << "WARNING ChunkedBinaryReader::open() - out of memory reading " << fileName << endln;
+    mapSize = 0;
+    return -2;
+  }
+  theFile.seekg(0, ios::beg);
+  theFile.read(theData, mapSize);
+  theMap = theData;
+  isMapped = false;
+#else
+  int fd = ::open(fileName, O_RDONLY);
+  if (fd < 0)
+    return -1;
+
+  struct stat theStat;
+  if (fstat(fd, &theStat) != 0 || theStat.st_size == 0) {
+    ::close(fd);
+    return -1;
+  }
+
+  mapSize = theStat.st_size;
+  void *theData = mmap(0, mapSize, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (theData == MAP_FAILED) {
+    opserr << "WARNING ChunkedBinaryReader::open() - failed to map " << fileName << endln;
+    mapSize = 0;
+    return -2;
+  }
+  theMap = (const char *)theData;
+  isMapped = true;
+#endif
+
+  if (this->readIndex() < 0) {
+    opserr << "WARNING ChunkedBinaryReader::open() - " << fileName << " is not a chunked binary file\n";
+    this->close();
+    return -3;
+  }
+
+  return 0;
+}
+
+int
+ChunkedBinaryReader::close(void)
+{
+  if (theMap != 0) {
+#ifdef _WIN32
+    delete [] theMap;
+#else
+    if (isMapped == true)
+      munmap((void *)theMap, mapSize);
+    else
+      delete [] theMap;
+#endif
+  }
+  theMap = 0;
+  mapSize = 0;
+  headerSize = 0;
+
+  if (columnInfo != 0)
+    delete [] columnInfo;
+  if (chunkOffset != 0)
+    delete [] chunkOffset;
+  if (chunkFirstRow != 0)
+    delete [] chunkFirstRow;
+
+  columnInfo = 0;
+  chunkOffset = 0;
+  chunkFirstRow = 0;
+  columnName.clear();
+  numColumns = 0;
+  numRows = 0;
+  numChunks = 0;
+  complete = true;
+
+  return 0;
+}
+
+int
+ChunkedBinaryReader::readIndex(void)
+{
+  // the header
+  size_t loc = 0;
+  int theInt;
+  if (mapSize < 8 + 2*sizeof(int) || strncmp(theMap, CHUNKED_BINARY_MAGIC, 8) != 0)
+    return -1;
+  loc += 8;
+
+  memcpy(&theInt, theMap + loc, sizeof(int));
+  loc += sizeof(int);
+  if (theInt != CHUNKED_BINARY_ORDER) {
+    opserr << "WARNING ChunkedBinaryReader::readIndex() - file written with another byte order\n";
+    return -2;
+  }
+
+  memcpy(&numColumns, theMap + loc, sizeof(int));
+  loc += sizeof(int);
+  if (numColumns < 0)
+    return -1;
+
+  columnInfo = new (nothrow) int[3*numColumns+1];
+  if (columnInfo == 0)
+    return -3;
+
+  for (int j=0; j<numColumns; j++) {
+    int data[4];
+    if (loc + 4*sizeof(int) > mapSize)
+      return -1;
+    memcpy(data, theMap + loc, 4*sizeof(int));
+    loc += 4*sizeof(int);
+    if (data[3] < 0 || loc + data[3] > mapSize)
+      return -1;
+    columnInfo[3*j] = data[0];
+    columnInfo[3*j+1] = data[1];
+    columnInfo[3*j+2] = data[2];
+    columnName.push_back(std::string(theMap + loc, data[3]));
+    loc += data[3];
+  }
+  headerSize = loc;
+
+  // count the chunks, then store where they are
+  for (int pass=0; pass<2; pass++) {
+    loc = headerSize;
+    numChunks = 0;
+    numRows = 0;
+    complete = true;
+
+    while (loc < mapSize) {
+      int chunkRows = 0;
+      if (loc + 4 + sizeof(int) <= mapSize && strncmp(theMap + loc, CHUNKED_BINARY_CHUNK, 4) == 0)
+	memcpy(&chunkRows, theMap + loc + 4, sizeof(int));
+      size_t dataLoc = loc + 4 + sizeof(int);
+      size_t chunkSize = (size_t)chunkRows*numColumns*sizeof(double);
+      if (chunkRows <= 0 || dataLoc + chunkSize > mapSize) {
+	// a chunk cut by a crash, ignore it and whatever follows
+	complete = false;
+	break;
+      }
+
+      if (pass == 1) {
+	chunkOffset[numChunks] = dataLoc;
+	chunkFirstRow[numChunks] = numRows;
+      }
+      numChunks++;
+      numRows += chunkRows;
+      loc = dataLoc + chunkSize;
+    }
+
+    if (pass == 0) {
+      chunkOffset = new (nothrow) size_t[numChunks+1];
+      chunkFirstRow = new (nothrow) int[numChunks+1];
+      if (chunkOffset == 0 || chunkFirstRow == 0)
+	return -3;
+    } else
+      chunkFirstRow[numChunks] = numRows;
+  }
+
+  return 0;
+}
+
+int
+ChunkedBinaryReader::getColumnKind(int column) const
+{
+  if (column < 0 || column >= numColumns)
+    return -1;
+  return columnInfo[3*column];
+}
+
+int
+ChunkedBinaryReader::getColumnTag(int column) const
+{
+  if (column < 0 || column >= numColumns)
+    return -1;
+  return columnInfo[3*column+1];
+}
+
+int
+ChunkedBinaryReader::getColumnComponent(int column) const
+{
+  if (column < 0 || column >= numColumns)
+    return -1;
+  return columnInfo[3*column+2];
+}
+
+const char *
+ChunkedBinaryReader::getColumnName(int column) const
+{
+  if (column < 0 || column >= numColumns)
+    return 0;
+  return columnName[column].c_str();
+}
+
+int
+ChunkedBinaryReader::findColumn(int kind, int tag, const char *name) const
+{
+  for (int j=0; j<numColumns; j++)
+    if (columnInfo[3*j] == kind && columnInfo[3*j+1] == tag && columnName[j] == name)
+      return j;
+
+  return -1;
+}
+
+int
+ChunkedBinaryReader::findChunk(int row) const
+{
+  // bisection on the first rows of the chunks
+  int low = 0;
+  int high = numChunks;
+  while (high - low > 1) {
+    int mid = (low + high)/2;
+    if (chunkFirstRow[mid] <= row)
+      low = mid;
+    else
+      high = mid;
+  }
+  return low;
+}
+
+double
+ChunkedBinaryReader::getValue(int row, int column) const
+{
+  if (row < 0 || row >= numRows || column < 0 || column >= numColumns)
+    return 0.0;
+
+  int k = this->findChunk(row);
+  int chunkRows = chunkFirstRow[k+1] - chunkFirstRow[k];
+  double value;
+  memcpy(&value, theMap + chunkOffset[k] + ((size_t)column*chunkRows + row - chunkFirstRow[k])*sizeof(double), sizeof(double));
+  return value;
+}
+
+int
+ChunkedBinaryReader::getColumn(int column, Vector &data, int firstRow, int nRows) const
+{
+  ID columns(1);
+  columns(0) = column;
+  Matrix theData;
+  int res = this->getColumns(columns, theData, firstRow, nRows);
+  if (res < 0)
+    return res;
+
+  int size = theData.noRows();
+  data.resize(size);
+  for (int i=0; i<size; i++)
+    data(i) = theData(i,0);
+
+  return 0;
+}
+
+int
+ChunkedBinaryReader::getColumns(const ID &columns, Matrix &data, int firstRow, int nRows) const
+{
+  if (nRows < 0)
+    nRows = numRows - firstRow;
+
+  if (firstRow < 0 || nRows < 0 || firstRow + nRows > numRows) {
+    opserr << "WARNING ChunkedBinaryReader::getColumns() - rows " << firstRow;
+    opserr << " to " << firstRow + nRows << " outside the " << numRows << " rows\n";
+    return -1;
+  }
+
+  int numCols = columns.Size();
+  for (int c=0; c<numCols; c++)
+    if (columns(c) < 0 || columns(c) >= numColumns) {
+      opserr << "WARNING ChunkedBinaryReader::getColumns() - no column " << columns(c) << endln;
+      return -1;
+    }
+
+  if (data.noRows() != nRows || data.noCols() != numCols)
+    data.resize(nRows, numCols);
+
+  if (nRows == 0)
+    return 0;
+
+  // as the chunks are stored by column, each column of a chunk is one copy
+  int lastRow = firstRow + nRows;
+  for (int k=this->findChunk(firstRow); k<numChunks && chunkFirstRow[k]<lastRow; k++) {
+    int chunkRows = chunkFirstRow[k+1] - chunkFirstRow[k];
+    int start = (firstRow > chunkFirstRow[k]) ? firstRow : chunkFirstRow[k];
+    int end = (lastRow < chunkFirstRow[k+1]) ? lastRow : chunkFirstRow[k+1];
+    for (int c=0; c<numCols; c++) {
+      const char *src = theMap + chunkOffset[k] + ((size_t)columns(c)*chunkRows + start - chunkFirstRow[k])*sizeof(double);
+      double *dst = &data(start - firstRow, c);
+      memcpy(dst, src, (end - start)*sizeof(double));
+    }
+  }
+
+  return 0;
+}
+
+int
+ChunkedBinaryReader::writeRows(const char *fileName, int nRows) const
+{
+  if (theMap == 0 || nRows < 0 || nRows > numRows)
+    return -1;
+
+  std::ofstream theFile(fileName, ios::out | ios::trunc | ios::binary);
+  if (!theFile.is_open()) {
+    opserr << "WARNING ChunkedBinaryReader::writeRows() - could not open " << fileName << endln;
+    return -1;
+  }
+
+  theFile.write(theMap, headerSize);
+
+  // the whole chunks are copied, the last one is cut to the rows kept
+  for (int k=0; k<numChunks && chunkFirstRow[k]<nRows; k++) {
+    int chunkRows = chunkFirstRow[k+1] - chunkFirstRow[k];
+    if (chunkFirstRow[k+1] <= nRows)
+      theFile.write(theMap + chunkOffset[k] - 4 - sizeof(int), 4 + sizeof(int) + (size_t)chunkRows*numColumns*sizeof(double));
+    else {
+      int keptRows = nRows - chunkFirstRow[k];
+      theFile.write(CHUNKED_BINARY_CHUNK, 4);
+      theFile.write((const char *)&keptRows, sizeof(int));
+      for (int j=0; j<numColumns; j++)
+	theFile.write(theMap + chunkOffset[k] + (size_t)j*chunkRows*sizeof(double), keptRows*sizeof(double));
+    }
+  }
+
+  theFile.close();
+  if (theFile.fail()) {
+    opserr << "WARNING ChunkedBinaryReader::writeRows() - failed to write " << fileName << endln;
+    return -1;
+  }
+
+  return 0;
+}
+
+int 
+chunkedBinaryToText(const char *inputFilename, const char *outputFilename, int precision)
+{
+  ChunkedBinaryReader theReader;
+  if (theReader.open(inputFilename) < 0) {
+    opserr << "chunkedBinaryToText - could not read " << inputFilename << endln;
+    return -1;
+  }
+
+  std::ofstream output(outputFilename, ios::out);
+  if (!output.is_open()) {
+    opserr << "chunkedBinaryToText - could not open " << outputFilename << endln;
+    return -1;
+  }
+  output << std::setprecision(precision);
+
+  int numColumns = theReader.getNumColumns();
+  for (int i=0; i<theReader.getNumRows(); i++) {
+    for (int j=0; j<numColumns; j++)
+      output << theReader.getValue(i, j) << " ";
+    output << "\n";
+  }
+
+  output.close();
+  return 0;
+}
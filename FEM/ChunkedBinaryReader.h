@@ -0,0 +1,98 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/handler/ChunkedBinaryReader.h
+//
+// Written: fmk
+//
+// Description: This file contains the class definition for
+// ChunkedBinaryReader. A ChunkedBinaryReader gives access to a file
+// written by a ChunkedBinaryStream. The file is memory mapped (read into
+// memory on Windows) and indexed on open(); any subset of the columns and
+// rows can then be copied out without reading the rest of the file.
+//
+// What: "@(#) ChunkedBinaryReader.h, revA"
+
+#ifndef ChunkedBinaryReader_h
+#define ChunkedBinaryReader_h
+
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+class ID;
+class Vector;
+class Matrix;
+
+#define CHUNKED_BINARY_MAGIC "SRTBIN01"
+#define CHUNKED_BINARY_CHUNK "CHNK"
+#define CHUNKED_BINARY_ORDER 0x01020304
+
+int chunkedBinaryToText(const char *inputFilename, const char *outputFilename, int precision = 6);
+
+class ChunkedBinaryReader
+{
+  public:
+    ChunkedBinaryReader();
+    ~ChunkedBinaryReader();
+
+    int open(const char *fileName);
+    int close(void);
+
+    int getNumColumns(void) const {return numColumns;};
+    int getNumRows(void) const {return numRows;};
+    bool isComplete(void) const {return complete;};
+
+    // the description of the columns
+    int getColumnKind(int column) const;
+    int getColumnTag(int column) const;
+    int getColumnComponent(int column) const;
+    const char *getColumnName(int column) const;
+    int findColumn(int kind, int tag, const char *name) const;
+
+    // the data, a numRows of -1 is all rows from firstRow on
+    double getValue(int row, int column) const;
+    int getColumn(int column, Vector &data, int firstRow = 0, int numRows = -1) const;
+    int getColumns(const ID &columns, Matrix &data, int firstRow = 0, int numRows = -1) const;
+
+    // write the header and the first numRows rows to a new file
+    int writeRows(const char *fileName, int numRows) const;
+
+  private:
+    int readIndex(void);
+    int findChunk(int row) const;
+
+    const char *theMap;        // the contents of the file
+    size_t mapSize;            // the size of the file
+    size_t headerSize;         // the size of the header in the file
+    bool isMapped;             // true if theMap is memory mapped
+
+    int numColumns;
+    int *columnInfo;           // kind, tag and component of each column
+    std::vector<std::string> columnName;
+
+    int numRows;
+    int numChunks;
+    size_t *chunkOffset;       // location of the data of each chunk
+    int *chunkFirstRow;        // first row of each chunk, size numChunks+1
+    bool complete;             // false if the last chunk was cut
+};
+
+#endif
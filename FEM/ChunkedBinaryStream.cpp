@@ -0,0 +1,354 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/handler/ChunkedBinaryStream.cpp
+//
+// Written: fmk
+//
+// Description: This file contains the implementation of
+// ChunkedBinaryStream, see ChunkedBinaryStream.h for the file format.
+//
+// What: "@(#) ChunkedBinaryStream.cpp, revA"
+
+#include <ChunkedBinaryStream.h>
+#include <ChunkedBinaryReader.h>
+#include <Vector.h>
+#include <classTags.h>
+
+#include <string.h>
+#include <stdio.h>
+#include <iostream>
+using std::nothrow;
+using std::ios;
+
+ChunkedBinaryStream::ChunkedBinaryStream(const char *file, openMode mode, int rows)
+  :OPS_Stream(OPS_STREAM_TAGS_ChunkedBinaryStream),
+   fileOpen(0), theOpenMode(mode), 
+   numColumns(0), columnKind(0, 16), columnTag(0, 16), columnComponent(0, 16),
+   numOpenTags(0), outputDepth(-1), outputKind(CHUNKED_BINARY_UNKNOWN), outputTag(-1), outputCount(0),
+   rowsPerChunk(rows), numRows(0), theData(0)
+{
+  if (rowsPerChunk < 1)
+    rowsPerChunk = 1;
+
+  this->setFile(file, mode);
+}
+
+ChunkedBinaryStream::~ChunkedBinaryStream()
+{
+  this->close();
+
+  if (theData != 0)
+    delete [] theData;
+}
+
+int 
+ChunkedBinaryStream::setFile(const char *name, openMode mode, bool echo)
+{
+  if (name == 0) {
+    opserr << "ChunkedBinaryStream::setFile() - no name passed\n";
+    return -1;
+  }
+
+  // if file already open, close it
+  this->close();
+
+  fileName = name;
+  theOpenMode = mode;
+
+  return 0;
+}
+
+int 
+ChunkedBinaryStream::open(void)
+{
+  // if file already open, return
+  if (fileOpen == 1)
+    return 0;
+
+  if (fileName.empty()) {
+    opserr << "ChunkedBinaryStream::open(void) - no file name has been set\n";
+    return -1;
+  }
+
+  // the data of a previous run is continued only if it is the same columns
+  if (theOpenMode == APPEND && this->headerMatchesFile() != 0)
+    theOpenMode = OVERWRITE;
+
+  if (theOpenMode == OVERWRITE) {
+    theFile.open(fileName.c_str(), ios::out | ios::trunc | ios::binary);
+    if (theFile.is_open() && this->writeHeader() < 0)
+      theFile.close();
+  } else
+    theFile.open(fileName.c_str(), ios::out | ios::app | ios::binary);
+
+  theOpenMode = APPEND;
+
+  if (!theFile.is_open() || theFile.bad()) {
+    opserr << "WARNING - ChunkedBinaryStream::open()";
+    opserr << " - could not open file " << fileName.c_str() << endln;
+    fileOpen = 0;
+    return -1;
+  } else
+    fileOpen = 1;
+
+  return 0;
+}
+
+int 
+ChunkedBinaryStream::close(void)
+{
+  if (fileOpen != 0) {
+    this->writeChunk();
+    theFile.close();
+  }
+  fileOpen = 0;
+
+  return 0;
+}
+
+void
+ChunkedBinaryStream::flush(void)
+{
+  if (fileOpen != 0) {
+    this->writeChunk();
+    theFile.flush();
+  }
+}
+
+int 
+ChunkedBinaryStream::tag(const char *tagName)
+{
+  // a NodeOutput, ElementOutput or TimeOutput starts a new set of columns
+  if (strcmp(tagName, "NodeOutput") == 0) {
+    outputDepth = numOpenTags;
+    outputKind = CHUNKED_BINARY_NODE;
+    outputTag = -1;
+    outputCount = 0;
+  } else if (strcmp(tagName, "ElementOutput") == 0) {
+    outputDepth = numOpenTags;
+    outputKind = CHUNKED_BINARY_ELEMENT;
+    outputTag = -1;
+    outputCount = 0;
+  } else if (strcmp(tagName, "TimeOutput") == 0) {
+    outputDepth = numOpenTags;
+    outputKind = CHUNKED_BINARY_TIME;
+    outputTag = -1;
+    outputCount = 0;
+  }
+
+  numOpenTags++;
+  return 0;
+}
+
+int 
+ChunkedBinaryStream::tag(const char *tagName, const char *value)
+{
+  // every ResponseType is a column of the output being described
+  if (strcmp(tagName, "ResponseType") == 0) {
+    if (outputDepth < 0)
+      this->addColumn(CHUNKED_BINARY_UNKNOWN, -1, 1, value);
+    else
+      this->addColumn(outputKind, outputTag, ++outputCount, value);
+  }
+
+  return 0;
+}
+
+int 
+ChunkedBinaryStream::endTag()
+{
+  if (numOpenTags > 0)
+    numOpenTags--;
+
+  if (numOpenTags <= outputDepth) {
+    outputDepth = -1;
+    outputKind = CHUNKED_BINARY_UNKNOWN;
+    outputTag = -1;
+    outputCount = 0;
+  }
+
+  return 0;
+}
+
+int 
+ChunkedBinaryStream::attr(const char *name, int value)
+{
+  if (outputDepth >= 0 && numOpenTags == outputDepth+1 &&
+      (strcmp(name, "nodeTag") == 0 || strcmp(name, "eleTag") == 0))
+    outputTag = value;
+
+  return 0;
+}
+
+int 
+ChunkedBinaryStream::attr(const char *name, double value)
+{
+  return 0;
+}
+
+int 
+ChunkedBinaryStream::attr(const char *name, const char *value)
+{
+  return 0;
+}
+
+int 
+ChunkedBinaryStream::write(Vector &data)
+{
+  // the first row fixes the columns; columns the recorder did not
+  // describe are added as unknown ones
+  if (theData == 0) {
+    int size = data.Size();
+    for (int j=numColumns; j<size; j++)
+      this->addColumn(CHUNKED_BINARY_UNKNOWN, -1, j+1, "unknown");
+
+    if (numColumns > size) {
+      opserr << "WARNING ChunkedBinaryStream::write() - " << numColumns;
+      opserr << " columns described but only " << size << " in the data of " << fileName.c_str() << endln;
+      numColumns = size;
+      columnName.resize(size);
+    }
+
+    theData = new (nothrow) double[numColumns*rowsPerChunk+1];
+    if (theData == 0) {
+      opserr << "WARNING ChunkedBinaryStream::write() - out of memory\n";
+      return -1;
+    }
+  }
+
+  if (fileOpen == 0 && this->open() < 0)
+    return -1;
+
+  if (data.Size() != numColumns) {
+    opserr << "WARNING ChunkedBinaryStream::write() - data of size " << data.Size();
+    opserr << " for " << numColumns << " columns\n";
+    return -1;
+  }
+
+  for (int j=0; j<numColumns; j++)
+    theData[j*rowsPerChunk + numRows] = data(j);
+  numRows++;
+
+  if (numRows == rowsPerChunk)
+    return this->writeChunk();
+
+  return 0;
+}
+
+int 
+ChunkedBinaryStream::sendSelf(int commitTag, Channel &theChannel)
+{
+  return 0;
+}
+
+int 
+ChunkedBinaryStream::recvSelf(int commitTag, Channel &theChannel, 
+			      FEM_ObjectBroker &theBroker)
+{
+  return 0;
+}
+
+void
+ChunkedBinaryStream::addColumn(int kind, int theTag, int component, const char *name)
+{
+  columnKind[numColumns] = kind;
+  columnTag[numColumns] = theTag;
+  columnComponent[numColumns] = component;
+  columnName.push_back(std::string(name));
+  numColumns++;
+}
+
+int
+ChunkedBinaryStream::writeHeader(void)
+{
+  int order = CHUNKED_BINARY_ORDER;
+
+  theFile.write(CHUNKED_BINARY_MAGIC, 8);
+  theFile.write((const char *)&order, sizeof(int));
+  theFile.write((const char *)&numColumns, sizeof(int));
+
+  for (int j=0; j<numColumns; j++) {
+    int data[4];
+    data[0] = columnKind(j);
+    data[1] = columnTag(j);
+    data[2] = columnComponent(j);
+    data[3] = columnName[j].size();
+    theFile.write((const char *)data, 4*sizeof(int));
+    theFile.write(columnName[j].c_str(), data[3]);
+  }
+
+  if (theFile.bad()) {
+    opserr << "WARNING ChunkedBinaryStream::writeHeader() - failed to write " << fileName.c_str() << endln;
+    return -1;
+  }
+
+  return 0;
+}
+
+int
+ChunkedBinaryStream::headerMatchesFile(void)
+{
+  ChunkedBinaryReader theReader;
+  if (theReader.open(fileName.c_str()) < 0)
+    return -1;
+
+  if (theReader.getNumColumns() != numColumns)
+    return -2;
+
+  for (int j=0; j<numColumns; j++)
+    if (theReader.getColumnKind(j) != columnKind(j) || theReader.getColumnTag(j) != columnTag(j) ||
+	theReader.getColumnComponent(j) != columnComponent(j) || columnName[j] != theReader.getColumnName(j))
+      return -2;
+
+  // a chunk cut by a crash is removed, so the new chunks can be read
+  if (theReader.isComplete() == false) {
+    std::string tmpName = fileName + ".tmp";
+    if (theReader.writeRows(tmpName.c_str(), theReader.getNumRows()) < 0)
+      return -3;
+    theReader.close();
+    remove(fileName.c_str());
+    if (rename(tmpName.c_str(), fileName.c_str()) != 0)
+      return -3;
+  }
+
+  return 0;
+}
+
+int
+ChunkedBinaryStream::writeChunk(void)
+{
+  if (numRows == 0 || fileOpen == 0)
+    return 0;
+
+  theFile.write(CHUNKED_BINARY_CHUNK, 4);
+  theFile.write((const char *)&numRows, sizeof(int));
+  for (int j=0; j<numColumns; j++)
+    theFile.write((const char *)&theData[j*rowsPerChunk], numRows*sizeof(double));
+
+  numRows = 0;
+
+  if (theFile.bad()) {
+    opserr << "WARNING ChunkedBinaryStream::writeChunk() - failed to write " << fileName.c_str() << endln;
+    return -1;
+  }
+
+  return 0;
+}
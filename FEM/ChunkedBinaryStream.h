@@ -0,0 +1,126 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/handler/ChunkedBinaryStream.h
+//
+// Written: fmk
+//
+// Description: This file contains the class definition for
+// ChunkedBinaryStream. ChunkedBinaryStream is an OPS_Stream that writes
+// the data of a recorder as doubles to a self describing binary file.
+// The description of the columns is taken from the tags the recorder and
+// the elements send to the stream (TimeOutput, NodeOutput with nodeTag,
+// ElementOutput with eleTag and a ResponseType tag for each column); the
+// rows are kept in memory and written a chunk at a time.
+//
+// The file, with all numbers in the byte order of the writing machine:
+//
+//   header: char[8]   "SRTBIN01"
+//           int       0x01020304, to check the byte order
+//           int       number of columns, n
+//           n times:  int kind (0 time, 1 node, 2 element, 3 unknown),
+//                     int tag of the node or element (-1 if none),
+//                     int component of the node or element output (1..),
+//                     int length l of the response name, char[l] name
+//   chunks: char[4]   "CHNK"
+//           int       number of rows in the chunk, m
+//           double[n*m] the data, column by column
+//
+// A file opened in APPEND mode is continued if its header matches the
+// columns of the recorder, so the chunks of several runs (a restart) go
+// to the one file. A chunk that was cut by a crash is ignored when read.
+// The file is read by ChunkedBinaryReader.
+//
+// What: "@(#) ChunkedBinaryStream.h, revA"
+
+#ifndef _ChunkedBinaryStream
+#define _ChunkedBinaryStream
+
+#include <OPS_Stream.h>
+#include <ID.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#define CHUNKED_BINARY_TIME    0
+#define CHUNKED_BINARY_NODE    1
+#define CHUNKED_BINARY_ELEMENT 2
+#define CHUNKED_BINARY_UNKNOWN 3
+
+class ChunkedBinaryStream : public OPS_Stream
+{
+ public:
+  ChunkedBinaryStream(const char *fileName, openMode mode = OVERWRITE, int rowsPerChunk = 256);
+  ~ChunkedBinaryStream();
+
+  int setFile(const char *fileName, openMode mode = OVERWRITE, bool echo = false);
+  int open(void);
+  int close(void);
+  void flush(void);
+
+  int getNumColumns(void) const {return numColumns;};
+
+  // xml stuff, used for the description of the columns
+  int tag(const char *);
+  int tag(const char *, const char *);
+  int endTag();
+  int attr(const char *name, int value);
+  int attr(const char *name, double value);
+  int attr(const char *name, const char *value);
+  int write(Vector &data);
+
+  // parallel stuff
+  int sendSelf(int commitTag, Channel &theChannel);  
+  int recvSelf(int commitTag, Channel &theChannel, 
+	       FEM_ObjectBroker &theBroker);
+
+ private:
+  void addColumn(int kind, int tag, int component, const char *name);
+  int writeHeader(void);
+  int headerMatchesFile(void);
+  int writeChunk(void);
+
+  std::ofstream theFile;
+  int fileOpen;
+  openMode theOpenMode;
+  std::string fileName;
+
+  // the description of the columns
+  int numColumns;
+  ID columnKind;
+  ID columnTag;
+  ID columnComponent;
+  std::vector<std::string> columnName;
+
+  // the output (TimeOutput, NodeOutput or ElementOutput) being described
+  int numOpenTags;
+  int outputDepth;
+  int outputKind;
+  int outputTag;
+  int outputCount;
+
+  // the rows not yet written, stored column by column
+  int rowsPerChunk;
+  int numRows;
+  double *theData;
+};
+
+#endif
@@ -37,7 +37,7 @@
 #include <TaggedObject.h>
 #include <MapOfTaggedObjects.h>
 
-static MapOfTaggedObjects theCrdTransfObjects;
+static thread_local MapOfTaggedObjects theCrdTransfObjects;
 
 bool 
 OPS_addCrdTransf(CrdTransf *newComponent) {
@@ -79,7 +79,7 @@ CrdTransf::getBasicDisplSensitivity(int gradNumber)
     opserr << "WARNING CrdTransf::getBasicDisplSensitivity() - this method "
         << " should not be called." << endln;
     
-    static Vector dummy(1);
+    static thread_local Vector dummy(1);
     return dummy;
 }
 
@@ -91,7 +91,7 @@ CrdTransf::getGlobalResistingForceShapeSensitivity(const Vector &pb,
     opserr << "ERROR CrdTransf::getGlobalResistingForceSensitivity() - has not been"
         << " implemented yet for the chosen transformation." << endln;
     
-    static Vector dummy(1);
+    static thread_local Vector dummy(1);
     return dummy;
 }
 
@@ -102,7 +102,7 @@ CrdTransf::getGlobalResistingForceShapeSensitivity(const Vector &pb,
     opserr << "ERROR CrdTransf::getGlobalResistingForceSensitivity() - has not been"
         << " implemented yet for the chosen transformation." << endln;
     
-    static Vector dummy(1);
+    static thread_local Vector dummy(1);
     return dummy;
 }
 
@@ -112,7 +112,7 @@ CrdTransf::getBasicTrialDispShapeSensitivity(void)
     opserr << "ERROR CrdTransf::getBasicTrialDispShapeSensitivity() - has not been"
         << " implemented yet for the chosen transformation." << endln;
     
-    static Vector dummy(1);
+    static thread_local Vector dummy(1);
     return dummy;
 }
 
@@ -125,6 +125,6 @@ CrdTransf::getBasicDisplSensitivity(int gradNumber, int)
     opserr << "WARNING CrdTransf::getBasicDisplSensitivity() - this method "
         << " should not be called." << endln;
     
-    static Vector dummy(1);
+    static thread_local Vector dummy(1);
     return dummy;
 }
@@ -43,15 +43,10 @@
 #include <Matrix.h>
 #include <TransientIntegrator.h>
 
-#define MAX_NUM_DOF 256
-
 
 // static variables initialisation
 Matrix DOF_Group::errMatrix(1,1);
 Vector DOF_Group::errVect(1);
-Matrix **DOF_Group::theMatrices; // array of pointers to class wide matrices
-Vector **DOF_Group::theVectors;  // array of pointers to class widde vectors
-int DOF_Group::numDOFs(0);           // number of objects
 
 
 //  DOF_Group(Node *);
@@ -82,58 +77,17 @@ DOF_Group::DOF_Group(int tag, Node *node)
     for (int i=0; i<numDOF; i++)
 	myID(i) = -2;
     
-    // if this is the first DOF_Group we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return tangent and residual
-    if (numDOFs == 0) {
-	theMatrices = new Matrix *[MAX_NUM_DOF+1];
-	theVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	if (theMatrices == 0 || theVectors == 0) {
-	    opserr << "DOF_Group::DOF_Group(Node *) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    theMatrices[i] = 0;
-	    theVectors[i] = 0;
-	}
-    }    
-    
-    // set the pointers for the tangent and residual
-    if (numDOF <= MAX_NUM_DOF) {
-	// use class wide objects
-	if (theVectors[numDOF] == 0) {
-	    // have to create matrix and vector of size as none yet created
-	    theVectors[numDOF] = new Vector(numDOF);
-	    theMatrices[numDOF] = new Matrix(numDOF,numDOF);
-	    unbalance = theVectors[numDOF];
-	    tangent = theMatrices[numDOF];
-	    if (unbalance == 0 || unbalance->Size() != numDOF ||	
-		tangent == 0 || tangent->noCols() != numDOF)	{  
-		opserr << "DOF_Group::DOF_Group(Node *) ";
-		opserr << " ran out of memory for vector/Matrix of size :";
-		opserr << numDOF << endln;
-		exit(-1);
-	    }
-	} else {
-	    unbalance = theVectors[numDOF];
-	    tangent = theMatrices[numDOF];
-	}
-    } else {
-	// create matrices and vectors for each object instance
-	unbalance = new Vector(numDOF);
-	tangent = new Matrix(numDOF, numDOF);
-	if (unbalance == 0 || unbalance->Size() ==0 ||
-	    tangent ==0 || tangent->noRows() ==0) {
-	    
-	    opserr << "DOF_Group::DOF_Group(Node *) ";
-	    opserr << " ran out of memory for vector/Matrix of size :";
-	    opserr << numDOF << endln;
-	    exit(-1);
-	}
+    // create the tangent and residual, these are a copy for each object
+    // so that DOF_Groups can be used by more than one thread at a time
+    unbalance = new Vector(numDOF);
+    tangent = new Matrix(numDOF, numDOF);
+    if (unbalance == 0 || unbalance->Size() != numDOF ||	
+	tangent == 0 || tangent->noCols() != numDOF)	{  
+	opserr << "DOF_Group::DOF_Group(Node *) ";
+	opserr << " ran out of memory for vector/Matrix of size :";
+	opserr << numDOF << endln;
+	exit(-1);
     }
-    
-    numDOFs++;
 }
 
 
@@ -162,58 +116,17 @@ DOF_Group::DOF_Group(int tag, int ndof)
     for (int i=0; i<numDOF; i++)
 	myID(i) = -2;
     
-    // if this is the first DOF_Group we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return tangent and residual
-    if (numDOFs == 0) {
-	theMatrices = new Matrix *[MAX_NUM_DOF+1];
-	theVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	if (theMatrices == 0 || theVectors == 0) {
-	    opserr << "DOF_Group::DOF_Group(int, int ndof) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    theMatrices[i] = 0;
-	    theVectors[i] = 0;
-	}
-    }    
-
-    // set the pointers for the tangent and residual
-    if (numDOF <= MAX_NUM_DOF) {
-	// use class wide objects
-	if (theVectors[numDOF] == 0) {
-	    // have to create matrix and vector of size as none yet created
-	    theVectors[numDOF] = new Vector(numDOF);
-	    theMatrices[numDOF] = new Matrix(numDOF,numDOF);
-	    unbalance = theVectors[numDOF];
-	    tangent = theMatrices[numDOF];
-	    if (unbalance == 0 || unbalance->Size() != numDOF ||	
-		tangent == 0 || tangent->noCols() != numDOF)	{  
-		opserr << "DOF_Group::DOF_Group(int, int ndof) ";
-		opserr << " ran out of memory for vector/Matrix of size :";
-		opserr << numDOF << endln;
-		exit(-1);
-	    }
-	} else {
-	    unbalance = theVectors[numDOF];
-	    tangent = theMatrices[numDOF];
-	}
-    } else {
-	// create matrices and vectors for each object instance
-	unbalance = new Vector(numDOF);
-	tangent = new Matrix(numDOF, numDOF);
-	if (unbalance == 0 || tangent ==0 ||
-	    tangent ==0 || tangent->noRows() ==0) {
-	    
-	    opserr << "DOF_Group::DOF_Group(int, int ndof) ";
-	    opserr << " ran out of memory for vector/Matrix of size :";
-	    opserr << numDOF << endln;
-	    exit(-1);
-	}
+    // create the tangent and residual, these are a copy for each object
+    // so that DOF_Groups can be used by more than one thread at a time
+    unbalance = new Vector(numDOF);
+    tangent = new Matrix(numDOF, numDOF);
+    if (unbalance == 0 || unbalance->Size() != numDOF ||	
+	tangent == 0 || tangent->noCols() != numDOF)	{  
+	opserr << "DOF_Group::DOF_Group(int, int ndof) ";
+	opserr << " ran out of memory for vector/Matrix of size :";
+	opserr << numDOF << endln;
+	exit(-1);
     }
-    
-    numDOFs++;
 }
 
 // ~DOF_Group();    
@@ -221,33 +134,13 @@ DOF_Group::DOF_Group(int tag, int ndof)
 
 DOF_Group::~DOF_Group()
 {
-    numDOFs--;
-
-    int numDOF = unbalance->Size();
-
     // set the pointer in the associated Node to 0, to stop
     // segmentation fault if node tries to use this object after destroyed
     if (myNode != 0) 
       myNode->setDOF_GroupPtr(0);
 
-    // delete tangent and residual if created specially
-    if (numDOF > MAX_NUM_DOF) {
-	if (tangent != 0) delete tangent;
-	if (unbalance != 0) delete unbalance;
-    }
-
-    // if this is the last FE_Element, clean up the
-    // storage for the matrix and vector objects
-    if (numDOFs == 0) {
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    if (theVectors[i] != 0)
-		delete theVectors[i];
-	    if (theMatrices[i] != 0)
-		delete theMatrices[i];
-	}	
-	delete [] theMatrices;
-	delete [] theVectors;
-    }    
+    if (tangent != 0) delete tangent;
+    if (unbalance != 0) delete unbalance;
 }    
 
 // void setID(int index, int value);
@@ -144,9 +144,6 @@ class DOF_Group: public TaggedObject
     // static variables - single copy for all objects of the class	    
     static Matrix errMatrix;
     static Vector errVect;
-    static Matrix **theMatrices; // array of pointers to class wide matrices
-    static Vector **theVectors;  // array of pointers to class widde vectors
-    static int numDOFs;           // number of objects    
 };
 
 #endif
@@ -196,6 +196,13 @@ DataFileStream::close(void)
   return 0;
 }
 
+void
+DataFileStream::flush(void)
+{
+  if (fileOpen != 0)
+    theFile.flush();
+}
+
 
 int 
 DataFileStream::setPrecision(int prec)
@@ -630,7 +637,7 @@ DataFileStream::sendSelf(int commitTag, Channel &theChannel)
     delete [] theChannels;
   theChannels = theNextChannels;
 
-  static ID idData(3);
+  static thread_local ID idData(3);
   int fileNameLength = 0;
   if (fileName != 0)
     fileNameLength = strlen(fileName);
@@ -663,7 +670,7 @@ DataFileStream::sendSelf(int commitTag, Channel &theChannel)
 int 
 DataFileStream::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
-  static ID idData(3);
+  static thread_local ID idData(3);
 
   sendSelfCount = -1;
   theChannels = new Channel *[1];
@@ -728,7 +735,7 @@ DataFileStream::setOrder(const ID &orderData)
     return 0;
 
   if (sendSelfCount < 0) {
-    static ID numColumnID(1);
+    static thread_local ID numColumnID(1);
     int numColumn = orderData.Size();
     numColumnID(0) = numColumn;
     theChannels[0]->sendID(0, 0, numColumnID);
@@ -767,7 +774,7 @@ DataFileStream::setOrder(const ID &orderData)
 
     // now receive orderData from the other channels
     for (int i=0; i<sendSelfCount; i++) { 
-      static ID numColumnID(1);	  
+      static thread_local ID numColumnID(1);	  
       if (theChannels[i]->recvID(0, 0, numColumnID) < 0) {
 	opserr << "DataFileStream::setOrder - failed to recv column size for process: " << i+1 << endln;
 	return -1;
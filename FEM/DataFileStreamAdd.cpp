@@ -674,7 +674,7 @@ DataFileStreamAdd::sendSelf(int commitTag, Channel &theChannel)
     delete [] theChannels;
   theChannels = theNextChannels;
 
-  static ID idData(3);
+  static thread_local ID idData(3);
   int fileNameLength = 0;
   if (fileName != 0)
     fileNameLength = strlen(fileName);
@@ -707,7 +707,7 @@ DataFileStreamAdd::sendSelf(int commitTag, Channel &theChannel)
 int 
 DataFileStreamAdd::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
-  static ID idData(3);
+  static thread_local ID idData(3);
 
   sendSelfCount = -1;
   theChannels = new Channel *[1];
@@ -773,7 +773,7 @@ DataFileStreamAdd::setOrder(const ID &orderData)
 
   if (sendSelfCount < 0) {
 
-    static ID numColumnID(1);
+    static thread_local ID numColumnID(1);
     int numColumn = orderData.Size();
     numColumnID(0) = numColumn;
     theChannels[0]->sendID(0, 0, numColumnID);
@@ -812,7 +812,7 @@ DataFileStreamAdd::setOrder(const ID &orderData)
 
     // now receive orderData from the other channels
     for (int i=0; i<sendSelfCount; i++) { 
-      static ID numColumnID(1);	  
+      static thread_local ID numColumnID(1);	  
       if (theChannels[i]->recvID(0, 0, numColumnID) < 0) {
 	opserr << "DataFileStreamAdd::setOrder - failed to recv column size for process: " << i+1 << endln;
 	return -1;
@@ -82,7 +82,7 @@ DirectIntegrationAnalysis::DirectIntegrationAnalysis(Domain &the_Domain,
  theEigenSOE(0),
  theIntegrator(&theTransientIntegrator), 
  theTest(theConvergenceTest),
- domainStamp(0)
+ domainStamp(0), lastDeltaT(0.0)
 {
   // first we set up the links needed by the elements in the 
   // aggregation
@@ -202,6 +202,12 @@ DirectIntegrationAnalysis::analyze(int numSteps, double dT)
       }	
     }
 
+    // a tangent the algorithm keeps between steps depends on dt
+    if (dT != lastDeltaT) {
+      theAlgorithm->integratorChanged();
+      lastDeltaT = dT;
+    }
+
     if (theIntegrator->newStep(dT) < 0) {
       opserr << "DirectIntegrationAnalysis::analyze() - the Integrator failed";
       opserr << " at time " << the_Domain->getCurrentTime() << endln;
@@ -541,8 +547,8 @@ DirectIntegrationAnalysis::setEigenSOE(EigenSOE &theNewSOE)
 int 
 DirectIntegrationAnalysis::setConvergenceTest(ConvergenceTest &theNewTest)
 {
-  // invoke the destructor on the old one
-  if (theTest != 0)
+  // invoke the destructor on the old one, unless it is being set again
+  if (theTest != 0 && theTest != &theNewTest)
     delete theTest;
   
   // set the links needed by the other objects in the aggregation
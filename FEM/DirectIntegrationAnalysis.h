@@ -108,6 +108,7 @@ class DirectIntegrationAnalysis: public TransientAnalysis
     ConvergenceTest     *theTest;
 
     int domainStamp;
+    double lastDeltaT;      // dt of the last step, see analyze()
 
     // AddingSensitivity:BEGIN ///////////////////////////////
 #ifdef _RELIABILITY
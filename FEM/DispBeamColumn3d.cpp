@@ -49,9 +49,9 @@
 #include <elementAPI.h>
 #include <string>
 
-Matrix DispBeamColumn3d::K(12,12);
-Vector DispBeamColumn3d::P(12);
-double DispBeamColumn3d::workArea[200];
+thread_local Matrix DispBeamColumn3d::K(12,12);
+thread_local Vector DispBeamColumn3d::P(12);
+thread_local double DispBeamColumn3d::workArea[200];
 
 void* OPS_DispBeamColumn3d()
 {
@@ -411,7 +411,7 @@ DispBeamColumn3d::update(void)
 const Matrix&
 DispBeamColumn3d::getTangentStiff()
 {
-  static Matrix kb(6,6);
+  static thread_local Matrix kb(6,6);
   
   // Zero for integral
   kb.Zero();
@@ -543,7 +543,7 @@ DispBeamColumn3d::getTangentStiff()
 const Matrix&
 DispBeamColumn3d::getInitialBasicStiff()
 {
-  static Matrix kb(6,6);
+  static thread_local Matrix kb(6,6);
   
   // Zero for integral
   kb.Zero();
@@ -665,7 +665,7 @@ DispBeamColumn3d::getMass()
     K(0,0) = K(1,1) = K(2,2) = K(6,6) = K(7,7) = K(8,8) = m;
   } else  {
     // consistent mass matrix
-    static Matrix ml(12,12);
+    static thread_local Matrix ml(12,12);
     double m = rho*L/420.0;
     ml(0,0) = ml(6,6) = m*140.0;
     ml(0,6) = ml(6,0) = m*70.0;
@@ -828,7 +828,7 @@ DispBeamColumn3d::addInertiaLoadToUnbalance(const Vector &accel)
     Q(8) -= m*Raccel2(2);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(12);
+    static thread_local Vector Raccel(12);
     for (int i=0; i<6; i++)  {
       Raccel(i)   = Raccel1(i);
       Raccel(i+6) = Raccel2(i);
@@ -929,7 +929,7 @@ DispBeamColumn3d::getResistingForceIncInertia()
     P(8) += m*accel2(2);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(12);
+    static thread_local Vector accel(12);
     for (int i=0; i<6; i++)  {
       accel(i)   = accel1(i);
       accel(i+6) = accel2(i);
@@ -960,7 +960,7 @@ DispBeamColumn3d::sendSelf(int commitTag, Channel &theChannel)
   int i, j;
   int loc = 0;
   
-  static Vector data(14);
+  static thread_local Vector data(14);
   data(0) = this->getTag();
   data(1) = connectedExternalNodes(0);
   data(2) = connectedExternalNodes(1);
@@ -1054,7 +1054,7 @@ DispBeamColumn3d::recvSelf(int commitTag, Channel &theChannel,
   int dbTag = this->getDbTag();
   int i;
   
-  static Vector data(14);
+  static thread_local Vector data(14);
 
   if (theChannel.recvVector(dbTag, commitTag, data) < 0)  {
     opserr << "DispBeamColumn3d::recvSelf() - failed to recv data Vector\n";
@@ -1263,8 +1263,8 @@ DispBeamColumn3d::Print(OPS_Stream &s, int flag)
 int
 DispBeamColumn3d::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **modes, int numModes)
 {
-  static Vector v1(3);
-  static Vector v2(3);
+  static thread_local Vector v1(3);
+  static thread_local Vector v2(3);
 
   if (displayMode >= 0) {
 
@@ -1508,8 +1508,8 @@ DispBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 
   // Plastic rotation
   else if (responseID == 4) {
-    static Vector vp(6);
-    static Vector ve(6);
+    static thread_local Vector vp(6);
+    static thread_local Vector ve(6);
     const Matrix &kb = this->getInitialBasicStiff();
     kb.Solve(q, ve);
     vp = crdTransf->getBasicTrialDisp();
@@ -1646,7 +1646,7 @@ DispBeamColumn3d::getMassSensitivity(int gradNumber)
     K(0,0) = K(1,1) = K(2,2) = K(6,6) = K(7,7) = K(8,8) = m;
   } else  {
     // consistent mass matrix
-    static Matrix ml(12,12);
+    static thread_local Matrix ml(12,12);
     //double m = rho*L/420.0;
     double m = L/420.0;
     ml(0,0) = ml(6,6) = m*140.0;
@@ -1695,7 +1695,7 @@ DispBeamColumn3d::getResistingForceSensitivity(int gradNumber)
   beamInt->getSectionWeights(numSections, L, wt);
 
   // Zero for integration
-  static Vector dqdh(6);
+  static thread_local Vector dqdh(6);
   dqdh.Zero();
   
   // Loop over the integration points
@@ -1738,7 +1738,7 @@ DispBeamColumn3d::getResistingForceSensitivity(int gradNumber)
   }
   
   // Transform forces
-  static Vector dp0dh(6);		// No distributed loads
+  static thread_local Vector dp0dh(6);		// No distributed loads
 
   P.Zero();
 
@@ -1748,7 +1748,7 @@ DispBeamColumn3d::getResistingForceSensitivity(int gradNumber)
     
     // Perform numerical integration to obtain basic stiffness matrix
     // Some extra declarations
-    static Matrix kbmine(6,6);
+    static thread_local Matrix kbmine(6,6);
     kbmine.Zero();
     q.Zero();
     
@@ -1871,7 +1871,7 @@ DispBeamColumn3d::commitSensitivity(int gradNumber, int numGrads)
   // Get basic deformation and sensitivities
   const Vector &v = crdTransf->getBasicTrialDisp();
   
-  static Vector dvdh(6);
+  static thread_local Vector dvdh(6);
   dvdh = crdTransf->getBasicDisplSensitivity(gradNumber);
   
   double L = crdTransf->getInitialLength();
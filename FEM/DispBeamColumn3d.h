@@ -119,8 +119,8 @@ class DispBeamColumn3d : public Element
 
     Node *theNodes[2];
 
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
+    static thread_local Matrix K;		// Element stiffness, damping, and mass Matrix
+    static thread_local Vector P;		// Element resisting force vector
 
     Vector Q;      // Applied nodal loads
     Vector q;      // Basic force
@@ -134,7 +134,7 @@ class DispBeamColumn3d : public Element
 
     enum {maxNumSections = 20};
 
-    static double workArea[];
+    static thread_local double workArea[];
 };
 
 #endif
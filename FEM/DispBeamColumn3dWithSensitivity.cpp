@@ -48,9 +48,9 @@
 
 # define ELE_TAG_DispBeamColumn3dWithSensitivity 1110000
 
-Matrix DispBeamColumn3dWithSensitivity::K(12,12);
-Vector DispBeamColumn3dWithSensitivity::P(12);
-double DispBeamColumn3dWithSensitivity::workArea[200];
+thread_local Matrix DispBeamColumn3dWithSensitivity::K(12,12);
+thread_local Vector DispBeamColumn3dWithSensitivity::P(12);
+thread_local double DispBeamColumn3dWithSensitivity::workArea[200];
 //GaussQuadRule1d01 DispBeamColumn3dWithSensitivity::quadRule;
 
 void* OPS_DispBeamColumn3dWithSensitivity()
@@ -409,7 +409,7 @@ DispBeamColumn3dWithSensitivity::update(void)
 const Matrix&
 DispBeamColumn3dWithSensitivity::getTangentStiff()
 {
-  static Matrix kb(6,6);
+  static thread_local Matrix kb(6,6);
   
   // Zero for integral
   kb.Zero();
@@ -545,7 +545,7 @@ DispBeamColumn3dWithSensitivity::getTangentStiff()
 const Matrix&
 DispBeamColumn3dWithSensitivity::getInitialBasicStiff()
 {
-  static Matrix kb(6,6);
+  static thread_local Matrix kb(6,6);
   
   // Zero for integral
   kb.Zero();
@@ -916,7 +916,7 @@ DispBeamColumn3dWithSensitivity::sendSelf(int commitTag, Channel &theChannel)
   int i, j;
   int loc = 0;
   
-  static ID idData(7);  // one bigger than needed so no clash later
+  static thread_local ID idData(7);  // one bigger than needed so no clash later
   idData(0) = this->getTag();
   idData(1) = connectedExternalNodes(0);
   idData(2) = connectedExternalNodes(1);
@@ -939,7 +939,7 @@ DispBeamColumn3dWithSensitivity::sendSelf(int commitTag, Channel &theChannel)
   }    
   if (idData(6) == 1) {
     // send damping coefficients
-    static Vector dData(4);
+    static thread_local Vector dData(4);
     dData(0) = alphaM;
     dData(1) = betaK;
     dData(2) = betaK0;
@@ -1007,7 +1007,7 @@ DispBeamColumn3dWithSensitivity::recvSelf(int commitTag, Channel &theChannel,
   int dbTag = this->getDbTag();
   int i;
   
-  static ID idData(7); // one bigger than needed so no clash with section ID
+  static thread_local ID idData(7); // one bigger than needed so no clash with section ID
 
   if (theChannel.recvID(dbTag, commitTag, idData) < 0)  {
     opserr << "DispBeamColumn3dWithSensitivity::recvSelf() - failed to recv ID data\n";
@@ -1022,7 +1022,7 @@ DispBeamColumn3dWithSensitivity::recvSelf(int commitTag, Channel &theChannel,
   int crdTransfDbTag = idData(5);
   if (idData(6) == 1) {
     // recv damping coefficients
-    static Vector dData(4);
+    static thread_local Vector dData(4);
     if (theChannel.recvVector(dbTag, commitTag, dData) < 0) {
       opserr << "DispBeamColumn3d::sendSelf() - failed to recv double data\n";
       return -1;
@@ -1192,8 +1192,8 @@ DispBeamColumn3dWithSensitivity::displaySelf(Renderer &theViewer, int displayMod
   const Vector &end1Crd = theNodes[0]->getCrds();
   const Vector &end2Crd = theNodes[1]->getCrds();	
   
-  static Vector v1(3);
-  static Vector v2(3);
+  static thread_local Vector v1(3);
+  static thread_local Vector v2(3);
 
   if (displayMode >= 0) {
     const Vector &end1Disp = theNodes[0]->getDisp();
@@ -1378,8 +1378,8 @@ DispBeamColumn3dWithSensitivity::getResponse(int responseID, Information &eleInf
 
   // Plastic rotation
   else if (responseID == 4) {
-    static Vector vp(6);
-    static Vector ve(6);
+    static thread_local Vector vp(6);
+    static thread_local Vector ve(6);
     const Matrix &kb = this->getInitialBasicStiff();
     kb.Solve(q, ve);
     vp = crdTransf->getBasicTrialDisp();
@@ -1489,7 +1489,7 @@ DispBeamColumn3dWithSensitivity::getResistingForceSensitivity(int gradNumber)
 
 	// Zero for integration
 	q.Zero();
-	static Vector qsens(6);
+	static thread_local Vector qsens(6);
 	qsens.Zero();
 
 
@@ -1553,7 +1553,7 @@ DispBeamColumn3dWithSensitivity::getResistingForceSensitivity(int gradNumber)
 	}  //for section
 
 	// Term 5
-	static Vector dummy(5); //dummy is only 5
+	static thread_local Vector dummy(5); //dummy is only 5
 	dummy.Zero();
 	P = crdTransf->getGlobalResistingForce(qsens,dummy);
 	
@@ -1574,7 +1574,7 @@ int
 DispBeamColumn3dWithSensitivity::commitSensitivity(int gradNumber, int numGrads)
 {
   const Vector &v = crdTransf->getBasicTrialDisp();
-  static Vector vsens(6); 
+  static thread_local Vector vsens(6); 
    vsens = crdTransf->getBasicDisplSensitivity(gradNumber);
   double L = crdTransf->getInitialLength();
   double oneOverL = 1.0/L;
@@ -44,6 +44,7 @@
 #include <ElementalLoadIter.h>
 #include <NodalLoadIter.h>
 #include <Element.h>
+#include <NDMaterial.h>
 #include <Node.h>
 #include <SP_Constraint.h>
 #include <Pressure_Constraint.h>
@@ -80,9 +81,9 @@
 // global variables
 //
 
-Domain       *ops_TheActiveDomain = 0;
-double        ops_Dt = 0.0;
-bool          ops_InitialStateAnalysis = false;
+thread_local Domain *ops_TheActiveDomain = 0;
+thread_local double ops_Dt = 0.0;
+thread_local bool ops_InitialStateAnalysis = false;
 
 Domain::Domain()
 :theRecorders(0), numRecorders(0),
@@ -91,6 +92,9 @@ Domain::Domain()
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false),  nodeGraphBuiltFlag(false), theNodeGraph(0), 
  theElementGraph(0), 
+ eleArrayBuiltFlag(false), theEleArray(0), numEleArray(0),
+ materialBatchSize(0), theBatchMaterials(0), theBatchStrains(0),
+ theBatchRanges(0), numBatchArray(0),
  theRegions(0), numRegions(0), commitTag(0),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalDampingFactors(0), inclModalMatrix(false),
@@ -146,6 +150,9 @@ Domain::Domain(int numNodes, int numElements, int numSPs, int numMPs,
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false), theNodeGraph(0), 
  theElementGraph(0),
+ eleArrayBuiltFlag(false), theEleArray(0), numEleArray(0),
+ materialBatchSize(0), theBatchMaterials(0), theBatchStrains(0),
+ theBatchRanges(0), numBatchArray(0),
  theRegions(0), numRegions(0), commitTag(0),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalDampingFactors(0), inclModalMatrix(false),
@@ -201,6 +208,9 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false), theNodeGraph(0), 
  theElementGraph(0), 
+ eleArrayBuiltFlag(false), theEleArray(0), numEleArray(0),
+ materialBatchSize(0), theBatchMaterials(0), theBatchStrains(0),
+ theBatchRanges(0), numBatchArray(0),
  theElements(&theElementsStorage),
  theNodes(&theNodesStorage),
  theSPs(&theSPsStorage),
@@ -264,6 +274,9 @@ Domain::Domain(TaggedObjectStorage &theStorage)
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false), theNodeGraph(0), 
  theElementGraph(0), 
+ eleArrayBuiltFlag(false), theEleArray(0), numEleArray(0),
+ materialBatchSize(0), theBatchMaterials(0), theBatchStrains(0),
+ theBatchRanges(0), numBatchArray(0),
  theRegions(0), numRegions(0), commitTag(0),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalDampingFactors(0), inclModalMatrix(false),
@@ -374,6 +387,15 @@ Domain::~Domain()
 
   if (theModalDampingFactors != 0)
     delete theModalDampingFactors;
+
+  if (theEleArray != 0)
+    delete [] theEleArray;
+
+  if (theBatchMaterials != 0) {
+    delete [] theBatchMaterials;
+    delete [] theBatchStrains;
+    delete [] theBatchRanges;
+  }
   
   int i;
   for (i=0; i<numRecorders; i++) 
@@ -994,6 +1016,7 @@ Domain::clearAll(void) {
   hasDomainChangedFlag = false;
   nodeGraphBuiltFlag = false;
   eleGraphBuiltFlag = false;
+  eleArrayBuiltFlag = false;
 
   if (theNodeGraph != 0)
     delete theNodeGraph;
@@ -1592,7 +1615,7 @@ Domain::getNodeResponse(int nodeTag, NodeResponseType responseType)
 }
 
 
-static Vector responseData(0);
+static thread_local Vector responseData(0);
 
 const Vector *
 Domain::getElementResponse(int eleTag, const char **argv, int argc)
@@ -1854,6 +1877,14 @@ Domain::setRayleighDampingFactors(double alphaM, double betaK, double betaK0, do
   return result;
 }
 
+void
+Domain::setMaterialBatchSize(int size)
+{
+  // with size > 0 the trial strains of the NDMaterials of the elements are
+  // set in batches of up to size materials, see updateMaterialBatches()
+  materialBatchSize = (size > 0) ? size : 0;
+}
+
 
 int
 Domain::record(bool fromAnalysis)
@@ -1883,11 +1914,28 @@ Domain::commit(void)
       nodePtr->commitState();
     }
 
+#ifdef _OPENMP
+    if (eleArrayBuiltFlag == true) {
+      // the elements commit their own state only, so can be done in parallel
+      OPS_Stream *theErr = opserrPtr;
+      Element **theEles = theEleArray;
+      int numEles = numEleArray;
+
+#pragma omp parallel for schedule(dynamic, 16)
+      for (int i=0; i<numEles; i++) {
+	opserrPtr = theErr;
+	theEles[i]->commitState();
+      }
+    } else {
+#endif
     Element *elePtr;
     ElementIter &theElemIter = this->getElements();    
     while ((elePtr = theElemIter()) != 0) {
       elePtr->commitState();
     }
+#ifdef _OPENMP
+    }
+#endif
 
     // set the new committed time in the domain
     committedTime = currentTime;
@@ -1976,6 +2024,43 @@ Domain::update(void)
 
   int ok = 0;
 
+  if (materialBatchSize > 0 && eleArrayBuiltFlag == true)
+    return this->updateMaterialBatches();
+
+#ifdef _OPENMP
+  // the ele's only change their own state in update(), so once the array
+  // of elements is built they are updated in parallel. the first update
+  // after the domain has changed is done in the loop below, as a node
+  // creates its response vectors when they are first asked for.
+  if (eleArrayBuiltFlag == true) {
+    // the globals are thread local, each thread gets those of this one
+    OPS_Stream *theErr = opserrPtr;
+    bool initialState = ops_InitialStateAnalysis;
+    double theDt = dT;
+    Element **theEles = theEleArray;
+    int numEles = numEleArray;
+
+#pragma omp parallel reduction(+:ok)
+    {
+      opserrPtr = theErr;
+      ops_Dt = theDt;
+      ops_TheActiveDomain = this;
+      ops_InitialStateAnalysis = initialState;
+
+#pragma omp for schedule(dynamic, 16)
+      for (int i=0; i<numEles; i++) {
+	ops_TheActiveElement = theEles[i];
+	ok += theEles[i]->update();
+      }
+    }
+
+    if (ok != 0)
+      opserr << "Domain::update - domain failed in update\n";
+
+    return ok;
+  }
+#endif
+
   // invoke update on all the ele's
   ElementIter &theEles = this->getElements();
   Element *theEle;
@@ -1985,6 +2070,13 @@ Domain::update(void)
     ok += theEle->update();
   }
 
+#ifdef _OPENMP
+  this->buildElementArray();
+#else
+  if (materialBatchSize > 0)
+    this->buildElementArray();
+#endif
+
   if (ok != 0)
     opserr << "Domain::update - domain failed in update\n";
 
@@ -2143,6 +2235,7 @@ void
 Domain::domainChange(void)
 {
     hasDomainChangedFlag = true;
+    eleArrayBuiltFlag = false;
 }
 
 
@@ -2348,6 +2441,128 @@ Domain::getRegionTags(ID& rtags) const
 
 }
 
+int
+Domain::buildElementArray(void)
+{
+  // the array holds the elements in the order of the ElementIter, it is
+  // used by the element loops that are run on several threads
+  int numEle = theElements->getNumComponents();
+  if (theEleArray == 0 || numEle > numEleArray) {
+    if (theEleArray != 0)
+      delete [] theEleArray;
+    theEleArray = new Element *[numEle];
+    if (theEleArray == 0) {
+      opserr << "WARNING Domain::buildElementArray - out of memory\n";
+      numEleArray = 0;
+      eleArrayBuiltFlag = false;
+      return -1;
+    }
+  }
+
+  numEleArray = 0;
+  ElementIter &theEles = this->getElements();
+  Element *theEle;
+  while ((theEle = theEles()) != 0)
+    theEleArray[numEleArray++] = theEle;
+
+  eleArrayBuiltFlag = true;
+  return 0;
+}
+
+int
+Domain::updateMaterialBatches(void)
+{
+  // the ele's form the trial strains of their materials, then the materials
+  // of consecutive ele's with the same type and tag of material (in a soil
+  // column the ele's of a layer) get their strains in batches of up to
+  // materialBatchSize, which a material can evaluate all at once. ele's that
+  // do not give their material out are updated as usual.
+  int numEles = numEleArray;
+  if (theBatchMaterials == 0 || numEles > numBatchArray) {
+    if (theBatchMaterials != 0) {
+      delete [] theBatchMaterials;
+      delete [] theBatchStrains;
+      delete [] theBatchRanges;
+    }
+    theBatchMaterials = new NDMaterial *[numEles];
+    theBatchStrains = new const Vector *[numEles];
+    theBatchRanges = new int[2*numEles];
+    numBatchArray = numEles;
+  }
+
+  Element **theEles = theEleArray;
+  NDMaterial **theMats = theBatchMaterials;
+  const Vector **theStrains = theBatchStrains;
+  int *theRanges = theBatchRanges;
+  int batchSize = materialBatchSize;
+  int numBatches = 0;
+  int ok = 0;
+
+  // the globals are thread local, each thread gets those of this one
+  OPS_Stream *theErr = opserrPtr;
+  bool initialState = ops_InitialStateAnalysis;
+  double theDt = dT;
+
+#ifdef _OPENMP
+#pragma omp parallel reduction(+:ok)
+#endif
+  {
+    opserrPtr = theErr;
+    ops_Dt = theDt;
+    ops_TheActiveDomain = this;
+    ops_InitialStateAnalysis = initialState;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 16)
+#endif
+    for (int i=0; i<numEles; i++) {
+      ops_TheActiveElement = theEles[i];
+      theMats[i] = theEles[i]->formMaterialStrain(theStrains[i]);
+      if (theMats[i] == 0)
+	ok += theEles[i]->update();
+    }
+
+#ifdef _OPENMP
+#pragma omp single
+#endif
+    {
+      int i = 0;
+      while (i < numEles) {
+	if (theMats[i] == 0) {
+	  i++;
+	  continue;
+	}
+	int classTag = theMats[i]->getClassTag();
+	int matTag = theMats[i]->getTag();
+	int end = i+1;
+	while (end < numEles && end-i < batchSize && theMats[end] != 0 &&
+	       theMats[end]->getClassTag() == classTag && theMats[end]->getTag() == matTag)
+	  end++;
+	theRanges[2*numBatches] = i;
+	theRanges[2*numBatches+1] = end;
+	numBatches++;
+	i = end;
+      }
+    }
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+    for (int j=0; j<numBatches; j++) {
+      int start = theRanges[2*j];
+      int end = theRanges[2*j+1];
+      ops_TheActiveElement = theEles[start];
+      if (theMats[start]->setTrialStrains(end-start, &theMats[start], &theStrains[start]) != 0)
+	ok++;
+    }
+  }
+
+  if (ok != 0)
+    opserr << "Domain::update - domain failed in update\n";
+
+  return ok;
+}
+
 typedef map<int, int> MAP_INT;
 typedef MAP_INT::value_type   MAP_INT_TYPE;
 typedef MAP_INT::iterator     MAP_INT_ITERATOR;
@@ -2649,7 +2864,7 @@ Domain::sendSelf(int cTag, Channel &theChannel)
 
   /*
   if (theChannel.isDatastore() == 1) {
-    static ID theLastSendTag(1);
+    static thread_local ID theLastSendTag(1);
     if (theChannel.recvID(0,0,theLastSendTag) == 0)
       lastGeoSendTag = theLastSendTag(0);
     else
@@ -2873,7 +3088,7 @@ Domain::sendSelf(int cTag, Channel &theChannel)
     lastGeoSendTag = currentGeoTag;
     /*
     if (theChannel.isDatastore() == 1) {
-      static ID theLastSendTag(1);
+      static thread_local ID theLastSendTag(1);
       theLastSendTag(0) = lastGeoSendTag;
       theChannel.sendID(0,0, theLastSendTag);
     }
@@ -2991,7 +3206,7 @@ Domain::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 
   /*
   if (theChannel.isDatastore() == 1) {
-    static ID theLastSendTag(1);
+    static thread_local ID theLastSendTag(1);
     if (theChannel.recvID(0,0,theLastSendTag) == 0)
       lastGeoSendTag = theLastSendTag(0);
   }
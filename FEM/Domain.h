@@ -40,6 +40,7 @@
 #include <Vector.h>
 
 class Element;
+class NDMaterial;
 class Node;
 class SP_Constraint;
 class MP_Constraint;
@@ -179,6 +180,7 @@ class Domain
     virtual void  unsetLoadConstant(void);
     virtual  int  initialize(void);    
     virtual  int  setRayleighDampingFactors(double alphaM, double betaK, double betaK0, double betaKc);
+    virtual  void setMaterialBatchSize(int size);
 
     virtual  int  commit(void);
     virtual  int  revertToLastCommit(void);
@@ -236,6 +238,8 @@ class Domain
 
     virtual int buildEleGraph(Graph *theEleGraph);
     virtual int buildNodeGraph(Graph *theNodeGraph);
+    virtual int buildElementArray(void);
+    virtual int updateMaterialBatches(void);
 
     Recorder **theRecorders;
     int numRecorders;    
@@ -256,6 +260,16 @@ class Domain
     Graph *theNodeGraph;
     Graph *theElementGraph;
 
+    bool eleArrayBuiltFlag;           // flag indicating if theEleArray is current
+    Element **theEleArray;            // the elements, for the threaded element loops
+    int numEleArray;                  // number of elements in theEleArray
+
+    int materialBatchSize;            // max number of materials in a batch, 0 if not batched
+    NDMaterial **theBatchMaterials;   // the materials of the elements in theEleArray
+    const Vector **theBatchStrains;   // their trial strains
+    int *theBatchRanges;              // first and one past the last material of every batch
+    int numBatchArray;                // size of the three arrays above
+
     TaggedObjectStorage  *theElements;
     TaggedObjectStorage  *theNodes;
     TaggedObjectStorage  *theSPs;    
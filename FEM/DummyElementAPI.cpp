@@ -60,11 +60,11 @@ typedef struct materialFunction {
   struct materialFunction *next;
 } MaterialFunction;
 
-static ElementFunction *theElementFunctions = NULL;
-static MaterialFunction *theMaterialFunctions = NULL;
-static Domain *theDomain = 0;
-static int currentArg = 0;
-static int maxArg = 0;
+static thread_local ElementFunction *theElementFunctions = NULL;
+static thread_local MaterialFunction *theMaterialFunctions = NULL;
+static thread_local Domain *theDomain = 0;
+static thread_local int currentArg = 0;
+static thread_local int maxArg = 0;
 extern FE_Datastore *theDatabase;
 //static int uniaxialMaterialObjectCount =0;
 
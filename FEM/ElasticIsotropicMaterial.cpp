@@ -256,7 +256,7 @@ ElasticIsotropicMaterial::sendSelf (int commitTag, Channel &theChannel)
 {
   int res = 0;
 
-  static Vector data(4);
+  static thread_local Vector data(4);
   
   data(0) = this->getTag();
   data(1) = E;
@@ -278,7 +278,7 @@ ElasticIsotropicMaterial::recvSelf (int commitTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(4);
+  static thread_local Vector data(4);
   
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
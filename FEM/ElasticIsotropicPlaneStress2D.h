@@ -77,8 +77,8 @@ class ElasticIsotropicPlaneStress2D : public ElasticIsotropicMaterial
   protected:
 
   private:
-    static Vector sigma;	// Stress vector ... class-wide for returns
-    static Matrix D;		// Elastic constants
+    static thread_local Vector sigma;	// Stress vector ... class-wide for returns
+    static thread_local Matrix D;		// Elastic constants
     Vector epsilon;	        // Trial strains
     Vector Cepsilon;	        // Committed strains
 };
@@ -21,8 +21,8 @@
 #include <ElasticIsotropicThreeDimensional.h>           
 #include <Channel.h>
 
-Vector ElasticIsotropicThreeDimensional::sigma(6);
-Matrix ElasticIsotropicThreeDimensional::D(6,6);
+thread_local Vector ElasticIsotropicThreeDimensional::sigma(6);
+thread_local Matrix ElasticIsotropicThreeDimensional::D(6,6);
 
 ElasticIsotropicThreeDimensional::ElasticIsotropicThreeDimensional
 (int tag, double E, double nu, double rho) :
@@ -193,7 +193,7 @@ ElasticIsotropicThreeDimensional::getOrder (void) const
 int 
 ElasticIsotropicThreeDimensional::sendSelf(int commitTag, Channel &theChannel)
 {
-  static Vector data(10);
+  static thread_local Vector data(10);
   
   data(0) = this->getTag();
   data(1) = E;
@@ -219,7 +219,7 @@ int
 ElasticIsotropicThreeDimensional::recvSelf(int commitTag, Channel &theChannel, 
 					FEM_ObjectBroker &theBroker)
 {
-  static Vector data(10);
+  static thread_local Vector data(10);
   
   int res = theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
@@ -82,9 +82,9 @@ class ElasticSection3d : public SectionForceDeformation
   
   Vector e;			// section trial deformations
   
-  static Vector s;
-  static Matrix ks;
-  static ID code;
+  static thread_local Vector s;
+  static thread_local Matrix ks;
+  static thread_local ID code;
 
   int parameterID;
 };
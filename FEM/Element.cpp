@@ -44,12 +44,12 @@
 #include <Node.h>
 #include <Domain.h>
 
-Element  *ops_TheActiveElement = 0;
+thread_local Element  *ops_TheActiveElement = 0;
 
-Matrix **Element::theMatrices; 
-Vector **Element::theVectors1; 
-Vector **Element::theVectors2; 
-int  Element::numMatrices(0);
+thread_local Matrix **Element::theMatrices = 0;
+thread_local Vector **Element::theVectors1 = 0;
+thread_local Vector **Element::theVectors2 = 0;
+thread_local int  Element::numMatrices(0);
 
 // Element(int tag, int noExtNodes);
 // 	constructor that takes the element's unique tag and the number
@@ -58,7 +58,7 @@ int  Element::numMatrices(0);
 Element::Element(int tag, int cTag) 
   :DomainComponent(tag, cTag), alphaM(0.0), 
   betaK(0.0), betaK0(0.0), betaKc(0.0), 
-   Kc(0), previousK(0), numPreviousK(0), index(-1), nodeIndex(-1)
+   Kc(0), previousK(0), numPreviousK(0), nodeIndex(-1)
 {
   // does nothing
   ops_TheActiveElement = this;
@@ -91,6 +91,13 @@ Element::update(void)
     return 0;
 }
 
+NDMaterial *
+Element::formMaterialStrain(const Vector *&theStrain)
+{
+    theStrain = 0;
+    return 0;
+}
+
 int
 Element::revertToStart(void)
 {
@@ -111,76 +118,82 @@ Element::addInertiaLoadToUnbalance(const Vector &accel)
 }
 
 
+// getWorkArea(int numDOF)
+//	returns the location of the matrix and vectors of size numDOF in the
+//	work storage of the calling thread, creating them if needed. The
+//	storage is per thread so that elements can be used on many threads.
 int
-Element::setRayleighDampingFactors(double alpham, double betak, double betak0, double betakc)
+Element::getWorkArea(int numDOF)
 {
-  alphaM = alpham;
-  betaK  = betak;
-  betaK0 = betak0;
-  betaKc = betakc;
+  int index = -1;
 
-  // check that memory has been allocated to store compute/return
-  // damping matrix & residual force calculations
+  for (int i=0; i<numMatrices; i++) {
+    Matrix *aMatrix = theMatrices[i];
+    if (aMatrix->noRows() == numDOF) {
+      index = i;
+      i = numMatrices;
+    }
+  }
   if (index == -1) {
-    int numDOF = this->getNumDOF();
-
-    for (int i=0; i<numMatrices; i++) {
-      Matrix *aMatrix = theMatrices[i];
-      if (aMatrix->noRows() == numDOF) {
-	index = i;
-	i = numMatrices;
-      }
+    Matrix **nextMatrices = new Matrix *[numMatrices+1];
+    if (nextMatrices == 0) {
+      opserr << "Element::getTheMatrix - out of memory\n";
     }
-    if (index == -1) {
-      Matrix **nextMatrices = new Matrix *[numMatrices+1];
-      if (nextMatrices == 0) {
-	opserr << "Element::getTheMatrix - out of memory\n";
-      }
-	  int j;
-      for (j=0; j<numMatrices; j++)
-	nextMatrices[j] = theMatrices[j];
-      Matrix *theMatrix = new Matrix(numDOF, numDOF);
-      if (theMatrix == 0) {
-	opserr << "Element::getTheMatrix - out of memory\n";
-	exit(-1);
-      }
-      nextMatrices[numMatrices] = theMatrix;
-
-      Vector **nextVectors1 = new Vector *[numMatrices+1];
-      Vector **nextVectors2 = new Vector *[numMatrices+1];
-      if (nextVectors1 == 0 || nextVectors2 == 0) {
-	opserr << "Element::getTheVector - out of memory\n";
-	exit(-1);
-      }
-
-      for (j=0; j<numMatrices; j++) {
-	nextVectors1[j] = theVectors1[j];
-	nextVectors2[j] = theVectors2[j];
-      }
-	
-      Vector *theVector1 = new Vector(numDOF);
-      Vector *theVector2 = new Vector(numDOF);
-      if (theVector1 == 0 || theVector2 == 0) {
-	opserr << "Element::getTheVector - out of memory\n";
-	exit(-1);
-      }
-
-      nextVectors1[numMatrices] = theVector1;
-      nextVectors2[numMatrices] = theVector2;
-
-      if (numMatrices != 0) {
-	delete [] theMatrices;
-	delete [] theVectors1;
-	delete [] theVectors2;
-      }
-      index = numMatrices;
-      numMatrices++;
-      theMatrices = nextMatrices;
-      theVectors1 = nextVectors1;
-      theVectors2 = nextVectors2;
+    int j;
+    for (j=0; j<numMatrices; j++)
+      nextMatrices[j] = theMatrices[j];
+    Matrix *theMatrix = new Matrix(numDOF, numDOF);
+    if (theMatrix == 0) {
+      opserr << "Element::getTheMatrix - out of memory\n";
+      exit(-1);
     }
+    nextMatrices[numMatrices] = theMatrix;
+
+    Vector **nextVectors1 = new Vector *[numMatrices+1];
+    Vector **nextVectors2 = new Vector *[numMatrices+1];
+    if (nextVectors1 == 0 || nextVectors2 == 0) {
+      opserr << "Element::getTheVector - out of memory\n";
+      exit(-1);
+    }
+
+    for (j=0; j<numMatrices; j++) {
+      nextVectors1[j] = theVectors1[j];
+      nextVectors2[j] = theVectors2[j];
+    }
+      
+    Vector *theVector1 = new Vector(numDOF);
+    Vector *theVector2 = new Vector(numDOF);
+    if (theVector1 == 0 || theVector2 == 0) {
+      opserr << "Element::getTheVector - out of memory\n";
+      exit(-1);
+    }
+
+    nextVectors1[numMatrices] = theVector1;
+    nextVectors2[numMatrices] = theVector2;
+
+    if (numMatrices != 0) {
+      delete [] theMatrices;
+      delete [] theVectors1;
+      delete [] theVectors2;
+    }
+    index = numMatrices;
+    numMatrices++;
+    theMatrices = nextMatrices;
+    theVectors1 = nextVectors1;
+    theVectors2 = nextVectors2;
   }
 
+  return index;
+}
+
+int
+Element::setRayleighDampingFactors(double alpham, double betak, double betak0, double betakc)
+{
+  alphaM = alpham;
+  betaK  = betak;
+  betaK0 = betak0;
+  betaKc = betakc;
+
   // if need storage for Kc go get it
   if (betaKc != 0.0) {  
     if (Kc == 0) 
@@ -202,9 +215,7 @@ Element::setRayleighDampingFactors(double alpham, double betak, double betak0, d
 const Matrix &
 Element::getDamp(void) 
 {
-  if (index  == -1) {
-    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  int index = getWorkArea(this->getNumDOF());
 
   // now compute the damping matrix
   Matrix *theMatrix = theMatrices[index]; 
@@ -227,9 +238,7 @@ Element::getDamp(void)
 const Matrix &
 Element::getMass(void)
 {
-  if (index  == -1) {
-    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  int index = getWorkArea(this->getNumDOF());
 
   // zero the matrix & return it
   Matrix *theMatrix = theMatrices[index]; 
@@ -240,9 +249,7 @@ Element::getMass(void)
 const Vector &
 Element::getResistingForceIncInertia(void) 
 {
-  if (index == -1) {
-    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  int index = getWorkArea(this->getNumDOF());
 
   Matrix *theMatrix = theMatrices[index]; 
   Vector *theVector = theVectors2[index];
@@ -307,9 +314,7 @@ const Vector &
 Element::getRayleighDampingForces(void) 
 {
 
-  if (index == -1) {
-    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  int index = getWorkArea(this->getNumDOF());
 
   Matrix *theMatrix = theMatrices[index]; 
   Vector *theVector = theVectors2[index];
@@ -417,7 +422,7 @@ Element::setResponse(const char **argv, int argc, OPS_Stream &output)
   output.attr("eleTag",this->getTag());
   int numNodes = this->getNumExternalNodes();
   const ID &nodes = this->getExternalNodes();
-  static char nodeData[32];
+  static thread_local char nodeData[32];
 
   for (int i=0; i<numNodes; i++) {
     sprintf(nodeData,"node%d",i+1);
@@ -485,9 +490,7 @@ Element::getResponseSensitivity(int responseID, int gradIndex,
 const Vector &
 Element::getResistingForceSensitivity(int gradIndex)
 {
-  if (index == -1) {
-    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  int index = getWorkArea(this->getNumDOF());
 
   Vector *theVector = theVectors1[index];
   theVector->Zero();
@@ -498,9 +501,7 @@ Element::getResistingForceSensitivity(int gradIndex)
 const Matrix &
 Element::getInitialStiffSensitivity(int gradIndex)
 {
-  if (index == -1) {
-    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  int index = getWorkArea(this->getNumDOF());
 
   Matrix *theMatrix = theMatrices[index];
   theMatrix->Zero();
@@ -511,9 +512,7 @@ Element::getInitialStiffSensitivity(int gradIndex)
 const Matrix &
 Element::getMassSensitivity(int gradIndex)
 {
-  if (index == -1) {
-    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  int index = getWorkArea(this->getNumDOF());
 
   Matrix *theMatrix = theMatrices[index];
   theMatrix->Zero();
@@ -541,9 +540,7 @@ Element::addInertiaLoadSensitivityToUnbalance(const Vector &accel, bool tag)
 const Matrix &
 Element::getDampSensitivity(int gradIndex) 
 {
-  if (index  == -1) {
-    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  int index = getWorkArea(this->getNumDOF());
 
   // now compute the damping matrix
   Matrix *theMatrix = theMatrices[index]; 
@@ -575,7 +572,7 @@ Element::addResistingForceToNodalReaction(int flag)
   int numNodes = this->getNumExternalNodes();
   Node **theNodes = this->getNodePtrs();
 
-  static Vector theVector(48);
+  static thread_local Vector theVector(48);
 
   //
   // now determine the resisting force
@@ -703,9 +700,7 @@ Element::displaySelf(Renderer &, int mode, float fact, const char **displayModes
 const Matrix &
 Element::getGeometricTangentStiff()
 {
-    if (index == -1) {
-	this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-    }
+    int index = getWorkArea(this->getNumDOF());
     
     Matrix *theMatrix = theMatrices[index];
     theMatrix->Zero();
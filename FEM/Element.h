@@ -46,6 +46,7 @@ class Info;
 class Response;
 class ElementalLoad;
 class Node;
+class NDMaterial;
 
 class Element : public DomainComponent
 {
@@ -65,6 +66,12 @@ class Element : public DomainComponent
     virtual int revertToLastCommit(void) = 0;        
     virtual int revertToStart(void);                
     virtual int update(void);
+
+    // for the batched material updates of the Domain: an ele with a single
+    // NDMaterial whose update() only sets its trial strain forms that
+    // strain, points theStrain to it and returns the material. the default
+    // returns 0 and the Domain invokes update() instead.
+    virtual NDMaterial *formMaterialStrain(const Vector *&theStrain);
     virtual bool isSubdomain(void);
     
     // methods to return the current linearized stiffness,
@@ -118,14 +125,15 @@ class Element : public DomainComponent
     Matrix **previousK;
     int numPreviousK;
 
-    int index, nodeIndex;
-
-    static Matrix ** theMatrices; 
-    static Vector ** theVectors1; 
-    static Vector ** theVectors2; 
-    static int numMatrices;
+    int nodeIndex;
 
   private:
+    static int getWorkArea(int numDOF);
+
+    static thread_local Matrix ** theMatrices; 
+    static thread_local Vector ** theVectors1; 
+    static thread_local Vector ** theVectors2; 
+    static thread_local int numMatrices;
 };
 
 
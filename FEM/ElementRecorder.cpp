@@ -386,12 +386,20 @@ ElementRecorder::record(int commitTag, double timeStamp)
     }
   }
   
+  // rows outside the time window or before the trigger are not recorded
+  if (this->isRecording(timeStamp) == false)
+    return 0;
+
   int result = 0;
-  if (deltaT == 0.0 || timeStamp >= nextTimeStampToRecord) {
+  // the tolerance keeps round-off in the accumulated time from skipping a record
+  if (deltaT == 0.0 || timeStamp - nextTimeStampToRecord >= -deltaT * 1.0e-5) {
 
     if (deltaT != 0.0) 
       nextTimeStampToRecord = timeStamp + deltaT;
 
+    if (this->isDecimated() == true)
+      return 0;
+
     int loc = 0;
     if (echoTimeFlag == true) 
       (*data)(loc++) = timeStamp;
@@ -466,7 +474,7 @@ ElementRecorder::sendSelf(int commitTag, Channel &theChannel)
   // into an ID, place & send (*eleID) size, numArgs and length of all responseArgs
   //
 
-  static ID idData(7);
+  static thread_local ID idData(7);
   if (eleID != 0)
     idData(0) = eleID->Size();
   else
@@ -499,7 +507,7 @@ ElementRecorder::sendSelf(int commitTag, Channel &theChannel)
     return -1;
   }
 
-  static Vector dData(2);
+  static thread_local Vector dData(2);
   dData(0) = deltaT;
   dData(1) = nextTimeStampToRecord;
   if (theChannel.sendVector(0, commitTag, dData) < 0) {
@@ -598,7 +606,7 @@ ElementRecorder::recvSelf(int commitTag, Channel &theChannel,
   // into an ID of size 2 recv eleID size and length of all responseArgs
   //
 
-  static ID idData(7);
+  static thread_local ID idData(7);
   if (theChannel.recvID(0, commitTag, idData) < 0) {
     opserr << "ElementRecorder::recvSelf() - failed to recv idData\n";
     return -1;
@@ -618,7 +626,7 @@ ElementRecorder::recvSelf(int commitTag, Channel &theChannel,
 
   numEle = eleSize;
 
-  static Vector dData(2);
+  static thread_local Vector dData(2);
   if (theChannel.recvVector(0, commitTag, dData) < 0) {
     opserr << "ElementRecorder::sendSelf() - failed to send dData\n";
     return -1;
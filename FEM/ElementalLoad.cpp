@@ -94,7 +94,7 @@ ElementalLoad::applyLoad(const Vector &loadFactors)
 const Vector&
 ElementalLoad::getSensitivityData(int gradIndex)
 {
-  static Vector trash(10);
+  static thread_local Vector trash(10);
 
   return trash;
 }
@@ -0,0 +1,246 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/recorder/EnvelopeElementRecorder.cpp
+//
+// Written: fmk
+//
+// Description: This file contains the implementation of
+// EnvelopeElementRecorder.
+//
+// What: "@(#) EnvelopeElementRecorder.cpp, revA"
+
+#include <EnvelopeElementRecorder.h>
+#include <Domain.h>
+#include <Element.h>
+#include <Response.h>
+#include <Information.h>
+#include <OPS_Stream.h>
+#include <classTags.h>
+
+#include <string.h>
+#include <math.h>
+
+EnvelopeElementRecorder::EnvelopeElementRecorder()
+:Recorder(RECORDER_TAGS_EnvelopeElementRecorder),
+ numEle(0), eleID(0), theResponses(0), 
+ theDomain(0), theOutputHandler(0),
+ echoTimeFlag(true), deltaT(0.0), nextTimeStampToRecord(0.0),
+ currentData(0), data(), first(true),
+ initializationDone(false), responseArgs(0), numArgs(0)
+{
+
+}
+
+EnvelopeElementRecorder::EnvelopeElementRecorder(const ID &ele,
+						 const char **argv, 
+						 int argc,
+						 Domain &theDom, 
+						 OPS_Stream &theOutputHandler,
+						 double dT,
+						 bool echoTime)
+:Recorder(RECORDER_TAGS_EnvelopeElementRecorder),
+ numEle(ele.Size()), eleID(ele), theResponses(0), 
+ theDomain(&theDom), theOutputHandler(&theOutputHandler),
+ echoTimeFlag(echoTime), deltaT(dT), nextTimeStampToRecord(0.0),
+ currentData(0), data(), first(true),
+ initializationDone(false), responseArgs(0), numArgs(0)
+{
+  // create a copy of the response request
+  responseArgs = new char *[argc];
+  for (int i=0; i<argc; i++) {
+    responseArgs[i] = new char[strlen(argv[i])+1];
+    strcpy(responseArgs[i], argv[i]);
+  }
+  numArgs = argc;
+}
+
+EnvelopeElementRecorder::~EnvelopeElementRecorder()
+{
+  if (theOutputHandler != 0) {
+    this->writeEnvelope();
+    theOutputHandler->endTag(); // Data
+    delete theOutputHandler;
+  }
+
+  if (theResponses != 0) {
+    for (int i = 0; i < numEle; i++)
+      if (theResponses[i] != 0)
+	delete theResponses[i];
+    delete [] theResponses;
+  }
+
+  for (int i=0; i<numArgs; i++)
+    delete [] responseArgs[i];
+  if (responseArgs != 0)
+    delete [] responseArgs;
+}
+
+int 
+EnvelopeElementRecorder::record(int commitTag, double timeStamp)
+{
+  if (initializationDone == false) {
+    if (this->initialize() != 0) {
+      opserr << "EnvelopeElementRecorder::record() - failed to initialize\n";
+      return -1;
+    }
+  }
+
+  // rows outside the time window or before the trigger are not recorded
+  if (this->isRecording(timeStamp) == false)
+    return 0;
+
+  // the tolerance keeps round-off in the accumulated time from skipping a record
+  if (deltaT != 0.0 && timeStamp - nextTimeStampToRecord < -deltaT * 1.0e-5)
+    return 0;
+
+  if (deltaT != 0.0) 
+    nextTimeStampToRecord = timeStamp + deltaT;
+
+  int result = 0;
+  int loc = 0;
+  for (int i=0; i<numEle; i++) {
+    if (theResponses[i] == 0)
+      continue;
+
+    int res;
+    if ((res = theResponses[i]->getResponse()) < 0) {
+      result += res;
+      // keep the columns of this element where they are
+      loc += theResponses[i]->getInformation().getData().Size();
+    } else {
+      const Vector &eleData = theResponses[i]->getInformation().getData();
+      for (int j=0; j<eleData.Size(); j++)
+	currentData(loc++) = eleData(j);
+    }
+  }
+
+  // update the min, max and abs max and the times they occurred
+  int size = currentData.Size();
+  for (int i=0; i<size; i++) {
+    double value = currentData(i);
+    if (first == true || value < data(0, i)) {
+      data(0, i) = value;
+      if (echoTimeFlag == true)
+	data(3, i) = timeStamp;
+    }
+    if (first == true || value > data(1, i)) {
+      data(1, i) = value;
+      if (echoTimeFlag == true)
+	data(4, i) = timeStamp;
+    }
+    if (first == true || fabs(value) > data(2, i)) {
+      data(2, i) = fabs(value);
+      if (echoTimeFlag == true)
+	data(5, i) = timeStamp;
+    }
+  }
+  first = false;
+
+  return result;
+}
+
+int
+EnvelopeElementRecorder::restart(void)
+{
+  data.Zero();
+  first = true;
+  return 0;
+}
+
+int
+EnvelopeElementRecorder::writeEnvelope(void)
+{
+  if (initializationDone == false || first == true)
+    return 0;
+
+  int numCols = data.noCols();
+  Vector row(numCols);
+  for (int i=0; i<data.noRows(); i++) {
+    for (int j=0; j<numCols; j++)
+      row(j) = data(i, j);
+    theOutputHandler->write(row);
+  }
+
+  return 0;
+}
+
+int 
+EnvelopeElementRecorder::setDomain(Domain &theDom)
+{
+  theDomain = &theDom;
+  return 0;
+}
+
+int
+EnvelopeElementRecorder::sendSelf(int commitTag, Channel &theChannel)
+{
+  return 0;
+}
+
+int 
+EnvelopeElementRecorder::recvSelf(int commitTag, Channel &theChannel, 
+				  FEM_ObjectBroker &theBroker)
+{
+  return 0;
+}
+
+int 
+EnvelopeElementRecorder::initialize(void)
+{
+  if (theDomain == 0)
+    return -1;
+
+  if (theResponses != 0) {
+    for (int i = 0; i < numEle; i++)
+      if (theResponses[i] != 0)
+	delete theResponses[i];
+    delete [] theResponses;
+  }
+
+  // the elements describe their columns in setResponse()
+  theResponses = new Response *[numEle];
+  int size = 0;
+  for (int i=0; i<numEle; i++) {
+    theResponses[i] = 0;
+    Element *theEle = theDomain->getElement(eleID(i));
+    if (theEle != 0) {
+      theResponses[i] = theEle->setResponse((const char **)responseArgs, numArgs, *theOutputHandler);
+      if (theResponses[i] != 0)
+	size += theResponses[i]->getInformation().getData().Size();
+    }
+  }
+
+  if (size == 0) {
+    opserr << "EnvelopeElementRecorder::initialize() - no element responses\n";
+    return -1;
+  }
+
+  currentData.resize(size);
+  currentData.Zero();
+  data.resize(echoTimeFlag ? 6 : 3, size);
+  data.Zero();
+  first = true;
+
+  theOutputHandler->tag("Data");
+  initializationDone = true;
+
+  return 0;
+}
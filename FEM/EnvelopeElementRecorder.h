@@ -0,0 +1,94 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/recorder/EnvelopeElementRecorder.h
+//
+// Written: fmk
+//
+// Description: This file contains the class definition for
+// EnvelopeElementRecorder. An EnvelopeElementRecorder keeps the running
+// min, max and absolute max of a response of a collection of elements in
+// memory and writes them, as three rows with the columns of an
+// ElementRecorder without time, when it is destroyed. If the time is
+// echoed three more rows hold the times at which they occurred.
+//
+// What: "@(#) EnvelopeElementRecorder.h, revA"
+
+#ifndef EnvelopeElementRecorder_h
+#define EnvelopeElementRecorder_h
+
+#include <Recorder.h>
+#include <ID.h>
+#include <Vector.h>
+#include <Matrix.h>
+
+class Domain;
+class Response;
+
+class EnvelopeElementRecorder: public Recorder
+{
+  public:
+    EnvelopeElementRecorder();
+    EnvelopeElementRecorder(const ID &eleID, 
+			    const char **argv, 
+			    int argc,
+			    Domain &theDomain, 
+			    OPS_Stream &theOutputHandler,
+			    double deltaT = 0.0,
+			    bool echoTimeFlag = true);
+
+    ~EnvelopeElementRecorder();
+
+    int record(int commitTag, double timeStamp);
+    int restart(void);    
+
+    int setDomain(Domain &theDomain);
+    int sendSelf(int commitTag, Channel &theChannel);  
+    int recvSelf(int commitTag, Channel &theChannel, 
+		 FEM_ObjectBroker &theBroker);
+    
+  protected:
+
+  private:	
+    int initialize(void);
+    int writeEnvelope(void);
+
+    int numEle;
+    ID eleID;
+    Response **theResponses;
+
+    Domain *theDomain;
+    OPS_Stream *theOutputHandler;
+
+    bool echoTimeFlag;
+
+    double deltaT;
+    double nextTimeStampToRecord;
+
+    Vector currentData;
+    Matrix data;         // rows: min, max, abs max and, if echoTimeFlag, their times
+    bool first;
+
+    bool initializationDone;
+    char **responseArgs;
+    int numArgs;
+};
+
+#endif
@@ -0,0 +1,313 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/recorder/EnvelopeNodeRecorder.cpp
+//
+// Written: fmk
+//
+// Description: This file contains the implementation of
+// EnvelopeNodeRecorder.
+//
+// What: "@(#) EnvelopeNodeRecorder.cpp, revA"
+
+#include <EnvelopeNodeRecorder.h>
+#include <Domain.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <TimeSeries.h>
+#include <OPS_Stream.h>
+#include <classTags.h>
+
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+EnvelopeNodeRecorder::EnvelopeNodeRecorder()
+:Recorder(RECORDER_TAGS_EnvelopeNodeRecorder),
+ theDofs(0), theNodalTags(0), theNodes(0), numValidNodes(0),
+ currentData(0), data(), first(true),
+ theDomain(0), theOutputHandler(0),
+ echoTimeFlag(true), dataFlag(0),
+ deltaT(0.0), nextTimeStampToRecord(0.0),
+ initializationDone(false), theTimeSeries(0)
+{
+
+}
+
+EnvelopeNodeRecorder::EnvelopeNodeRecorder(const ID &dofs, 
+					   const ID *nodes, 
+					   const char *dataToStore,
+					   Domain &theDom,
+					   OPS_Stream &theOutputHandler,
+					   double dT,
+					   bool timeFlag,
+					   TimeSeries **theSeries)
+:Recorder(RECORDER_TAGS_EnvelopeNodeRecorder),
+ theDofs(0), theNodalTags(0), theNodes(0), numValidNodes(0),
+ currentData(0), data(), first(true),
+ theDomain(&theDom), theOutputHandler(&theOutputHandler),
+ echoTimeFlag(timeFlag), dataFlag(0),
+ deltaT(dT), nextTimeStampToRecord(0.0),
+ initializationDone(false), theTimeSeries(theSeries)
+{
+  // store the valid dofs
+  int numDOF = dofs.Size();
+  theDofs = new ID(0, numDOF);
+  int count = 0;
+  for (int i=0; i<numDOF; i++) {
+    if (dofs(i) >= 0)
+      (*theDofs)[count++] = dofs(i);
+    else {
+      opserr << "EnvelopeNodeRecorder::EnvelopeNodeRecorder - invalid dof  " << dofs(i);
+      opserr << " will be ignored\n";
+    }
+  }
+
+  if (nodes != 0)
+    theNodalTags = new ID(*nodes);
+
+  if (dataToStore == 0 || (strcmp(dataToStore, "disp") == 0)) {
+    dataFlag = 0;
+  } else if ((strcmp(dataToStore, "vel") == 0)) {
+    dataFlag = 1;
+  } else if ((strcmp(dataToStore, "accel") == 0)) {
+    dataFlag = 2;
+  } else {
+    dataFlag = 0;
+    opserr << "EnvelopeNodeRecorder::EnvelopeNodeRecorder - dataToStore " << dataToStore;
+    opserr << " not recognized (disp, vel, accel), using disp\n";
+  }
+}
+
+EnvelopeNodeRecorder::~EnvelopeNodeRecorder()
+{
+  if (theOutputHandler != 0) {
+    this->writeEnvelope();
+    theOutputHandler->endTag(); // Data
+    delete theOutputHandler;
+  }
+
+  int numDOF = 0;
+  if (theDofs != 0) {
+    numDOF = theDofs->Size();
+    delete theDofs;
+  }
+
+  if (theNodalTags != 0)
+    delete theNodalTags;
+
+  if (theNodes != 0)
+    delete [] theNodes;
+
+  if (theTimeSeries != 0) {
+    for (int i=0; i<numDOF; i++)
+      if (theTimeSeries[i] != 0)
+	delete theTimeSeries[i];
+    delete [] theTimeSeries;
+  }
+}
+
+int 
+EnvelopeNodeRecorder::record(int commitTag, double timeStamp)
+{
+  if (theDomain == 0 || theDofs == 0)
+    return 0;
+
+  if (theOutputHandler == 0) {
+    opserr << "EnvelopeNodeRecorder::record() - no DataOutputHandler has been set\n";
+    return -1;
+  }
+
+  if (initializationDone == false) {
+    if (this->initialize() != 0) {
+      opserr << "EnvelopeNodeRecorder::record() - failed in initialize()\n";
+      return -1;
+    }
+  }
+
+  // rows outside the time window or before the trigger are not recorded
+  if (this->isRecording(timeStamp) == false)
+    return 0;
+
+  // the tolerance keeps round-off in the accumulated time from skipping a record
+  if (deltaT != 0.0 && timeStamp - nextTimeStampToRecord < -deltaT * 1.0e-5)
+    return 0;
+
+  if (deltaT != 0.0) 
+    nextTimeStampToRecord = timeStamp + deltaT;
+
+  int numDOF = theDofs->Size();
+
+  for (int i=0; i<numValidNodes; i++) {
+    Node *theNode = theNodes[i];
+    const Vector *theResponse;
+    if (dataFlag == 0)
+      theResponse = &theNode->getTrialDisp();
+    else if (dataFlag == 1)
+      theResponse = &theNode->getTrialVel();
+    else
+      theResponse = &theNode->getTrialAccel();
+
+    for (int j=0; j<numDOF; j++) {
+      int dof = (*theDofs)(j);
+      double value = 0.0;
+      if (theResponse->Size() > dof)
+	value = (*theResponse)(dof);
+      if (theTimeSeries != 0 && theTimeSeries[j] != 0)
+	value += theTimeSeries[j]->getFactor(timeStamp);
+      currentData(i*numDOF + j) = value;
+    }
+  }
+
+  // update the min, max and abs max and the times they occurred
+  int size = currentData.Size();
+  for (int i=0; i<size; i++) {
+    double value = currentData(i);
+    if (first == true || value < data(0, i)) {
+      data(0, i) = value;
+      if (echoTimeFlag == true)
+	data(3, i) = timeStamp;
+    }
+    if (first == true || value > data(1, i)) {
+      data(1, i) = value;
+      if (echoTimeFlag == true)
+	data(4, i) = timeStamp;
+    }
+    if (first == true || fabs(value) > data(2, i)) {
+      data(2, i) = fabs(value);
+      if (echoTimeFlag == true)
+	data(5, i) = timeStamp;
+    }
+  }
+  first = false;
+
+  return 0;
+}
+
+int
+EnvelopeNodeRecorder::restart(void)
+{
+  data.Zero();
+  first = true;
+  return 0;
+}
+
+int
+EnvelopeNodeRecorder::writeEnvelope(void)
+{
+  if (initializationDone == false || first == true)
+    return 0;
+
+  int numCols = data.noCols();
+  Vector row(numCols);
+  for (int i=0; i<data.noRows(); i++) {
+    for (int j=0; j<numCols; j++)
+      row(j) = data(i, j);
+    theOutputHandler->write(row);
+  }
+
+  return 0;
+}
+
+int 
+EnvelopeNodeRecorder::domainChanged(void)
+{
+  return 0;
+}
+
+int 
+EnvelopeNodeRecorder::setDomain(Domain &theDom)
+{
+  theDomain = &theDom;
+  return 0;
+}
+
+int 
+EnvelopeNodeRecorder::sendSelf(int commitTag, Channel &theChannel)
+{
+  return 0;
+}
+
+int 
+EnvelopeNodeRecorder::recvSelf(int commitTag, Channel &theChannel, 
+			       FEM_ObjectBroker &theBroker)
+{
+  return 0;
+}
+
+int
+EnvelopeNodeRecorder::initialize(void)
+{
+  if (theDofs == 0 || theDomain == 0) {
+    opserr << "EnvelopeNodeRecorder::initialize() - either nodes, dofs or domain has not been set\n";
+    return -1;
+  }
+
+  if (theNodes != 0)
+    delete [] theNodes;
+  numValidNodes = 0;
+
+  if (theNodalTags != 0) {
+    int numNode = theNodalTags->Size();
+    theNodes = new Node *[numNode];
+    for (int i=0; i<numNode; i++) {
+      Node *theNode = theDomain->getNode((*theNodalTags)(i));
+      if (theNode != 0)
+	theNodes[numValidNodes++] = theNode;
+    }
+  } else {
+    int numNodes = theDomain->getNumNodes();
+    theNodes = new Node *[numNodes];
+    NodeIter &theDomainNodes = theDomain->getNodes();
+    Node *theNode;
+    while (((theNode = theDomainNodes()) != 0) && (numValidNodes < numNodes))
+      theNodes[numValidNodes++] = theNode;
+  }
+
+  int numDOF = theDofs->Size();
+  int size = numValidNodes*numDOF;
+  if (size == 0) {
+    opserr << "EnvelopeNodeRecorder::initialize() - no valid nodes or dofs\n";
+    return -1;
+  }
+  currentData.resize(size);
+  currentData.Zero();
+  data.resize(echoTimeFlag ? 6 : 3, size);
+  data.Zero();
+  first = true;
+
+  // describe the columns
+  const char *dataType = (dataFlag == 0) ? "D" : ((dataFlag == 1) ? "V" : "A");
+  char outputData[32];
+  for (int i=0; i<numValidNodes; i++) {
+    theOutputHandler->tag("NodeOutput");
+    theOutputHandler->attr("nodeTag", theNodes[i]->getTag());
+    for (int k=0; k<numDOF; k++) {
+      sprintf(outputData, "%s%d", dataType, k+1);
+      theOutputHandler->tag("ResponseType", outputData);
+    }
+    theOutputHandler->endTag();
+  }
+
+  theOutputHandler->tag("Data");
+  initializationDone = true;
+
+  return 0;
+}
@@ -0,0 +1,99 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/recorder/EnvelopeNodeRecorder.h
+//
+// Written: fmk
+//
+// Description: This file contains the class definition for
+// EnvelopeNodeRecorder. An EnvelopeNodeRecorder keeps the running min, max
+// and absolute max of the specified dof responses at a collection of nodes
+// in memory and writes them, as three rows with the columns of a
+// NodeRecorder without time, when it is destroyed. If the time is echoed
+// three more rows hold the times at which they occurred.
+//
+// What: "@(#) EnvelopeNodeRecorder.h, revA"
+
+#ifndef EnvelopeNodeRecorder_h
+#define EnvelopeNodeRecorder_h
+
+#include <Recorder.h>
+#include <ID.h>
+#include <Vector.h>
+#include <Matrix.h>
+
+class Domain;
+class Node;
+class TimeSeries;
+
+class EnvelopeNodeRecorder: public Recorder
+{
+  public:
+    EnvelopeNodeRecorder();
+    EnvelopeNodeRecorder(const ID &theDof, 
+			 const ID *theNodes, 
+			 const char *dataToStore,
+			 Domain &theDomain,
+			 OPS_Stream &theOutputHandler,
+			 double deltaT = 0.0,
+			 bool echoTimeFlag = true,
+			 TimeSeries **timeSeries = 0); 
+    
+    ~EnvelopeNodeRecorder();
+
+    int record(int commitTag, double timeStamp);
+    int restart(void);
+
+    int domainChanged(void);    
+    int setDomain(Domain &theDomain);
+    int sendSelf(int commitTag, Channel &theChannel);  
+    int recvSelf(int commitTag, Channel &theChannel, 
+		 FEM_ObjectBroker &theBroker);
+
+  protected:
+
+  private:	
+    int initialize(void);
+    int writeEnvelope(void);
+
+    ID *theDofs;
+    ID *theNodalTags;
+    Node **theNodes;
+    int numValidNodes;
+
+    Vector currentData;
+    Matrix data;         // rows: min, max, abs max and, if echoTimeFlag, their times
+    bool first;
+
+    Domain *theDomain;
+    OPS_Stream *theOutputHandler;
+
+    bool echoTimeFlag;
+    int dataFlag;        // 0 disp, 1 vel, 2 accel
+
+    double deltaT;
+    double nextTimeStampToRecord;
+
+    bool initializationDone;
+
+    TimeSeries **theTimeSeries;
+};
+
+#endif
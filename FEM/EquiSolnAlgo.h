@@ -67,6 +67,10 @@ class EquiSolnAlgo: public SolutionAlgorithm
 
     virtual void Print(OPS_Stream &s, int flag =0) =0;    
 
+    // the integrator has new coefficients (e.g. a new dt), a tangent kept
+    // from an earlier step is no longer the tangent of the system
+    virtual void integratorChanged(void) {}
+
     virtual int getNumFactorizations(void) {return 0;}
     virtual int getNumIterations(void) {return 0;}
     virtual double getTotalTimeCPU(void)   {return 0.0;}
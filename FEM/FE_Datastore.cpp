@@ -40,7 +40,7 @@
 #include <OPS_Globals.h>
 #include <ID.h>
 
-int FE_Datastore::lastDbTag(0);
+thread_local int FE_Datastore::lastDbTag(0);
 
 // FE_Datastore(int tag, int noExtNodes);
 // 	constructor that takes the FE_Datastore's unique tag and the number
@@ -191,3 +191,9 @@ FE_Datastore::getDbTag(void)
   lastDbTag++;
   return lastDbTag;
 }
+
+FEM_ObjectBroker *
+FE_Datastore::getObjectBroker(void)
+{
+  return theObjectBroker;
+}
@@ -86,7 +86,7 @@ class FE_Datastore: public Channel
   private:
     FEM_ObjectBroker *theObjectBroker;
     Domain *theDomain;
-    static int lastDbTag;
+    static thread_local int lastDbTag;
 
 };
 
@@ -93,6 +93,10 @@ class FE_Element: public TaggedObject
     virtual const Vector &getLastResponse(void);
     Element *getElement(void);
 
+    // true if getTangent() and getResidual() may be invoked from a thread
+    // other than the one that created the object
+    virtual bool isThreadSafe(void) const {return true;};
+
     virtual void  Print(OPS_Stream&, int = 0) {return;};
 
     // AddingSensitivity:BEGIN ////////////////////////////////////
@@ -126,9 +130,6 @@ class FE_Element: public TaggedObject
     // static variables - single copy for all objects of the class	
     static Matrix errMatrix;
     static Vector errVector;
-    static Matrix **theMatrices; // array of pointers to class wide matrices
-    static Vector **theVectors;  // array of pointers to class widde vectors
-    static int numFEs;           // number of objects
     
 
 };
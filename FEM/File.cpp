@@ -95,7 +95,7 @@ File::addFile(File *theFile)
 int
 File::addFile(const char *fileName, const char *path, const char *fileDescription)
 {
-  static char dirName[128];
+  static thread_local char dirName[128];
   
   char *combined = 0;     // combined array of path + fileName
   const char *combinedFile = 0; // pointer into combined where file is
@@ -520,7 +520,7 @@ FileStream::operator<<(float n)
 int 
 FileStream::sendSelf(int commitTag, Channel &theChannel)
 {
-  static ID idData(2);
+  static thread_local ID idData(2);
   int fileNameLength = 0;
   if (fileName != 0)
     fileNameLength = strlen(fileName);
@@ -553,7 +553,7 @@ FileStream::sendSelf(int commitTag, Channel &theChannel)
 int 
 FileStream::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
-  static ID idData(2);
+  static thread_local ID idData(2);
 
   if (theChannel.recvID(0, commitTag, idData) < 0) {
     opserr << "FileStream::recvSelf() - failed to recv id data\n";
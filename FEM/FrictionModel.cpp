@@ -34,7 +34,7 @@
 #include <TaggedObject.h>
 #include <MapOfTaggedObjects.h>
 
-static MapOfTaggedObjects theFrictionModelObjects;
+static thread_local MapOfTaggedObjects theFrictionModelObjects;
 
 
 bool OPS_addFrictionModel(FrictionModel *newComponent)
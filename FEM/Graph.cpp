@@ -335,7 +335,7 @@ Graph::sendSelf(int commitTag, Channel &theChannel)
   int numVertex = this->getNumVertex();
 
   // send numEdge & the number of vertices
-  static ID idData(2);
+  static thread_local ID idData(2);
   idData(0) = numEdge;
   idData(1) = numVertex;
 
@@ -417,7 +417,7 @@ Graph::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
   }
 
   // recv numEdge & numVertices
-  static ID idData(2);
+  static thread_local ID idData(2);
   if (theChannel.recvID(0, commitTag, idData) < 0) {
     opserr << "Graph::recvSelf() - failed to receive the id\n";
     return -3;
@@ -30,6 +30,11 @@
 #include <GroundMotion.h>
 #include <TimeSeriesIntegrator.h>
 #include <TrapezoidalTimeSeriesIntegrator.h>
+#include <PathTimeSeries.h>
+#include <GroundMotionSeries.h>
+#include <Matrix.h>
+#include <classTags.h>
+#include <math.h>
 #include <OPS_Globals.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
@@ -85,7 +90,8 @@ GroundMotion::GroundMotion(TimeSeries *dispSeries,
 :MovableObject(GROUND_MOTION_TAG_GroundMotion), 
  theAccelSeries(accelSeries), theVelSeries(velSeries), 
  theDispSeries(dispSeries), theIntegrator(theIntegratr),
- data(3), delta(dTintegration), fact(factor)
+ data(3), delta(dTintegration), fact(factor), pathSeries(-1),
+ theMotion(0), motionDt(0.0), numMotionPoints(0), useLast(false)
 {
 
   if (theAccelSeries != 0 && theVelSeries == 0 ) 
@@ -100,7 +106,8 @@ GroundMotion::GroundMotion(TimeSeries *dispSeries,
 GroundMotion::GroundMotion(int theClassTag)
 :MovableObject(theClassTag), 
  theAccelSeries(0), theVelSeries(0), theDispSeries(0), theIntegrator(0),
- data(3), delta(0.0), fact(1.0)
+ data(3), delta(0.0), fact(1.0), pathSeries(-1),
+ theMotion(0), motionDt(0.0), numMotionPoints(0), useLast(false)
 {
 
 }
@@ -115,6 +122,8 @@ GroundMotion::~GroundMotion()
     delete theDispSeries;
   if (theIntegrator != 0)
     delete theIntegrator;
+  if (theMotion != 0)
+    delete theMotion;
 }
 
 
@@ -228,6 +237,10 @@ GroundMotion::getAccel(double time)
 {
   if (time < 0.0)
     return 0.0;
+
+  double factors[3];
+  if (theMotion != 0 && this->getPrecomputed(time, factors) == 0)
+    return fact*factors[0];
   
   if (theAccelSeries != 0)
     return fact*(theAccelSeries->getFactor(time));
@@ -252,6 +265,10 @@ GroundMotion::getVel(double time)
 {
   if (time < 0.0)
     return 0.0;
+
+  double factors[3];
+  if (theMotion != 0 && this->getPrecomputed(time, factors) == 0)
+    return fact*factors[1];
   
   if (theVelSeries != 0)
     return fact*(theVelSeries->getFactor(time));      
@@ -279,6 +296,10 @@ GroundMotion::getDisp(double time)
   if (time < 0.0)
     return 0.0;
 
+  double factors[3];
+  if (theMotion != 0 && this->getPrecomputed(time, factors) == 0)
+    return fact*factors[2];
+
   if (theDispSeries != 0)
     return fact*(theDispSeries->getFactor(time));
 
@@ -319,10 +340,12 @@ GroundMotion::getDispVelAccel(double time)
     return data;
   }
 
-  if (theAccelSeries != 0 && theVelSeries != 0 && theDispSeries != 0) {
-    data(0) = fact*(theDispSeries->getFactor(time));
-    data(1) = fact*(theVelSeries->getFactor(time));
-    data(2) = fact*(theAccelSeries->getFactor(time));
+  if (theMotion != 0 || (theAccelSeries != 0 && theVelSeries != 0 && theDispSeries != 0)) {
+    double factors[3];
+    this->getFactors(time, factors);
+    data(0) = factors[2];
+    data(1) = factors[1];
+    data(2) = factors[0];
   } else {
     data(2) = this->getAccel(time);
     data(1) = this->getVel(time);
@@ -333,13 +356,229 @@ GroundMotion::getDispVelAccel(double time)
 }
 
 
+// the acceleration, velocity and displacement at time in factors[0..2].
+// If the three are PathTimeSeries at the same time points the interval
+// holding the time is searched for once.
+int
+GroundMotion::getFactors(double time, double *factors)
+{
+  if (time < 0.0) {
+    factors[0] = 0.0;
+    factors[1] = 0.0;
+    factors[2] = 0.0;
+    return 0;
+  }
+
+  if (theMotion != 0 && this->getPrecomputed(time, factors) == 0) {
+    factors[0] *= fact;
+    factors[1] *= fact;
+    factors[2] *= fact;
+    return 0;
+  }
+
+  if (pathSeries < 0 && theAccelSeries != 0 && theVelSeries != 0 && theDispSeries != 0) {
+    pathSeries = 0;
+    if (theAccelSeries->getClassTag() == TSERIES_TAG_PathTimeSeries &&
+	theVelSeries->getClassTag() == TSERIES_TAG_PathTimeSeries &&
+	theDispSeries->getClassTag() == TSERIES_TAG_PathTimeSeries) {
+      PathTimeSeries *theAccel = (PathTimeSeries *)theAccelSeries;
+      if (theAccel->hasSameTime(*(PathTimeSeries *)theVelSeries) &&
+	  theAccel->hasSameTime(*(PathTimeSeries *)theDispSeries))
+	pathSeries = 1;
+    }
+  }
+
+  if (pathSeries == 1) {
+    double dTime, dTimeInterval;
+    int loc = ((PathTimeSeries *)theAccelSeries)->getInterval(time, dTime, dTimeInterval);
+    if (loc < 0) {
+      factors[0] = 0.0;
+      factors[1] = 0.0;
+      factors[2] = 0.0;
+    } else {
+      factors[0] = fact*((PathTimeSeries *)theAccelSeries)->getFactor(loc, dTime, dTimeInterval);
+      factors[1] = fact*((PathTimeSeries *)theVelSeries)->getFactor(loc, dTime, dTimeInterval);
+      factors[2] = fact*((PathTimeSeries *)theDispSeries)->getFactor(loc, dTime, dTimeInterval);
+    }
+    return 0;
+  }
+
+  factors[0] = this->getAccel(time);
+  factors[1] = this->getVel(time);
+  factors[2] = this->getDisp(time);
+  return 0;
+}
+
+int
+GroundMotion::precompute(double dt, int baselineOrder, double padTime, double taperTime,
+			 bool last)
+{
+  // the motion is given by the acceleration or else by the velocity
+  TimeSeries *theSeries = (theAccelSeries != 0) ? theAccelSeries : theVelSeries;
+  if (theSeries == 0 || dt <= 0.0) {
+    opserr << "WARNING GroundMotion::precompute() - no acceleration or velocity series\n";
+    return -1;
+  }
+
+  double duration = theSeries->getDuration();
+  int numRecord = (int)(duration/dt + 0.5) + 1;
+  int numPoints = numRecord + (int)(padTime/dt + 0.5);
+  if (numRecord < 2) {
+    opserr << "WARNING GroundMotion::precompute() - the motion is shorter than dt\n";
+    return -1;
+  }
+
+  Vector *motion = new Vector(3*numPoints);
+  Vector &m = *motion;
+  int numTaper = (int)(taperTime/dt + 0.5);
+  if (2*numTaper > numRecord)
+    numTaper = numRecord/2;
+
+  // sample the record with a cosine taper at both ends, zero in the padding
+  int given = (theAccelSeries != 0) ? 0 : 1;
+  for (int i=0; i<numRecord; i++) {
+    double taper = 1.0;
+    if (i < numTaper)
+      taper = 0.5*(1.0 - cos(M_PI*i/numTaper));
+    else if (i > numRecord-1-numTaper)
+      taper = 0.5*(1.0 - cos(M_PI*(numRecord-1-i)/numTaper));
+    m(3*i+given) = taper*theSeries->getFactor(i*dt);
+  }
+
+  if (given == 0) {
+    // trapezoidal integration of the acceleration
+    for (int i=1; i<numPoints; i++)
+      m(3*i+1) = m(3*i-2) + 0.5*dt*(m(3*i-3) + m(3*i));
+  } else {
+    // central differences of the velocity
+    for (int i=0; i<numPoints; i++) {
+      int im1 = (i > 0) ? i-1 : 0;
+      int ip1 = (i < numPoints-1) ? i+1 : numPoints-1;
+      m(3*i) = (m(3*ip1+1) - m(3*im1+1))/((ip1-im1)*dt);
+    }
+  }
+  for (int i=1; i<numPoints; i++)
+    m(3*i+2) = m(3*i-1) + 0.5*dt*(m(3*i-2) + m(3*i+1));
+
+  // remove the least squares polynomial fit to the displacement, in the
+  // time scaled by the duration, and its derivatives
+  if (baselineOrder >= 0) {
+    int n = baselineOrder+1;
+    double T = (numPoints-1)*dt;
+    Matrix A(n, n);
+    Vector b(n), c(n), tau(2*n);
+    for (int i=0; i<numPoints; i++) {
+      tau(0) = 1.0;
+      for (int k=1; k<2*n; k++)
+	tau(k) = tau(k-1)*i*dt/T;
+      for (int j=0; j<n; j++) {
+	b(j) += tau(j)*m(3*i+2);
+	for (int k=0; k<n; k++)
+	  A(j,k) += tau(j+k);
+      }
+    }
+    if (A.Solve(b, c) < 0) {
+      opserr << "WARNING GroundMotion::precompute() - baseline fit failed\n";
+      delete motion;
+      return -1;
+    }
+    for (int i=0; i<numPoints; i++) {
+      double t = i*dt/T;
+      double p = 0.0, dp = 0.0, ddp = 0.0;
+      for (int k=n-1; k>=0; k--) {
+	ddp = ddp*t + 2.0*dp;
+	dp = dp*t + p;
+	p = p*t + c(k);
+      }
+      m(3*i) -= ddp/(T*T);
+      m(3*i+1) -= dp/T;
+      m(3*i+2) -= p;
+    }
+  }
+
+  if (theMotion != 0)
+    delete theMotion;
+  theMotion = motion;
+  motionDt = dt;
+  numMotionPoints = numPoints;
+  useLast = last;
+
+  return 0;
+}
+
+int
+GroundMotion::getPrecomputed(double time, double *factors)
+{
+  if (theMotion == 0)
+    return -1;
+
+  // linear between the points, after the end zero or the last point
+  double x = time/motionDt;
+  int i = (int)x;
+  if (time < 0.0) {
+    factors[0] = 0.0;
+    factors[1] = 0.0;
+    factors[2] = 0.0;
+    return 0;
+  }
+
+  const Vector &m = *theMotion;
+  if (i >= numMotionPoints-1) {
+    i = numMotionPoints-1;
+    if (x > i && useLast == false) {
+      factors[0] = 0.0;
+      factors[1] = 0.0;
+      factors[2] = 0.0;
+      return 0;
+    }
+    factors[0] = m(3*i);
+    factors[1] = m(3*i+1);
+    factors[2] = m(3*i+2);
+    return 0;
+  }
+
+  double w = x - i;
+  factors[0] = m(3*i) + w*(m(3*i+3) - m(3*i));
+  factors[1] = m(3*i+1) + w*(m(3*i+4) - m(3*i+1));
+  factors[2] = m(3*i+2) + w*(m(3*i+5) - m(3*i+2));
+  return 0;
+}
+
+double
+GroundMotion::getPrecomputedDuration(void)
+{
+  return (numMotionPoints-1)*motionDt;
+}
+
+double
+GroundMotion::getPrecomputedPeak(int component)
+{
+  double peak = 0.0;
+  for (int i=0; i<numMotionPoints; i++)
+    if (fabs((*theMotion)(3*i+component)) > peak)
+      peak = fabs((*theMotion)(3*i+component));
+
+  return peak;
+}
+
+TimeSeries *
+GroundMotion::getPrecomputedSeries(int component)
+{
+  if (theMotion == 0 || component < 0 || component > 2) {
+    opserr << "WARNING GroundMotion::getPrecomputedSeries() - no precomputed motion\n";
+    return 0;
+  }
+
+  return new GroundMotionSeries(component+1, *this, component, fact);
+}
+
 int 
 GroundMotion::sendSelf(int commitTag, Channel &theChannel)
 {
   int dbTag = this->getDbTag();
 
-  static ID idData(8);
-  static Vector data(2);
+  static thread_local ID idData(8);
+  static thread_local Vector data(2);
   
   if (theAccelSeries != 0) {
     idData(0) = theAccelSeries->getClassTag();
@@ -438,8 +677,8 @@ GroundMotion::recvSelf(int commitTag, Channel &theChannel,
 {
 	  int dbTag = this->getDbTag();
 
-  static ID idData(8);
-  static Vector data(2);
+  static thread_local ID idData(8);
+  static thread_local Vector data(2);
   int res = theChannel.recvID(dbTag, commitTag, idData);
   res += theChannel.recvVector(dbTag, commitTag, data);
   if (res < 0) {
@@ -447,6 +686,8 @@ GroundMotion::recvSelf(int commitTag, Channel &theChannel,
     return res;
   }
 
+  pathSeries = -1;
+
   int seriesClassTag = idData(0);
   if (seriesClassTag != -1) {
     int seriesDbTag = idData(1);
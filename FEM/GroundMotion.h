@@ -66,6 +66,22 @@ class GroundMotion : public MovableObject
     virtual double getVel(double time);
     virtual double getDisp(double time);
     virtual const  Vector &getDispVelAccel(double time);
+    int getFactors(double time, double *factors);
+
+    // integrates the motion once on a grid of spacing dt into one array of
+    // (accel, vel, disp) triples, read by the get methods from then on.
+    // The record is tapered over taperTime at both ends and padded with
+    // padTime of zero motion; if baselineOrder >= 0 a polynomial of that
+    // order fitted to the displacement is removed from the three. After the
+    // end the motion is zero, or its last values if useLast is true (as for
+    // PathTimeSeries).
+    int precompute(double dt, int baselineOrder = -1, double padTime = 0.0, double taperTime = 0.0,
+		   bool useLast = false);
+    int getPrecomputed(double time, double *factors);
+    double getPrecomputedDuration(void);
+    double getPrecomputedTimeStep(void) {return motionDt;}
+    double getPrecomputedPeak(int component);
+    TimeSeries *getPrecomputedSeries(int component);
     
     void setIntegrator(TimeSeriesIntegrator *integrator);
     TimeSeries *integrate(TimeSeries *theSeries, double delta = 0.01); 
@@ -94,6 +110,13 @@ class GroundMotion : public MovableObject
     Vector data;
     double delta;
     double fact;
+    int pathSeries;              // 1 if the three series are PathTimeSeries with the
+                                 // same time points, 0 if not, -1 if not checked
+
+    Vector *theMotion;           // precomputed accel, vel and disp at i*motionDt
+    double motionDt;
+    int numMotionPoints;
+    bool useLast;
 };
 
 #endif
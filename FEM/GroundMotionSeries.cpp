@@ -0,0 +1,98 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/domain/pattern/GroundMotionSeries.cpp
+//
+// Written: fmk
+//
+// Description: This file contains the implementation of
+// GroundMotionSeries.
+//
+// What: "@(#) GroundMotionSeries.cpp, revA"
+
+#include <GroundMotionSeries.h>
+#include <GroundMotion.h>
+#include <classTags.h>
+
+GroundMotionSeries::GroundMotionSeries(int tag, GroundMotion &motion, int comp, double factor)
+  :TimeSeries(tag, TSERIES_TAG_GroundMotionSeries),
+   theMotion(motion), component(comp), cFactor(factor)
+{
+
+}
+
+GroundMotionSeries::~GroundMotionSeries()
+{
+
+}
+
+TimeSeries *
+GroundMotionSeries::getCopy(void)
+{
+  return new GroundMotionSeries(this->getTag(), theMotion, component, cFactor);
+}
+
+double
+GroundMotionSeries::getFactor(double pseudoTime)
+{
+  double factors[3];
+  if (theMotion.getPrecomputed(pseudoTime, factors) != 0)
+    return 0.0;
+
+  return cFactor*factors[component];
+}
+
+double
+GroundMotionSeries::getDuration()
+{
+  return theMotion.getPrecomputedDuration();
+}
+
+double
+GroundMotionSeries::getPeakFactor()
+{
+  return cFactor*theMotion.getPrecomputedPeak(component);
+}
+
+double
+GroundMotionSeries::getTimeIncr(double pseudoTime)
+{
+  return theMotion.getPrecomputedTimeStep();
+}
+
+int
+GroundMotionSeries::sendSelf(int commitTag, Channel &theChannel)
+{
+  return -1;
+}
+
+int
+GroundMotionSeries::recvSelf(int commitTag, Channel &theChannel, 
+			     FEM_ObjectBroker &theBroker)
+{
+  return -1;
+}
+
+void
+GroundMotionSeries::Print(OPS_Stream &s, int flag)
+{
+  s << "GroundMotion Series: component: " << component;
+  s << " constant factor: " << cFactor << endln;
+}
@@ -0,0 +1,67 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/domain/pattern/GroundMotionSeries.h
+//
+// Written: fmk
+//
+// Description: This file contains the class definition for
+// GroundMotionSeries. A GroundMotionSeries is a TimeSeries giving one
+// component (0 acceleration, 1 velocity, 2 displacement) of the motion a
+// GroundMotion has precomputed, see GroundMotion::precompute(). The
+// GroundMotion has to exist as long as the series.
+//
+// What: "@(#) GroundMotionSeries.h, revA"
+
+#ifndef GroundMotionSeries_h
+#define GroundMotionSeries_h
+
+#include <TimeSeries.h>
+
+class GroundMotion;
+
+class GroundMotionSeries : public TimeSeries
+{
+  public:
+    GroundMotionSeries(int tag, GroundMotion &theMotion, int component, double cFactor = 1.0);
+    ~GroundMotionSeries();
+
+    TimeSeries *getCopy(void);
+
+    double getFactor(double pseudoTime);
+    double getDuration();
+    double getPeakFactor();
+    double getTimeIncr(double pseudoTime);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, 
+		 FEM_ObjectBroker &theBroker);
+
+    void Print(OPS_Stream &s, int flag =0);    
+
+  protected:
+    
+  private:
+    GroundMotion &theMotion;
+    int component;
+    double cFactor;
+};
+
+#endif
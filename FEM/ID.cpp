@@ -166,6 +166,31 @@ ID::ID(const ID &other)
 
 
 
+// ID(ID &&):
+//	Constructor taking over the data of a temporary ID, the data is
+//	copied if the other ID does not own it.
+
+ID::ID(ID &&other)
+  :sz(other.sz), data(other.data), arraySize(other.arraySize), fromFree(0)
+{
+  if (other.fromFree == 0) {
+    other.sz = 0;
+    other.data = 0;
+    other.arraySize = 0;
+    return;
+  }
+
+  data = new (nothrow) int[arraySize]; 
+  if (data == 0) {
+    opserr << "ID::ID(ID &&): ran out of memory with arraySize " << arraySize << endln,
+    exit(-1);
+  }
+
+  for (int i=0; i<sz; i++)
+    data[i] = other.data[i];
+}
+
+
 // ~ID():
 // 	destructor, deletes the [] data
 
@@ -459,6 +484,25 @@ ID::operator=(const ID &V)
 }
 
 
+// ID &operator=(ID &&V):
+//	The data of V and this are swapped if both own their data, otherwise
+//	the data of V is copied.
+
+ID &
+ID::operator=(ID &&V) 
+{
+    if (this != &V && fromFree == 0 && V.fromFree == 0) {
+	int tmpSz = sz, tmpArraySize = arraySize;
+	int *tmpData = data;
+	sz = V.sz; arraySize = V.arraySize; data = V.data;
+	V.sz = tmpSz; V.arraySize = tmpArraySize; V.data = tmpData;
+	return *this;
+    }
+
+    return *this = static_cast<const ID &>(V);
+}
+
+
 // ID operator==(const ID &V):
 //	The == operator checks the two IDs are of the same size.
 // 	Then returns 1 if all the components of the two IDs are equal and 0 otherwise.
@@ -48,6 +48,7 @@ class ID
     ID(int size, int arraySize);
     ID(int *data, int size, bool cleanIt = false);
     ID(const ID &);    
+    ID(ID &&);
     ~ID();
  
     // utility methods
@@ -62,6 +63,7 @@ class ID
     int &operator[](int);    	    
     
     ID &operator=(const ID  &V);
+    ID &operator=(ID &&V);
 
     int operator==(const ID &V) const;
     int operator==(int) const;
@@ -85,6 +87,7 @@ class ID
     friend class MPI_Channel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
+    friend class BinaryFileDatastore;
     
   private:
     static int ID_NOT_VALID_ENTRY;
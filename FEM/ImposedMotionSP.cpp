@@ -162,7 +162,7 @@ ImposedMotionSP::sendSelf(int cTag, Channel &theChannel)
     return -1;
   }
   
-  static ID myExtraData(2);
+  static thread_local ID myExtraData(2);
   myExtraData(0) = groundMotionTag;
   myExtraData(1) = patternTag;
   if (theChannel.sendID(dbTag, cTag, myExtraData) < 0) {
@@ -185,7 +185,7 @@ ImposedMotionSP::recvSelf(int cTag, Channel &theChannel,
     return -1;
   }
   
-  static ID myExtraData(2);
+  static thread_local ID myExtraData(2);
   if (theChannel.recvID(dbTag, cTag, myExtraData) < 0) {
     opserr << "ImposedMotionSP::sendSelf() - failed to send extra data\n";
     return -1;
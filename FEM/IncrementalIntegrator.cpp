@@ -39,6 +39,7 @@
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
 #include <EigenSOE.h>
+#include <OPS_Globals.h>
 #include <cmath>
 
 IncrementalIntegrator::IncrementalIntegrator(int clasTag)
@@ -96,18 +97,9 @@ IncrementalIntegrator::formTangent(int statFlag)
     // zero the A matrix of the linearSOE
     theSOE->zeroA();
 
-    // the loops to form and add the tangents are broken into two for 
-    // efficiency when performing parallel computations - CHANGE
-
     // loop through the FE_Elements adding their contributions to the tangent
-    FE_Element *elePtr;
-    FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
-    while((elePtr = theEles2()) != 0)     
-	if (theSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0) {
-	    opserr << "WARNING IncrementalIntegrator::formTangent -";
-	    opserr << " failed in addA for ID " << elePtr->getID();	    
-	    result = -3;
-	}
+    if (this->formElementTangent() < 0)
+	result = -3;
 
     return result;
 }
@@ -258,6 +250,9 @@ IncrementalIntegrator::formNodalUnbalance(void)
 int 
 IncrementalIntegrator::formElementResidual(void)
 {
+#ifdef _OPENMP
+    return this->formColouredElements(false);
+#else
     // loop through the FE_Elements and add the residual
     FE_Element *elePtr;
 
@@ -274,7 +269,110 @@ IncrementalIntegrator::formElementResidual(void)
     }
 
     return res;	    
+#endif
+}
+
+int 
+IncrementalIntegrator::formElementTangent(void)
+{
+#ifdef _OPENMP
+    return this->formColouredElements(true);
+#else
+    // loop through the FE_Elements and add the tangent
+    FE_Element *elePtr;
+
+    int res = 0;    
+
+    FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
+    while((elePtr = theEles2()) != 0) {
+
+	if (theSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0) {
+	    opserr << "WARNING IncrementalIntegrator::formElementTangent -";
+	    opserr << " failed in addA for ID " << elePtr->getID();	    
+	    res = -2;
+	}
+    }
+
+    return res;	    
+#endif
+}
+
+#ifdef _OPENMP
+// int formColouredElements(bool tangent);
+//	Forms and adds the tangent (or the residual) of the FE_Elements a
+//	colour of the AnalysisModel at a time. The FE_Elements of a colour
+//	share no equations, so they are formed on several threads and each
+//	adds its contribution to its own locations in the SOE. The additions
+//	to any one location are made in the order of the colours, so the
+//	result does not depend on the number of threads.
+
+int
+IncrementalIntegrator::formColouredElements(bool tangent)
+{
+    int numColours = theAnalysisModel->getNumFE_Colours();
+    if (numColours < 0) {
+	opserr << "WARNING IncrementalIntegrator::formColouredElements -";
+	opserr << " failed to colour the FE_Elements\n";
+	return -1;
+    }
+
+    // the globals are thread local, each thread gets those of this one
+    OPS_Stream *theErr = opserrPtr;
+    Domain *theDomain = ops_TheActiveDomain;
+    double theDt = ops_Dt;
+    bool initialState = ops_InitialStateAnalysis;
+
+    int numFailed = 0;
+
+#pragma omp parallel reduction(+:numFailed)
+    {
+	opserrPtr = theErr;
+	ops_TheActiveDomain = theDomain;
+	ops_Dt = theDt;
+	ops_InitialStateAnalysis = initialState;
+
+	for (int c=0; c<numColours; c++) {
+	    FE_Element **theFEs;
+	    bool threadSafe;
+	    int numFEs = theAnalysisModel->getFE_Colour(c, theFEs, threadSafe);
+
+	    if (threadSafe == true) {
+#pragma omp for schedule(dynamic, 8)
+		for (int i=0; i<numFEs; i++)
+		    numFailed += this->addElementContribution(theFEs[i], tangent);
+	    } else {
+		// these are done by the thread that created them
+#pragma omp master
+		for (int i=0; i<numFEs; i++)
+		    numFailed += this->addElementContribution(theFEs[i], tangent);
+#pragma omp barrier
+	    }
+	}
+    }
+
+    return (numFailed == 0) ? 0 : -2;
+}
+
+int
+IncrementalIntegrator::addElementContribution(FE_Element *elePtr, bool tangent)
+{
+    if (tangent == true) {
+	if (theSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0) {
+	    opserr << "WARNING IncrementalIntegrator::formElementTangent -";
+	    opserr << " failed in addA for ID " << elePtr->getID();	    
+	    return 1;
+	}
+    } else {
+	if (theSOE->addB(elePtr->getResidual(this),elePtr->getID()) < 0) {
+	    opserr << "WARNING IncrementalIntegrator::formElementResidual -";
+	    opserr << " failed in addB for ID " << elePtr->getID();
+	    return 1;
+	}
+    }
+
+    return 0;
 }
+#endif
 
 /*
 int
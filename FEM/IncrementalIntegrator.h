@@ -107,6 +107,7 @@ class IncrementalIntegrator : public Integrator
 
     virtual int  formNodalUnbalance(void);        
     virtual int  formElementResidual(void);            
+    virtual int  formElementTangent(void);
     int statusFlag;
 
     //    Vector *modalDampingValues;
@@ -121,6 +122,9 @@ class IncrementalIntegrator : public Integrator
     Vector *tmpV2;
     
   private:
+    int formColouredElements(bool tangent);
+    int addElementContribution(FE_Element *theEle, bool tangent);
+
     LinearSOE *theSOE;
     AnalysisModel *theAnalysisModel;
     ConvergenceTest *theTest;
@@ -36,9 +36,6 @@
 #include <FEM_ObjectBroker.h>
 #include <elementAPI.h>
 
-//parameters
-
-char  unsigned      J2CyclicBoundingSurface::m_ElastFlag = 1;
 
 
 void* OPS_J2CyclicBoundingSurface()
@@ -82,7 +79,12 @@ void* OPS_J2CyclicBoundingSurface()
 
 //null constructor
 J2CyclicBoundingSurface::J2CyclicBoundingSurface() :
-	NDMaterial()
+	NDMaterial(), m_ElastFlag(1),
+	m_sigma0_n(m_state.committed.sigma0, 6), m_sigma0_np1(m_state.trial.sigma0, 6),
+	m_stress_n(m_state.committed.stress, 6), m_stress_np1(m_state.trial.stress, 6),
+	m_stress_vis_n(m_state.committed.stress_vis, 6), m_stress_vis_n1(m_state.trial.stress_vis, 6),
+	m_strain_n(m_state.committed.strain, 6), m_strain_np1(m_state.trial.strain, 6),
+	m_strainRate_n(m_state.committed.strainRate, 6), m_strainRate_n1(m_state.trial.strainRate, 6)
 {
 
 }
@@ -99,10 +101,13 @@ J2CyclicBoundingSurface::J2CyclicBoundingSurface(int  tag,
 	double chi,
 	double beta)
 	:
-	NDMaterial(tag, ND_TAG_J2CyclicBoundingSurface),
-	m_sigma0_n(6), m_sigma0_np1(6), m_stress_n(6), m_stress_np1(6), m_strain_np1(6), 
-	m_strain_n(6), m_strainRate_n(6), m_strainRate_n1(6), m_Cep(6, 6), m_Ce(6, 6), 
-	m_D(6, 6), m_stress_vis_n(6), m_stress_vis_n1(6)
+	NDMaterial(tag, ND_TAG_J2CyclicBoundingSurface), m_ElastFlag(1),
+	m_sigma0_n(m_state.committed.sigma0, 6), m_sigma0_np1(m_state.trial.sigma0, 6),
+	m_stress_n(m_state.committed.stress, 6), m_stress_np1(m_state.trial.stress, 6),
+	m_stress_vis_n(m_state.committed.stress_vis, 6), m_stress_vis_n1(m_state.trial.stress_vis, 6),
+	m_Cep(6, 6), m_Ce(6, 6), m_D(6, 6),
+	m_strain_n(m_state.committed.strain, 6), m_strain_np1(m_state.trial.strain, 6),
+	m_strainRate_n(m_state.committed.strainRate, 6), m_strainRate_n1(m_state.trial.strainRate, 6)
 {
 	double m_poiss = (3.*K - 2.*G) / 2. / (3. * K + G);
 
@@ -121,9 +126,9 @@ J2CyclicBoundingSurface::J2CyclicBoundingSurface(int  tag,
 	m_h_par = h;
 	m_m_par = m;
 	m_beta = beta;
-	m_kappa_n = m_kappa_inf;
-	m_kappa_np1 = m_kappa_inf;
-	m_psi_n = 2.*m_shear;
+	m_state.committed.kappa = m_kappa_inf;
+	m_state.trial.kappa = m_kappa_inf;
+	m_state.committed.psi = 2.*m_shear;
 	m_chi = chi;
 
 	m_isElast2Plast = false;
@@ -200,14 +205,14 @@ void J2CyclicBoundingSurface::plastic_integrator()
 	double norm_dev_stress_n   = sqrt(inner_product(dev_stress_n, dev_stress_n, 1));
 	double norm_dev_sigma0_np1 = sqrt(inner_product(dev_sigma0_np1, dev_sigma0_np1, 1));
 
-	m_kappa_np1 = m_kappa_n;
-	m_psi_np1   = m_psi_n;
+	m_state.trial.kappa = m_state.committed.kappa;
+	m_state.trial.psi   = m_state.committed.psi;
 
 	// check loading/unloading
 
 	// this is how it's written in the paper
-	/*double temp_numerator = inner_product(-(1 + m_kappa_n) * dev_stress_n - m_kappa_n * (1 + m_kappa_n)*(dev_stress_n - dev_sigma0_np1), dStrain_dev, 3);
-	double temp_denominator = inner_product(  (1 + m_kappa_n) * dev_stress_n - m_kappa_n * dev_sigma0_np1, (dev_stress_n - dev_sigma0_np1), 1 );
+	/*double temp_numerator = inner_product(-(1 + m_state.committed.kappa) * dev_stress_n - m_state.committed.kappa * (1 + m_state.committed.kappa)*(dev_stress_n - dev_sigma0_np1), dStrain_dev, 3);
+	double temp_denominator = inner_product(  (1 + m_state.committed.kappa) * dev_stress_n - m_state.committed.kappa * dev_sigma0_np1, (dev_stress_n - dev_sigma0_np1), 1 );
 	
 	if (abs(temp_denominator) < small)
 		loadingCond = 0.0;
@@ -215,7 +220,7 @@ void J2CyclicBoundingSurface::plastic_integrator()
 		loadingCond = temp_numerator / temp_denominator;*/
 
 	// this is how I do it
-	loadingCond = inner_product(m_kappa_n / (1+m_kappa_n) * dev_sigma0_np1 - dev_stress_n, dStrain_dev, 3);
+	loadingCond = inner_product(m_state.committed.kappa / (1+m_state.committed.kappa) * dev_sigma0_np1 - dev_stress_n, dStrain_dev, 3);
 
 	if (loadingCond > 0.0)
 	{
@@ -240,14 +245,14 @@ void J2CyclicBoundingSurface::plastic_integrator()
 		else
 			devStrainDir = dStrain_dev / devStrainNorm;
 
-		m_psi_np1 = 2 * m_shear;
-		m_kappa_np1 = 1.0e10;
+		m_state.trial.psi = 2 * m_shear;
+		m_state.trial.kappa = 1.0e10;
 
-		H_np1 = H(m_kappa_np1);
+		H_np1 = H(m_state.trial.kappa);
 
 		Vector res(2); double res_norm;
-		res(0) = m_psi_np1 * (1.0 + 3.0 * m_shear *  m_beta / H_np1) / (2.0 * m_shear) - 1.0;
-		res(1) = vector_norm(dev_stress_n + (1.0 + m_kappa_np1) * m_psi_np1 * convert_to_stressLike(dStrain_dev), 1) / m_R - 1.0;;
+		res(0) = m_state.trial.psi * (1.0 + 3.0 * m_shear *  m_beta / H_np1) / (2.0 * m_shear) - 1.0;
+		res(1) = vector_norm(dev_stress_n + (1.0 + m_state.trial.kappa) * m_state.trial.psi * convert_to_stressLike(dStrain_dev), 1) / m_R - 1.0;;
 
 		res_norm = vector_norm(res, 3);
 
@@ -265,28 +270,28 @@ void J2CyclicBoundingSurface::plastic_integrator()
 
 			if (res_norm < tol_material + small)
 			{
-				m_stress_np1 = m_stress_n + m_bulk * dStrain_vol * eye + m_psi_np1 * convert_to_stressLike(dStrain_dev);
+				m_stress_np1 = m_stress_n + m_bulk * dStrain_vol * eye + m_state.trial.psi * convert_to_stressLike(dStrain_dev);
 				break;
 			}
 
-			Vector temp = (dev_stress_n + (1.0 + m_kappa_np1) * m_psi_np1 * convert_to_stressLike(dStrain_dev) );
+			Vector temp = (dev_stress_n + (1.0 + m_state.trial.kappa) * m_state.trial.psi * convert_to_stressLike(dStrain_dev) );
 			temp = temp / vector_norm(temp, 1);
 			Ktan(0, 0) = (1.0 + 3.0 * m_shear *  m_beta / H_np1) / (2.0 * m_shear);
-			Ktan(0, 1) = (-3.0 * m_shear * m_psi_np1 * m_beta * m_m_par / m_h_par / pow(m_kappa_np1, m_m_par + 1.0)) / (2.0 * m_shear);
-			Ktan(1, 0) = ((1 + m_kappa_np1) * inner_product(temp, dStrain_dev, 3)) / m_R;
-			Ktan(1, 1) = (inner_product(temp, m_psi_np1 * convert_to_stressLike(dStrain_dev), 1)) / m_R;
+			Ktan(0, 1) = (-3.0 * m_shear * m_state.trial.psi * m_beta * m_m_par / m_h_par / pow(m_state.trial.kappa, m_m_par + 1.0)) / (2.0 * m_shear);
+			Ktan(1, 0) = ((1 + m_state.trial.kappa) * inner_product(temp, dStrain_dev, 3)) / m_R;
+			Ktan(1, 1) = (inner_product(temp, m_state.trial.psi * convert_to_stressLike(dStrain_dev), 1)) / m_R;
 
 			// Solve the system
 			Ktan.Solve(res, incVar);
 
-			m_psi_np1 = m_psi_np1 - incVar(0);
-			m_kappa_np1 = m_kappa_np1 - incVar(1);
+			m_state.trial.psi = m_state.trial.psi - incVar(0);
+			m_state.trial.kappa = m_state.trial.kappa - incVar(1);
 
-			H_np1 = H(m_kappa_np1);
+			H_np1 = H(m_state.trial.kappa);
 
 			// calculate new residual
-			res(0) = m_psi_np1 * (1.0 + 3.0 * m_shear * ( + m_beta / H_np1)) / (2.0 * m_shear) - 1.0;
-			res(1) = vector_norm(dev_stress_n + (1.0 + m_kappa_np1) * m_psi_np1 * convert_to_stressLike(dStrain_dev) , 1) / m_R - 1.0;
+			res(0) = m_state.trial.psi * (1.0 + 3.0 * m_shear * ( + m_beta / H_np1)) / (2.0 * m_shear) - 1.0;
+			res(1) = vector_norm(dev_stress_n + (1.0 + m_state.trial.kappa) * m_state.trial.psi * convert_to_stressLike(dStrain_dev) , 1) / m_R - 1.0;
 
 			res_norm = vector_norm(res, 3);
 		}
@@ -297,12 +302,12 @@ void J2CyclicBoundingSurface::plastic_integrator()
 	{
 		if (debugFlag) opserr << "Loading continues..." << endln;
 		// calculate the initial residual
-		H_n = H(m_kappa_n);
-		H_np1 = H(m_kappa_np1);
+		H_n = H(m_state.committed.kappa);
+		H_np1 = H(m_state.trial.kappa);
 
 		Vector res(2); double res_norm;
-		res(0) = m_psi_np1 * (1.0 + 3.0 * m_shear * ((1 - m_beta) / H_n +  m_beta / H_np1)) / ( 2.0 * m_shear ) - 1.0;
-		res(1) = vector_norm(dev_stress_n + (1.0 + m_kappa_np1) * m_psi_np1 * convert_to_stressLike(dStrain_dev) + m_kappa_np1 * (dev_stress_n - dev_sigma0_np1), 1) / m_R - 1.0;;
+		res(0) = m_state.trial.psi * (1.0 + 3.0 * m_shear * ((1 - m_beta) / H_n +  m_beta / H_np1)) / ( 2.0 * m_shear ) - 1.0;
+		res(1) = vector_norm(dev_stress_n + (1.0 + m_state.trial.kappa) * m_state.trial.psi * convert_to_stressLike(dStrain_dev) + m_state.trial.kappa * (dev_stress_n - dev_sigma0_np1), 1) / m_R - 1.0;;
 
 		res_norm = vector_norm(res, 3);
 
@@ -320,28 +325,28 @@ void J2CyclicBoundingSurface::plastic_integrator()
 
 			if (res_norm < tol_material + small)
 			{
-				m_stress_np1 = m_stress_n + m_bulk * dStrain_vol * eye + m_psi_np1 * convert_to_stressLike(dStrain_dev);
+				m_stress_np1 = m_stress_n + m_bulk * dStrain_vol * eye + m_state.trial.psi * convert_to_stressLike(dStrain_dev);
 				break;
 			}
 
-			Vector temp = (dev_stress_n + (1.0 + m_kappa_np1) * m_psi_np1 * convert_to_stressLike(dStrain_dev) + m_kappa_np1 * (dev_stress_n - dev_sigma0_np1));
+			Vector temp = (dev_stress_n + (1.0 + m_state.trial.kappa) * m_state.trial.psi * convert_to_stressLike(dStrain_dev) + m_state.trial.kappa * (dev_stress_n - dev_sigma0_np1));
 			temp = temp / vector_norm(temp,1);
 			Ktan(0, 0) = (1.0 + 3.0 * m_shear * ((1 - m_beta) / H_n + m_beta / H_np1)) / (2.0 * m_shear);
-			Ktan(0, 1) = (-3.0 * m_shear * m_psi_np1 * m_beta * m_m_par / m_h_par / pow(m_kappa_np1, m_m_par + 1.0)) / (2.0 * m_shear);
-			Ktan(1, 0) = ((1 + m_kappa_np1) * inner_product(temp, dStrain_dev,3)) / m_R;
-			Ktan(1, 1) = (inner_product(temp, dev_stress_n + m_psi_np1 * convert_to_stressLike(dStrain_dev) - dev_sigma0_np1, 1)) / m_R;
+			Ktan(0, 1) = (-3.0 * m_shear * m_state.trial.psi * m_beta * m_m_par / m_h_par / pow(m_state.trial.kappa, m_m_par + 1.0)) / (2.0 * m_shear);
+			Ktan(1, 0) = ((1 + m_state.trial.kappa) * inner_product(temp, dStrain_dev,3)) / m_R;
+			Ktan(1, 1) = (inner_product(temp, dev_stress_n + m_state.trial.psi * convert_to_stressLike(dStrain_dev) - dev_sigma0_np1, 1)) / m_R;
 
 			// Solve the system
 			Ktan.Solve(res, incVar);
 
-			m_psi_np1 = m_psi_np1 - incVar(0);
-			m_kappa_np1 = m_kappa_np1 - incVar(1);
+			m_state.trial.psi = m_state.trial.psi - incVar(0);
+			m_state.trial.kappa = m_state.trial.kappa - incVar(1);
 
-			H_np1 = H(m_kappa_np1);
+			H_np1 = H(m_state.trial.kappa);
 
 			// calculate new residual
-			res(0) = m_psi_np1 * (1.0 + 3.0 * m_shear * ((1 - m_beta) / H_n + m_beta / H_np1)) / (2.0 * m_shear) - 1.0;
-			res(1) = vector_norm(dev_stress_n + (1.0 + m_kappa_np1) * m_psi_np1 * convert_to_stressLike(dStrain_dev) + m_kappa_np1 * (dev_stress_n - dev_sigma0_np1), 1) / m_R - 1.0;
+			res(0) = m_state.trial.psi * (1.0 + 3.0 * m_shear * ((1 - m_beta) / H_n + m_beta / H_np1)) / (2.0 * m_shear) - 1.0;
+			res(1) = vector_norm(dev_stress_n + (1.0 + m_state.trial.kappa) * m_state.trial.psi * convert_to_stressLike(dStrain_dev) + m_state.trial.kappa * (dev_stress_n - dev_sigma0_np1), 1) / m_R - 1.0;
 
 			res_norm = vector_norm(res, 3);
 		}
@@ -486,6 +491,7 @@ NDMaterial * J2CyclicBoundingSurface::getCopy(const char * type)
 	if (strcmp(type, "ThreeDimensional") == 0 || strcmp(type, "3D") == 0) {
 		J2CyclicBoundingSurface *clone;
 		clone = new J2CyclicBoundingSurface(this->getTag(), m_shear, m_bulk, m_su, m_density, m_h_par, m_m_par, m_chi, m_beta);
+		clone->m_ElastFlag = m_ElastFlag;
 		return clone;
 	}
 	else {
@@ -500,13 +506,7 @@ J2CyclicBoundingSurface::commitState()
 
 	//m_stress_vis = m_D * (m_strain_np1 - m_strain_n) / 0.01;
 
-	m_sigma0_n = m_sigma0_np1;
-	m_stress_n = m_stress_np1;
-	m_kappa_n  = m_kappa_np1;
-	m_psi_n    = m_psi_np1;
-	m_strain_n = m_strain_np1;
-	m_strainRate_n = m_strainRate_n1;
-	m_stress_vis_n = m_stress_vis_n1;
+	m_state.commit();
 
 	return 0;
 }
@@ -514,6 +514,7 @@ J2CyclicBoundingSurface::commitState()
 int
 J2CyclicBoundingSurface::revertToLastCommit()
 {
+	m_state.revert();
 	return 0;
 }
 
@@ -580,7 +581,38 @@ J2CyclicBoundingSurface::activateParameter(int paramID)
 int
 J2CyclicBoundingSurface::sendSelf(int commitTag, Channel &theChannel)
 {
-	// TODO : implement this
+	static thread_local Vector data(45);
+
+	data(0)  = this->getTag();
+	data(1)  = m_su;
+	data(2)  = m_bulk;
+	data(3)  = m_shear;
+	data(4)  = m_R;
+	data(5)  = m_density;
+	data(6)  = m_h_par;
+	data(7)  = m_m_par;
+	data(8)  = m_beta;
+	data(9)  = m_chi;
+	data(10) = m_kappa_inf;
+	data(11) = m_ElastFlag;
+	data(12) = m_isElast2Plast;
+	data(13) = m_state.committed.kappa;
+	data(14) = m_state.committed.psi;
+
+	for (int i = 0; i < 6; i++) {
+		data(15 + i) = m_sigma0_n(i);
+		data(21 + i) = m_stress_n(i);
+		data(27 + i) = m_strain_n(i);
+		data(33 + i) = m_strainRate_n(i);
+		data(39 + i) = m_stress_vis_n(i);
+	}
+
+	int res = theChannel.sendVector(this->getDbTag(), commitTag, data);
+	if (res < 0) {
+		opserr << "WARNING: J2CyclicBoundingSurface::sendSelf - failed to send vector to channel" << endln;
+		return -1;
+	}
+
 	return 0;
 }
 
@@ -588,7 +620,43 @@ int
 J2CyclicBoundingSurface::recvSelf(int commitTag, Channel &theChannel,
 	FEM_ObjectBroker &theBroker)
 {
-	// TODO : implement this
+	static thread_local Vector data(45);
+
+	int res = theChannel.recvVector(this->getDbTag(), commitTag, data);
+	if (res < 0) {
+		opserr << "WARNING: J2CyclicBoundingSurface::recvSelf - failed to receive vector from channel" << endln;
+		return -1;
+	}
+
+	this->setTag((int)data(0));
+	m_su          = data(1);
+	m_bulk        = data(2);
+	m_shear       = data(3);
+	m_R           = data(4);
+	m_density     = data(5);
+	m_h_par       = data(6);
+	m_m_par       = data(7);
+	m_beta        = data(8);
+	m_chi         = data(9);
+	m_kappa_inf   = data(10);
+	m_ElastFlag   = (int)data(11);
+	m_isElast2Plast = (data(12) != 0.0);
+	m_state.committed.kappa     = data(13);
+	m_state.committed.psi       = data(14);
+
+	for (int i = 0; i < 6; i++) {
+		m_sigma0_n(i)     = data(15 + i);
+		m_stress_n(i)     = data(21 + i);
+		m_strain_n(i)     = data(27 + i);
+		m_strainRate_n(i) = data(33 + i);
+		m_stress_vis_n(i) = data(39 + i);
+	}
+
+	// trial state equal to the committed state
+	m_state.revert();
+
+	calcInitialTangent();
+
 	return 0;
 }
 
@@ -652,7 +720,7 @@ J2CyclicBoundingSurface::getTangent()
 			}
 		I4dev = eye - 1 / 3 * I2xI2;
 
-		m_Cep = m_bulk * I2xI2 + m_psi_np1 * I4dev;
+		m_Cep = m_bulk * I2xI2 + m_state.trial.psi * I4dev;
 
 		return m_Cep;
 		//return m_Ce;
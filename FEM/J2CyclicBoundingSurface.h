@@ -113,7 +113,7 @@ public:
 
 
 protected:
-	static char unsigned m_ElastFlag;	// 1: enforce elastic response
+	char unsigned m_ElastFlag;	// 1: enforce elastic response
 
 //material parameters
 	double m_su;          // undrained shear strength
@@ -126,13 +126,21 @@ protected:
 	double m_beta;        // Integration scheme parameter beta = 0, explicit. beta = 1, implicit. beta = 0.5 mid point rule
 
 
-	//internal variables
+	//internal variables, time n+1 (trial) and time n (last committed);
+	//the Vectors of time n and n+1 below hold the arrays of m_state
+	struct State {
+		double sigma0[6];
+		double stress[6];
+		double stress_vis[6];
+		double strain[6];
+		double strainRate[6];
+		double kappa;
+		double psi;              // hardening variable
+	};
+	NDMaterialState<State> m_state;
+
 	Vector m_sigma0_n;           // sigma0 time n
 	Vector m_sigma0_np1;         // sigma0 time n+1
-	double m_kappa_n;            // kappa  time n
-	double m_kappa_np1;          // kappa  time n+1
-	double m_psi_n;              // hardening variable time n
-	double m_psi_np1;            // hardening variable time n+1
 	double m_kappa_inf;          // kappa inf  
 
 	//material response 
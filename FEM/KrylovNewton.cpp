@@ -0,0 +1,429 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/analysis/algorithm/equiSolnAlgo/KrylovNewton.cpp
+//
+// Written: fmk
+//
+// Description: This file contains the implementation of KrylovNewton.
+//
+// What: "@(#) KrylovNewton.cpp, revA"
+
+#include <KrylovNewton.h>
+#include <AnalysisModel.h>
+#include <IncrementalIntegrator.h>
+#include <LinearSOE.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <ConvergenceTest.h>
+#include <ID.h>
+#include <elementAPI.h>
+#include <string.h>
+#include <iostream>
+using std::nothrow;
+
+void* OPS_KrylovNewton()
+{
+    int formTangent = CURRENT_TANGENT;
+    int maxDim = 3;
+    int maxReuseIter = 0;
+
+    while(OPS_GetNumRemainingInputArgs() > 0) {
+	const char* type = OPS_GetString();
+	int numData = 1;
+	if(strcmp(type,"-secant")==0 || strcmp(type,"-Secant")==0) {
+	    formTangent = CURRENT_SECANT;
+	} else if(strcmp(type,"-initial")==0 || strcmp(type,"-Initial")==0) {
+	    formTangent = INITIAL_TANGENT;
+	} else if(strcmp(type,"-maxDim")==0 && OPS_GetNumRemainingInputArgs() > 0) {
+	    if (OPS_GetIntInput(&numData, &maxDim) < 0) {
+		opserr << "WARNING KrylovNewton - invalid value for -maxDim\n";
+		return 0;
+	    }
+	} else if(strcmp(type,"-reuse")==0 && OPS_GetNumRemainingInputArgs() > 0) {
+	    if (OPS_GetIntInput(&numData, &maxReuseIter) < 0) {
+		opserr << "WARNING KrylovNewton - invalid value for -reuse\n";
+		return 0;
+	    }
+	}
+    }
+
+    return new KrylovNewton(formTangent, maxDim, maxReuseIter);
+}
+
+// Constructor
+KrylovNewton::KrylovNewton(int theTangentToUse, int maxDim, int maxReuse)
+:EquiSolnAlgo(EquiALGORITHM_TAGS_KrylovNewton),
+ tangent(theTangentToUse), maxDimension(maxDim), maxReuseIter(maxReuse),
+ numIterations(0), numFactorizations(0), haveTangent(false),
+ v(0), Av(0), AvData(0), rData(0), work(0), lwork(0), numEqns(0)
+{
+    if (maxDimension < 0)
+	maxDimension = 0;
+}
+
+
+KrylovNewton::KrylovNewton(ConvergenceTest &theT, int theTangentToUse, int maxDim,
+			   int maxReuse)
+:EquiSolnAlgo(EquiALGORITHM_TAGS_KrylovNewton),
+ tangent(theTangentToUse), maxDimension(maxDim), maxReuseIter(maxReuse),
+ numIterations(0), numFactorizations(0), haveTangent(false),
+ v(0), Av(0), AvData(0), rData(0), work(0), lwork(0), numEqns(0)
+{
+    if (maxDimension < 0)
+	maxDimension = 0;
+}
+
+// Destructor
+KrylovNewton::~KrylovNewton()
+{
+    this->freeStorage();
+}
+
+
+void
+KrylovNewton::freeStorage(void)
+{
+    if (v != 0) {
+	for (int i = 0; i <= maxDimension; i++)
+	    if (v[i] != 0)
+		delete v[i];
+	delete [] v;
+    }
+
+    if (Av != 0) {
+	for (int i = 0; i <= maxDimension; i++)
+	    if (Av[i] != 0)
+		delete Av[i];
+	delete [] Av;
+    }
+
+    if (AvData != 0) delete [] AvData;
+    if (rData != 0) delete [] rData;
+    if (work != 0) delete [] work;
+
+    v = Av = 0;
+    AvData = rData = work = 0;
+    lwork = 0;
+    numEqns = 0;
+}
+
+
+int
+KrylovNewton::setStorage(int numEqn)
+{
+    if (numEqn == numEqns && v != 0)
+	return 0;
+
+    this->freeStorage();
+
+    v = new (nothrow) Vector*[maxDimension+1];
+    Av = new (nothrow) Vector*[maxDimension+1];
+    if (v == 0 || Av == 0) {
+	opserr << "WARNING KrylovNewton::solveCurrentStep() - out of memory\n";
+	this->freeStorage();
+	return -1;
+    }
+    for (int i = 0; i <= maxDimension; i++)
+	v[i] = Av[i] = 0;
+
+    for (int i = 0; i <= maxDimension; i++) {
+	v[i] = new Vector(numEqn);
+	Av[i] = new Vector(numEqn);
+    }
+
+    // dgels needs at least min(M,N) + max(min(M,N),NRHS)
+    lwork = 2*(maxDimension+1);
+    AvData = new (nothrow) double[maxDimension*numEqn + 1];
+    rData = new (nothrow) double[numEqn > maxDimension ? numEqn : maxDimension];
+    work = new (nothrow) double[lwork];
+    if (AvData == 0 || rData == 0 || work == 0) {
+	opserr << "WARNING KrylovNewton::solveCurrentStep() - out of memory\n";
+	this->freeStorage();
+	return -1;
+    }
+
+    numEqns = numEqn;
+
+    return 0;
+}
+
+
+int
+KrylovNewton::formTangent(void)
+{
+    IncrementalIntegrator *theIntegrator = this->getIncrementalIntegratorPtr();
+
+    // formTangent() zeroes A, so the LinearSOE factors it again on the next solve
+    haveTangent = false;
+    SOLUTION_ALGORITHM_tangentFlag = tangent;
+    if (theIntegrator->formTangent(tangent) < 0) {
+	opserr << "WARNING KrylovNewton::solveCurrentStep() -";
+	opserr << "the Integrator failed in formTangent()\n";
+	return -1;
+    }
+    numFactorizations++;
+    haveTangent = true;
+
+    return 0;
+}
+
+
+int
+KrylovNewton::solveCurrentStep(void)
+{
+    // set up some pointers and check they are valid
+    AnalysisModel   *theAnaModel = this->getAnalysisModelPtr();
+    IncrementalIntegrator *theIntegrator = this->getIncrementalIntegratorPtr();
+    LinearSOE  *theSOE = this->getLinearSOEptr();
+
+    if ((theAnaModel == 0) || (theIntegrator == 0) || (theSOE == 0)
+	|| (theTest == 0)){
+	opserr << "WARNING KrylovNewton::solveCurrentStep() - setLinks() has";
+	opserr << " not been called - or no ConvergenceTest has been set\n";
+	return -5;
+    }
+
+    if (this->setStorage(theSOE->getNumEqn()) < 0)
+	return -5;
+
+    if (theIntegrator->formUnbalance() < 0) {
+	opserr << "WARNING KrylovNewton::solveCurrentStep() -";
+	opserr << "the Integrator failed in formUnbalance()\n";
+	haveTangent = false;
+	return -2;
+    }
+
+    // keep the factors of an earlier step if allowed, otherwise form the tangent
+    bool oldTangent = (maxReuseIter > 0 && haveTangent == true);
+    if (oldTangent == false)
+	if (this->formTangent() < 0)
+	    return -1;
+
+    // set itself as the ConvergenceTest objects EquiSolnAlgo
+    theTest->setEquiSolnAlgo(*this);
+    if (theTest->start() < 0) {
+	opserr << "KrylovNewton::solveCurrentStep() -";
+	opserr << "the ConvergenceTest object failed in start()\n";
+	return -3;
+    }
+
+    int result = -1;
+    numIterations = 0;
+
+    // number of vectors in the subspace
+    int k = 0;
+
+    do {
+
+	// convergence on the old factors is too slow, form the tangent again
+	if (oldTangent == true && numIterations == maxReuseIter) {
+	    if (this->formTangent() < 0)
+		return -1;
+	    oldTangent = false;
+	    k = 0;
+	}
+
+	// preconditioned residual r_k = K^{-1} R(y_k)
+	if (theSOE->solve() < 0) {
+	    opserr << "WARNING KrylovNewton::solveCurrentStep() -";
+	    opserr << "the LinearSysOfEqn failed in solve()\n";
+	    haveTangent = false;
+	    return -3;
+	}
+
+	const Vector &r = theSOE->getX();
+	*(v[k]) = r;
+	*(Av[k]) = r;
+
+	// correction from the subspace of the previous iterations
+	if (k > 0)
+	    if (this->leastSquares(k) < 0) {
+		haveTangent = false;
+		return -3;
+	    }
+
+	if (theIntegrator->update(*(v[k])) < 0) {
+	    opserr << "WARNING KrylovNewton::solveCurrentStep() -";
+	    opserr << "the Integrator failed in update()\n";
+	    haveTangent = false;
+	    return -4;
+	}
+
+	if (theIntegrator->formUnbalance() < 0) {
+	    opserr << "WARNING KrylovNewton::solveCurrentStep() -";
+	    opserr << "the Integrator failed in formUnbalance()\n";
+	    haveTangent = false;
+	    return -2;
+	}
+
+	result = theTest->test();
+	numIterations++;
+	this->record(numIterations);
+
+	// subspace full, start again from a new tangent
+	k++;
+	if (result == -1 && k > maxDimension) {
+	    if (this->formTangent() < 0)
+		return -1;
+	    oldTangent = false;
+	    k = 0;
+	}
+
+    } while (result == -1);
+
+    if (result == -2) {
+	opserr << "KrylovNewton::solveCurrentStep() -";
+	opserr << "the ConvergenceTest object failed in test()\n";
+	haveTangent = false;
+	return -3;
+    }
+
+    // note - if postive result we are returning what the convergence test returned
+    // which should be the number of iterations
+    return result;
+}
+
+
+#ifdef _WIN32
+
+extern "C" int DGELS(char *T, int *M, int *N, int *NRHS, double *A, int *LDA,
+		     double *B, int *LDB, double *WORK, int *LWORK, int *INFO);
+
+#define dgels_ DGELS
+
+#else
+
+extern "C" int dgels_(char *T, int *M, int *N, int *NRHS, double *A, int *LDA,
+		      double *B, int *LDB, double *WORK, int *LWORK, int *INFO);
+
+#endif
+
+int
+KrylovNewton::leastSquares(int k)
+{
+    const Vector &r = *(v[k]);
+
+    // Av_{k-1} = r_{k-1} - r_k, the change in residual due to v_{k-1}
+    Av[k-1]->addVector(1.0, r, -1.0);
+
+    // least squares problem min |Av c - r_k|, column major for Lapack
+    for (int i = 0; i < k; i++) {
+	const Vector &Ai = *(Av[i]);
+	double *col = AvData + i*numEqns;
+	for (int j = 0; j < numEqns; j++)
+	    col[j] = Ai(j);
+    }
+
+    for (int j = 0; j < numEqns; j++)
+	rData[j] = r(j);
+
+    char trans[] = "N";
+    int nrhs = 1;
+    int ldb = (numEqns > k) ? numEqns : k;
+    int info = 0;
+    dgels_(trans, &numEqns, &k, &nrhs, AvData, &numEqns, rData, &ldb,
+	   work, &lwork, &info);
+
+    if (info < 0) {
+	opserr << "WARNING KrylovNewton::leastSquares() - error code ";
+	opserr << info << " returned by LAPACK dgels\n";
+	return info;
+    }
+
+    // correction v_k = r_k + sum c_i (v_i - Av_i)
+    for (int i = 0; i < k; i++) {
+	double ci = rData[i];
+	v[k]->addVector(1.0, *(v[i]), ci);
+	v[k]->addVector(1.0, *(Av[i]), -ci);
+    }
+
+    return 0;
+}
+
+
+int
+KrylovNewton::domainChanged(void)
+{
+    // the LinearSOE has been resized and no longer holds the factors
+    haveTangent = false;
+    return 0;
+}
+
+
+void
+KrylovNewton::integratorChanged(void)
+{
+    // the factors hold the tangent of the old dt (Newmark c2, c3)
+    haveTangent = false;
+}
+
+
+int
+KrylovNewton::sendSelf(int cTag, Channel &theChannel)
+{
+    static thread_local ID data(3);
+    data(0) = tangent;
+    data(1) = maxDimension;
+    data(2) = maxReuseIter;
+    return theChannel.sendID(this->getDbTag(), cTag, data);
+}
+
+int
+KrylovNewton::recvSelf(int cTag,
+		       Channel &theChannel,
+		       FEM_ObjectBroker &theBroker)
+{
+    static thread_local ID data(3);
+    theChannel.recvID(this->getDbTag(), cTag, data);
+
+    this->freeStorage();
+    tangent = data(0);
+    maxDimension = data(1);
+    maxReuseIter = data(2);
+    haveTangent = false;
+    return 0;
+}
+
+
+void
+KrylovNewton::Print(OPS_Stream &s, int flag)
+{
+    if (flag == 0) {
+	s << "KrylovNewton -maxDim " << maxDimension;
+	if (maxReuseIter > 0)
+	    s << " -reuse " << maxReuseIter;
+	s << endln;
+    }
+}
+
+
+int
+KrylovNewton::getNumIterations(void)
+{
+    return numIterations;
+}
+
+
+int
+KrylovNewton::getNumFactorizations(void)
+{
+    return numFactorizations;
+}
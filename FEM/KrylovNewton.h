@@ -0,0 +1,93 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/analysis/algorithm/equiSolnAlgo/KrylovNewton.h
+//
+// Written: fmk
+//
+// Description: This file contains the class definition for
+// KrylovNewton. KrylovNewton accelerates the modified Newton-Raphson
+// iterations with the Krylov subspace method of Carlson and Miller
+// ("Design and Application of a 1D GWMFE Code", SIAM J. Sci. Comput.,
+// 19(3), 1998). The corrections and the changes in the preconditioned
+// residual of the previous iterations span a subspace in which the
+// correction is found by least squares, so the factored tangent is used
+// for many more iterations than by ModifiedNewton.
+//
+// The tangent is formed again when the subspace exceeds maxDim vectors.
+// As for ModifiedNewton, if maxReuseIter > 0 the factored tangent is
+// kept for the following steps and only formed again once a step has
+// needed maxReuseIter iterations on a tangent from an earlier step.
+//
+// What: "@(#) KrylovNewton.h, revA"
+
+#ifndef KrylovNewton_h
+#define KrylovNewton_h
+
+#include <EquiSolnAlgo.h>
+#include <Vector.h>
+
+class KrylovNewton: public EquiSolnAlgo
+{
+  public:
+    KrylovNewton(int tangent = CURRENT_TANGENT, int maxDim = 3,
+		 int maxReuseIter = 0);
+    KrylovNewton(ConvergenceTest &theTest, int tangent = CURRENT_TANGENT,
+		 int maxDim = 3, int maxReuseIter = 0);
+    ~KrylovNewton();
+
+    int solveCurrentStep(void);
+    int domainChanged(void);
+    void integratorChanged(void);
+
+    virtual int sendSelf(int commitTag, Channel &theChannel);
+    virtual int recvSelf(int commitTag, Channel &theChannel,
+			 FEM_ObjectBroker &theBroker);
+    void Print(OPS_Stream &s, int flag =0);
+
+    int getNumIterations(void);
+    int getNumFactorizations(void);
+
+  protected:
+
+  private:
+    int formTangent(void);
+    int leastSquares(int k);
+    int setStorage(int numEqn);
+    void freeStorage(void);
+
+    int tangent;
+    int maxDimension;      // maximum number of vectors in the subspace
+    int maxReuseIter;      // iterations allowed on a tangent from an earlier step
+    int numIterations;
+    int numFactorizations;
+    bool haveTangent;      // true if the SOE holds a factored tangent
+
+    // storage for the subspace and the least squares problem
+    Vector **v;            // corrections
+    Vector **Av;           // changes in the preconditioned residual
+    double *AvData;
+    double *rData;
+    double *work;
+    int lwork;
+    int numEqns;
+};
+
+#endif
@@ -524,7 +524,7 @@ LoadPattern::sendSelf(int cTag, Channel &theChannel)
 
   /*
   if (theChannel.isDatastore() == 1) {
-    static ID theLastSendTag(1);
+    static thread_local ID theLastSendTag(1);
     if (theChannel.recvID(myDbTag,0,theLastSendTag) == 0)
       lastGeoSendTag = theLastSendTag(0);
     else
@@ -632,7 +632,7 @@ LoadPattern::sendSelf(int cTag, Channel &theChannel)
     // set the lst send db tag so we don't have to do all that again
     lastGeoSendTag = currentGeoTag;
     if (theChannel.isDatastore() == 1) {
-      static ID theLastSendTag(1);
+      static thread_local ID theLastSendTag(1);
       theLastSendTag(0) = lastGeoSendTag;
       theChannel.sendID(myDbTag,0, theLastSendTag);
     }
@@ -728,7 +728,7 @@ LoadPattern::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker
 
   /*
   if (theChannel.isDatastore() == 1) {
-    static ID theLastSendTag(1);
+    static thread_local ID theLastSendTag(1);
     if (theChannel.recvID(myDbTag,0,theLastSendTag) == 0)
       lastGeoSendTag = theLastSendTag(0);
   }
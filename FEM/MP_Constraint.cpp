@@ -42,8 +42,8 @@
 #include <elementAPI.h>
 #include <Domain.h>
 
-static int numMPs = 0;
-static int nextTag = 0;
+static thread_local int numMPs = 0;
+static thread_local int nextTag = 0;
 
 int OPS_EqualDOF()
 {
@@ -331,7 +331,7 @@ MP_Constraint::getConstraint(void)
 int 
 MP_Constraint::sendSelf(int cTag, Channel &theChannel)
 {
-    static ID data(10);
+    static thread_local ID data(10);
     int dataTag = this->getDbTag();
 
     data(0) = this->getTag(); 
@@ -394,7 +394,7 @@ MP_Constraint::recvSelf(int cTag, Channel &theChannel,
 			FEM_ObjectBroker &theBroker)
 {
     int dataTag = this->getDbTag();
-    static ID data(10);
+    static thread_local ID data(10);
     int result = theChannel.recvID(dataTag, cTag, data);
     if (result < 0) {
 	opserr << "WARNING MP_Constraint::recvSelf - error receiving ID data\n";
@@ -50,11 +50,48 @@ using std::nothrow;
 
 #include <math.h>
 
-int Matrix::sizeDoubleWork = MATRIX_WORK_AREA;
-int Matrix::sizeIntWork = INT_WORK_AREA;
+thread_local int Matrix::sizeDoubleWork = 0;
+thread_local int Matrix::sizeIntWork = 0;
 double Matrix::MATRIX_NOT_VALID_ENTRY =0.0;
-double *Matrix::matrixWork = 0;
-int    *Matrix::intWork =0;
+thread_local double *Matrix::matrixWork = 0;
+thread_local int    *Matrix::intWork =0;
+
+// allocates the work areas of the calling thread if not yet done, they
+// are released again when the thread exits
+int
+Matrix::allocateWorkArea(void)
+{
+  if (matrixWork != 0 && intWork != 0)
+    return 0;
+
+  struct WorkAreaOwner {
+    ~WorkAreaOwner() {
+      if (matrixWork != 0)
+	delete [] matrixWork;
+      if (intWork != 0)
+	delete [] intWork;
+      matrixWork = 0; intWork = 0;
+      sizeDoubleWork = 0; sizeIntWork = 0;
+    }
+  };
+  static thread_local WorkAreaOwner theOwner;
+  (void)theOwner;
+
+  if (matrixWork == 0) {
+    matrixWork = new (nothrow) double[MATRIX_WORK_AREA];
+    sizeDoubleWork = MATRIX_WORK_AREA;
+  }
+  if (intWork == 0) {
+    intWork = new (nothrow) int[INT_WORK_AREA];
+    sizeIntWork = INT_WORK_AREA;
+  }
+  if (matrixWork == 0 || intWork == 0) {
+    opserr << "WARNING: Matrix::allocateWorkArea() - out of memory creating work area's\n";
+    exit(-1);
+  }
+
+  return 0;
+}
 
 //double *Matrix::matrixWork = (double *)malloc(400*sizeof(double));
 
@@ -65,15 +102,6 @@ int    *Matrix::intWork =0;
 Matrix::Matrix()
 :numRows(0), numCols(0), dataSize(0), data(0), fromFree(0)
 {
-  // allocate work areas if the first
-  if (matrixWork == 0) {
-    matrixWork = new (nothrow) double[sizeDoubleWork];
-    intWork = new (nothrow) int[sizeIntWork];
-    if (matrixWork == 0 || intWork == 0) {
-      opserr << "WARNING: Matrix::Matrix() - out of memory creating work area's\n";
-      exit(-1);
-    }
-  }
 }
 
 
@@ -81,15 +109,6 @@ Matrix::Matrix(int nRows,int nCols)
 :numRows(nRows), numCols(nCols), dataSize(0), data(0), fromFree(0)
 {
 
-  // allocate work areas if the first matrix
-  if (matrixWork == 0) {
-    matrixWork = new (nothrow) double[sizeDoubleWork];
-    intWork = new (nothrow) int[sizeIntWork];
-    if (matrixWork == 0 || intWork == 0) {
-      opserr << "WARNING: Matrix::Matrix() - out of memory creating work area's\n";
-      exit(-1);
-    }
-  }
 
 #ifdef _G3DEBUG
     if (nRows < 0) {
@@ -125,15 +144,6 @@ Matrix::Matrix(int nRows,int nCols)
 Matrix::Matrix(double *theData, int row, int col) 
 :numRows(row),numCols(col),dataSize(row*col),data(theData),fromFree(1)
 {
-  // allocate work areas if the first matrix
-  if (matrixWork == 0) {
-    matrixWork = new (nothrow) double[sizeDoubleWork];
-    intWork = new (nothrow) int[sizeIntWork];
-    if (matrixWork == 0 || intWork == 0) {
-      opserr << "WARNING: Matrix::Matrix() - out of memory creating work area's\n";
-      exit(-1);
-    }
-  }
 
 #ifdef _G3DEBUG
     if (row < 0) {
@@ -154,15 +164,6 @@ Matrix::Matrix(double *theData, int row, int col)
 Matrix::Matrix(const Matrix &other)
 :numRows(0), numCols(0), dataSize(0), data(0), fromFree(0)
 {
-  // allocate work areas if the first matrix
-  if (matrixWork == 0) {
-    matrixWork = new (nothrow) double[sizeDoubleWork];
-    intWork = new (nothrow) int[sizeIntWork];
-    if (matrixWork == 0 || intWork == 0) {
-      opserr << "WARNING: Matrix::Matrix() - out of memory creating work area's\n";
-      exit(-1);
-    }
-  }
 
     numRows = other.numRows;
     numCols = other.numCols;
@@ -186,6 +187,36 @@ Matrix::Matrix(const Matrix &other)
 }
 
 
+//
+// MOVE CONSTRUCTOR: takes over the data of a temporary Matrix, the data
+// is copied if the other Matrix does not own it
+//
+
+Matrix::Matrix(Matrix &&other)
+:numRows(other.numRows), numCols(other.numCols), dataSize(other.dataSize), data(other.data), fromFree(0)
+{
+    if (other.fromFree == 0) {
+      other.numRows = 0; other.numCols = 0; other.dataSize = 0; other.data = 0;
+      return;
+    }
+
+    data = 0;
+    if (dataSize != 0) {
+      data = new (nothrow) double[dataSize];
+      if (data == 0) {
+	opserr << "WARNING:Matrix::Matrix(Matrix &&): ";
+	opserr << "Ran out of memory on init of size " << dataSize << endln; 
+	numRows = 0; numCols =0; dataSize = 0;
+      } else {
+	double *dataPtr = data;
+	double *otherDataPtr = other.data;
+	for (int i=0; i<dataSize; i++)
+	  *dataPtr++ = *otherDataPtr++;
+      }
+    }
+}
+
+
 //
 // DESTRUCTOR
 //
@@ -373,6 +404,8 @@ Matrix::Solve(const Vector &b, Vector &x) const
     }
 #endif
     
+    allocateWorkArea();
+
     // check work area can hold all the data
     if (dataSize > sizeDoubleWork) {
 
@@ -468,6 +501,8 @@ Matrix::Solve(const Matrix &b, Matrix &x) const
     }
 #endif
 
+    allocateWorkArea();
+
     // check work area can hold all the data
     if (dataSize > sizeDoubleWork) {
 
@@ -567,6 +602,8 @@ Matrix::Invert(Matrix &theInverse) const
     }
 #endif
 
+    allocateWorkArea();
+
     // check work area can hold all the data
     if (dataSize > sizeDoubleWork) {
 
@@ -951,6 +988,7 @@ Matrix::addMatrixTripleProduct(double thisFact,
     int dimB = B.numCols;
     int sizeWork = dimB * numCols;
 
+    allocateWorkArea();
     if (sizeWork > sizeDoubleWork) {
       this->addMatrix(thisFact, T^B*T, otherFact);
       return 0;
@@ -1049,6 +1087,7 @@ Matrix::addMatrixTripleProduct(double thisFact,
     // cheack work area can hold the temporary matrix
     int sizeWork = B.numRows * numCols;
 
+    allocateWorkArea();
     if (sizeWork > sizeDoubleWork) {
       this->addMatrix(thisFact, A^B*C, otherFact);
       return 0;
@@ -1198,6 +1237,24 @@ Matrix::operator=(const Matrix &other)
 }
 
 
+// the data of other and this are swapped if both own their data,
+// otherwise (this wraps the data of another object) other is copied
+
+Matrix &
+Matrix::operator=(Matrix &&other)
+{
+  if (this != &other && fromFree == 0 && other.fromFree == 0) {
+    int tmpRows = numRows, tmpCols = numCols, tmpSize = dataSize;
+    double *tmpData = data;
+    numRows = other.numRows; numCols = other.numCols; dataSize = other.dataSize; data = other.data;
+    other.numRows = tmpRows; other.numCols = tmpCols; other.dataSize = tmpSize; other.data = tmpData;
+    return *this;
+  }
+
+  return *this = static_cast<const Matrix &>(other);
+}
+
+
 
 
 // virtual Matrix &operator+=(double fact);
@@ -1326,60 +1383,9 @@ Matrix::operator/(double fact) const
 
 
 //
-// MATRIX_VECTOR OPERATIONS
+// MATRIX_VECTOR OPERATIONS are expressions, see Matrix.h
 //
 
-Vector
-Matrix::operator*(const Vector &V) const
-{
-    Vector result(numRows);
-    
-    if (V.Size() != numCols) {
-	opserr << "Matrix::operator*(Vector): incompatable sizes\n";
-	return result;
-    } 
-    
-    double *dataPtr = data;
-    for (int i=0; i<numCols; i++)
-      for (int j=0; j<numRows; j++)
-	result(j) += *dataPtr++ * V(i);
-
-    /*
-    opserr << "HELLO: " << V;
-    for (int i=0; i<numRows; i++) {
-	double sum = 0.0;
-	for (int j=0; j<numCols; j++) {
-	    sum += (*this)(i,j) * V(j);
-	    if (i == 9) opserr << "sum: " << sum << " " << (*this)(i,j)*V(j) << " " << V(j) << 
-;
-	}
-	result(i) += sum;
-    }
-    opserr << *this;
-    opserr << "HELLO result: " << result;    
-    */
-
-    return result;
-}
-
-Vector
-Matrix::operator^(const Vector &V) const
-{
-    Vector result(numCols);
-    
-    if (V.Size() != numRows) {
-      opserr << "Matrix::operator*(Vector): incompatable sizes\n";
-      return result;
-    } 
-
-    double *dataPtr = data;
-    for (int i=0; i<numCols; i++)
-      for (int j=0; j<numRows; j++)
-	result(i) += *dataPtr++ * V(j);
-
-    return result;
-}
-
 
 //
 // MATRIX - MATRIX OPERATIONS
@@ -1780,11 +1786,11 @@ Matrix::Eigen3(const Matrix &M)
   int     rot, its, i, j , k ;
   double  g, h, aij, sm, thresh, t, c, s, tau ;
 
-  static Matrix  v(3,3) ;
-  static Vector  d(3) ;
-  static Vector  a(3) ;
-  static Vector  b(3) ; 
-  static Vector  z(3) ;
+  static thread_local Matrix  v(3,3) ;
+  static thread_local Vector  d(3) ;
+  static thread_local Vector  a(3) ;
+  static thread_local Vector  b(3) ; 
+  static thread_local Vector  z(3) ;
 
   static const double tol = 1.0e-08 ;
 
@@ -1904,7 +1910,7 @@ Matrix::Eigen3(const Matrix &M)
     sm = fabs(a(0)) + fabs(a(1)) + fabs(a(2)) ;
 
   } //end while sm
-  static Vector  dd(3) ;
+  static thread_local Vector  dd(3) ;
   if (d(0)>d(1))
     {
       if (d(0)>d(2))
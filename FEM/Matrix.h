@@ -38,8 +38,8 @@
 // What: "@(#) Matrix.h, revA"
 
 #include <OPS_Globals.h>
+#include <Vector.h>
 
-class Vector;
 class ID;
 class Message;
 
@@ -53,6 +53,7 @@ class Matrix
     Matrix(int nrows, int ncols);
     Matrix(double *data, int nrows, int ncols);    
     Matrix(const Matrix &M);    
+    Matrix(Matrix &&M);
     ~Matrix();
 
     // utility methods
@@ -82,6 +83,7 @@ class Matrix
     Matrix operator()(const ID &rows, const ID & cols) const;
     
     Matrix &operator=(const Matrix &M);
+    Matrix &operator=(Matrix &&M);
     
     // matrix operations which will preserve the derived type and
     // which can be implemented efficiently without many constructor calls.
@@ -102,9 +104,7 @@ class Matrix
     Matrix operator*(double fact) const;
     Matrix operator/(double fact) const;
     
-    // matrix-vector operations
-    Vector operator*(const Vector &V) const;
-    Vector operator^(const Vector &V) const;    
+    // matrix-vector operations M*V and M^V are expressions, see below
 
     
     // matrix-matrix operations
@@ -143,15 +143,20 @@ class Matrix
     friend class MPI_Channel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
+    friend class BinaryFileDatastore;
 
   protected:
 
   private:
     static double MATRIX_NOT_VALID_ENTRY;
-    static double *matrixWork;
-    static int *intWork;
-    static int sizeDoubleWork;
-    static int sizeIntWork;
+    static int allocateWorkArea(void);
+
+    // work areas are per thread so that Domains on different threads
+    // can use Solve(), Invert() and addMatrixTripleProduct() at once
+    static thread_local double *matrixWork;
+    static thread_local int *intWork;
+    static thread_local int sizeDoubleWork;
+    static thread_local int sizeIntWork;
 
     int numRows;
     int numCols;
@@ -206,6 +211,107 @@ Matrix::operator()(int row, int col) const
   return data[col*numRows + row];
 }
 
+
+// Matrix-Vector products as Vector expressions (VectorExpression.h). A
+// component is the dot product of a row (column for M^V) with the
+// Vector, accumulated in the order of the former Matrix::operator*(). A
+// product used as the Vector of another product is evaluated once into a
+// Vector instead of once for every row.
+
+template <class E> class MatrixVectorProduct;
+template <class E> class MatrixTransposeVectorProduct;
+
+template <class E>
+struct MatrixVectorOperand
+{
+  typedef typename VectorOperand<E>::type type;
+};
+
+template <class E>
+struct MatrixVectorOperand<MatrixVectorProduct<E> >
+{
+  typedef const Vector type;
+};
+
+template <class E>
+struct MatrixVectorOperand<MatrixTransposeVectorProduct<E> >
+{
+  typedef const Vector type;
+};
+
+
+template <class E>
+class MatrixVectorProduct : public VectorExpression<MatrixVectorProduct<E> >
+{
+  public:
+    MatrixVectorProduct(const Matrix &m, const E &v, int n) :M(m), vect(v), numCols(n) {}
+
+    int Size(void) const {return M.noRows();}
+    double operator()(int i) const
+    {
+      double result = 0.0;
+      for (int j=0; j<numCols; j++)
+	result += M(i, j) * vect(j);
+      return result;
+    }
+    bool aliases(const double *data) const {return vect.aliases(data);}
+    bool crossAliases(const double *data) const {return vect.aliases(data) || vect.crossAliases(data);}
+
+  private:
+    const Matrix &M;
+    typename MatrixVectorOperand<E>::type vect;
+    int numCols;    // 0 if the sizes do not match
+};
+
+
+template <class E>
+class MatrixTransposeVectorProduct : public VectorExpression<MatrixTransposeVectorProduct<E> >
+{
+  public:
+    MatrixTransposeVectorProduct(const Matrix &m, const E &v, int n) :M(m), vect(v), numRows(n) {}
+
+    int Size(void) const {return M.noCols();}
+    double operator()(int i) const
+    {
+      double result = 0.0;
+      for (int j=0; j<numRows; j++)
+	result += M(j, i) * vect(j);
+      return result;
+    }
+    bool aliases(const double *data) const {return vect.aliases(data);}
+    bool crossAliases(const double *data) const {return vect.aliases(data) || vect.crossAliases(data);}
+
+  private:
+    const Matrix &M;
+    typename MatrixVectorOperand<E>::type vect;
+    int numRows;    // 0 if the sizes do not match
+};
+
+
+template <class E>
+inline MatrixVectorProduct<E>
+operator*(const Matrix &M, const VectorExpression<E> &V)
+{
+  int numCols = M.noCols();
+  if (V.self().Size() != numCols) {
+    opserr << "Matrix::operator*(Vector): incompatable sizes\n";
+    numCols = 0;
+  }
+  return MatrixVectorProduct<E>(M, V.self(), numCols);
+}
+
+template <class E>
+inline MatrixTransposeVectorProduct<E>
+operator^(const Matrix &M, const VectorExpression<E> &V)
+{
+  int numRows = M.noRows();
+  if (V.self().Size() != numRows) {
+    opserr << "Matrix::operator*(Vector): incompatable sizes\n";
+    numRows = 0;
+  }
+  return MatrixTransposeVectorProduct<E>(M, V.self(), numRows);
+}
+
 #endif
 
 
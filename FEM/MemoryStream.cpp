@@ -0,0 +1,81 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/handler/MemoryStream.cpp
+//
+// Written: fmk
+//
+// Description: This file contains the implementation of MemoryStream.
+//
+// What: "@(#) MemoryStream.cpp, revA"
+
+#include <MemoryStream.h>
+#include <Vector.h>
+#include <classTags.h>
+
+MemoryStream::MemoryStream(ResponseHistory &history, int rows)
+  :OPS_Stream(OPS_STREAM_TAGS_MemoryStream),
+   theHistory(history), expectedRows(rows)
+{
+  theHistory.clear();
+}
+
+MemoryStream::~MemoryStream()
+{
+
+}
+
+int
+MemoryStream::write(Vector &data)
+{
+  int size = data.Size();
+  if (size == 0)
+    return 0;
+
+  // the first row sets the number of columns
+  if (theHistory.numColumns == 0) {
+    theHistory.numColumns = size;
+    if (expectedRows > 0)
+      theHistory.data.reserve(expectedRows*size);
+  } else if (size != theHistory.numColumns) {
+    opserr << "WARNING MemoryStream::write() - row of size " << size;
+    opserr << " does not match the " << theHistory.numColumns << " columns of the history\n";
+    return -1;
+  }
+
+  for (int i=0; i<size; i++)
+    theHistory.data.push_back(data(i));
+  theHistory.numRows++;
+
+  return 0;
+}
+
+int
+MemoryStream::sendSelf(int commitTag, Channel &theChannel)
+{
+  return 0;
+}
+
+int
+MemoryStream::recvSelf(int commitTag, Channel &theChannel, 
+		       FEM_ObjectBroker &theBroker)
+{
+  return 0;
+}
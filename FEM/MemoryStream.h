@@ -0,0 +1,89 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/handler/MemoryStream.h
+//
+// Written: fmk
+//
+// Description: This file contains the class definition for MemoryStream.
+// MemoryStream is an OPS_Stream that keeps the rows a recorder writes in
+// a ResponseHistory, one contiguous array of doubles stored row by row.
+// The ResponseHistory is owned by the caller, so the data is still there
+// when the recorder, which deletes its stream, is gone. The array is
+// allocated for the expected number of rows when the first row arrives
+// and only grows if more rows than expected are written.
+//
+// What: "@(#) MemoryStream.h, revA"
+
+#ifndef _MemoryStream
+#define _MemoryStream
+
+#include <OPS_Stream.h>
+
+#include <vector>
+
+class ResponseHistory
+{
+ public:
+  ResponseHistory() :numRows(0), numColumns(0) {};
+
+  int getNumRows(void) const {return numRows;};
+  int getNumColumns(void) const {return numColumns;};
+
+  // the data, row i starts at getData() + i*getNumColumns()
+  const double *getData(void) const {return data.empty() ? 0 : &data[0];};
+  const double *getRow(int i) const {return &data[i*numColumns];};
+  double operator()(int row, int col) const {return data[row*numColumns + col];};
+
+  void clear(void) {numRows = 0; numColumns = 0; data.clear();};
+
+ private:
+  friend class MemoryStream;
+  int numRows;
+  int numColumns;
+  std::vector<double> data;
+};
+
+class MemoryStream : public OPS_Stream
+{
+ public:
+  MemoryStream(ResponseHistory &theHistory, int expectedRows = 0);
+  ~MemoryStream();
+
+  // xml stuff
+  int tag(const char *) {return 0;};
+  int tag(const char *, const char *) {return 0;};
+  int endTag() {return 0;};
+  int attr(const char *name, int value) {return 0;};
+  int attr(const char *name, double value) {return 0;};
+  int attr(const char *name, const char *value) {return 0;};
+  int write(Vector &data);
+
+  // parallel stuff
+  int sendSelf(int commitTag, Channel &theChannel);  
+  int recvSelf(int commitTag, Channel &theChannel, 
+	       FEM_ObjectBroker &theBroker);
+
+ private:
+  ResponseHistory &theHistory;
+  int expectedRows;
+};
+
+#endif
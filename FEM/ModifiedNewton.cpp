@@ -0,0 +1,259 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/analysis/algorithm/equiSolnAlgo/ModifiedNewton.cpp
+//
+// Written: fmk
+//
+// Description: This file contains the implementation of ModifiedNewton.
+//
+// What: "@(#) ModifiedNewton.cpp, revA"
+
+#include <ModifiedNewton.h>
+#include <AnalysisModel.h>
+#include <IncrementalIntegrator.h>
+#include <LinearSOE.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <ConvergenceTest.h>
+#include <ID.h>
+#include <elementAPI.h>
+#include <string.h>
+
+void* OPS_ModifiedNewton()
+{
+    int formTangent = CURRENT_TANGENT;
+    int maxReuseIter = 0;
+
+    while(OPS_GetNumRemainingInputArgs() > 0) {
+	const char* type = OPS_GetString();
+	if(strcmp(type,"-secant")==0 || strcmp(type,"-Secant")==0) {
+	    formTangent = CURRENT_SECANT;
+	} else if(strcmp(type,"-initial")==0 || strcmp(type,"-Initial")==0) {
+	    formTangent = INITIAL_TANGENT;
+	} else if(strcmp(type,"-reuse")==0 && OPS_GetNumRemainingInputArgs() > 0) {
+	    int numData = 1;
+	    if (OPS_GetIntInput(&numData, &maxReuseIter) < 0) {
+		opserr << "WARNING ModifiedNewton - invalid value for -reuse\n";
+		return 0;
+	    }
+	}
+    }
+
+    return new ModifiedNewton(formTangent, maxReuseIter);
+}
+
+// Constructor
+ModifiedNewton::ModifiedNewton(int theTangentToUse, int maxReuse)
+:EquiSolnAlgo(EquiALGORITHM_TAGS_ModifiedNewton),
+ tangent(theTangentToUse), maxReuseIter(maxReuse), numIterations(0),
+ numFactorizations(0), haveTangent(false)
+{
+
+}
+
+
+ModifiedNewton::ModifiedNewton(ConvergenceTest &theT, int theTangentToUse, int maxReuse)
+:EquiSolnAlgo(EquiALGORITHM_TAGS_ModifiedNewton),
+ tangent(theTangentToUse), maxReuseIter(maxReuse), numIterations(0),
+ numFactorizations(0), haveTangent(false)
+{
+
+}
+
+// Destructor
+ModifiedNewton::~ModifiedNewton()
+{
+
+}
+
+
+int
+ModifiedNewton::formTangent(void)
+{
+    IncrementalIntegrator *theIntegrator = this->getIncrementalIntegratorPtr();
+
+    // formTangent() zeroes A, so the LinearSOE factors it again on the next solve
+    haveTangent = false;
+    SOLUTION_ALGORITHM_tangentFlag = tangent;
+    if (theIntegrator->formTangent(tangent) < 0) {
+	opserr << "WARNING ModifiedNewton::solveCurrentStep() -";
+	opserr << "the Integrator failed in formTangent()\n";
+	return -1;
+    }
+    numFactorizations++;
+    haveTangent = true;
+
+    return 0;
+}
+
+
+int
+ModifiedNewton::solveCurrentStep(void)
+{
+    // set up some pointers and check they are valid
+    AnalysisModel   *theAnaModel = this->getAnalysisModelPtr();
+    IncrementalIntegrator *theIntegrator = this->getIncrementalIntegratorPtr();
+    LinearSOE  *theSOE = this->getLinearSOEptr();
+
+    if ((theAnaModel == 0) || (theIntegrator == 0) || (theSOE == 0)
+	|| (theTest == 0)){
+	opserr << "WARNING ModifiedNewton::solveCurrentStep() - setLinks() has";
+	opserr << " not been called - or no ConvergenceTest has been set\n";
+	return -5;
+    }
+
+    if (theIntegrator->formUnbalance() < 0) {
+	opserr << "WARNING ModifiedNewton::solveCurrentStep() -";
+	opserr << "the Integrator failed in formUnbalance()\n";
+	haveTangent = false;
+	return -2;
+    }
+
+    // keep the factors of an earlier step if allowed, otherwise form the tangent
+    bool oldTangent = (maxReuseIter > 0 && haveTangent == true);
+    if (oldTangent == false)
+	if (this->formTangent() < 0)
+	    return -1;
+
+    // set itself as the ConvergenceTest objects EquiSolnAlgo
+    theTest->setEquiSolnAlgo(*this);
+    if (theTest->start() < 0) {
+	opserr << "ModifiedNewton::solveCurrentStep() -";
+	opserr << "the ConvergenceTest object failed in start()\n";
+	return -3;
+    }
+
+    int result = -1;
+    numIterations = 0;
+
+    do {
+
+	// convergence on the old factors is too slow, form the tangent again
+	if (oldTangent == true && numIterations == maxReuseIter) {
+	    if (this->formTangent() < 0)
+		return -1;
+	    oldTangent = false;
+	}
+
+	if (theSOE->solve() < 0) {
+	    opserr << "WARNING ModifiedNewton::solveCurrentStep() -";
+	    opserr << "the LinearSysOfEqn failed in solve()\n";
+	    haveTangent = false;
+	    return -3;
+	}
+
+	if (theIntegrator->update(theSOE->getX()) < 0) {
+	    opserr << "WARNING ModifiedNewton::solveCurrentStep() -";
+	    opserr << "the Integrator failed in update()\n";
+	    haveTangent = false;
+	    return -4;
+	}
+
+	if (theIntegrator->formUnbalance() < 0) {
+	    opserr << "WARNING ModifiedNewton::solveCurrentStep() -";
+	    opserr << "the Integrator failed in formUnbalance()\n";
+	    haveTangent = false;
+	    return -2;
+	}
+
+	result = theTest->test();
+	numIterations++;
+	this->record(numIterations);
+
+    } while (result == -1);
+
+    if (result == -2) {
+	opserr << "ModifiedNewton::solveCurrentStep() -";
+	opserr << "the ConvergenceTest object failed in test()\n";
+	haveTangent = false;
+	return -3;
+    }
+
+    // note - if postive result we are returning what the convergence test returned
+    // which should be the number of iterations
+    return result;
+}
+
+
+int
+ModifiedNewton::domainChanged(void)
+{
+    // the LinearSOE has been resized and no longer holds the factors
+    haveTangent = false;
+    return 0;
+}
+
+
+void
+ModifiedNewton::integratorChanged(void)
+{
+    // the factors hold the tangent of the old dt (Newmark c2, c3)
+    haveTangent = false;
+}
+
+
+int
+ModifiedNewton::sendSelf(int cTag, Channel &theChannel)
+{
+    static thread_local ID data(2);
+    data(0) = tangent;
+    data(1) = maxReuseIter;
+    return theChannel.sendID(this->getDbTag(), cTag, data);
+}
+
+int
+ModifiedNewton::recvSelf(int cTag,
+			 Channel &theChannel,
+			 FEM_ObjectBroker &theBroker)
+{
+    static thread_local ID data(2);
+    theChannel.recvID(this->getDbTag(), cTag, data);
+    tangent = data(0);
+    maxReuseIter = data(1);
+    haveTangent = false;
+    return 0;
+}
+
+
+void
+ModifiedNewton::Print(OPS_Stream &s, int flag)
+{
+    if (flag == 0) {
+	s << "ModifiedNewton";
+	if (maxReuseIter > 0)
+	    s << " -reuse " << maxReuseIter;
+	s << endln;
+    }
+}
+
+
+int
+ModifiedNewton::getNumIterations(void)
+{
+    return numIterations;
+}
+
+
+int
+ModifiedNewton::getNumFactorizations(void)
+{
+    return numFactorizations;
+}
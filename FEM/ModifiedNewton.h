@@ -0,0 +1,75 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/analysis/algorithm/equiSolnAlgo/ModifiedNewton.h
+//
+// Written: fmk
+//
+// Description: This file contains the class definition for
+// ModifiedNewton. ModifiedNewton is a class which uses the modified
+// Newton-Raphson solution algorithm: the tangent is formed, and factored
+// by the LinearSOE, at the start of a step and then reused for all the
+// iterations of the step.
+//
+// If maxReuseIter > 0 the factored tangent is also kept for the following
+// steps. It is only formed again once a step has needed maxReuseIter
+// iterations on a tangent from an earlier step, after a failed step and
+// after the domain has changed.
+//
+// What: "@(#) ModifiedNewton.h, revA"
+
+#ifndef ModifiedNewton_h
+#define ModifiedNewton_h
+
+#include <EquiSolnAlgo.h>
+
+class ModifiedNewton: public EquiSolnAlgo
+{
+  public:
+    ModifiedNewton(int tangent = CURRENT_TANGENT, int maxReuseIter = 0);
+    ModifiedNewton(ConvergenceTest &theTest, int tangent = CURRENT_TANGENT,
+		   int maxReuseIter = 0);
+    ~ModifiedNewton();
+
+    int solveCurrentStep(void);
+    int domainChanged(void);
+    void integratorChanged(void);
+
+    virtual int sendSelf(int commitTag, Channel &theChannel);
+    virtual int recvSelf(int commitTag, Channel &theChannel,
+			 FEM_ObjectBroker &theBroker);
+    void Print(OPS_Stream &s, int flag =0);
+
+    int getNumIterations(void);
+    int getNumFactorizations(void);
+
+  protected:
+
+  private:
+    int formTangent(void);
+
+    int tangent;
+    int maxReuseIter;      // iterations allowed on a tangent from an earlier step
+    int numIterations;
+    int numFactorizations;
+    bool haveTangent;      // true if the SOE holds a factored tangent
+};
+
+#endif
@@ -47,7 +47,7 @@
 Matrix NDMaterial::errMatrix(1,1);
 Vector NDMaterial::errVector(1);
 
-static MapOfTaggedObjects theNDMaterialObjects;
+static thread_local MapOfTaggedObjects theNDMaterialObjects;
 
 bool OPS_addNDMaterial(NDMaterial *newComponent)
 {
@@ -134,6 +134,17 @@ NDMaterial::setTrialStrainIncr(const Vector &v, const Vector &r)
    return -1;    
 }
 
+int
+NDMaterial::setTrialStrains(int numMaterials, NDMaterial **theMaterials,
+			    const Vector **theStrains)
+{
+  int res = 0;
+  for (int i=0; i<numMaterials; i++)
+    if (theMaterials[i]->setTrialStrain(*theStrains[i]) != 0)
+      res = -1;
+  return res;
+}
+
 const Matrix &
 NDMaterial::getTangent(void)
 {
@@ -286,14 +297,14 @@ NDMaterial::getResponse (int responseID, Information &matInfo)
 const Vector &
 NDMaterial::getStressSensitivity(int gradIndex, bool conditional)
 {
-	static Vector dummy(1);
+	static thread_local Vector dummy(1);
 	return dummy;
 }
 
 const Vector &
 NDMaterial::getStrainSensitivity(int gradIndex)
 {
-	static Vector dummy(1);
+	static thread_local Vector dummy(1);
 	return dummy;
 }
 
@@ -306,19 +317,19 @@ NDMaterial::getRhoSensitivity(int gradIndex)
 const Matrix &
 NDMaterial::getDampTangentSensitivity(int gradIndex)
 {
-	static Matrix dummy(1,1);
+	static thread_local Matrix dummy(1,1);
 	return dummy;
 }
 const Matrix &
 NDMaterial::getTangentSensitivity(int gradIndex)
 {
-	static Matrix dummy(1,1);
+	static thread_local Matrix dummy(1,1);
 	return dummy;
 }
 const Matrix &
 NDMaterial::getInitialTangentSensitivity(int gradIndex)
 {
-	static Matrix dummy(1,1);
+	static thread_local Matrix dummy(1,1);
 	return dummy;
 }
 int
@@ -39,6 +39,7 @@
 // What: "@(#) NDMaterial.h, revA"
 
 #include <Material.h>
+#include <NDMaterialState.h>
 
 class Matrix;
 class ID;
@@ -60,6 +61,12 @@ class NDMaterial : public Material
     virtual int setTrialStrain(const Vector &v, const Vector &r);
     virtual int setTrialStrainIncr(const Vector &v);
     virtual int setTrialStrainIncr(const Vector &v, const Vector &r);
+
+    // batched state determination: sets the trial strain of numMaterials
+    // materials of the same type as this one, theMaterials[i] gets
+    // *theStrains[i]. the default calls setTrialStrain() on each of them.
+    virtual int setTrialStrains(int numMaterials, NDMaterial **theMaterials,
+				const Vector **theStrains);
     virtual const Matrix &getTangent(void);
     virtual const Matrix &getInitialTangent(void) {return this->getTangent();};
 	virtual const Matrix &getDampTangent(void);
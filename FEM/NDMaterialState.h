@@ -0,0 +1,51 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/material/nD/NDMaterialState.h
+//
+// Written: fmk
+//
+// Description: This file contains the class definition for
+// NDMaterialState, the history variables of an NDMaterial kept as one
+// block with a trial and a last committed half. State is a struct with the
+// history variables of the material, which it must be possible to copy
+// byte by byte. commit() copies the trial half onto the committed one and
+// revert() the committed half onto the trial one, each one copy of the
+// whole block instead of assigning the variables one at a time.
+//
+// What: "@(#) NDMaterialState.h, revA"
+
+#ifndef NDMaterialState_h
+#define NDMaterialState_h
+
+template <class State>
+class NDMaterialState
+{
+  public:
+    NDMaterialState() :trial(), committed() {}
+
+    void commit(void) { committed = trial; }
+    void revert(void) { trial = committed; }
+
+    State trial;        // trial values, set by setTrialStrain()
+    State committed;    // values at the last commitState()
+};
+
+#endif
@@ -52,8 +52,8 @@
 #include <fstream>
 #include<Parameter.h>
 #include<ParameterIter.h>//Abbas
-static bool converged = false;
-static int count = 0;
+static thread_local bool converged = false;
+static thread_local int count = 0;
 
 void *
 OPS_Newmark(void)
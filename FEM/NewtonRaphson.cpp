@@ -217,7 +217,7 @@ NewtonRaphson::solveCurrentStep(void)
 int
 NewtonRaphson::sendSelf(int cTag, Channel &theChannel)
 {
-  static ID data(1);
+  static thread_local ID data(1);
   data(0) = tangent;
   return theChannel.sendID(this->getDbTag(), cTag, data);
 }
@@ -227,7 +227,7 @@ NewtonRaphson::recvSelf(int cTag,
 			Channel &theChannel, 
 			FEM_ObjectBroker &theBroker)
 {
-  static ID data(1);
+  static thread_local ID data(1);
   theChannel.recvID(this->getDbTag(), cTag, data);
   tangent = data(0);
   return 0;
@@ -39,7 +39,7 @@
 #include <elementAPI.h>
 
 // AddingSensitivity:BEGIN /////////////////////////////////////
-Vector NodalLoad::gradientVector(1);
+thread_local Vector NodalLoad::gradientVector(1);
 // AddingSensitivity:END ///////////////////////////////////////
 
 NodalLoad::NodalLoad(int theClasTag)
@@ -71,7 +71,7 @@ class NodalLoad : public Load
     bool  konstant;     // true if load is load factor independent
     // AddingSensitivity:BEGIN /////////////////////////////////////
     int parameterID;
-    static Vector gradientVector;
+    static thread_local Vector gradientVector;
     // AddingSensitivity:END ///////////////////////////////////////
 };
 
@@ -56,8 +56,8 @@
 #include <OPS_Globals.h>
 #include <elementAPI.h>
 
-Matrix **Node::theMatrices = 0;
-int Node::numMatrices = 0;
+thread_local Matrix **Node::theMatrices = 0;
+thread_local int Node::numMatrices = 0;
 
 int OPS_Node()
 {
@@ -189,7 +189,7 @@ Node::Node(int theClassTag)
  incrDeltaDisp(0),
  disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0), 
- index(-1), reaction(0), displayLocation(0)
+ reaction(0), displayLocation(0)
 {
   // for FEM_ObjectBroker, recvSelf() must be invoked on object
 
@@ -210,7 +210,7 @@ Node::Node(int tag, int theClassTag)
  incrDeltaDisp(0), 
  disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
   R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0), 
- index(-1), reaction(0), displayLocation(0)
+ reaction(0), displayLocation(0)
 {
   // for subclasses - they must implement all the methods with
   // their own data structures.
@@ -231,7 +231,7 @@ Node::Node(int tag, int ndof, double Crd1, Vector *dLoc)
  incrDeltaDisp(0), 
  disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0), 
- index(-1), reaction(0), displayLocation(0)
+ reaction(0), displayLocation(0)
 {
   // AddingSensitivity:BEGIN /////////////////////////////////////////
   dispSensitivity = 0;
@@ -247,34 +247,6 @@ Node::Node(int tag, int ndof, double Crd1, Vector *dLoc)
     displayLocation = new Vector(*dLoc);
   }
   
-  index = -1;
-  if (numMatrices != 0) {
-    for (int i=0; i<numMatrices; i++)
-      if (theMatrices[i]->noRows() == ndof) {
-	index = i;
-	i = numMatrices;
-      }
-  }
-  if (index == -1) {
-    Matrix **nextMatrices = new Matrix *[numMatrices+1];
-    if (nextMatrices == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    for (int j=0; j<numMatrices; j++)
-      nextMatrices[j] = theMatrices[j];
-    Matrix *theMatrix = new Matrix(ndof, ndof);
-    if (theMatrix == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    nextMatrices[numMatrices] = theMatrix;
-    if (numMatrices != 0) 
-      delete [] theMatrices;
-    index = numMatrices;
-    numMatrices++;
-    theMatrices = nextMatrices;
-  }
 }
 
 
@@ -305,34 +277,6 @@ Node::Node(int tag, int ndof, double Crd1, double Crd2, Vector *dLoc)
     displayLocation = new Vector(*dLoc);
   }
   
-  index = -1;
-  if (numMatrices != 0) {
-    for (int i=0; i<numMatrices; i++)
-      if (theMatrices[i]->noRows() == ndof) {
-	index = i;
-	i = numMatrices;
-      }
-  }
-  if (index == -1) {
-    Matrix **nextMatrices = new Matrix *[numMatrices+1];
-    if (nextMatrices == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    for (int j=0; j<numMatrices; j++)
-      nextMatrices[j] = theMatrices[j];
-    Matrix *theMatrix = new Matrix(ndof, ndof);
-    if (theMatrix == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    nextMatrices[numMatrices] = theMatrix;
-    if (numMatrices != 0) 
-      delete [] theMatrices;
-    index = numMatrices;
-    numMatrices++;
-    theMatrices = nextMatrices;
-  }
 }
 
 
@@ -365,34 +309,6 @@ Node::Node(int tag, int ndof, double Crd1, double Crd2, Vector *dLoc)
     displayLocation = new Vector(*dLoc);
   }
   
-  index = -1;
-  if (numMatrices != 0) {
-    for (int i=0; i<numMatrices; i++)
-      if (theMatrices[i]->noRows() == ndof) {
-	index = i;
-	i = numMatrices;
-      }
-  }
-  if (index == -1) {
-    Matrix **nextMatrices = new Matrix *[numMatrices+1];
-    if (nextMatrices == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    for (int j=0; j<numMatrices; j++)
-      nextMatrices[j] = theMatrices[j];
-    Matrix *theMatrix = new Matrix(ndof, ndof);
-    if (theMatrix == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    nextMatrices[numMatrices] = theMatrix;
-    if (numMatrices != 0) 
-      delete [] theMatrices;
-    index = numMatrices;
-    numMatrices++;
-    theMatrices = nextMatrices;
-  }
 }
 
 
@@ -479,34 +395,6 @@ Node::Node(const Node &otherNode, bool copyMass)
     }
   }
 
-  index = -1;
-  if (numMatrices != 0) {
-    for (int i=0; i<numMatrices; i++)
-      if (theMatrices[i]->noRows() == numberDOF) {
-	index = i;
-	i = numMatrices;
-      }
-  }
-  if (index == -1) {
-    Matrix **nextMatrices = new Matrix *[numMatrices+1];
-    if (nextMatrices == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    for (int j=0; j<numMatrices; j++)
-      nextMatrices[j] = theMatrices[j];
-    Matrix *theMatrix = new Matrix(numberDOF, numberDOF);
-    if (theMatrix == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    nextMatrices[numMatrices] = theMatrix;
-    if (numMatrices != 0) 
-      delete [] theMatrices;
-    index = numMatrices;
-    numMatrices++;
-    theMatrices = nextMatrices;
-  }  
 }
 
 
@@ -1222,9 +1110,49 @@ Node::revertToStart()
 }
 
 
+// getWorkArea(int ndof)
+//	returns the location of the ndof x ndof matrix in the work storage
+//	of the calling thread, creating it if needed.
+int
+Node::getWorkArea(int ndof)
+{
+  int index = -1;
+  for (int i=0; i<numMatrices; i++)
+    if (theMatrices[i]->noRows() == ndof) {
+      index = i;
+      i = numMatrices;
+    }
+
+  if (index == -1) {
+    Matrix **nextMatrices = new Matrix *[numMatrices+1];
+    if (nextMatrices == 0) {
+      opserr << "Node::getWorkArea - out of memory\n";
+      exit(-1);
+    }
+    for (int j=0; j<numMatrices; j++)
+      nextMatrices[j] = theMatrices[j];
+    Matrix *theMatrix = new Matrix(ndof, ndof);
+    if (theMatrix == 0) {
+      opserr << "Node::getWorkArea - out of memory\n";
+      exit(-1);
+    }
+    nextMatrices[numMatrices] = theMatrix;
+    if (numMatrices != 0) 
+      delete [] theMatrices;
+    index = numMatrices;
+    numMatrices++;
+    theMatrices = nextMatrices;
+  }
+
+  return index;
+}
+
+
 const Matrix &
 Node::getMass(void) 
 {
+    int index = getWorkArea(numberDOF);
+
     // make sure it was created before we return it
     if (mass == 0) {
       theMatrices[index]->Zero();
@@ -1244,6 +1172,8 @@ Node::setRayleighDampingFactor(double alpham) {
 const Matrix &
 Node::getDamp(void) 
 {
+    int index = getWorkArea(numberDOF);
+
     // make sure it was created before we return it
     if (mass == 0 || alphaM == 0.0) {
       theMatrices[index]->Zero();
@@ -1260,6 +1190,8 @@ Node::getDamp(void)
 const Matrix &
 Node::getDampSensitivity(void) 
 {
+    int index = getWorkArea(numberDOF);
+
     // make sure it was created before we return it
     if (mass == 0 || alphaM == 0.0) {
       theMatrices[index]->Zero();
@@ -1700,34 +1632,6 @@ Node::recvSelf(int cTag, Channel &theChannel,
     }        
 
 
-  index = -1;
-  if (numMatrices != 0) {
-    for (int i=0; i<numMatrices; i++)
-      if (theMatrices[i]->noRows() == numberDOF) {
-	index = i;
-	i = numMatrices;
-      }
-  }
-  if (index == -1) {
-    Matrix **nextMatrices = new Matrix *[numMatrices+1];
-    if (nextMatrices == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    for (int j=0; j<numMatrices; j++)
-      nextMatrices[j] = theMatrices[j];
-    Matrix *theMatrix = new Matrix(numberDOF, numberDOF);
-    if (theMatrix == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    nextMatrices[numMatrices] = theMatrix;
-    if (numMatrices != 0) 
-      delete [] theMatrices;
-    index = numMatrices;
-    numMatrices++;
-    theMatrices = nextMatrices;
-  }
 
   return 0;
 }
@@ -1774,14 +1678,14 @@ Node::displaySelf(Renderer &theRenderer, int displayMode, float fact, const char
     return 0;
 
 //  const Vector &theDisp = this->getDisp();
-  static Vector position(3);
+  static thread_local Vector position(3);
 
   this->getDisplayCrds(position, fact);
 
   
   if (displayMode == -1) { 
     // draw a text string containing tag
-    static char theText[20];
+    static thread_local char theText[20];
     sprintf(theText,"%d",this->getTag());
     return theRenderer.drawText(position, theText, strlen(theText));
 
@@ -1881,6 +1785,8 @@ Node::createAccel(void)
 Matrix
 Node::getMassSensitivity(void)
 {
+	int index = getWorkArea(numberDOF);
+
 	if (mass == 0) {
 		theMatrices[index]->Zero();
 		return *theMatrices[index];
@@ -195,11 +195,9 @@ class Node : public DomainComponent
     int parameterID;
     // AddingSensitivity:END ///////////////////////////////////////////
 
-    static Matrix **theMatrices;
-    static int numMatrices;
-    static Matrix **theVectors;
-    static int numVectors;
-    int index;
+    static int getWorkArea(int ndof);
+    static thread_local Matrix **theMatrices;
+    static thread_local int numMatrices;
 
     Vector *reaction;
     Vector *displayLocation;
@@ -483,11 +483,19 @@ NodeRecorder::record(int commitTag, double timeStamp)
 
   int numDOF = theDofs->Size();
   
-  if (deltaT == 0.0 || timeStamp >= nextTimeStampToRecord) {
+  // rows outside the time window or before the trigger are not recorded
+  if (this->isRecording(timeStamp) == false)
+    return 0;
+
+  // the tolerance keeps round-off in the accumulated time from skipping a record
+  if (deltaT == 0.0 || timeStamp - nextTimeStampToRecord >= -deltaT * 1.0e-5) {
 
     if (deltaT != 0.0) 
       nextTimeStampToRecord = timeStamp + deltaT;
 
+    if (this->isDecimated() == true)
+      return 0;
+
     //
     // if need nodal reactions get the domain to calculate them
     // before we iterate over the nodes
@@ -812,7 +820,7 @@ NodeRecorder::sendSelf(int commitTag, Channel &theChannel)
 
   int numDOF = theDofs->Size();
 
-  static ID idData(8); 
+  static thread_local ID idData(8); 
   idData.Zero();
   if (theDofs != 0)
     idData(0) = numDOF;
@@ -854,7 +862,7 @@ NodeRecorder::sendSelf(int commitTag, Channel &theChannel)
       return -1;
     }
 
-  static Vector data(2);
+  static thread_local Vector data(2);
   data(0) = deltaT;
   data(1) = nextTimeStampToRecord;
   if (theChannel.sendVector(0, commitTag, data) < 0) {
@@ -907,7 +915,7 @@ NodeRecorder::recvSelf(int commitTag, Channel &theChannel,
     return -1;
   }
 
-  static ID idData(8); 
+  static thread_local ID idData(8); 
   if (theChannel.recvID(0, commitTag, idData) < 0) {
     opserr << "NodeRecorder::recvSelf() - failed to send idData\n";
     return -1;
@@ -972,7 +980,7 @@ NodeRecorder::recvSelf(int commitTag, Channel &theChannel,
     } 
 
 
-  static Vector data(2);
+  static thread_local Vector data(2);
   if (theChannel.recvVector(0, commitTag, data) < 0) {
     opserr << "NodeRecorder::sendSelf() - failed to receive data\n";
     return -1;
@@ -1193,12 +1201,11 @@ NodeRecorder::initialize(void)
   char nodeCrdData[20];
   sprintf(nodeCrdData,"coord");
 
+  // the time is the first column whenever it is echoed, as in ElementRecorder
   if (echoTimeFlag == true) {
-    if (theNodalTags != 0 && addColumnInfo == 1) {
-      theOutputHandler->tag("TimeOutput");
-      theOutputHandler->tag("ResponseType", "time");
-      theOutputHandler->endTag();
-    }
+    theOutputHandler->tag("TimeOutput");
+    theOutputHandler->tag("ResponseType", "time");
+    theOutputHandler->endTag();
   }
 
   for (int i=0; i<numValidNodes; i++) {
@@ -39,8 +39,10 @@
 #define _USING_OpenSees_STREAMS
 #include <OPS_Stream.h>
 //extern OPS_Stream &opserr;
-extern OPS_Stream *opserrPtr;
-extern OPS_Stream *opsoutPtr;
+// the streams and the globals below are per thread, so that a thread
+// running its own Domain can send its output to its own streams
+extern thread_local OPS_Stream *opserrPtr;
+extern thread_local OPS_Stream *opsoutPtr;
 #define opserr (*opserrPtr)
 #define opsout (*opsoutPtr)
 #define endln "\n"
@@ -63,14 +65,14 @@ class Element;
 
 #define MAX_FILENAMELENGTH 50
 
-extern double   ops_Dt;                // current delta T for current domain doing an update
+extern thread_local double   ops_Dt;                // current delta T for current domain doing an update
 // extern double  *ops_Gravity;        // gravity factors for current domain undergoing an update
-extern Domain  *ops_TheActiveDomain;   // current domain undergoing an update
-extern Element *ops_TheActiveElement;  // current element undergoing an update
+extern thread_local Domain  *ops_TheActiveDomain;   // current domain undergoing an update
+extern thread_local Element *ops_TheActiveElement;  // current element undergoing an update
 
 // global variable for initial state analysis
 // added: Chris McGann, University of Washington
-extern bool  ops_InitialStateAnalysis;
+extern thread_local bool  ops_InitialStateAnalysis;
 
 #define OPS_DISPLAYMODE_MATERIAL_TAG 2
 #define OPS_DISPLAYMODE_ELEMENT_CLASS 3
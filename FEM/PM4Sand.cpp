@@ -44,6 +44,8 @@
 #define INT_MAXSTR_FE     4
 #define INT_MAXSTR_ME     5
 
+#define BATCH_WIDTH       32  // points evaluated together in setTrialStrains()
+
 const double		PM4Sand::root12 = sqrt(1.0 / 2.0);
 const double		PM4Sand::one3 = 1.0 / 3.0;
 const double		PM4Sand::two3 = 2.0 / 3.0;
@@ -51,19 +53,18 @@ const double		PM4Sand::root23 = sqrt(2.0 / 3.0);
 const double		PM4Sand::small = 1e-10;
 const double		PM4Sand::maxStrainInc = 1e-6;
 const bool  		PM4Sand::debugFlag = false;
-char unsigned		PM4Sand::me2p = 1;
-
-Vector 			PM4Sand::mI1(3);
-Matrix  		PM4Sand::mIIco(3, 3);
-Matrix 			PM4Sand::mIIcon(3, 3);
-Matrix 			PM4Sand::mIImix(3, 3);
-Matrix 			PM4Sand::mIIvol(3, 3);
-Matrix 			PM4Sand::mIIdevCon(3, 3);
-Matrix 			PM4Sand::mIIdevMix(3, 3);
-Matrix 			PM4Sand::mIIdevCo(3, 3);
+
+VoigtVector		PM4Sand::mI1;
+VoigtMatrix		PM4Sand::mIIco;
+VoigtMatrix		PM4Sand::mIIcon;
+VoigtMatrix		PM4Sand::mIImix;
+VoigtMatrix		PM4Sand::mIIvol;
+VoigtMatrix		PM4Sand::mIIdevCon;
+VoigtMatrix		PM4Sand::mIIdevMix;
+VoigtMatrix		PM4Sand::mIIdevCo;
 PM4Sand::initTensors PM4Sand::initTensorOps;
 
-static int numPM4SandMaterials = 0;
+static thread_local int numPM4SandMaterials = 0;
 
 void *
 OPS_PM4SandMaterial(void)
@@ -149,32 +150,12 @@ PM4Sand::PM4Sand(int tag, int classTag, double Dr, double G0, double hp0, double
 	double ce, double phi_cv, double nu, double Cgd, double Cdr, double Ckaf, double Q,
 	double R, double m, double Fsed_min, double p_sdeo, int integrationScheme, int tangentType,
 	double TolF, double TolR) : NDMaterial(tag, classTag),
-	mEpsilon(3),
-	mEpsilon_n(3),
-	mEpsilonE(3),
-	mEpsilonE_n(3),
-	mSigma(3),
-	mSigma_b(3),
-	mSigma_n(3),
-	mAlpha(3),
-	mAlpha_n(3),
-	mAlpha_in(3),
-	mAlpha_in_n(3),
-	mAlpha_in_p(3),
-	mAlpha_in_p_n(3),
-	mAlpha_in_true(3),
-	mAlpha_in_true_n(3),
-	mAlpha_in_max(3),
-	mAlpha_in_max_n(3),
-	mAlpha_in_min(3),
-	mAlpha_in_min_n(3),
-	mFabric(3),
-	mFabric_n(3),
-	mFabric_in(3),
-	mFabric_in_n(3),
-	mCe(3, 3),
-	mCep(3, 3),
-	mCep_Consistent(3, 3),
+	mEpsilon_r(3),
+	mSigma_r(3),
+	mSigma_rec(3),
+	mEpsilonE_r(3),
+	mTangent_r(3, 3),
+	mInitialTangent_r(3, 3),
 	mTracker(3)
 {
 	m_Dr = Dr;
@@ -218,6 +199,7 @@ PM4Sand::PM4Sand(int tag, int classTag, double Dr, double G0, double hp0, double
 	m_FirstCall = 0;
 	m_PostShake = 0;
 	mScheme = integrationScheme;
+	me2p = 1;
 	mTangType = tangentType;
 	mTolF = TolF;
 	mTolR = TolR;
@@ -234,32 +216,12 @@ PM4Sand::PM4Sand(int tag, double Dr, double G0, double hp0, double mDen, double
 	double ce, double phi_cv, double nu, double Cgd, double Cdr, double Ckaf, double Q,//7
 	double R, double m, double Fsed_min, double p_sdeo, int integrationScheme, int tangentType,//6
 	double TolF, double TolR) : NDMaterial(tag, ND_TAG_PM4Sand),//2
-	mEpsilon(3),
-	mEpsilon_n(3),
-	mEpsilonE(3),
-	mEpsilonE_n(3),
-	mSigma(3),
-	mSigma_n(3),
-	mSigma_b(3),
-	mAlpha(3),
-	mAlpha_n(3),
-	mAlpha_in(3),
-	mAlpha_in_n(3),
-	mAlpha_in_p(3),
-	mAlpha_in_p_n(3),
-	mAlpha_in_true(3),
-	mAlpha_in_true_n(3),
-	mAlpha_in_max(3),
-	mAlpha_in_max_n(3),
-	mAlpha_in_min(3),
-	mAlpha_in_min_n(3),
-	mFabric(3),
-	mFabric_n(3),
-	mFabric_in(3),
-	mFabric_in_n(3),
-	mCe(3, 3),
-	mCep(3, 3),
-	mCep_Consistent(3, 3),
+	mEpsilon_r(3),
+	mSigma_r(3),
+	mSigma_rec(3),
+	mEpsilonE_r(3),
+	mTangent_r(3, 3),
+	mInitialTangent_r(3, 3),
 	mTracker(3)
 {
 	m_Dr = Dr;
@@ -303,6 +265,7 @@ PM4Sand::PM4Sand(int tag, double Dr, double G0, double hp0, double mDen, double
 	m_FirstCall = 0;
 	m_PostShake = 0;
 	mScheme = integrationScheme;
+	me2p = 1;
 	mTangType = tangentType;
 	mTolF = TolF;
 	mTolR = TolR;
@@ -316,32 +279,12 @@ PM4Sand::PM4Sand(int tag, double Dr, double G0, double hp0, double mDen, double
 // null constructor
 PM4Sand::PM4Sand()
 	: NDMaterial(),
-	mEpsilon(3),
-	mEpsilon_n(3),
-	mEpsilonE(3),
-	mEpsilonE_n(3),
-	mSigma(3),
-	mSigma_n(3),
-	mSigma_b(3),
-	mAlpha(3),
-	mAlpha_n(3),
-	mAlpha_in(3),
-	mAlpha_in_n(3),
-	mAlpha_in_p(3),
-	mAlpha_in_p_n(3),
-	mAlpha_in_true(3),
-	mAlpha_in_true_n(3),
-	mAlpha_in_max(3),
-	mAlpha_in_max_n(3),
-	mAlpha_in_min(3),
-	mAlpha_in_min_n(3),
-	mFabric(3),
-	mFabric_n(3),
-	mFabric_in(3),
-	mFabric_in_n(3),
-	mCe(3, 3),
-	mCep(3, 3),
-	mCep_Consistent(3, 3),
+	mEpsilon_r(3),
+	mSigma_r(3),
+	mSigma_rec(3),
+	mEpsilonE_r(3),
+	mTangent_r(3, 3),
+	mInitialTangent_r(3, 3),
 	mTracker(3)
 {
 	m_Dr = 0.0;
@@ -371,6 +314,7 @@ PM4Sand::PM4Sand()
 	m_FirstCall = 0;
 	m_PostShake = 0;
 	mScheme = 2;
+	me2p = 1;
 	mTangType = 0;
 	mTolF = 1.0e-9;
 	mTolR = 1.0e-10;
@@ -396,6 +340,7 @@ PM4Sand::getCopy(const char *type)
 		clone = new PM4Sand(this->getTag(), m_Dr, m_G0, m_hpo, massDen, m_P_atm, m_h0, m_emax,
 			m_emin, m_nb, m_nd, m_Ado, m_z_max, m_cz, m_ce, phi_cv, m_nu, m_Cgd, m_Cdr, m_Ckaf, m_Q,
 			m_R, m_m, m_Fsed_min, m_p_sedo, mScheme, mTangType, mTolF, mTolR);
+		clone->me2p = me2p;
 		return clone;
 	}
 	else if (strcmp(type, "ThreeDimensional") == 0 || strcmp(type, "3D") == 0) {
@@ -411,36 +356,25 @@ PM4Sand::getCopy(const char *type)
 int
 PM4Sand::commitState(void)
 {
-	Vector n(3), R(3), dFabric(3);
-
-	mAlpha_in_n = mAlpha_in;
-	mAlpha_n = mAlpha;
-	mAlpha_in_p_n = mAlpha_in_p;
-	mAlpha_in_true_n = mAlpha_in_true;
-	mAlpha_in_max_n = mAlpha_in_max;
-	mAlpha_in_min_n = mAlpha_in_min;
-	mSigma_n = mSigma;
-	mEpsilon_n = mEpsilon;
-	mEpsilonE_n = mEpsilonE;
-	dFabric = mFabric - mFabric_n;
+	VoigtVector n, R, dFabric;
+
+	dFabric = mState.trial.Fabric - mState.committed.Fabric;
 	// update cumulated fabric
 	mzcum = mzcum + sqrt(DoubleDot2_2_Contr(dFabric, dFabric) / 2.0);
-	mzpeak = fmax(sqrt(DoubleDot2_2_Contr(mFabric, mFabric) / 2.0), mzpeak);
-	mFabric_n = mFabric;
-	mFabric_in_n = mFabric_in;
-	mDGamma_n = mDGamma;
-	mVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(mEpsilon);
+	mzpeak = fmax(sqrt(DoubleDot2_2_Contr(mState.trial.Fabric, mState.trial.Fabric) / 2.0), mzpeak);
+	mState.commit();
+	mVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(mState.trial.Epsilon);
 
-	this->GetElasticModuli(mSigma, mK, mG, mMcur, mzcum);
+	this->GetElasticModuli(mState.trial.Sigma, mK, mG, mMcur, mzcum);
 	mCe = GetStiffness(mK, mG);
-	mCep = GetElastoPlasticTangent(mSigma_n, mCe, R, n, mKp);
+	mCep = GetElastoPlasticTangent(mState.committed.Sigma, mCe, R, n, mKp);
 	mCep_Consistent = mCe;
 	return 0;
 }
 
 int PM4Sand::revertToLastCommit(void)
 {
-	// need to be added
+	mState.revert();
 	return 0;
 }
 
@@ -452,7 +386,7 @@ int PM4Sand::revertToStart(void)
 	}
 	else {
 		// normal call for revertToStart (not initialStateAnalysis)
-		this->initialize(mSigma);
+		this->initialize(mState.trial.Sigma);
 	}
 
 	return 0;
@@ -483,22 +417,38 @@ PM4Sand::getOrder(void) const
 Response*
 PM4Sand::setResponse(const char **argv, int argc, OPS_Stream &output)
 {
-	if (strcmp(argv[0], "stress") == 0 || strcmp(argv[0], "stresses") == 0)
-		return new MaterialResponse(this, 1, this->getStress());
-	else if (strcmp(argv[0], "strain") == 0 || strcmp(argv[0], "strains") == 0)
-		return new MaterialResponse(this, 2, this->getStrain());
+	Response *theResponse = 0;
+
+	output.tag("NdMaterialOutput");
+	output.attr("matType", this->getClassType());
+	output.attr("matTag", this->getTag());
+
+	if (strcmp(argv[0], "stress") == 0 || strcmp(argv[0], "stresses") == 0) {
+		output.tag("ResponseType", "sigma11");
+		output.tag("ResponseType", "sigma22");
+		output.tag("ResponseType", "sigma12");
+		theResponse = new MaterialResponse(this, 1, this->getStress());
+	}
+	else if (strcmp(argv[0], "strain") == 0 || strcmp(argv[0], "strains") == 0) {
+		output.tag("ResponseType", "eps11");
+		output.tag("ResponseType", "eps22");
+		output.tag("ResponseType", "eps12");
+		theResponse = new MaterialResponse(this, 2, this->getStrain());
+	}
 	else if (strcmp(argv[0], "state") == 0)
-		return new MaterialResponse(this, 3, this->getState());
+		theResponse = new MaterialResponse(this, 3, this->getState());
 	else if (strcmp(argv[0], "alpha") == 0 || strcmp(argv[0], "backstressratio") == 0)
-		return new MaterialResponse(this, 4, this->getAlpha());
+		theResponse = new MaterialResponse(this, 4, this->getAlpha());
 	else if (strcmp(argv[0], "fabric") == 0)
-		return new MaterialResponse(this, 5, this->getFabric());
+		theResponse = new MaterialResponse(this, 5, this->getFabric());
 	else if (strcmp(argv[0], "alpha_in") == 0 || strcmp(argv[0], "alphain") == 0)
-		return new MaterialResponse(this, 6, this->getAlpha_in());
+		theResponse = new MaterialResponse(this, 6, this->getAlpha_in());
 	else if (strcmp(argv[0], "trackers") == 0 || strcmp(argv[0], "tracker") == 0)
-		return new MaterialResponse(this, 7, this->getTracker());
-	else
-		return 0;
+		theResponse = new MaterialResponse(this, 7, this->getTracker());
+
+	output.endTag(); // NdMaterialOutput
+
+	return theResponse;
 }
 
 int
@@ -545,7 +495,7 @@ PM4Sand::sendSelf(int commitTag, Channel &theChannel)
 {
 
 	int res = 0;
-	static Vector data(101);
+	static thread_local Vector data(101);
 
 	data(0) = this->getTag();
 
@@ -586,8 +536,8 @@ PM4Sand::sendSelf(int commitTag, Channel &theChannel)
 	data(35) = m_pzpFlag;
 	data(36) = me2p;
 
-	data(37) = mDGamma;
-	data(38) = mDGamma_n;
+	data(37) = mState.trial.DGamma;
+	data(38) = mState.committed.DGamma;
 	data(39) = mK;
 	data(40) = mG;
 	data(41) = mVoidRatio;
@@ -600,21 +550,21 @@ PM4Sand::sendSelf(int commitTag, Channel &theChannel)
 	data(48) = mMd;
 	data(49) = mMcur;
 
-	data(50) = mEpsilon(0);		  data(53) = mEpsilon_n(0);	    data(56) = mSigma(0);	data(59) = mSigma_n(0);   data(62) = mSigma_b(0);
-	data(51) = mEpsilon(1);		  data(54) = mEpsilon_n(1);	    data(57) = mSigma(1);	data(60) = mSigma_n(1);	  data(63) = mSigma_b(1);
-	data(52) = mEpsilon(2);		  data(55) = mEpsilon_n(2);	    data(58) = mSigma(2);	data(61) = mSigma_n(2);	  data(64) = mSigma_b(2);
+	data(50) = mState.trial.Epsilon(0);		  data(53) = mState.committed.Epsilon(0);	    data(56) = mState.trial.Sigma(0);	data(59) = mState.committed.Sigma(0);   data(62) = mSigma_b(0);
+	data(51) = mState.trial.Epsilon(1);		  data(54) = mState.committed.Epsilon(1);	    data(57) = mState.trial.Sigma(1);	data(60) = mState.committed.Sigma(1);	  data(63) = mSigma_b(1);
+	data(52) = mState.trial.Epsilon(2);		  data(55) = mState.committed.Epsilon(2);	    data(58) = mState.trial.Sigma(2);	data(61) = mState.committed.Sigma(2);	  data(64) = mSigma_b(2);
 
-	data(65) = mEpsilonE(0);	  data(68) = mEpsilonE_n(0);	data(71) = mAlpha(0);	data(74) = mAlpha_n(0);   data(77) = mAlpha_in_n(0);
-	data(66) = mEpsilonE(1);	  data(69) = mEpsilonE_n(1);	data(72) = mAlpha(1);	data(75) = mAlpha_n(1);	  data(78) = mAlpha_in_n(1);
-	data(67) = mEpsilonE(2);	  data(70) = mEpsilonE_n(2);	data(73) = mAlpha(2);	data(76) = mAlpha_n(2);	  data(79) = mAlpha_in_n(2);
+	data(65) = mState.trial.EpsilonE(0);	  data(68) = mState.committed.EpsilonE(0);	data(71) = mState.trial.Alpha(0);	data(74) = mState.committed.Alpha(0);   data(77) = mState.committed.Alpha_in(0);
+	data(66) = mState.trial.EpsilonE(1);	  data(69) = mState.committed.EpsilonE(1);	data(72) = mState.trial.Alpha(1);	data(75) = mState.committed.Alpha(1);	  data(78) = mState.committed.Alpha_in(1);
+	data(67) = mState.trial.EpsilonE(2);	  data(70) = mState.committed.EpsilonE(2);	data(73) = mState.trial.Alpha(2);	data(76) = mState.committed.Alpha(2);	  data(79) = mState.committed.Alpha_in(2);
 
-	data(80) = mAlpha_in_p_n(0);  data(83) = mAlpha_in_true_n(0);    data(86) = mAlpha_in_max_n(0);      data(89) = mAlpha_in_min_n(0);
-	data(81) = mAlpha_in_p_n(1);  data(84) = mAlpha_in_true_n(1);    data(87) = mAlpha_in_max_n(1);      data(90) = mAlpha_in_min_n(1);
-	data(82) = mAlpha_in_p_n(2);  data(85) = mAlpha_in_true_n(2);    data(88) = mAlpha_in_max_n(2);      data(91) = mAlpha_in_min_n(2);
+	data(80) = mState.committed.Alpha_in_p(0);  data(83) = mState.committed.Alpha_in_true(0);    data(86) = mState.committed.Alpha_in_max(0);      data(89) = mState.committed.Alpha_in_min(0);
+	data(81) = mState.committed.Alpha_in_p(1);  data(84) = mState.committed.Alpha_in_true(1);    data(87) = mState.committed.Alpha_in_max(1);      data(90) = mState.committed.Alpha_in_min(1);
+	data(82) = mState.committed.Alpha_in_p(2);  data(85) = mState.committed.Alpha_in_true(2);    data(88) = mState.committed.Alpha_in_max(2);      data(91) = mState.committed.Alpha_in_min(2);
 
-	data(92) = mFabric(0);		data(95) = mFabric_n(0);	 data(98) = mFabric_in_n(0);
-	data(93) = mFabric(1);		data(96) = mFabric_n(1);	 data(99) = mFabric_in_n(1);
-	data(94) = mFabric(2);		data(97) = mFabric_n(2);	 data(100) = mFabric_in_n(2);
+	data(92) = mState.trial.Fabric(0);		data(95) = mState.committed.Fabric(0);	 data(98) = mState.committed.Fabric_in(0);
+	data(93) = mState.trial.Fabric(1);		data(96) = mState.committed.Fabric(1);	 data(99) = mState.committed.Fabric_in(1);
+	data(94) = mState.trial.Fabric(2);		data(97) = mState.committed.Fabric(2);	 data(100) = mState.committed.Fabric_in(2);
 
 	res = theChannel.sendVector(this->getDbTag(), commitTag, data);
 	if (res < 0) {
@@ -630,7 +580,7 @@ PM4Sand::recvSelf(int commitTag, Channel &theChannel,
 	FEM_ObjectBroker &theBroker)
 {
 	int res = 0;
-	static Vector data(101);
+	static thread_local Vector data(101);
 
 	res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 	if (res < 0) {
@@ -676,8 +626,8 @@ PM4Sand::recvSelf(int commitTag, Channel &theChannel,
 	m_pzpFlag = data(35);
 	me2p = data(36);
 
-	mDGamma = data(37);
-	mDGamma_n = data(38);
+	mState.trial.DGamma = data(37);
+	mState.committed.DGamma = data(38);
 	mK = data(39);
 	mG = data(40);
 	mVoidRatio = data(41);
@@ -690,21 +640,21 @@ PM4Sand::recvSelf(int commitTag, Channel &theChannel,
 	mMd = data(48);
 	mMcur = data(49);
 
-	mEpsilon(0) = data(50);		  mEpsilon_n(0) = data(53);	    mSigma(0) = data(56);	mSigma_n(0) = data(59);   mSigma_b(0) = data(62);
-	mEpsilon(1) = data(51);		  mEpsilon_n(1) = data(54);	    mSigma(1) = data(57);	mSigma_n(1) = data(60);	  mSigma_b(1) = data(63);
-	mEpsilon(2) = data(52);		  mEpsilon_n(2) = data(55);	    mSigma(2) = data(58);	mSigma_n(2) = data(61);	  mSigma_b(2) = data(64);
+	mState.trial.Epsilon(0) = data(50);		  mState.committed.Epsilon(0) = data(53);	    mState.trial.Sigma(0) = data(56);	mState.committed.Sigma(0) = data(59);   mSigma_b(0) = data(62);
+	mState.trial.Epsilon(1) = data(51);		  mState.committed.Epsilon(1) = data(54);	    mState.trial.Sigma(1) = data(57);	mState.committed.Sigma(1) = data(60);	  mSigma_b(1) = data(63);
+	mState.trial.Epsilon(2) = data(52);		  mState.committed.Epsilon(2) = data(55);	    mState.trial.Sigma(2) = data(58);	mState.committed.Sigma(2) = data(61);	  mSigma_b(2) = data(64);
 
-	mEpsilonE(0) = data(65);	  mEpsilonE_n(0) = data(68);	mAlpha(0) = data(71);	mAlpha_n(0) = data(74);   mAlpha_in_n(0) = data(77);
-	mEpsilonE(1) = data(66);	  mEpsilonE_n(1) = data(69);	mAlpha(1) = data(72);	mAlpha_n(1) = data(75);	  mAlpha_in_n(1) = data(78);
-	mEpsilonE(2) = data(67);	  mEpsilonE_n(2) = data(70);	mAlpha(2) = data(73);	mAlpha_n(2) = data(76);	  mAlpha_in_n(2) = data(79);
+	mState.trial.EpsilonE(0) = data(65);	  mState.committed.EpsilonE(0) = data(68);	mState.trial.Alpha(0) = data(71);	mState.committed.Alpha(0) = data(74);   mState.committed.Alpha_in(0) = data(77);
+	mState.trial.EpsilonE(1) = data(66);	  mState.committed.EpsilonE(1) = data(69);	mState.trial.Alpha(1) = data(72);	mState.committed.Alpha(1) = data(75);	  mState.committed.Alpha_in(1) = data(78);
+	mState.trial.EpsilonE(2) = data(67);	  mState.committed.EpsilonE(2) = data(70);	mState.trial.Alpha(2) = data(73);	mState.committed.Alpha(2) = data(76);	  mState.committed.Alpha_in(2) = data(79);
 
-	mAlpha_in_p_n(0) = data(80);  mAlpha_in_true_n(0) = data(83);    mAlpha_in_max_n(0) = data(86);      mAlpha_in_min_n(0) = data(89);
-	mAlpha_in_p_n(1) = data(81);  mAlpha_in_true_n(1) = data(84);    mAlpha_in_max_n(1) = data(87);      mAlpha_in_min_n(1) = data(90);
-	mAlpha_in_p_n(2) = data(82);  mAlpha_in_true_n(2) = data(85);    mAlpha_in_max_n(2) = data(88);      mAlpha_in_min_n(2) = data(91);
+	mState.committed.Alpha_in_p(0) = data(80);  mState.committed.Alpha_in_true(0) = data(83);    mState.committed.Alpha_in_max(0) = data(86);      mState.committed.Alpha_in_min(0) = data(89);
+	mState.committed.Alpha_in_p(1) = data(81);  mState.committed.Alpha_in_true(1) = data(84);    mState.committed.Alpha_in_max(1) = data(87);      mState.committed.Alpha_in_min(1) = data(90);
+	mState.committed.Alpha_in_p(2) = data(82);  mState.committed.Alpha_in_true(2) = data(85);    mState.committed.Alpha_in_max(2) = data(88);      mState.committed.Alpha_in_min(2) = data(91);
 
-	mFabric(0) = data(92);		mFabric_n(0) = data(95);	 mFabric_in_n(0) = data(98);
-	mFabric(1) = data(93);		mFabric_n(1) = data(96);	 mFabric_in_n(1) = data(99);
-	mFabric(2) = data(94);		mFabric_n(2) = data(97);	 mFabric_in_n(2) = data(100);
+	mState.trial.Fabric(0) = data(92);		mState.committed.Fabric(0) = data(95);	 mState.committed.Fabric_in(0) = data(98);
+	mState.trial.Fabric(1) = data(93);		mState.committed.Fabric(1) = data(96);	 mState.committed.Fabric_in(1) = data(99);
+	mState.trial.Fabric(2) = data(94);		mState.committed.Fabric(2) = data(97);	 mState.committed.Fabric_in(2) = data(100);
 	return 0;
 }
 
@@ -781,19 +731,19 @@ PM4Sand::updateParameter(int responseID, Information &info)
 	//called update first call
 	else if (responseID == 8) {
 		m_FirstCall = info.theInt;
-		initialize(mSigma_n);
+		initialize(mState.committed.Sigma);
 		opserr << this->getTag() << " initialize" << endln;
 	}
 	// called update voidRatio
 	else if (responseID == 9) {
-		double eps_v = GetTrace(mEpsilon);
+		double eps_v = GetTrace(mState.trial.Epsilon);
 		m_e_init = (info.theDouble + eps_v) / (1 - eps_v);
 	}
 	// called PostShake
 	else if (responseID == 13) {
 		m_PostShake = 1;
 		// mElastFlag = 1;
-		GetElasticModuli(mSigma, mK, mG, mMcur, mzcum);
+		GetElasticModuli(mState.trial.Sigma, mK, mG, mMcur, mzcum);
 		opserr << this->getTag() << " activate post shaking reconsolidation" << endln;
 	}
 	else {
@@ -805,6 +755,12 @@ PM4Sand::updateParameter(int responseID, Information &info)
 
 int
 PM4Sand::initialize(Vector initStress)
+{
+	return this->initialize(VoigtVector(initStress));
+}
+
+int
+PM4Sand::initialize(const VoigtVector& initStress)
 {
 	double p0;
 	p0 = 0.5 * GetTrace(initStress);
@@ -818,16 +774,16 @@ PM4Sand::initialize(Vector initStress)
 			opserr << "Warning, initial p is small. \n";
 		//initial p is small, set p to p_min and store the difference(mSigmab), the difference
 		//will be added to the stress returned to element
-		mSigma_n = m_Pmin * mI1;
-		mSigma_b = initStress - mSigma_n;
+		mState.committed.Sigma = m_Pmin * mI1;
+		mSigma_b = initStress - mState.committed.Sigma;
 		p0 = m_Pmin;
-		mAlpha.Zero();
-		mAlpha_n.Zero();
+		mState.trial.Alpha.Zero();
+		mState.committed.Alpha.Zero();
 	}
 	else {
-		mSigma_n = initStress;
+		mState.committed.Sigma = initStress;
 		mSigma_b.Zero();
-		mAlpha_n = GetDevPart(initStress) / p0 ;
+		mState.committed.Alpha = GetDevPart(initStress) / p0 ;
 	}
 
 	double ksi = GetKsi(m_Dr, p0);
@@ -859,36 +815,36 @@ PM4Sand::initialize(Vector initStress)
 
 	// check if initial stresses are inside bounding/dilatancy surface 
 	double Mcut = fmax(mMb, mMd);
-	double Mfin = sqrt(2) * GetNorm_Contr(GetDevPart(mSigma_n));
+	double Mfin = sqrt(2) * GetNorm_Contr(GetDevPart(mState.committed.Sigma));
 	Mfin = Mfin / p0;
 	if (Mfin > Mcut)
 	{
-		Vector r = (mSigma_n - p0 * mI1) / p0 * Mcut / Mfin;
+		VoigtVector r = (mState.committed.Sigma - p0 * mI1) / p0 * Mcut / Mfin;
 		// initial stress outside bounding/dilatancy surface, scale shear stress and store the difference(mSigma_b),
 		// the difference will be added to the stress returned to element to maintain global equilibrium
-		mSigma_n = p0 * mI1 + r * p0;
-		mSigma_b = initStress - mSigma_n;
-		mAlpha_n = r * (Mcut - m_m) / Mcut;
+		mState.committed.Sigma = p0 * mI1 + r * p0;
+		mSigma_b = initStress - mState.committed.Sigma;
+		mState.committed.Alpha = r * (Mcut - m_m) / Mcut;
 	}
 	mzcum = 0.0;
-	GetElasticModuli(mSigma_n, mK, mG, mMcur, mzcum);
+	GetElasticModuli(mState.committed.Sigma, mK, mG, mMcur, mzcum);
 	mCe = mCep = mCep_Consistent = GetStiffness(mK, mG);
 	mKp = 100 * mG;
-	mAlpha = mAlpha_n;
-	mAlpha_in.Zero();
-	mAlpha_in_n.Zero();
-	mAlpha_in_p.Zero();
-	mAlpha_in_p_n.Zero();
-	mAlpha_in_true = mAlpha_n;
-	mAlpha_in_true_n = mAlpha_n;
-	mAlpha_in_max = mAlpha_n;
-	mAlpha_in_max_n = mAlpha_n;
-	mAlpha_in_min = mAlpha_n;
-	mAlpha_in_min_n = mAlpha_n;
-	mFabric.Zero();
-	mFabric_in.Zero();
-	mFabric_in_n.Zero();
-	mFabric_n.Zero();
+	mState.trial.Alpha = mState.committed.Alpha;
+	mState.trial.Alpha_in.Zero();
+	mState.committed.Alpha_in.Zero();
+	mState.trial.Alpha_in_p.Zero();
+	mState.committed.Alpha_in_p.Zero();
+	mState.trial.Alpha_in_true = mState.committed.Alpha;
+	mState.committed.Alpha_in_true = mState.committed.Alpha;
+	mState.trial.Alpha_in_max = mState.committed.Alpha;
+	mState.committed.Alpha_in_max = mState.committed.Alpha;
+	mState.trial.Alpha_in_min = mState.committed.Alpha;
+	mState.committed.Alpha_in_min = mState.committed.Alpha;
+	mState.trial.Fabric.Zero();
+	mState.trial.Fabric_in.Zero();
+	mState.committed.Fabric_in.Zero();
+	mState.committed.Fabric.Zero();
 	// internal parameter tracker
 	mTracker.Zero();
 	mzpeak = m_z_max / 100000.0;
@@ -903,7 +859,7 @@ int
 PM4Sand::initialize()
 {
 	// set Initial parameters with p = p_atm
-	Vector mSig(3);
+	VoigtVector mSig;
 	m_Pmin = m_P_atm / 200.0;
 	m_Pmin2 = m_Pmin * 5.0;
 	mSig(0) = m_P_atm;
@@ -918,7 +874,8 @@ PM4Sand::initialize()
 
 int
 PM4Sand::setTrialStrain(const Vector &strain_from_element) {
-	mEpsilon = -1.0 * strain_from_element;   // -1.0 is for geotechnical sign convention
+	mState.revert();   // the step starts from the last committed state
+	mState.trial.Epsilon = -1.0 * VoigtVector(strain_from_element);   // -1.0 is for geotechnical sign convention
 	integrate();
 	return 0;
 }
@@ -930,17 +887,125 @@ PM4Sand::setTrialStrain(const Vector &v, const Vector &r)
 	return this->setTrialStrain(v);
 }
 
+// batched trial strain function
+int
+PM4Sand::setTrialStrains(int numMaterials, NDMaterial **theMaterials, const Vector **theStrains)
+{
+	for (int i = 0; i < numMaterials; i++)
+		if (theMaterials[i]->getClassTag() != this->getClassTag())
+			return NDMaterial::setTrialStrains(numMaterials, theMaterials, theStrains);
+
+	// The points are done BATCH_WIDTH at a time. Their trial strains and the
+	// committed state needed by the elastic predictor of explicit_integrator()
+	// are gathered into one array per component, and the trial stress and
+	// yield function of all of them are computed in a loop without branches.
+	// The points that stay inside the yield surface are finished from these
+	// arrays; the others, and the ones forced to be elastic, are masked out
+	// and integrated one by one with their sub-stepping.
+	double eps0[BATCH_WIDTH], eps1[BATCH_WIDTH], eps2[BATCH_WIDTH];
+	double epsn0[BATCH_WIDTH], epsn1[BATCH_WIDTH], epsn2[BATCH_WIDTH];
+	double sign0[BATCH_WIDTH], sign1[BATCH_WIDTH], sign2[BATCH_WIDTH];
+	double alpha0[BATCH_WIDTH], alpha1[BATCH_WIDTH], alpha2[BATCH_WIDTH];
+	double G[BATCH_WIDTH], K[BATCH_WIDTH], m[BATCH_WIDTH], tolF[BATCH_WIDTH];
+	double sig0[BATCH_WIDTH], sig1[BATCH_WIDTH], sig2[BATCH_WIDTH];
+	bool e2p[BATCH_WIDTH], elastic[BATCH_WIDTH];
+	const double I0 = mI1(0), I1 = mI1(1), I2 = mI1(2);
+
+	for (int start = 0; start < numMaterials; start += BATCH_WIDTH) {
+		int num = (numMaterials - start < BATCH_WIDTH) ? (numMaterials - start) : BATCH_WIDTH;
+		PM4Sand **theMats = (PM4Sand **)(theMaterials + start);
+
+		for (int i = 0; i < num; i++) {
+			PM4Sand *theMat = theMats[i];
+			const Vector &strain = *theStrains[start + i];
+			eps0[i] = -1.0 * strain(0);   // -1.0 is for geotechnical sign convention
+			eps1[i] = -1.0 * strain(1);
+			eps2[i] = -1.0 * strain(2);
+			epsn0[i] = theMat->mState.committed.Epsilon(0);
+			epsn1[i] = theMat->mState.committed.Epsilon(1);
+			epsn2[i] = theMat->mState.committed.Epsilon(2);
+			sign0[i] = theMat->mState.committed.Sigma(0);
+			sign1[i] = theMat->mState.committed.Sigma(1);
+			sign2[i] = theMat->mState.committed.Sigma(2);
+			alpha0[i] = theMat->mState.committed.Alpha(0);
+			alpha1[i] = theMat->mState.committed.Alpha(1);
+			alpha2[i] = theMat->mState.committed.Alpha(2);
+			G[i] = theMat->mG;
+			K[i] = theMat->mK;
+			m[i] = theMat->m_m;
+			tolF[i] = theMat->mTolF;
+			e2p[i] = (theMat->me2p != 0);
+		}
+
+		// elastic predictor, in the order of the operations of explicit_integrator()
+		for (int i = 0; i < num; i++) {
+			double dEps0 = eps0[i] - epsn0[i];
+			double dEps1 = eps1[i] - epsn1[i];
+			double dEps2 = eps2[i] - epsn2[i];
+			double dVolStrain = dEps0 + dEps1;
+			double dVol3 = dVolStrain / 3.0;
+			double dDev0 = dEps0 - dVol3 * I0;
+			double dDev1 = dEps1 - dVol3 * I1;
+			double dDev2 = (dEps2 - dVol3 * I2) * 0.5;
+			double twoG = 2 * G[i];
+			double KdVol = K[i] * dVolStrain;
+			sig0[i] = sign0[i] + (twoG * dDev0 + KdVol * I0);
+			sig1[i] = sign1[i] + (twoG * dDev1 + KdVol * I1);
+			sig2[i] = sign2[i] + (twoG * dDev2 + KdVol * I2);
+
+			// GetF(NextStress, CurAlpha)
+			double tr = sig0[i] + sig1[i];
+			double p = 0.5 * tr;
+			double s0 = (sig0[i] - 0.5 * tr) - p * alpha0[i];
+			double s1 = (sig1[i] - 0.5 * tr) - p * alpha1[i];
+			double s2 = sig2[i] - p * alpha2[i];
+			double f = sqrt((s0 * s0 + s1 * s1) + (s2 * s2 + s2 * s2)) - root12 * m[i] * p;
+			elastic[i] = e2p[i] && (f <= tolF[i]);
+		}
+
+		for (int i = 0; i < num; i++) {
+			PM4Sand *theMat = theMats[i];
+			State &trial = theMat->mState.trial;
+			const State &committed = theMat->mState.committed;
+			theMat->mState.revert();
+			trial.Epsilon(0) = eps0[i];
+			trial.Epsilon(1) = eps1[i];
+			trial.Epsilon(2) = eps2[i];
+			if (!elastic[i]) {
+				theMat->integrate();
+				continue;
+			}
+
+			// pure elastic loading/unloading
+			theMat->mIter = 0;
+			theMat->update_reversal();
+			theMat->mVoidRatio = theMat->m_e_init - (1 + theMat->m_e_init) * GetTrace(trial.Epsilon);
+			trial.EpsilonE = committed.EpsilonE + trial.Epsilon - committed.Epsilon;
+			theMat->mCe = theMat->GetStiffness(theMat->mK, theMat->mG);
+			trial.Sigma(0) = sig0[i];
+			trial.Sigma(1) = sig1[i];
+			trial.Sigma(2) = sig2[i];
+			trial.DGamma = 0;
+			theMat->mCep_Consistent = theMat->mCep = theMat->mCe;
+		}
+	}
+
+	return 0;
+}
+
 //send back the state parameters to the recorders
 const Vector
 PM4Sand::getState()
 {
 	Vector result(16);
-	result.Assemble(mEpsilonE, 0, 1.0);
-	result.Assemble(mAlpha_n, 3, 1.0);
-	result.Assemble(mFabric_n, 6, 1.0);
-	result.Assemble(mAlpha_in_n, 9, 1.0);
+	for (int i = 0; i < 3; i++) {
+		result(i) = mState.trial.EpsilonE(i);
+		result(3 + i) = mState.committed.Alpha(i);
+		result(6 + i) = mState.committed.Fabric(i);
+		result(9 + i) = mState.committed.Alpha_in(i);
+	}
 	result(12) = mVoidRatio;
-	result(13) = mDGamma_n;
+	result(13) = mState.committed.DGamma;
 	result(14) = mG;
 	result(15) = mKp;
 
@@ -950,19 +1015,25 @@ PM4Sand::getState()
 const Vector
 PM4Sand::getAlpha()
 {
-	return mAlpha_n;
+	Vector result(3);
+	mState.committed.Alpha.copyTo(result);
+	return result;
 }
 //send back fabric tensor
 const Vector
 PM4Sand::getFabric()
 {
-	return mFabric_n;
+	Vector result(3);
+	mState.committed.Fabric.copyTo(result);
+	return result;
 }
 //send back alpha_in tensor
 const Vector
 PM4Sand::getAlpha_in()
 {
-	return mAlpha_in_n;
+	Vector result(3);
+	mState.committed.Alpha_in.copyTo(result);
+	return result;
 }
 //send back internal parameter for tracking
 const Vector
@@ -987,44 +1058,49 @@ PM4Sand::getG()
 const Vector
 PM4Sand::getAlpha_in_p()
 {
-	return mAlpha_in_p_n;
+	Vector result(3);
+	mState.committed.Alpha_in_p.copyTo(result);
+	return result;
 }
 //send back previous L
 double
 PM4Sand::getDGamma()
 {
-	return mDGamma_n;
+	return mState.committed.DGamma;
 }
 /*************************************************************/
 const Matrix&
 PM4Sand::getTangent() {
 	if (mTangType == 0)
-		return mCe;
+		mCe.copyTo(mTangent_r);
 	else if (mTangType == 1)
-		return mCep;
-	else return mCep_Consistent;
+		mCep.copyTo(mTangent_r);
+	else
+		mCep_Consistent.copyTo(mTangent_r);
+	return mTangent_r;
 }
 /*************************************************************/
 const Matrix &
 PM4Sand::getInitialTangent() {
-	return mCe;
+	mCe.copyTo(mInitialTangent_r);
+	return mInitialTangent_r;
 }
 /*************************************************************/
 const Vector &
 PM4Sand::getStress() {
-	mSigma_r = -1.0 * (mSigma + mSigma_b);
+	(-1.0 * (mState.trial.Sigma + mSigma_b)).copyTo(mSigma_r);
 	return  mSigma_r;  // -1.0 is for geotechnical sign convention
 }
 /*************************************************************/
 const Vector &
 PM4Sand::getStrain() {
-	mEpsilon_r = -1.0 * mEpsilon;   // -1.0 is for geotechnical sign convention
+	(-1.0 * mState.trial.Epsilon).copyTo(mEpsilon_r);   // -1.0 is for geotechnical sign convention
 	return mEpsilon_r;
 }
 /*************************************************************/
 const Vector &
 PM4Sand::getElasticStrain() {
-	mEpsilonE_r = -1.0 * mEpsilonE;   // -1.0 is for geotechnical sign convention
+	(-1.0 * mState.trial.EpsilonE).copyTo(mEpsilonE_r);   // -1.0 is for geotechnical sign convention
 	return mEpsilonE_r;
 }
 // -------------------------------------------------------------------------------------------------------
@@ -1033,27 +1109,41 @@ PM4Sand::getElasticStrain() {
 /*************************************************************/
 void PM4Sand::integrate()
 {
-	mAlpha = mAlpha_n;
-	mAlpha_in = mAlpha_in_n;
-	mAlpha_in_true = mAlpha_in_true_n;
-	mAlpha_in_p = mAlpha_in_p_n;
-	mAlpha_in_max = mAlpha_in_max_n;
-	mAlpha_in_min = mAlpha_in_min_n;
-	mFabric = mFabric_n;
-	mFabric_in = mFabric_in_n;
-
-	Vector n_tr(3);
-	n_tr = GetNormalToYield(mSigma_n + mCe*(mEpsilon - mEpsilon_n), mAlpha);
-	// n_tr = GetNormalToYield(mSigma_n, mAlpha);
-	if ((DoubleDot2_2_Contr(mAlpha - mAlpha_in_true, n_tr) < 0.0) && me2p) {
-		mAlpha_in_p = mAlpha_in;
-		mAlpha_in_true = mAlpha;
-		mFabric_in = mFabric;
+	mIter = 0;
+	update_reversal();
+
+	// Force elastic response
+	if (me2p == 0) {
+		elastic_integrator(mState.committed.Sigma, mState.committed.Epsilon, mState.committed.EpsilonE, mState.trial.Epsilon, mState.trial.EpsilonE, mState.trial.Sigma, mState.trial.Alpha,
+			mVoidRatio, mG, mK, mCe, mCep, mCep_Consistent);
+	}
+	// ElastoPlastic response
+	else {
+		// explicit schemes
+		explicit_integrator(mState.committed.Sigma, mState.committed.Epsilon, mState.committed.EpsilonE, mState.committed.Alpha, mState.committed.Fabric, mState.trial.Alpha_in,
+			mState.trial.Alpha_in_p, mState.trial.Epsilon, mState.trial.EpsilonE, mState.trial.Sigma, mState.trial.Alpha, mState.trial.Fabric, mState.trial.DGamma, mVoidRatio, mG,
+			mK, mCe, mCep, mCep_Consistent);
+	}
+
+}
+// -------------------------------------------------------------------------------------------------------
+/*************************************************************/
+// Loading reversal
+/*************************************************************/
+void PM4Sand::update_reversal()
+{
+	VoigtVector n_tr;
+	n_tr = GetNormalToYield(mState.committed.Sigma + mCe*(mState.trial.Epsilon - mState.committed.Epsilon), mState.trial.Alpha);
+	// n_tr = GetNormalToYield(mState.committed.Sigma, mState.trial.Alpha);
+	if ((DoubleDot2_2_Contr(mState.trial.Alpha - mState.trial.Alpha_in_true, n_tr) < 0.0) && me2p) {
+		mState.trial.Alpha_in_p = mState.trial.Alpha_in;
+		mState.trial.Alpha_in_true = mState.trial.Alpha;
+		mState.trial.Fabric_in = mState.trial.Fabric;
 		// This is a loading reversal
 		// update pzp
-		double p = 0.5 * GetTrace(mSigma_n);
+		double p = 0.5 * GetTrace(mState.committed.Sigma);
 		p = (p <= m_Pmin) ? (m_Pmin) : p;
-		double zxpTemp = GetNorm_Contr(mFabric_n) * p;
+		double zxpTemp = GetNorm_Contr(mState.committed.Fabric) * p;
 		if (((zxpTemp > mzxp) && (p > mpzp)) || m_pzpFlag) {
 			mzxp = zxpTemp;
 			mpzp = p;
@@ -1061,51 +1151,37 @@ void PM4Sand::integrate()
 		}
 		// track initial back-stress ratio history 
 		for (int ii = 0; ii < 3; ii++) {
-			if (mAlpha_in(ii) > 0.0)
+			if (mState.trial.Alpha_in(ii) > 0.0)
 				// minimum positive value
-				mAlpha_in_min(ii) = fmin(mAlpha_in_min(ii), mAlpha(ii));
+				mState.trial.Alpha_in_min(ii) = fmin(mState.trial.Alpha_in_min(ii), mState.trial.Alpha(ii));
 			else
 				// maximum negative value
-				mAlpha_in_max(ii) = fmax(mAlpha_in_max(ii), mAlpha(ii));
+				mState.trial.Alpha_in_max(ii) = fmax(mState.trial.Alpha_in_max(ii), mState.trial.Alpha(ii));
 		}
-		if (mAlpha(2) * mAlpha_in_p(2) > 0) {
+		if (mState.trial.Alpha(2) * mState.trial.Alpha_in_p(2) > 0) {
 			for (int ii = 0; ii < 3; ii++) {
 				if (n_tr(ii) > 0.0)
 					// positive loading direction
-					mAlpha_in(ii) = fmax(0.0, mAlpha_in_min(ii));
+					mState.trial.Alpha_in(ii) = fmax(0.0, mState.trial.Alpha_in_min(ii));
 				else
 					// negative loading direction
-					mAlpha_in(ii) = fmin(0.0, mAlpha_in_max(ii));
+					mState.trial.Alpha_in(ii) = fmin(0.0, mState.trial.Alpha_in_max(ii));
 			}
 		}
 		else {
-			mAlpha_in = mAlpha;
+			mState.trial.Alpha_in = mState.trial.Alpha;
 		}
 	}
-
-	// Force elastic response
-	if (me2p == 0) {
-		elastic_integrator(mSigma_n, mEpsilon_n, mEpsilonE_n, mEpsilon, mEpsilonE, mSigma, mAlpha,
-			mVoidRatio, mG, mK, mCe, mCep, mCep_Consistent);
-	}
-	// ElastoPlastic response
-	else {
-		// explicit schemes
-		explicit_integrator(mSigma_n, mEpsilon_n, mEpsilonE_n, mAlpha_n, mFabric_n, mAlpha_in,
-			mAlpha_in_p, mEpsilon, mEpsilonE, mSigma, mAlpha, mFabric, mDGamma, mVoidRatio, mG,
-			mK, mCe, mCep, mCep_Consistent);
-	}
-
 }
 // -------------------------------------------------------------------------------------------------------
 /*************************************************************/
 // Elastic Integrator
 /*************************************************************/
-void PM4Sand::elastic_integrator(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
-	const Vector& NextStrain, Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha,
-	double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent)
+void PM4Sand::elastic_integrator(const VoigtVector& CurStress, const VoigtVector& CurStrain, const VoigtVector& CurElasticStrain,
+	const VoigtVector& NextStrain, VoigtVector& NextElasticStrain, VoigtVector& NextStress, VoigtVector& NextAlpha,
+	double& NextVoidRatio, double& G, double& K, VoigtMatrix& aC, VoigtMatrix& aCep, VoigtMatrix& aCep_Consistent)
 {
-	Vector dStrain(3);
+	VoigtVector dStrain;
 
 	// calculate elastic response
 	dStrain = NextStrain - CurStrain;
@@ -1124,15 +1200,15 @@ void PM4Sand::elastic_integrator(const Vector& CurStress, const Vector& CurStrai
 /*************************************************************/
 // Explicit Integrator
 /*************************************************************/
-void PM4Sand::explicit_integrator(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
-	const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& alpha_in_p, const Vector& NextStrain,
-	Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
-	double& NextL, double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent)
+void PM4Sand::explicit_integrator(const VoigtVector& CurStress, const VoigtVector& CurStrain, const VoigtVector& CurElasticStrain,
+	const VoigtVector& CurAlpha, const VoigtVector& CurFabric, const VoigtVector& alpha_in, const VoigtVector& alpha_in_p, const VoigtVector& NextStrain,
+	VoigtVector& NextElasticStrain, VoigtVector& NextStress, VoigtVector& NextAlpha, VoigtVector& NextFabric,
+	double& NextL, double& NextVoidRatio, double& G, double& K, VoigtMatrix& aC, VoigtMatrix& aCep, VoigtMatrix& aCep_Consistent)
 {
 	// function pointer to the integration scheme
-	void (PM4Sand::*exp_int) (const Vector&, const Vector&, const Vector&, const Vector&, const Vector&, const Vector&,
-		const Vector&, const Vector&, Vector&, Vector&, Vector&, Vector&, double&, double&, double&, double&,
-		Matrix&, Matrix&, Matrix&);
+	void (PM4Sand::*exp_int) (const VoigtVector&, const VoigtVector&, const VoigtVector&, const VoigtVector&, const VoigtVector&, const VoigtVector&,
+		const VoigtVector&, const VoigtVector&, VoigtVector&, VoigtVector&, VoigtVector&, VoigtVector&, double&, double&, double&, double&,
+		VoigtMatrix&, VoigtMatrix&, VoigtMatrix&);
 
 	switch (mScheme) {
 	case INT_ForwardEuler:	// Forward Euler
@@ -1156,7 +1232,7 @@ void PM4Sand::explicit_integrator(const Vector& CurStress, const Vector& CurStra
 	}
 
 	double elasticRatio, f, fn, dVolStrain;
-	Vector dSigma(3), dDevStrain(3), n(3);
+	VoigtVector dSigma, dDevStrain, n;
 
 	NextVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(NextStrain);
 	NextElasticStrain = CurElasticStrain + NextStrain - CurStrain;
@@ -1228,14 +1304,15 @@ void PM4Sand::explicit_integrator(const Vector& CurStress, const Vector& CurStra
 /*************************************************************/
 // Forward-Euler Integrator
 /*************************************************************/
-void PM4Sand::ForwardEuler(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
-	const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& alpha_in_p, const Vector& NextStrain,
-	Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
-	double& NextL, double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent)
+void PM4Sand::ForwardEuler(const VoigtVector& CurStress, const VoigtVector& CurStrain, const VoigtVector& CurElasticStrain,
+	const VoigtVector& CurAlpha, const VoigtVector& CurFabric, const VoigtVector& alpha_in, const VoigtVector& alpha_in_p, const VoigtVector& NextStrain,
+	VoigtVector& NextElasticStrain, VoigtVector& NextStress, VoigtVector& NextAlpha, VoigtVector& NextFabric,
+	double& NextL, double& NextVoidRatio, double& G, double& K, VoigtMatrix& aC, VoigtMatrix& aCep, VoigtMatrix& aCep_Consistent)
 {
 	double CurVoidRatio, CurDr, Cka, h, p, dVolStrain, D, AlphaAlphaBDotN;
-	Vector n(3), R(3), alphaD(3), dPStrain(3), b(3), dDevStrain(3), r(3);
-	Vector dSigma(3), dAlpha(3), dFabric(3);
+	VoigtVector n, R, alphaD, dPStrain, b, dDevStrain, r;
+	VoigtVector dSigma, dAlpha, dFabric;
+	mIter++;
 
 	CurVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(CurStrain);
 	CurDr = (m_emax - CurVoidRatio) / (m_emax - m_emin);
@@ -1244,7 +1321,7 @@ void PM4Sand::ForwardEuler(const Vector& CurStress, const Vector& CurStrain, con
 	NextVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(NextStrain);
 	NextElasticStrain = CurElasticStrain + (NextStrain - CurStrain);
 	// using NextStress instead of CurStress to get correct n
-	GetStateDependent(NextStress, CurAlpha, alpha_in, alpha_in_p, CurFabric, mFabric_in, mG, mzcum
+	GetStateDependent(NextStress, CurAlpha, alpha_in, alpha_in_p, CurFabric, mState.trial.Fabric_in, mG, mzcum
 		, mzpeak, mpzp, mMcur, CurDr, n, D, R, mKp, alphaD, Cka, h, b, AlphaAlphaBDotN);
 	dVolStrain = GetTrace(NextStrain - CurStrain);
 	dDevStrain = (NextStrain - CurStrain) - dVolStrain / 3.0 * mI1;
@@ -1264,7 +1341,7 @@ void PM4Sand::ForwardEuler(const Vector& CurStress, const Vector& CurStrain, con
 	}
 	else {
 		NextL = (2 * mG * DoubleDot2_2_Mixed(n, dDevStrain) - DoubleDot2_2_Contr(n, r) * mK * dVolStrain) / temp4;
-		mDGamma = NextL;
+		mState.trial.DGamma = NextL;
 		if (NextL < 0) {
 			if (debugFlag) {
 				opserr << "NextL is smaller than 0\n";
@@ -1301,15 +1378,15 @@ void PM4Sand::ForwardEuler(const Vector& CurStress, const Vector& CurStrain, con
 /*************************************************************/
 // Integrator Constraining Maximum Strain Increment
 /*************************************************************/
-void PM4Sand::MaxStrainInc(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
-	const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& alpha_in_p, const Vector& NextStrain,
-	Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
-	double& NextL, double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent)
+void PM4Sand::MaxStrainInc(const VoigtVector& CurStress, const VoigtVector& CurStrain, const VoigtVector& CurElasticStrain,
+	const VoigtVector& CurAlpha, const VoigtVector& CurFabric, const VoigtVector& alpha_in, const VoigtVector& alpha_in_p, const VoigtVector& NextStrain,
+	VoigtVector& NextElasticStrain, VoigtVector& NextStress, VoigtVector& NextAlpha, VoigtVector& NextFabric,
+	double& NextL, double& NextVoidRatio, double& G, double& K, VoigtMatrix& aC, VoigtMatrix& aCep, VoigtMatrix& aCep_Consistent)
 {
 	// function pointer to the integration scheme
-	void (PM4Sand::*exp_int) (const Vector&, const Vector&, const Vector&, const Vector&, const Vector&, const Vector&,
-		const Vector&, const Vector&, Vector&, Vector&, Vector&, Vector&, double&, double&, double&, double&,
-		Matrix&, Matrix&, Matrix&);
+	void (PM4Sand::*exp_int) (const VoigtVector&, const VoigtVector&, const VoigtVector&, const VoigtVector&, const VoigtVector&, const VoigtVector&,
+		const VoigtVector&, const VoigtVector&, VoigtVector&, VoigtVector&, VoigtVector&, VoigtVector&, double&, double&, double&, double&,
+		VoigtMatrix&, VoigtMatrix&, VoigtMatrix&);
 
 	switch (mScheme)
 	{
@@ -1323,7 +1400,7 @@ void PM4Sand::MaxStrainInc(const Vector& CurStress, const Vector& CurStrain, con
 		exp_int = &PM4Sand::ForwardEuler;
 		break;
 	}
-	Vector StrainInc(3); StrainInc = NextStrain - CurStrain;
+	VoigtVector StrainInc; StrainInc = NextStrain - CurStrain;
 	double maxInc = StrainInc(0);
 
 	for (int ii = 1; ii < 3; ii++)
@@ -1334,9 +1411,9 @@ void PM4Sand::MaxStrainInc(const Vector& CurStress, const Vector& CurStrain, con
 		int numSteps = (int)floor(fabs(maxInc) / maxStrainInc) + 1;
 		StrainInc = (NextStrain - CurStrain) / (double)numSteps;
 
-		Vector cStress(3), cStrain(3), cAlpha(3), cFabric(3), cAlpha_in(3), cAlpha_in_p(3), cEStrain(3);
-		Vector nStrain(3);
-		Matrix nCe(3, 3), nCep(3, 3), nCepC(3, 3);
+		VoigtVector cStress, cStrain, cAlpha, cFabric, cAlpha_in, cAlpha_in_p, cEStrain;
+		VoigtVector nStrain;
+		VoigtMatrix nCe, nCep, nCepC;
 		double nL, nVoidRatio, nG, nK;
 
 		// create temporary variables
@@ -1365,15 +1442,15 @@ void PM4Sand::MaxStrainInc(const Vector& CurStress, const Vector& CurStrain, con
 /*************************************************************/
 // Modified-Euler Integrator
 /*************************************************************/
-void PM4Sand::ModifiedEuler(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
-	const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& alpha_in_p, const Vector& NextStrain,
-	Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
-	double& NextL, double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent)
+void PM4Sand::ModifiedEuler(const VoigtVector& CurStress, const VoigtVector& CurStrain, const VoigtVector& CurElasticStrain,
+	const VoigtVector& CurAlpha, const VoigtVector& CurFabric, const VoigtVector& alpha_in, const VoigtVector& alpha_in_p, const VoigtVector& NextStrain,
+	VoigtVector& NextElasticStrain, VoigtVector& NextStress, VoigtVector& NextAlpha, VoigtVector& NextFabric,
+	double& NextL, double& NextVoidRatio, double& G, double& K, VoigtMatrix& aC, VoigtMatrix& aCep, VoigtMatrix& aCep_Consistent)
 {
 	double NextDr, dVolStrain, p, Cka, temp4, curStepError, q, stressNorm, h, D, AlphaAlphaBDotN;
-	Vector n(3), R1(3), R2(3), alphaD(3), dDevStrain(3), r(3), b(3);
-	Vector nStress(3), nAlpha(3), nFabric(3);
-	Vector dSigma1(3), dSigma2(3), dAlpha1(3), dAlpha2(3), dAlpha(3), dFabric1(3), dFabric2(3), dPStrain1(3), dPStrain2(3);
+	VoigtVector n, R1, R2, alphaD, dDevStrain, r, b;
+	VoigtVector nStress, nAlpha, nFabric;
+	VoigtVector dSigma1, dSigma2, dAlpha1, dAlpha2, dAlpha, dFabric1, dFabric2, dPStrain1, dPStrain2;
 	double T = 0.0, dT = 1.0, dT_min = 1e-4, TolE = 1e-5;
 
 	NextElasticStrain = CurElasticStrain + (NextStrain - CurStrain);
@@ -1392,13 +1469,14 @@ void PM4Sand::ModifiedEuler(const Vector& CurStress, const Vector& CurStrain, co
 	}
 	while (T < 1.0)
 	{
+		mIter++;
 		NextVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(CurStrain + T*(NextStrain - CurStrain));
 		NextDr = (m_emax - NextVoidRatio) / (m_emax - m_emin);
 		dVolStrain = dT * GetTrace(NextStrain - CurStrain);
 		dDevStrain = dT * (NextStrain - CurStrain) - dVolStrain / 3.0 * mI1;
 		p = 0.5 * GetTrace(NextStress);
 		// Calc Delta 1
-		GetStateDependent(NextStress, NextAlpha, alpha_in, alpha_in_p, NextFabric, mFabric_in, G, mzcum
+		GetStateDependent(NextStress, NextAlpha, alpha_in, alpha_in_p, NextFabric, mState.trial.Fabric_in, G, mzcum
 			, mzpeak, mpzp, mMcur, NextDr, n, D, R1, mKp, alphaD, Cka, h, b, AlphaAlphaBDotN);
 
 		r = GetDevPart(NextStress) / p;
@@ -1456,7 +1534,7 @@ void PM4Sand::ModifiedEuler(const Vector& CurStress, const Vector& CurStrain, co
 			continue;
 		}
 
-		GetStateDependent(NextStress + dSigma1, NextAlpha + dAlpha1, alpha_in, alpha_in_p, NextFabric + dFabric1, mFabric_in, G, mzcum
+		GetStateDependent(NextStress + dSigma1, NextAlpha + dAlpha1, alpha_in, alpha_in_p, NextFabric + dFabric1, mState.trial.Fabric_in, G, mzcum
 			, mzpeak, mpzp, mMcur, NextDr, n, D, R2, mKp, alphaD, Cka, h, b, AlphaAlphaBDotN);
 		r = GetDevPart(NextStress + dSigma1) / p;
 
@@ -1470,7 +1548,7 @@ void PM4Sand::ModifiedEuler(const Vector& CurStress, const Vector& CurStrain, co
 		}
 		else {
 			NextL = (2 * G * DoubleDot2_2_Mixed(n, dDevStrain) - DoubleDot2_2_Contr(n, r) * K * dVolStrain) / temp4;
-			mDGamma = NextL;
+			mState.trial.DGamma = NextL;
 			if (NextL < 0)
 			{
 				if (debugFlag) {
@@ -1557,17 +1635,17 @@ void PM4Sand::ModifiedEuler(const Vector& CurStress, const Vector& CurStrain, co
 /*************************************************************/
 // Runge-Kutta Integrator
 /*************************************************************/
-void PM4Sand::RungeKutta4(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
-	const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& alpha_in_p, const Vector& NextStrain,
-	Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
-	double& NextL, double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent)
+void PM4Sand::RungeKutta4(const VoigtVector& CurStress, const VoigtVector& CurStrain, const VoigtVector& CurElasticStrain,
+	const VoigtVector& CurAlpha, const VoigtVector& CurFabric, const VoigtVector& alpha_in, const VoigtVector& alpha_in_p, const VoigtVector& NextStrain,
+	VoigtVector& NextElasticStrain, VoigtVector& NextStress, VoigtVector& NextAlpha, VoigtVector& NextFabric,
+	double& NextL, double& NextVoidRatio, double& G, double& K, VoigtMatrix& aC, VoigtMatrix& aCep, VoigtMatrix& aCep_Consistent)
 {
 	double NextDr, dVolStrain, p, Cka, D, K_p, temp4, h, AlphaAlphaBDotN;
-	Vector n(3), R1(3), R2(3), R3(3), R4(3), alphaD(3), dDevStrain(3), r(3), b(3);
-	Vector nStress(3), nAlpha(3), nFabric(3);
-	Vector dSigma1(3), dSigma2(3), dSigma3(3), dSigma4(3), dSigma(3), dAlpha1(3), dAlpha2(3),
-		dAlpha3(3), dAlpha4(3), dAlpha(3), dFabric1(3), dFabric2(3), dFabric3(3), dFabric4(3),
-		dFabric(3), dPStrain1(3), dPStrain2(3), dPStrain3(3), dPStrain4(3), dPStrain(3);
+	VoigtVector n, R1, R2, R3, R4, alphaD, dDevStrain, r, b;
+	VoigtVector nStress, nAlpha, nFabric;
+	VoigtVector dSigma1, dSigma2, dSigma3, dSigma4, dSigma, dAlpha1, dAlpha2,
+		dAlpha3, dAlpha4, dAlpha, dFabric1, dFabric2, dFabric3, dFabric4,
+		dFabric, dPStrain1, dPStrain2, dPStrain3, dPStrain4, dPStrain;
 	double T = 0.0, dT = 0.5, dT_min = 1.0e-4, TolE = 1.0e-5;
 
 	NextElasticStrain = CurElasticStrain + (NextStrain - CurStrain);
@@ -1584,13 +1662,14 @@ void PM4Sand::RungeKutta4(const Vector& CurStress, const Vector& CurStrain, cons
 	}
 	while (T < 1.0)
 	{
+		mIter++;
 		NextVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(CurStrain + T*(NextStrain - CurStrain));
 		NextDr = (m_emax - NextVoidRatio) / (m_emax - m_emin);
 		dVolStrain = dT * GetTrace(NextStrain - CurStrain);
 		dDevStrain = dT * (NextStrain - CurStrain) - dVolStrain / 3.0 * mI1;
 		p = 0.5 * GetTrace(NextStress);
 		// Calc Delta 1
-		GetStateDependent(NextStress, NextAlpha, alpha_in, alpha_in_p, NextFabric, mFabric_in, mG, mzcum
+		GetStateDependent(NextStress, NextAlpha, alpha_in, alpha_in_p, NextFabric, mState.trial.Fabric_in, mG, mzcum
 			, mzpeak, mpzp, mMcur, NextDr, n, D, R1, K_p, alphaD, Cka, h, b, AlphaAlphaBDotN);
 
 		r = GetDevPart(NextStress) / p;
@@ -1636,7 +1715,7 @@ void PM4Sand::RungeKutta4(const Vector& CurStress, const Vector& CurStrain, cons
 		//Calc Delta 2
 		p = 0.5 * GetTrace(NextStress + 0.5 * dSigma1);
 
-		GetStateDependent(NextStress + 0.5 * dSigma1, CurAlpha + 0.5 * dAlpha1, alpha_in, alpha_in_p, NextFabric + 0.5 * dFabric1, mFabric_in, mG, mzcum
+		GetStateDependent(NextStress + 0.5 * dSigma1, CurAlpha + 0.5 * dAlpha1, alpha_in, alpha_in_p, NextFabric + 0.5 * dFabric1, mState.trial.Fabric_in, mG, mzcum
 			, mzpeak, mpzp, mMcur, NextDr, n, D, R2, K_p, alphaD, Cka, h, b, AlphaAlphaBDotN);
 		r = GetDevPart(NextStress + 0.5 * dSigma1) / p;
 
@@ -1677,7 +1756,7 @@ void PM4Sand::RungeKutta4(const Vector& CurStress, const Vector& CurStrain, cons
 		//Calc Delta 3
 		p = 0.5 * GetTrace(NextStress + 0.5 * dSigma2);
 
-		GetStateDependent(NextStress + 0.5 * dSigma2, CurAlpha + 0.5 * dAlpha2, alpha_in, alpha_in_p, NextFabric + 0.5 * dFabric2, mFabric_in, mG, mzcum
+		GetStateDependent(NextStress + 0.5 * dSigma2, CurAlpha + 0.5 * dAlpha2, alpha_in, alpha_in_p, NextFabric + 0.5 * dFabric2, mState.trial.Fabric_in, mG, mzcum
 			, mzpeak, mpzp, mMcur, NextDr, n, D, R3, K_p, alphaD, Cka, h, b, AlphaAlphaBDotN);
 		r = GetDevPart(NextStress + 0.5 * dSigma2) / p;
 
@@ -1718,7 +1797,7 @@ void PM4Sand::RungeKutta4(const Vector& CurStress, const Vector& CurStrain, cons
 		//Calc Delta 4
 		p = 0.5 * GetTrace(NextStress + dSigma3);
 
-		GetStateDependent(NextStress + dSigma3, CurAlpha + dAlpha3, alpha_in, alpha_in_p, NextFabric + dFabric3, mFabric_in, mG, mzcum
+		GetStateDependent(NextStress + dSigma3, CurAlpha + dAlpha3, alpha_in, alpha_in_p, NextFabric + dFabric3, mState.trial.Fabric_in, mG, mzcum
 			, mzpeak, mpzp, mMcur, NextDr, n, D, R4, K_p, alphaD, Cka, h, b, AlphaAlphaBDotN);
 		r = GetDevPart(NextStress + dSigma3) / p;
 
@@ -1785,12 +1864,12 @@ void PM4Sand::RungeKutta4(const Vector& CurStress, const Vector& CurStrain, cons
 //            Pegasus Iterations                             //
 /*************************************************************/
 double
-PM4Sand::IntersectionFactor(const Vector& CurStress, const Vector& CurStrain, const Vector& NextStrain, const Vector& CurAlpha,
+PM4Sand::IntersectionFactor(const VoigtVector& CurStress, const VoigtVector& CurStrain, const VoigtVector& NextStrain, const VoigtVector& CurAlpha,
 	double a0 = 0.0, double a1 = 1.0)
 {
 	double a = a0;
 	double f, f0, f1;
-	Vector dSigma(3), dSigma0(3), dSigma1(3), strainInc(3);
+	VoigtVector dSigma, dSigma0, dSigma1, strainInc;
 
 	strainInc = NextStrain - CurStrain;
 
@@ -1845,12 +1924,12 @@ PM4Sand::IntersectionFactor(const Vector& CurStress, const Vector& CurStrain, co
 //      Pegasus Iterations  (ElastoPlastic Unloading)        //
 /*************************************************************/
 double
-PM4Sand::IntersectionFactor_Unloading(const Vector& CurStress, const Vector& CurStrain, const Vector& NextStrain, const Vector& CurAlpha)
+PM4Sand::IntersectionFactor_Unloading(const VoigtVector& CurStress, const VoigtVector& CurStrain, const VoigtVector& NextStrain, const VoigtVector& CurAlpha)
 {
 	double a = 0.0, a0 = 0.0, a1 = 1.0, da;
 	double f, f0, f1, fs;
 	int nSub = 20;
-	Vector dSigma(3), dSigma0(3), dSigma1(3), strainInc(3);
+	VoigtVector dSigma, dSigma0, dSigma1, strainInc;
 	bool flag = false;
 
 	strainInc = NextStrain - CurStrain;
@@ -1901,13 +1980,13 @@ PM4Sand::IntersectionFactor_Unloading(const Vector& CurStress, const Vector& Cur
 //            Stress Correction                              //
 /*************************************************************/
 void
-PM4Sand::Stress_Correction(Vector& NextStress, Vector& NextAlpha, const Vector& alpha_in, const Vector& alpha_in_p,
-	const Vector& CurFabric, double& NextVoidRatio)
+PM4Sand::Stress_Correction(VoigtVector& NextStress, VoigtVector& NextAlpha, const VoigtVector& alpha_in, const VoigtVector& alpha_in_p,
+	const VoigtVector& CurFabric, double& NextVoidRatio)
 {
-	Vector dSigmaP(3), dfrOverdSigma(3), dfrOverdAlpha(3), n(3), R(3), alphaD(3), b(3), aBar(3), r(3);
+	VoigtVector dSigmaP, dfrOverdSigma, dfrOverdAlpha, n, R, alphaD, b, aBar, r;
 	double lambda, D, K_p, Cka, h, p, fr, AlphaAlphaBDotN;
-	Matrix aC(3, 3);
-	// Vector CurStress = NextStress;
+	VoigtMatrix aC;
+	// VoigtVector CurStress = NextStress;
 
 	int maxIter = 25;
 	p = 0.5 * GetTrace(NextStress);
@@ -1934,14 +2013,14 @@ PM4Sand::Stress_Correction(Vector& NextStress, Vector& NextAlpha, const Vector&
 		}
 		else {
 			double CurDr = (m_emax - NextVoidRatio) / (m_emax - m_emin);
-			Vector nStress = NextStress;
-			Vector nAlpha = NextAlpha;
+			VoigtVector nStress = NextStress;
+			VoigtVector nAlpha = NextAlpha;
 			for (int i = 1; i <= maxIter; i++) {
 				r = GetDevPart(nStress) / p;
-				GetStateDependent(nStress, nAlpha, alpha_in, alpha_in_p, CurFabric, mFabric_in, mG, mzcum
+				GetStateDependent(nStress, nAlpha, alpha_in, alpha_in_p, CurFabric, mState.trial.Fabric_in, mG, mzcum
 					, mzpeak, mpzp, mMcur, CurDr, n, D, R, K_p, alphaD, Cka, h, b, AlphaAlphaBDotN);
 				aC = GetStiffness(mK, mG);
-				dSigmaP = DoubleDot4_2(aC, mDGamma * ToCovariant(R));
+				dSigmaP = DoubleDot4_2(aC, mState.trial.DGamma * ToCovariant(R));
 				aBar = two3 * h * b;
 				dfrOverdSigma = n - 0.5 * DoubleDot2_2_Contr(n, r) * mI1;
 				dfrOverdAlpha = -p * n;
@@ -1975,11 +2054,11 @@ PM4Sand::Stress_Correction(Vector& NextStress, Vector& NextAlpha, const Vector&
 				opserr << "NextAlpha = " << NextAlpha;
 			}
 
-			Vector dSigma = NextStress - mSigma;
+			VoigtVector dSigma = NextStress - mState.trial.Sigma;
 			double alpha_up = 1.0;
 			double alpha_mid = 0.5;
 			double alpha_down = 0.0;
-			double fr_old = GetF(mSigma + alpha_mid * dSigma, NextAlpha);
+			double fr_old = GetF(mState.trial.Sigma + alpha_mid * dSigma, NextAlpha);
 			for (int jj = 0; jj < maxIter; jj++) {
 				if (fr_old < 0.0) {
 					alpha_down = alpha_mid;
@@ -1990,22 +2069,22 @@ PM4Sand::Stress_Correction(Vector& NextStress, Vector& NextAlpha, const Vector&
 					alpha_mid = 0.5 * (alpha_down + alpha_mid);
 				}
 
-				fr_old = GetF(mSigma + alpha_mid * dSigma, NextAlpha);
+				fr_old = GetF(mState.trial.Sigma + alpha_mid * dSigma, NextAlpha);
 				if (fabs(fr_old) < mTolF) {
-					NextStress = mSigma + alpha_mid * dSigma;
+					NextStress = mState.trial.Sigma + alpha_mid * dSigma;
 					break;
 				}
 			}
 
 			// // stress state ouside yield surface
 			// double CurDr = (m_emax - NextVoidRatio) / (m_emax - m_emin);
-			// Vector nStress = NextStress;
-			// Vector nAlpha = NextAlpha;
+			// VoigtVector nStress = NextStress;
+			// VoigtVector nAlpha = NextAlpha;
 			// for (int i = 1; i <= maxIter; i++) {
 			// 	// Sloan, Abbo, Sheng 2001, Refined explicit integration of elastoplastic models with automatic 
 			// 	// error control
 			// 	r = GetDevPart(nStress) / p;
-			// 	GetStateDependent(nStress, nAlpha, alpha_in, alpha_in_p, CurFabric, mFabric_in, mG, mzcum
+			// 	GetStateDependent(nStress, nAlpha, alpha_in, alpha_in_p, CurFabric, mState.trial.Fabric_in, mG, mzcum
 			// 		, mzpeak, mpzp, mMcur, CurDr, n, D, R, K_p, alphaD, Cka, h, b);
 			// 	dSigmaP = DoubleDot4_2(mCe, ToCovariant(R));
 			// 	aBar = h * b;
@@ -2040,7 +2119,7 @@ PM4Sand::Stress_Correction(Vector& NextStress, Vector& NextAlpha, const Vector&
 			// 	if (i == maxIter) {
 			// 		if (debugFlag)
 			// 			opserr << "Still outside with f =  " << fr << endln;
-			// 		Vector dSigma = NextStress - CurStress;
+			// 		VoigtVector dSigma = NextStress - CurStress;
 			// 		double alpha_up = 1.0;
 			// 		double alpha_mid = 0.5;
 			// 		double alpha_down = 0.0;
@@ -2073,10 +2152,10 @@ PM4Sand::Stress_Correction(Vector& NextStress, Vector& NextAlpha, const Vector&
 /************************************************************/
 /************************************************************/
 void
-PM4Sand::Stress_Correction(Vector& NextStress, Vector& NextAlpha, const Vector& dAlpha,
-	const double m, const Vector& R, const Vector& n, const Vector& r)
+PM4Sand::Stress_Correction(VoigtVector& NextStress, VoigtVector& NextAlpha, const VoigtVector& dAlpha,
+	const double m, const VoigtVector& R, const VoigtVector& n, const VoigtVector& r)
 {
-	Vector dfrOverdSigma(3);
+	VoigtVector dfrOverdSigma;
 	double lambda;
 	int maxIter = 50;
 	double f = GetF(NextStress, NextAlpha);
@@ -2085,7 +2164,7 @@ PM4Sand::Stress_Correction(Vector& NextStress, Vector& NextAlpha, const Vector&
 	else {
 		// Method C from Potts and Gens 1983. 
 		for (int i = 1; i <= maxIter; i++) {
-			// GetStateDependent(CurStress, CurAlpha, alpha_in, CurFabric, mFabric_in, mG, mzcum
+			// GetStateDependent(CurStress, CurAlpha, alpha_in, CurFabric, mState.trial.Fabric_in, mG, mzcum
 			// 	, mzpeak, mpzp, mMcur, ksi, CurDr, n, D, R, K_p, alphaD, Cka, h, b);
 			dfrOverdSigma = n - 0.5 * DoubleDot2_2_Contr(n, r)*mI1;
 			lambda = f / DoubleDot2_2_Contr(dfrOverdSigma, R);
@@ -2122,10 +2201,10 @@ double PM4Sand::MacauleyIndex(double x)
 /*************************************************************/
 // GetF() -----------------------------------------------------
 double
-PM4Sand::GetF(const Vector& nStress, const Vector& nAlpha)
+PM4Sand::GetF(const VoigtVector& nStress, const VoigtVector& nAlpha)
 {
 	// PM4Sand's yield function
-	Vector s(3); s = GetDevPart(nStress);
+	VoigtVector s; s = GetDevPart(nStress);
 	double p = 0.5 * GetTrace(nStress);
 	s = s - p * nAlpha;
 	double f = GetNorm_Contr(s) - root12 * m_m * p;
@@ -2145,7 +2224,7 @@ PM4Sand::GetKsi(const double& dr, const double& p)
 /*************************************************************/
 // GetElasticModuli() ---------------------------------------------
 void
-PM4Sand::GetElasticModuli(const Vector& sigma, double &K, double &G, double &Mcur, const double& zcum)
+PM4Sand::GetElasticModuli(const VoigtVector& sigma, double &K, double &G, double &Mcur, const double& zcum)
 // Calculates G, K, including effects of fabric and current stress ratio
 {
 	int msr = 4;
@@ -2174,7 +2253,7 @@ PM4Sand::GetElasticModuli(const Vector& sigma, double &K, double &G, double &Mcu
 	K = two3 * (1 + m_nu) / (1 - 2 * m_nu) * G;
 }
 void
-PM4Sand::GetElasticModuli(const Vector& sigma, double &K, double &G)
+PM4Sand::GetElasticModuli(const VoigtVector& sigma, double &K, double &G)
 // Calculates G, K
 {
 	double pn = 0.5 * GetTrace(sigma);
@@ -2189,11 +2268,11 @@ PM4Sand::GetElasticModuli(const Vector& sigma, double &K, double &G)
 }
 /*************************************************************/
 // GetStiffness() ---------------------------------------------
-Matrix
+VoigtMatrix
 PM4Sand::GetStiffness(const double& K, const double& G)
 // returns the stiffness matrix in its contravarinat-contravariant form
 {
-	Matrix C(3, 3);
+	VoigtMatrix C;
 	double a = K + 4.0*one3 * G;
 	double b = K - 2.0*one3 * G;
 	C(0, 0) = C(1, 1) = a;
@@ -2203,11 +2282,11 @@ PM4Sand::GetStiffness(const double& K, const double& G)
 }
 /*************************************************************/
 // GetCompliance() ---------------------------------------------
-Matrix
+VoigtMatrix
 PM4Sand::GetCompliance(const double& K, const double& G)
 // returns the compliance matrix in its covariant-covariant form
 {
-	Matrix D(3, 3);
+	VoigtMatrix D;
 	double a = (K + 4.0 / 3.0 * G) / (4.0 * G * K + 4.0 / 3.0 * pow(G, 2));
 	double b = (K - 2.0 / 3.0 * G) / (4.0 * G * K + 4.0 / 3.0 * pow(G, 2));
 	double c = 1 / G;
@@ -2218,17 +2297,17 @@ PM4Sand::GetCompliance(const double& K, const double& G)
 }
 /*************************************************************/
 // GetElastoPlasticTangent()---------------------------------------
-Matrix
-PM4Sand::GetElastoPlasticTangent(const Vector& NextStress, const Matrix& aCe, const Vector& R,
-	const Vector& n, const double K_p)
+VoigtMatrix
+PM4Sand::GetElastoPlasticTangent(const VoigtVector& NextStress, const VoigtMatrix& aCe, const VoigtVector& R,
+	const VoigtVector& n, const double K_p)
 {
 	double p = 0.5 * GetTrace(NextStress);
 	if (p < m_Pmin) p = m_Pmin;
-	Vector r = GetDevPart(NextStress) / p;
-	Matrix aCep(3, 3);
+	VoigtVector r = GetDevPart(NextStress) / p;
+	VoigtMatrix aCep;
 	aCep.Zero();
-	Vector temp1 = DoubleDot4_2(aCe, R);
-	Vector temp2 = DoubleDot2_4(n - 1 / 2 * DoubleDot2_2_Contr(n, r)*mI1, aCe*mIIco);
+	VoigtVector temp1 = DoubleDot4_2(aCe, R);
+	VoigtVector temp2 = DoubleDot2_4(n - 1 / 2 * DoubleDot2_2_Contr(n, r)*mI1, aCe*mIIco);
 	double temp3 = DoubleDot2_2_Contr(temp2, R) + K_p;
 	if (temp3 < small) {
 		aCep = aCe;
@@ -2241,12 +2320,12 @@ PM4Sand::GetElastoPlasticTangent(const Vector& NextStress, const Matrix& aCe, co
 }
 /*************************************************************/
 // GetNormalToYield() ----------------------------------------
-Vector
-PM4Sand::GetNormalToYield(const Vector &stress, const Vector &alpha)
+VoigtVector
+PM4Sand::GetNormalToYield(const VoigtVector &stress, const VoigtVector &alpha)
 {
-	Vector devStress(3); devStress = GetDevPart(stress);
+	VoigtVector devStress; devStress = GetDevPart(stress);
 	double p = 0.5 * GetTrace(stress);
-	Vector n(3);
+	VoigtVector n;
 	if (fabs(p) < small) {
 		n.Zero();
 	}
@@ -2261,7 +2340,7 @@ PM4Sand::GetNormalToYield(const Vector &stress, const Vector &alpha)
 /*************************************************************/
 // Check() ---------------------------------------------------
 int
-PM4Sand::Check(const Vector& TrialStress, const Vector& stress, const Vector& CurAlpha, const Vector& NextAlpha)
+PM4Sand::Check(const VoigtVector& TrialStress, const VoigtVector& stress, const VoigtVector& CurAlpha, const VoigtVector& NextAlpha)
 // Check if the solution of implicit integration makes sense
 {
 	return 0;
@@ -2269,10 +2348,10 @@ PM4Sand::Check(const Vector& TrialStress, const Vector& stress, const Vector& Cu
 /*************************************************************/
 // GetStateDependent() ----------------------------------------
 void
-PM4Sand::GetStateDependent(const Vector &stress, const Vector &alpha, const Vector &alpha_in, const Vector &alpha_in_p
-	, const Vector &fabric, const Vector &fabric_in, const double &G, const double &zcum, const double &zpeak
-	, const double &pzp, const double &Mcur, const double &CurDr, Vector &n, double &D, Vector &R, double &K_p
-	, Vector &alphaD, double &Cka, double &h, Vector &b, double &AlphaAlphaBDotN)
+PM4Sand::GetStateDependent(const VoigtVector &stress, const VoigtVector &alpha, const VoigtVector &alpha_in, const VoigtVector &alpha_in_p
+	, const VoigtVector &fabric, const VoigtVector &fabric_in, const double &G, const double &zcum, const double &zpeak
+	, const double &pzp, const double &Mcur, const double &CurDr, VoigtVector &n, double &D, VoigtVector &R, double &K_p
+	, VoigtVector &alphaD, double &Cka, double &h, VoigtVector &b, double &AlphaAlphaBDotN)
 {
 	double p = 0.5 * GetTrace(stress);
 	if (p <= m_Pmin) p = m_Pmin;
@@ -2290,7 +2369,7 @@ PM4Sand::GetStateDependent(const Vector &stress, const Vector &alpha, const Vect
 		mMd = m_Mc * exp(m_nd * 4.0 * ksi);
 	}
 
-	Vector alphaB = root12 * (mMb - m_m) * n;
+	VoigtVector alphaB = root12 * (mMb - m_m) * n;
 	alphaD = root12 * (mMd - m_m) * n;
 	double Czpk1 = zpeak / (zcum + m_z_max / 5.0);
 	double Czpk2 = zpeak / (zcum + m_z_max / 100.0);
@@ -2302,10 +2381,10 @@ PM4Sand::GetStateDependent(const Vector &stress, const Vector &alpha, const Vect
 
 	b = alphaB - alpha;
 	AlphaAlphaBDotN = DoubleDot2_2_Contr(b, n);
-	double AlphaAlphaInDotN = Macauley(DoubleDot2_2_Contr(alpha - mAlpha_in, n));
-	double AlphaAlphaInTrueDotN = Macauley(DoubleDot2_2_Contr(alpha - mAlpha_in_true, n));
+	double AlphaAlphaInDotN = Macauley(DoubleDot2_2_Contr(alpha - mState.trial.Alpha_in, n));
+	double AlphaAlphaInTrueDotN = Macauley(DoubleDot2_2_Contr(alpha - mState.trial.Alpha_in_true, n));
 	Cka = 1.0 + m_Ckaf / (1.0 + pow(2.5*AlphaAlphaInTrueDotN, 2))*Cpzp2*Czpk1;
-	// updataed K_p formulation following PM4Sand V3.1. mAlpha_in is the apparent back-stress ratio. 
+	// updataed K_p formulation following PM4Sand V3.1. mState.trial.Alpha_in is the apparent back-stress ratio. 
 	if (DoubleDot2_2_Contr(alpha - alpha_in_p, n) <= 0) {
 		h = 1.5 * G * m_h0 / p / (exp(AlphaAlphaInDotN) - 1 + Cg1) / sqrt(fabs(AlphaAlphaBDotN)) *
 			Cka / (1 + Ckp * zpeak / m_z_max * Macauley(AlphaAlphaBDotN) * sqrt(1 - Czpk2));
@@ -2321,7 +2400,7 @@ PM4Sand::GetStateDependent(const Vector &stress, const Vector &alpha, const Vect
 	// rotated dilatancy surface
 	double Crot1 = fmax((1.0 + 2 * Macauley(DoubleDot2_2_Contr(-1.0*fabric, n)) / (sqrt(2.0)*m_z_max)*(1 - Czin1)), 1.0);
 	double Mdr = mMd / Crot1;
-	Vector alphaDr = root12 * (Mdr - m_m) * n;
+	VoigtVector alphaDr = root12 * (Mdr - m_m) * n;
 	// dilation
 	if (DoubleDot2_2_Contr(alphaDr - alpha, n) <= 0) {
 		double Cpzp = (pzp == 0.0) ? 1.0 : 1.0 / (1.0 + pow((2.5*p / pzp), 5.0));
@@ -2347,7 +2426,7 @@ PM4Sand::GetStateDependent(const Vector &stress, const Vector &alpha, const Vect
 		double Cdz = fmax((1 - Crot2*sqrt(2.0)*zpeak / m_z_max)*(m_z_max / (m_z_max + Crot2*zcum)), 1 / (1 + m_z_max / 2.0));
 		double Adc = m_Ado * (1 + Macauley(DoubleDot2_2_Contr(fabric, n))) / hp / Cdz;
 		double Cin = 2.0 * Macauley(DoubleDot2_2_Contr(fabric, n)) / sqrt(2.0) / m_z_max;
-		D = fmin(Adc * pow((DoubleDot2_2_Contr(alpha - mAlpha_in, n) + Cin), 2), 1.5 * m_Ado) *
+		D = fmin(Adc * pow((DoubleDot2_2_Contr(alpha - mState.trial.Alpha_in, n) + Cin), 2), 1.5 * m_Ado) *
 			DoubleDot2_2_Contr(alphaD - alpha, n) / (DoubleDot2_2_Contr(alphaD - alpha, n) + 0.16);
 		// Apply a factor to D so it doesn't go very big when p is small
 		double C_pmin2;
@@ -2378,24 +2457,20 @@ PM4Sand::GetStateDependent(const Vector &stress, const Vector &alpha, const Vect
 
 //  GetTrace() ---------------------------------------------
 double
-PM4Sand::GetTrace(const Vector& v)
+PM4Sand::GetTrace(const VoigtVector& v)
 // computes the trace of the input argument
 {
-	if (v.Size() != 3)
-		opserr << "\n ERROR! PM4Sand::GetTrace requires vector of size(3)!" << endln;
 
 	return (v(0) + v(1));
 }
 /*************************************************************/
 //  GetDevPart() ---------------------------------------------
-Vector
-PM4Sand::GetDevPart(const Vector& aV)
+VoigtVector
+PM4Sand::GetDevPart(const VoigtVector& aV)
 // computes the deviatoric part of the input tensor
 {
-	if (aV.Size() != 3)
-		opserr << "\n ERROR! PM4Sand::GetDevPart requires vector of size(3)!" << endln;
 
-	Vector result(3);
+	VoigtVector result;
 	double p = GetTrace(aV);
 	result = aV;
 	result(0) -= 0.5 * p;
@@ -2406,11 +2481,9 @@ PM4Sand::GetDevPart(const Vector& aV)
 /*************************************************************/
 // DoubleDot2_2_Contr() ---------------------------------------
 double
-PM4Sand::DoubleDot2_2_Contr(const Vector& v1, const Vector& v2)
+PM4Sand::DoubleDot2_2_Contr(const VoigtVector& v1, const VoigtVector& v2)
 // computes doubledot product for vector-vector arguments, both "contravariant"
 {
-	if ((v1.Size() != 3) || (v2.Size() != 3))
-		opserr << "\n ERROR! PM4Sand::DoubleDot2_2_Contr requires vector of size(3)!" << endln;
 
 	double result = 0.0;
 	for (int i = 0; i < v1.Size(); i++) {
@@ -2422,11 +2495,9 @@ PM4Sand::DoubleDot2_2_Contr(const Vector& v1, const Vector& v2)
 /*************************************************************/
 // DoubleDot2_2_Cov() ---------------------------------------
 double
-PM4Sand::DoubleDot2_2_Cov(const Vector& v1, const Vector& v2)
+PM4Sand::DoubleDot2_2_Cov(const VoigtVector& v1, const VoigtVector& v2)
 // computes doubledot product for vector-vector arguments, both "covariant"
 {
-	if ((v1.Size() != 3) || (v2.Size() != 3))
-		opserr << "\n ERROR! PM4Sand::DoubleDot2_2_Cov requires vector of size(3)!" << endln;
 
 	double result = 0.0;
 	for (int i = 0; i < v1.Size(); i++) {
@@ -2438,11 +2509,9 @@ PM4Sand::DoubleDot2_2_Cov(const Vector& v1, const Vector& v2)
 /*************************************************************/
 // DoubleDot2_2_Mixed() ---------------------------------------
 double
-PM4Sand::DoubleDot2_2_Mixed(const Vector& v1, const Vector& v2)
+PM4Sand::DoubleDot2_2_Mixed(const VoigtVector& v1, const VoigtVector& v2)
 // computes doubledot product for vector-vector arguments, one "covariant" and the other "contravariant"
 {
-	if ((v1.Size() != 3) || (v2.Size() != 3))
-		opserr << "\n ERROR! PM4Sand::DoubleDot2_2_Mixed requires vector of size(3)!" << endln;
 
 	double result = 0.0;
 	for (int i = 0; i < v1.Size(); i++) {
@@ -2454,11 +2523,9 @@ PM4Sand::DoubleDot2_2_Mixed(const Vector& v1, const Vector& v2)
 /*************************************************************/
 // GetNorm_Contr() ---------------------------------------------
 double
-PM4Sand::GetNorm_Contr(const Vector& v)
+PM4Sand::GetNorm_Contr(const VoigtVector& v)
 // computes contravariant (stress-like) norm of input 6x1 tensor
 {
-	if (v.Size() != 3)
-		opserr << "\n ERROR! PM4Sand::GetNorm_Contr requires vector of size(3)!" << endln;
 
 	double result = 0.0;
 	result = sqrt(DoubleDot2_2_Contr(v, v));
@@ -2468,11 +2535,9 @@ PM4Sand::GetNorm_Contr(const Vector& v)
 /*************************************************************/
 // GetNorm_Cov() ---------------------------------------------
 double
-PM4Sand::GetNorm_Cov(const Vector& v)
+PM4Sand::GetNorm_Cov(const VoigtVector& v)
 // computes covariant (strain-like) norm of input 6x1 tensor
 {
-	if (v.Size() != 3)
-		opserr << "\n ERROR! PM4Sand::GetNorm_Cov requires vector of size(3)!" << endln;
 
 	double result = 0.0;
 	result = sqrt(DoubleDot2_2_Cov(v, v));
@@ -2481,15 +2546,13 @@ PM4Sand::GetNorm_Cov(const Vector& v)
 }
 /*************************************************************/
 // Dyadic2_2() ---------------------------------------------
-Matrix
-PM4Sand::Dyadic2_2(const Vector& v1, const Vector& v2)
+VoigtMatrix
+PM4Sand::Dyadic2_2(const VoigtVector& v1, const VoigtVector& v2)
 // computes dyadic product for two vector-storage arguments
 // the coordinate form of the result depends on the coordinate form of inputs
 {
-	if ((v1.Size() != 3) || (v2.Size() != 3))
-		opserr << "\n ERROR! PM4Sand::Dyadic2_2 requires vector of size(3)!" << endln;
 
-	Matrix result(3, 3);
+	VoigtMatrix result;
 
 	for (int i = 0; i < v1.Size(); i++) {
 		for (int j = 0; j < v2.Size(); j++)
@@ -2500,66 +2563,52 @@ PM4Sand::Dyadic2_2(const Vector& v1, const Vector& v2)
 }
 /*************************************************************/
 // DoubleDot4_2() ---------------------------------------------
-Vector
-PM4Sand::DoubleDot4_2(const Matrix& m1, const Vector& v1)
+VoigtVector
+PM4Sand::DoubleDot4_2(const VoigtMatrix& m1, const VoigtVector& v1)
 // computes doubledot product for matrix-vector arguments
 // caution: second coordinate of the matrix should be in opposite variant form of vector
 {
-	if (v1.Size() != 3)
-		opserr << "\n ERROR! PM4Sand::DoubleDot4_2 requires vector of size(3)!" << endln;
-	if ((m1.noCols() != 3) || (m1.noRows() != 3))
-		opserr << "\n ERROR! PM4Sand::DoubleDot4_2 requires 3-by-3 matrix " << endln;
 
 	return m1*v1;
 }
 /*************************************************************/
 // DoubleDot2_4() ---------------------------------------------
-Vector
-PM4Sand::DoubleDot2_4(const Vector& v1, const Matrix& m1)
+VoigtVector
+PM4Sand::DoubleDot2_4(const VoigtVector& v1, const VoigtMatrix& m1)
 // computes doubledot product for matrix-vector arguments
 // caution: first coordinate of the matrix should be in opposite 
 // variant form of vector
 {
-	if (v1.Size() != 3)
-		opserr << "\n ERROR! PM4Sand::DoubleDot2_4 requires vector of size(3)!" << endln;
-	if ((m1.noCols() != 3) || (m1.noRows() != 3))
-		opserr << "\n ERROR! PM4Sand::DoubleDot2_4 requires 3-by-3 matrix " << endln;
 
 	return  m1^v1;
 }
 /*************************************************************/
 // DoubleDot4_4() ---------------------------------------------
-Matrix
-PM4Sand::DoubleDot4_4(const Matrix& m1, const Matrix& m2)
+VoigtMatrix
+PM4Sand::DoubleDot4_4(const VoigtMatrix& m1, const VoigtMatrix& m2)
 // computes doubledot product for matrix-matrix arguments
 // caution: second coordinate of the first matrix should be in opposite 
 // variant form of the first coordinate of second matrix
 {
-	if ((m1.noCols() != 3) || (m1.noRows() != 3) || (m2.noCols() != 3) || (m2.noRows() != 3))
-		opserr << "\n ERROR! PM4Sand::DoubleDot4_4 requires 3-by-3 matrices " << endln;
 
 	return m1*m2;
 }
 /*************************************************************/
 // ToContraviant() ---------------------------------------------
-Vector PM4Sand::ToContraviant(const Vector& v1)
+VoigtVector PM4Sand::ToContraviant(const VoigtVector& v1)
 {
-	if (v1.Size() != 3)
-		opserr << "\n ERROR! PM4Sand::ToContraviant requires vector of size(3)!" << endln;
 	// aV(i) -> T(i,j) 1 = 11, 2=22, 3=12
-	Vector res = v1;
+	VoigtVector res = v1;
 	res(2) *= 0.5;
 
 	return res;
 }
 /*************************************************************/
 // ToCovariant() ---------------------------------------------
-Vector PM4Sand::ToCovariant(const Vector& v1)
+VoigtVector PM4Sand::ToCovariant(const VoigtVector& v1)
 {
-	if (v1.Size() != 3)
-		opserr << "\n ERROR! PM4Sand::ToCovariant requires vector of size(3)!" << endln;
 	// aV(i) -> T(i,j) 1 = 11, 2=22, 3=12
-	Vector res = v1;
+	VoigtVector res = v1;
 	res(2) *= 2.0;
 
 	return res;
@@ -37,6 +37,7 @@
 #include <NDMaterial.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <VoigtTensor.h>
 
 #include <Information.h>
 //#include <MaterialResponse.h>
@@ -79,6 +80,7 @@ public:
 
 	int setTrialStrain(const Vector &v);
 	int setTrialStrain(const Vector &v, const Vector &r);
+	int setTrialStrains(int numMaterials, NDMaterial **theMaterials, const Vector **theStrains);
 	int initialize(Vector initStress);
 	int initialize();
 	NDMaterial *getCopy(const char *type);
@@ -92,7 +94,7 @@ public:
 	int        getOrder(void) const;
 
 	// Recorder functions
-	virtual const Vector& getStressToRecord() { return mSigma; };
+	virtual const Vector& getStressToRecord() { mState.trial.Sigma.copyTo(mSigma_rec); return mSigma_rec; };
 	double getDGamma();
 	const Vector getState();
 	const Vector getAlpha();
@@ -151,38 +153,33 @@ protected:
 	int m_FirstCall;
 	int m_PostShake;
 
-	// internal variables
-	Vector mEpsilon;    // strain tensor
-	Vector mEpsilon_n;  // strain tensor (last committed)
+	// internal variables, trial and last committed
+	struct State {
+		VoigtVector Epsilon;		// strain tensor
+		VoigtVector Sigma;			// stress tensor
+		VoigtVector EpsilonE;		// elastic strain tensor
+		VoigtVector Alpha;			// back-stress ratio
+		VoigtVector Alpha_in;		// back-stress ratio at loading reversal
+		VoigtVector Alpha_in_p;		// previous back-stress ratio at loading reversal
+		VoigtVector Alpha_in_true;	// true initial back stress ratio tensor
+		VoigtVector Alpha_in_max;	// Maximum value of initial back stress ratio
+		VoigtVector Alpha_in_min;	// Minimum value of initial back stress ratio
+		VoigtVector Fabric;			// fabric tensor
+		VoigtVector Fabric_in;		// fabric tensor at loading reversal
+		double DGamma;				// plastic multiplier
+	};
+	NDMaterialState<State> mState;
+
 	Vector mEpsilon_r;  // negative strain tensor for returning
-	Vector mSigma;      // stress tensor
-	Vector mSigma_n;    // stress tensor (last committed)
 	Vector mSigma_r;    // negative stress tensor for returning
-	Vector mSigma_b;    // stress tensor offset from initial stress state outside bounding surface correction
-	Vector mEpsilonE;	// elastic strain tensor
-	Vector mEpsilonE_n;	// elastic strain tensor (last committed)
+	Vector mSigma_rec;  // stress tensor for recording
+	VoigtVector mSigma_b;    // stress tensor offset from initial stress state outside bounding surface correction
 	Vector mEpsilonE_r; // negative elastic strain tensor for returning
-	Vector mAlpha;		// back-stress ratio
-	Vector mAlpha_n;	// back-stress ratio (last committed)
-	Vector mAlpha_in;	// back-stress ratio at loading reversal
-	Vector mAlpha_in_n;	// back-stress ratio at loading reversal (last committed)
-	Vector mAlpha_in_p; // previous back-stress ratio at loading reversal
-	Vector mAlpha_in_p_n; // previous back-stress ratio at loading reversal (last committed)
-	Vector mAlpha_in_true;  // true initial back stress ratio tensor
-	Vector mAlpha_in_true_n;  // true initial back stress ratio tensor (last committed)
-	Vector mAlpha_in_max; // Maximum value of initial back stress ratio
-	Vector mAlpha_in_max_n; // Maximum value of initial back stress ratio (last committed)
-	Vector mAlpha_in_min; // Minimum value of initial back stress ratio
-	Vector mAlpha_in_min_n; // Minimum value of initial back stress ratio (last committed)
-	double mDGamma;		// plastic multiplier
-	double mDGamma_n;	// plastic multiplier (last committed)
-	Vector mFabric;		// fabric tensor
-	Vector mFabric_n;	// fabric tensor (last committed)
-	Vector mFabric_in;  // fabric tensor at loading reversal
-	Vector mFabric_in_n;  // fabric tensor at loading reversal (last committed)
-	Matrix mCe;			// elastic tangent
-	Matrix mCep;		// continuum elastoplastic tangent
-	Matrix mCep_Consistent; // consistent elastoplastic tangent
+	VoigtMatrix mCe;			// elastic tangent
+	VoigtMatrix mCep;		// continuum elastoplastic tangent
+	VoigtMatrix mCep_Consistent; // consistent elastoplastic tangent
+	Matrix mTangent_r;        // tangent for returning
+	Matrix mInitialTangent_r; // initial tangent for returning
 	double mK;			// state dependent Bulk modulus
 	double mG;			// state dependent Shear modulus
 	double mVoidRatio;	// material void ratio
@@ -198,22 +195,22 @@ protected:
 
 	double	mTolF;			// max drift from yield surface
 	double	mTolR;			// tolerance for Newton iterations
-	char unsigned mIter;	// number of iterations
+	int	mIter;			// number of sub-steps of the last integration
 	char unsigned mScheme;	// 1: Forward Euler Explicit, 2: Modified Euler Explicit
 	char unsigned mTangType;// 0: Elastic Tangent, 1: Contiuum ElastoPlastic Tangent, 2: Consistent ElastoPlastic Tangent
 	double	m_Pmin;			// Minimum allowable mean effective stress
 	double  m_Pmin2;        // Minimum p for Cpzp2 and Cpmin
 	bool    m_pzpFlag;          // flag for updating pzp
-	static char unsigned   me2p;	// 0: enforce elastic response
+	char unsigned   me2p;	// 0: enforce elastic response
 
-	static Vector mI1;			// 2nd Order Identity Tensor
-	static Matrix mIIco;		// 4th-order identity tensor, covariant
-	static Matrix mIIcon;		// 4th-order identity tensor, contravariant
-	static Matrix mIImix;		// 4th-order identity tensor, mixed variant
-	static Matrix mIIvol;		// 4th-order volumetric tensor, IIvol = I1 tensor I1 
-	static Matrix mIIdevCon;	// 4th order deviatoric tensor, contravariant
-	static Matrix mIIdevMix;	// 4th order deviatoric tensor, mixed variant
-	static Matrix mIIdevCo;		// 4th order deviatoric tensor, covariant
+	static VoigtVector mI1;			// 2nd Order Identity Tensor
+	static VoigtMatrix mIIco;		// 4th-order identity tensor, covariant
+	static VoigtMatrix mIIcon;		// 4th-order identity tensor, contravariant
+	static VoigtMatrix mIImix;		// 4th-order identity tensor, mixed variant
+	static VoigtMatrix mIIvol;		// 4th-order volumetric tensor, IIvol = I1 tensor I1 
+	static VoigtMatrix mIIdevCon;	// 4th order deviatoric tensor, contravariant
+	static VoigtMatrix mIIdevMix;	// 4th order deviatoric tensor, mixed variant
+	static VoigtMatrix mIIdevCo;		// 4th order deviatoric tensor, covariant
 								// initialize these Vector and Matrices:
 	static class initTensors {
 	public:
@@ -260,66 +257,68 @@ protected:
 
 											 //Member Functions specific for PM4Sand model
 											 //void	initialize();
+	int	initialize(const VoigtVector& initStress);
 	void	integrate();
-	void	elastic_integrator(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
-		const Vector& NextStrain, Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha,
-		double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent);
-	void	explicit_integrator(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
-		const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& alpha_in_p, const Vector& NextStrain,
-		Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
-		double& NextDGamma, double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent);
-	void	ForwardEuler(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
-		const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& alpha_in_p, const Vector& NextStrain,
-		Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
-		double& NextDGamma, double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent);
-	void	ModifiedEuler(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
-		const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& alpha_in_p, const Vector& NextStrain,
-		Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
-		double& NextDGamma, double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent);
-	void	RungeKutta4(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
-		const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& alpha_in_p, const Vector& NextStrain,
-		Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
-		double& NextDGamma, double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent);
-	void	MaxStrainInc(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
-		const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& alpha_in_p, const Vector& NextStrain,
-		Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
-		double& NextDGamma, double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent);
+	void	update_reversal();
+	void	elastic_integrator(const VoigtVector& CurStress, const VoigtVector& CurStrain, const VoigtVector& CurElasticStrain,
+		const VoigtVector& NextStrain, VoigtVector& NextElasticStrain, VoigtVector& NextStress, VoigtVector& NextAlpha,
+		double& NextVoidRatio, double& G, double& K, VoigtMatrix& aC, VoigtMatrix& aCep, VoigtMatrix& aCep_Consistent);
+	void	explicit_integrator(const VoigtVector& CurStress, const VoigtVector& CurStrain, const VoigtVector& CurElasticStrain,
+		const VoigtVector& CurAlpha, const VoigtVector& CurFabric, const VoigtVector& alpha_in, const VoigtVector& alpha_in_p, const VoigtVector& NextStrain,
+		VoigtVector& NextElasticStrain, VoigtVector& NextStress, VoigtVector& NextAlpha, VoigtVector& NextFabric,
+		double& NextDGamma, double& NextVoidRatio, double& G, double& K, VoigtMatrix& aC, VoigtMatrix& aCep, VoigtMatrix& aCep_Consistent);
+	void	ForwardEuler(const VoigtVector& CurStress, const VoigtVector& CurStrain, const VoigtVector& CurElasticStrain,
+		const VoigtVector& CurAlpha, const VoigtVector& CurFabric, const VoigtVector& alpha_in, const VoigtVector& alpha_in_p, const VoigtVector& NextStrain,
+		VoigtVector& NextElasticStrain, VoigtVector& NextStress, VoigtVector& NextAlpha, VoigtVector& NextFabric,
+		double& NextDGamma, double& NextVoidRatio, double& G, double& K, VoigtMatrix& aC, VoigtMatrix& aCep, VoigtMatrix& aCep_Consistent);
+	void	ModifiedEuler(const VoigtVector& CurStress, const VoigtVector& CurStrain, const VoigtVector& CurElasticStrain,
+		const VoigtVector& CurAlpha, const VoigtVector& CurFabric, const VoigtVector& alpha_in, const VoigtVector& alpha_in_p, const VoigtVector& NextStrain,
+		VoigtVector& NextElasticStrain, VoigtVector& NextStress, VoigtVector& NextAlpha, VoigtVector& NextFabric,
+		double& NextDGamma, double& NextVoidRatio, double& G, double& K, VoigtMatrix& aC, VoigtMatrix& aCep, VoigtMatrix& aCep_Consistent);
+	void	RungeKutta4(const VoigtVector& CurStress, const VoigtVector& CurStrain, const VoigtVector& CurElasticStrain,
+		const VoigtVector& CurAlpha, const VoigtVector& CurFabric, const VoigtVector& alpha_in, const VoigtVector& alpha_in_p, const VoigtVector& NextStrain,
+		VoigtVector& NextElasticStrain, VoigtVector& NextStress, VoigtVector& NextAlpha, VoigtVector& NextFabric,
+		double& NextDGamma, double& NextVoidRatio, double& G, double& K, VoigtMatrix& aC, VoigtMatrix& aCep, VoigtMatrix& aCep_Consistent);
+	void	MaxStrainInc(const VoigtVector& CurStress, const VoigtVector& CurStrain, const VoigtVector& CurElasticStrain,
+		const VoigtVector& CurAlpha, const VoigtVector& CurFabric, const VoigtVector& alpha_in, const VoigtVector& alpha_in_p, const VoigtVector& NextStrain,
+		VoigtVector& NextElasticStrain, VoigtVector& NextStress, VoigtVector& NextAlpha, VoigtVector& NextFabric,
+		double& NextDGamma, double& NextVoidRatio, double& G, double& K, VoigtMatrix& aC, VoigtMatrix& aCep, VoigtMatrix& aCep_Consistent);
 
-	double	IntersectionFactor(const Vector& CurStress, const Vector& CurStrain, const Vector& NextStrain, const Vector& CurAlpha,
+	double	IntersectionFactor(const VoigtVector& CurStress, const VoigtVector& CurStrain, const VoigtVector& NextStrain, const VoigtVector& CurAlpha,
 		double a0, double a1);
-	double	IntersectionFactor_Unloading(const Vector& CurStress, const Vector& CurStrain, const Vector& NextStrain, const Vector& CurAlpha);
-	void Stress_Correction(Vector& NextStress, Vector& NextAlpha, const Vector& alpha_in, const Vector& alpha_in_p, const Vector& CurFabric, double& NextVoidRatio);
-	void Stress_Correction(Vector& NextStress, Vector& NextAlpha, const Vector& dAlpha, const double m, const Vector& R, const Vector& n, const Vector& r);
+	double	IntersectionFactor_Unloading(const VoigtVector& CurStress, const VoigtVector& CurStrain, const VoigtVector& NextStrain, const VoigtVector& CurAlpha);
+	void Stress_Correction(VoigtVector& NextStress, VoigtVector& NextAlpha, const VoigtVector& alpha_in, const VoigtVector& alpha_in_p, const VoigtVector& CurFabric, double& NextVoidRatio);
+	void Stress_Correction(VoigtVector& NextStress, VoigtVector& NextAlpha, const VoigtVector& dAlpha, const double m, const VoigtVector& R, const VoigtVector& n, const VoigtVector& r);
 	// Material Specific Methods
 	double	Macauley(double x);
 	double	MacauleyIndex(double x);
-	double	GetF(const Vector& nStress, const Vector& nAlpha);
+	double	GetF(const VoigtVector& nStress, const VoigtVector& nAlpha);
 	double	GetKsi(const double& e, const double& p);
-	void	GetElasticModuli(const Vector& sigma, double &K, double &G);
-	void	GetElasticModuli(const Vector& sigma, double &K, double &G, double &Mcur, const double& zcum);
-	Matrix	GetStiffness(const double& K, const double& G);
-	Matrix	GetCompliance(const double& K, const double& G);
-	void	GetStateDependent(const Vector &stress, const Vector &alpha, const Vector &alpha_in, const Vector& alpha_in_p
-		, const Vector &fabric, const Vector &fabric_in, const double &G, const double &zcum, const double &zpeak
-		, const double &pzp, const double &Mcur, const double &dr, Vector &n, double &D, Vector &R, double &K_p
-		, Vector &alphaD, double &Cka, double &h, Vector &b, double &AlphaAlphaBDotN);
-	Matrix	GetElastoPlasticTangent(const Vector& NextStress, const Matrix& aCe, const Vector& R, const Vector& n, const double K_p);
-	Vector	GetNormalToYield(const Vector &stress, const Vector &alpha);
-	int	Check(const Vector& TrialStress, const Vector& stress, const Vector& CurAlpha, const Vector& NextAlpha);
+	void	GetElasticModuli(const VoigtVector& sigma, double &K, double &G);
+	void	GetElasticModuli(const VoigtVector& sigma, double &K, double &G, double &Mcur, const double& zcum);
+	VoigtMatrix	GetStiffness(const double& K, const double& G);
+	VoigtMatrix	GetCompliance(const double& K, const double& G);
+	void	GetStateDependent(const VoigtVector &stress, const VoigtVector &alpha, const VoigtVector &alpha_in, const VoigtVector& alpha_in_p
+		, const VoigtVector &fabric, const VoigtVector &fabric_in, const double &G, const double &zcum, const double &zpeak
+		, const double &pzp, const double &Mcur, const double &dr, VoigtVector &n, double &D, VoigtVector &R, double &K_p
+		, VoigtVector &alphaD, double &Cka, double &h, VoigtVector &b, double &AlphaAlphaBDotN);
+	VoigtMatrix	GetElastoPlasticTangent(const VoigtVector& NextStress, const VoigtMatrix& aCe, const VoigtVector& R, const VoigtVector& n, const double K_p);
+	VoigtVector	GetNormalToYield(const VoigtVector &stress, const VoigtVector &alpha);
+	int	Check(const VoigtVector& TrialStress, const VoigtVector& stress, const VoigtVector& CurAlpha, const VoigtVector& NextAlpha);
 
 	// Symmetric Tensor Operations
-	double GetTrace(const Vector& v);
-	Vector GetDevPart(const Vector& aV);
-	double DoubleDot2_2_Contr(const Vector& v1, const Vector& v2);
-	double DoubleDot2_2_Cov(const Vector& v1, const Vector& v2);
-	double DoubleDot2_2_Mixed(const Vector& v1, const Vector& v2);
-	double GetNorm_Contr(const Vector& v);
-	double GetNorm_Cov(const Vector& v);
-	Matrix Dyadic2_2(const Vector& v1, const Vector& v2);
-	Vector DoubleDot4_2(const Matrix& m1, const Vector& v1);
-	Vector DoubleDot2_4(const Vector& v1, const Matrix& m1);
-	Matrix DoubleDot4_4(const Matrix& m1, const Matrix& m2);
-	Vector ToContraviant(const Vector& v1);
-	Vector ToCovariant(const Vector& v1);
+	double GetTrace(const VoigtVector& v);
+	VoigtVector GetDevPart(const VoigtVector& aV);
+	double DoubleDot2_2_Contr(const VoigtVector& v1, const VoigtVector& v2);
+	double DoubleDot2_2_Cov(const VoigtVector& v1, const VoigtVector& v2);
+	double DoubleDot2_2_Mixed(const VoigtVector& v1, const VoigtVector& v2);
+	double GetNorm_Contr(const VoigtVector& v);
+	double GetNorm_Cov(const VoigtVector& v);
+	VoigtMatrix Dyadic2_2(const VoigtVector& v1, const VoigtVector& v2);
+	VoigtVector DoubleDot4_2(const VoigtMatrix& m1, const VoigtVector& v1);
+	VoigtVector DoubleDot2_4(const VoigtVector& v1, const VoigtMatrix& m1);
+	VoigtMatrix DoubleDot4_4(const VoigtMatrix& m1, const VoigtMatrix& m2);
+	VoigtVector ToContraviant(const VoigtVector& v1);
+	VoigtVector ToCovariant(const VoigtVector& v1);
 };
 #endif
@@ -51,19 +51,18 @@ const double		PM4Silt::small = 1e-10;
 const double		PM4Silt::maxStrainInc = 1e-6;
 const bool  		PM4Silt::debugFlag = false;
 const char unsigned	PM4Silt::mMaxSubStep = 10;
-char  unsigned		PM4Silt::me2p = 1;
-
-Vector 			PM4Silt::mI1(3);
-Matrix  		PM4Silt::mIIco(3, 3);
-Matrix 			PM4Silt::mIIcon(3, 3);
-Matrix 			PM4Silt::mIImix(3, 3);
-Matrix 			PM4Silt::mIIvol(3, 3);
-Matrix 			PM4Silt::mIIdevCon(3, 3);
-Matrix 			PM4Silt::mIIdevMix(3, 3);
-Matrix 			PM4Silt::mIIdevCo(3, 3);
+
+VoigtVector		PM4Silt::mI1;
+VoigtMatrix		PM4Silt::mIIco;
+VoigtMatrix		PM4Silt::mIIcon;
+VoigtMatrix		PM4Silt::mIImix;
+VoigtMatrix		PM4Silt::mIIvol;
+VoigtMatrix		PM4Silt::mIIdevCon;
+VoigtMatrix		PM4Silt::mIIdevMix;
+VoigtMatrix		PM4Silt::mIIdevCo;
 PM4Silt::initTensors PM4Silt::initTensorOps;
 
-static int numPM4SiltMaterials = 0;
+static thread_local int numPM4SiltMaterials = 0;
 
 void *
 OPS_PM4SiltMaterial(void)
@@ -146,32 +145,12 @@ OPS_PM4SiltMaterial(void)
 PM4Silt::PM4Silt(int tag, int classTag, double Su, double Su_rate, double G0, double hpo, double mDen, double Fsu, double P_atm, double nu, double nG, double h0,
 	double einit, double lambda, double phi_cv, double nbwet, double nbdry, double nd, double Ado, double ru_max, double z_max, double cz, double ce,
 	double Cgd, double Ckaf, double m, double CG_consol, int integrationScheme, int tangentType, double TolF, double TolR) : NDMaterial(tag, classTag),
-	mEpsilon(3),
-	mEpsilon_n(3),
-	mEpsilonE(3),
-	mEpsilonE_n(3),
-	mSigma(3),
-	mSigma_b(3),
-	mSigma_n(3),
-	mAlpha(3),
-	mAlpha_n(3),
-	mAlpha_in(3),
-	mAlpha_in_n(3),
-	mAlpha_in_p(3),
-	mAlpha_in_p_n(3),
-	mAlpha_in_true(3),
-	mAlpha_in_true_n(3),
-	mAlpha_in_max(3),
-	mAlpha_in_max_n(3),
-	mAlpha_in_min(3),
-	mAlpha_in_min_n(3),
-	mFabric(3),
-	mFabric_n(3),
-	mFabric_in(3),
-	mFabric_in_n(3),
-	mCe(3, 3),
-	mCep(3, 3),
-	mCep_Consistent(3, 3),
+	mEpsilon_r(3),
+	mSigma_r(3),
+	mSigma_rec(3),
+	mEpsilonE_r(3),
+	mTangent_r(3, 3),
+	mInitialTangent_r(3, 3),
 	mTracker(3)
 {
 	m_Su = Su;
@@ -211,6 +190,7 @@ PM4Silt::PM4Silt(int tag, int classTag, double Su, double Su_rate, double G0, do
 	m_PostShake = 0;
 	m_CG_consol = CG_consol;
 	mScheme = integrationScheme;
+	me2p = 1;
 	mTangType = tangentType;
 	mTolF = TolF;
 	mTolR = TolR;
@@ -224,32 +204,12 @@ PM4Silt::PM4Silt(int tag, double Su, double Su_rate, double G0, double hpo, doub
 	double einit, double lambda, double phi_cv, double nbwet, double nbdry, double nd, double Ado, double ru_max, double z_max, double cz,
 	double ce, double Cgd, double Ckaf, double m, double CG_consol, int integrationScheme, int tangentType, double TolF, double TolR)
 	: NDMaterial(tag, ND_TAG_PM4Silt),
-	mEpsilon(3),
-	mEpsilon_n(3),
-	mEpsilonE(3),
-	mEpsilonE_n(3),
-	mSigma(3),
-	mSigma_n(3),
-	mSigma_b(3),
-	mAlpha(3),
-	mAlpha_n(3),
-	mAlpha_in(3),
-	mAlpha_in_n(3),
-	mAlpha_in_p(3),
-	mAlpha_in_p_n(3),
-	mAlpha_in_true(3),
-	mAlpha_in_true_n(3),
-	mAlpha_in_max(3),
-	mAlpha_in_max_n(3),
-	mAlpha_in_min(3),
-	mAlpha_in_min_n(3),
-	mFabric(3),
-	mFabric_n(3),
-	mFabric_in(3),
-	mFabric_in_n(3),
-	mCe(3, 3),
-	mCep(3, 3),
-	mCep_Consistent(3, 3),
+	mEpsilon_r(3),
+	mSigma_r(3),
+	mSigma_rec(3),
+	mEpsilonE_r(3),
+	mTangent_r(3, 3),
+	mInitialTangent_r(3, 3),
 	mTracker(3)
 {
 	m_Su = Su;
@@ -289,6 +249,7 @@ PM4Silt::PM4Silt(int tag, double Su, double Su_rate, double G0, double hpo, doub
 	m_PostShake = 0;
 	m_CG_consol = CG_consol;
 	mScheme = integrationScheme;
+	me2p = 1;
 	mTangType = tangentType;
 	mTolF = TolF;
 	mTolR = TolR;
@@ -300,32 +261,12 @@ PM4Silt::PM4Silt(int tag, double Su, double Su_rate, double G0, double hpo, doub
 // null constructor
 PM4Silt::PM4Silt()
 	: NDMaterial(),
-	mEpsilon(3),
-	mEpsilon_n(3),
-	mEpsilonE(3),
-	mEpsilonE_n(3),
-	mSigma(3),
-	mSigma_n(3),
-	mSigma_b(3),
-	mAlpha(3),
-	mAlpha_n(3),
-	mAlpha_in(3),
-	mAlpha_in_n(3),
-	mAlpha_in_p(3),
-	mAlpha_in_p_n(3),
-	mAlpha_in_true(3),
-	mAlpha_in_true_n(3),
-	mAlpha_in_max(3),
-	mAlpha_in_max_n(3),
-	mAlpha_in_min(3),
-	mAlpha_in_min_n(3),
-	mFabric(3),
-	mFabric_n(3),
-	mFabric_in(3),
-	mFabric_in_n(3),
-	mCe(3, 3),
-	mCep(3, 3),
-	mCep_Consistent(3, 3),
+	mEpsilon_r(3),
+	mSigma_r(3),
+	mSigma_rec(3),
+	mEpsilonE_r(3),
+	mTangent_r(3, 3),
+	mInitialTangent_r(3, 3),
 	mTracker(3)
 {
 	m_Su = 0.0;
@@ -356,6 +297,7 @@ PM4Silt::PM4Silt()
 	m_PostShake = 0;
 	m_CG_consol = 2.0;
 	mScheme = 1;
+	me2p = 1;
 	mTangType = 0;
 	mTolF = 1.0e-7;
 	mTolR = 1.0e-7;
@@ -379,6 +321,7 @@ PM4Silt::getCopy(const char *type)
 		clone = new PM4Silt(this->getTag(), m_Su, m_Su_rate, m_G0, m_hpo, massDen, m_Fsu, m_P_atm, m_nu, m_nG, m_h0,
 			m_e_init, m_lambda, phi_cv, m_nbwet, m_nbdry, m_nd, m_Ado, m_ru_max, m_z_max, m_cz, m_ce, m_Cgd, m_Ckaf, m_m,
 			m_CG_consol, mScheme, mTangType, mTolF, mTolR);
+		clone->me2p = me2p;
 		return clone;
 	}
 	else if (strcmp(type, "ThreeDimensional") == 0 || strcmp(type, "3D") == 0) {
@@ -394,36 +337,25 @@ PM4Silt::getCopy(const char *type)
 int
 PM4Silt::commitState(void)
 {
-	Vector n(3), R(3), dFabric(3);
-
-	mAlpha_in_n = mAlpha_in;
-	mAlpha_n = mAlpha;
-	mAlpha_in_p_n = mAlpha_in_p;
-	mAlpha_in_true_n = mAlpha_in_true;
-	mAlpha_in_max_n = mAlpha_in_max;
-	mAlpha_in_min_n = mAlpha_in_min;
-	mSigma_n = mSigma;
-	mEpsilon_n = mEpsilon;
-	mEpsilonE_n = mEpsilonE;
-	dFabric = mFabric - mFabric_n;
+	VoigtVector n, R, dFabric;
+
+	dFabric = mState.trial.Fabric - mState.committed.Fabric;
 	// update cumulated fabric
 	mzcum = mzcum + sqrt(DoubleDot2_2_Contr(dFabric, dFabric) / 2.0);
-	mzpeak = fmax(sqrt(DoubleDot2_2_Contr(mFabric, mFabric) / 2.0), mzpeak);
-	mFabric_n = mFabric;
-	mFabric_in_n = mFabric_in;
-	mDGamma_n = mDGamma;
-	mVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(mEpsilon);
+	mzpeak = fmax(sqrt(DoubleDot2_2_Contr(mState.trial.Fabric, mState.trial.Fabric) / 2.0), mzpeak);
+	mState.commit();
+	mVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(mState.trial.Epsilon);
 
-	this->GetElasticModuli(mSigma, mK, mG, mMcur, mzcum);
+	this->GetElasticModuli(mState.trial.Sigma, mK, mG, mMcur, mzcum);
 	mCe = GetStiffness(mK, mG);
-	mCep = GetElastoPlasticTangent(mSigma_n, mCe, R, n, mKp);
+	mCep = GetElastoPlasticTangent(mState.committed.Sigma, mCe, R, n, mKp);
 	mCep_Consistent = mCe;
 	return 0;
 }
 
 int PM4Silt::revertToLastCommit(void)
 {
-	// need to be added
+	mState.revert();
 	return 0;
 }
 
@@ -435,7 +367,7 @@ int PM4Silt::revertToStart(void)
 	}
 	else {
 		// normal call for revertToStart (not initialStateAnalysis)
-		this->initialize(mSigma);
+		this->initialize(mState.trial.Sigma);
 	}
 
 	return 0;
@@ -531,7 +463,7 @@ PM4Silt::sendSelf(int commitTag, Channel &theChannel)
 {
 
 	int res = 0;
-	static Vector data(105);
+	static thread_local Vector data(105);
 
 	data(0) = this->getTag();
 
@@ -571,8 +503,8 @@ PM4Silt::sendSelf(int commitTag, Channel &theChannel)
 	data(35) = m_pzpFlag;
 	data(36) = me2p;
 
-	data(37) = mDGamma;
-	data(38) = mDGamma_n;
+	data(37) = mState.trial.DGamma;
+	data(38) = mState.committed.DGamma;
 	data(39) = me0;
 	data(40) = mpcs;
 	data(41) = mK;
@@ -589,21 +521,21 @@ PM4Silt::sendSelf(int commitTag, Channel &theChannel)
 	data(52) = mMd;
 	data(53) = mMcur;
 
-	data(54) = mEpsilon(0);		  data(57) = mEpsilon_n(0);	    data(60) = mSigma(0);	data(63) = mSigma_n(0);   data(66) = mSigma_b(0);
-	data(55) = mEpsilon(1);		  data(58) = mEpsilon_n(1);	    data(61) = mSigma(1);	data(64) = mSigma_n(1);	  data(67) = mSigma_b(1);
-	data(56) = mEpsilon(2);		  data(59) = mEpsilon_n(2);	    data(62) = mSigma(2);	data(65) = mSigma_n(2);	  data(68) = mSigma_b(2);
+	data(54) = mState.trial.Epsilon(0);		  data(57) = mState.committed.Epsilon(0);	    data(60) = mState.trial.Sigma(0);	data(63) = mState.committed.Sigma(0);   data(66) = mSigma_b(0);
+	data(55) = mState.trial.Epsilon(1);		  data(58) = mState.committed.Epsilon(1);	    data(61) = mState.trial.Sigma(1);	data(64) = mState.committed.Sigma(1);	  data(67) = mSigma_b(1);
+	data(56) = mState.trial.Epsilon(2);		  data(59) = mState.committed.Epsilon(2);	    data(62) = mState.trial.Sigma(2);	data(65) = mState.committed.Sigma(2);	  data(68) = mSigma_b(2);
 
-	data(69) = mEpsilonE(0);	  data(72) = mEpsilonE_n(0);	data(75) = mAlpha(0);	data(78) = mAlpha_n(0);   data(81) = mAlpha_in_n(0);
-	data(70) = mEpsilonE(1);	  data(73) = mEpsilonE_n(1);	data(76) = mAlpha(1);	data(79) = mAlpha_n(1);	  data(82) = mAlpha_in_n(1);
-	data(71) = mEpsilonE(2);	  data(74) = mEpsilonE_n(2);	data(77) = mAlpha(2);	data(80) = mAlpha_n(2);	  data(83) = mAlpha_in_n(2);
+	data(69) = mState.trial.EpsilonE(0);	  data(72) = mState.committed.EpsilonE(0);	data(75) = mState.trial.Alpha(0);	data(78) = mState.committed.Alpha(0);   data(81) = mState.committed.Alpha_in(0);
+	data(70) = mState.trial.EpsilonE(1);	  data(73) = mState.committed.EpsilonE(1);	data(76) = mState.trial.Alpha(1);	data(79) = mState.committed.Alpha(1);	  data(82) = mState.committed.Alpha_in(1);
+	data(71) = mState.trial.EpsilonE(2);	  data(74) = mState.committed.EpsilonE(2);	data(77) = mState.trial.Alpha(2);	data(80) = mState.committed.Alpha(2);	  data(83) = mState.committed.Alpha_in(2);
 
-	data(84) = mAlpha_in_p_n(0);  data(87) = mAlpha_in_true_n(0);    data(90) = mAlpha_in_max_n(0);      data(93) = mAlpha_in_min_n(0);
-	data(85) = mAlpha_in_p_n(1);  data(88) = mAlpha_in_true_n(1);    data(91) = mAlpha_in_max_n(1);      data(94) = mAlpha_in_min_n(1);
-	data(86) = mAlpha_in_p_n(2);  data(89) = mAlpha_in_true_n(2);    data(92) = mAlpha_in_max_n(2);      data(95) = mAlpha_in_min_n(2);
+	data(84) = mState.committed.Alpha_in_p(0);  data(87) = mState.committed.Alpha_in_true(0);    data(90) = mState.committed.Alpha_in_max(0);      data(93) = mState.committed.Alpha_in_min(0);
+	data(85) = mState.committed.Alpha_in_p(1);  data(88) = mState.committed.Alpha_in_true(1);    data(91) = mState.committed.Alpha_in_max(1);      data(94) = mState.committed.Alpha_in_min(1);
+	data(86) = mState.committed.Alpha_in_p(2);  data(89) = mState.committed.Alpha_in_true(2);    data(92) = mState.committed.Alpha_in_max(2);      data(95) = mState.committed.Alpha_in_min(2);
 
-	data(96) = mFabric(0);		data(99) = mFabric_n(0);	 data(102) = mFabric_in_n(0);
-	data(97) = mFabric(1);		data(100) = mFabric_n(1);	 data(103) = mFabric_in_n(1);
-	data(98) = mFabric(2);		data(101) = mFabric_n(2);	 data(104) = mFabric_in_n(2);
+	data(96) = mState.trial.Fabric(0);		data(99) = mState.committed.Fabric(0);	 data(102) = mState.committed.Fabric_in(0);
+	data(97) = mState.trial.Fabric(1);		data(100) = mState.committed.Fabric(1);	 data(103) = mState.committed.Fabric_in(1);
+	data(98) = mState.trial.Fabric(2);		data(101) = mState.committed.Fabric(2);	 data(104) = mState.committed.Fabric_in(2);
 
 	res = theChannel.sendVector(this->getDbTag(), commitTag, data);
 	if (res < 0) {
@@ -619,7 +551,7 @@ PM4Silt::recvSelf(int commitTag, Channel &theChannel,
 	FEM_ObjectBroker &theBroker)
 {
 	int res = 0;
-	static Vector data(105);
+	static thread_local Vector data(105);
 
 	res = theChannel.recvVector(this->getDbTag(), commitTag, data);
 	if (res < 0) {
@@ -664,8 +596,8 @@ PM4Silt::recvSelf(int commitTag, Channel &theChannel,
 	m_pzpFlag = data(35);
 	me2p = data(36);
 
-	mDGamma = data(37);
-	mDGamma_n = data(38);
+	mState.trial.DGamma = data(37);
+	mState.committed.DGamma = data(38);
 	me0 = data(39);
 	mpcs = data(40);
 	mK = data(41);
@@ -682,21 +614,21 @@ PM4Silt::recvSelf(int commitTag, Channel &theChannel,
 	mMd = data(52);
 	mMcur = data(53);
 
-	mEpsilon(0) = data(54); 		mEpsilon_n(0) = data(57); 	    mSigma(0) = data(60); 	  mSigma_n(0) = data(63);       mSigma_b(0) = data(66);
-	mEpsilon(1) = data(55); 		mEpsilon_n(1) = data(58); 	    mSigma(1) = data(61); 	  mSigma_n(1) = data(64); 	     mSigma_b(1) = data(67);
-	mEpsilon(2) = data(56); 		mEpsilon_n(2) = data(59); 	    mSigma(2) = data(62); 	  mSigma_n(2) = data(65); 	     mSigma_b(2) = data(68);
+	mState.trial.Epsilon(0) = data(54); 		mState.committed.Epsilon(0) = data(57); 	    mState.trial.Sigma(0) = data(60); 	  mState.committed.Sigma(0) = data(63);       mSigma_b(0) = data(66);
+	mState.trial.Epsilon(1) = data(55); 		mState.committed.Epsilon(1) = data(58); 	    mState.trial.Sigma(1) = data(61); 	  mState.committed.Sigma(1) = data(64); 	     mSigma_b(1) = data(67);
+	mState.trial.Epsilon(2) = data(56); 		mState.committed.Epsilon(2) = data(59); 	    mState.trial.Sigma(2) = data(62); 	  mState.committed.Sigma(2) = data(65); 	     mSigma_b(2) = data(68);
 
-	mEpsilonE(0) = data(69); 	    mEpsilonE_n(0) = data(72); 	  mAlpha(0) = data(75); 	   mAlpha_n(0) = data(78);     mAlpha_in_n(0) = data(81);
-	mEpsilonE(1) = data(70); 	    mEpsilonE_n(1) = data(73); 	  mAlpha(1) = data(76); 	   mAlpha_n(1) = data(79);	    mAlpha_in_n(1) = data(82);
-	mEpsilonE(2) = data(71); 	    mEpsilonE_n(2) = data(74); 	  mAlpha(2) = data(77); 	   mAlpha_n(2) = data(80);	    mAlpha_in_n(2) = data(83);
+	mState.trial.EpsilonE(0) = data(69); 	    mState.committed.EpsilonE(0) = data(72); 	  mState.trial.Alpha(0) = data(75); 	   mState.committed.Alpha(0) = data(78);     mState.committed.Alpha_in(0) = data(81);
+	mState.trial.EpsilonE(1) = data(70); 	    mState.committed.EpsilonE(1) = data(73); 	  mState.trial.Alpha(1) = data(76); 	   mState.committed.Alpha(1) = data(79);	    mState.committed.Alpha_in(1) = data(82);
+	mState.trial.EpsilonE(2) = data(71); 	    mState.committed.EpsilonE(2) = data(74); 	  mState.trial.Alpha(2) = data(77); 	   mState.committed.Alpha(2) = data(80);	    mState.committed.Alpha_in(2) = data(83);
 
-	mAlpha_in_p_n(0) = data(84);    mAlpha_in_true_n(0) = data(87);       mAlpha_in_max_n(0) = data(90);       mAlpha_in_min_n(0) = data(93);
-	mAlpha_in_p_n(1) = data(85);    mAlpha_in_true_n(1) = data(88);       mAlpha_in_max_n(1) = data(91);       mAlpha_in_min_n(1) = data(94);
-	mAlpha_in_p_n(2) = data(86);    mAlpha_in_true_n(2) = data(89);       mAlpha_in_max_n(2) = data(92);       mAlpha_in_min_n(2) = data(95);
+	mState.committed.Alpha_in_p(0) = data(84);    mState.committed.Alpha_in_true(0) = data(87);       mState.committed.Alpha_in_max(0) = data(90);       mState.committed.Alpha_in_min(0) = data(93);
+	mState.committed.Alpha_in_p(1) = data(85);    mState.committed.Alpha_in_true(1) = data(88);       mState.committed.Alpha_in_max(1) = data(91);       mState.committed.Alpha_in_min(1) = data(94);
+	mState.committed.Alpha_in_p(2) = data(86);    mState.committed.Alpha_in_true(2) = data(89);       mState.committed.Alpha_in_max(2) = data(92);       mState.committed.Alpha_in_min(2) = data(95);
 
-	mFabric(0) = data(96);		  mFabric_n(0) = data(99);  	   mFabric_in_n(0) = data(102);
-	mFabric(1) = data(97);		  mFabric_n(1) = data(100); 	   mFabric_in_n(1) = data(103);
-	mFabric(2) = data(98);		  mFabric_n(2) = data(101); 	   mFabric_in_n(2) = data(104);
+	mState.trial.Fabric(0) = data(96);		  mState.committed.Fabric(0) = data(99);  	   mState.committed.Fabric_in(0) = data(102);
+	mState.trial.Fabric(1) = data(97);		  mState.committed.Fabric(1) = data(100); 	   mState.committed.Fabric_in(1) = data(103);
+	mState.trial.Fabric(2) = data(98);		  mState.committed.Fabric(2) = data(101); 	   mState.committed.Fabric_in(2) = data(104);
 
 	return 0;
 }
@@ -777,19 +709,19 @@ PM4Silt::updateParameter(int responseID, Information &info)
 	//called update first call
 	else if (responseID == 8) {
 		m_FirstCall = 0;
-		initialize(mSigma_n);
+		initialize(mState.committed.Sigma);
 		opserr << this->getTag() << " initialize" << endln;
 	}
 	// called update voidRatio
 	else if (responseID == 9) {
-		double eps_v = GetTrace(mEpsilon);
+		double eps_v = GetTrace(mState.trial.Epsilon);
 		m_e_init = (info.theDouble + eps_v) / (1 - eps_v);
 	}
 	// called PostShake
 	else if (responseID == 13) {
 		m_PostShake = 1;
 		// mElastFlag = 1;
-		GetElasticModuli(mSigma, mK, mG, mMcur, mzcum);
+		GetElasticModuli(mState.trial.Sigma, mK, mG, mMcur, mzcum);
 		opserr << this->getTag() << " activate post shaking reconsolidation" << endln;
 	}
 	// update undrained shear strength reduction factor Fsu
@@ -805,6 +737,12 @@ PM4Silt::updateParameter(int responseID, Information &info)
 
 int
 PM4Silt::initialize(Vector initStress)
+{
+	return this->initialize(VoigtVector(initStress));
+}
+
+int
+PM4Silt::initialize(const VoigtVector& initStress)
 {
 	double p0;
 	p0 = 0.5 * GetTrace(initStress);
@@ -831,15 +769,15 @@ PM4Silt::initialize(Vector initStress)
 		if (debugFlag)
 			opserr << "Warning, initial p is small. \n";
 		p0 = m_P_atm / 200.0;
-		mSigma_n = p0 * mI1;
-		mSigma_b = initStress - mSigma_n;
-		mAlpha.Zero();
-		mAlpha_n.Zero();
+		mState.committed.Sigma = p0 * mI1;
+		mSigma_b = initStress - mState.committed.Sigma;
+		mState.trial.Alpha.Zero();
+		mState.committed.Alpha.Zero();
 	}
 	else {
-		mSigma_n = initStress;
+		mState.committed.Sigma = initStress;
 		mSigma_b.Zero();
-		mAlpha_n = GetDevPart(initStress) / p0;
+		mState.committed.Alpha = GetDevPart(initStress) / p0;
 	}
 	if (m_Su <= 0.0) {
 		m_Su = m_Su_rate * initStress(1);
@@ -884,33 +822,33 @@ PM4Silt::initialize(Vector initStress)
 
 	// check if initial stresses are inside bounding/dilatancy surface 
 	double Mcut = fmax(mMb, mMd);
-	double Mfin = sqrt(2) * GetNorm_Contr(GetDevPart(mSigma_n));
+	double Mfin = sqrt(2) * GetNorm_Contr(GetDevPart(mState.committed.Sigma));
 	Mfin = Mfin / p0;
 	if (Mfin > Mcut)
 	{
-		Vector r = (mSigma_n - p0 * mI1) / p0 * Mcut / Mfin;
-		mSigma_n = p0 * mI1 + r * p0;
-		mSigma_b = initStress - mSigma_n;
-		mAlpha_n = r * (Mcut - m_m) / Mcut;
+		VoigtVector r = (mState.committed.Sigma - p0 * mI1) / p0 * Mcut / Mfin;
+		mState.committed.Sigma = p0 * mI1 + r * p0;
+		mSigma_b = initStress - mState.committed.Sigma;
+		mState.committed.Alpha = r * (Mcut - m_m) / Mcut;
 	}
 	mzcum = 0.0;
-	GetElasticModuli(mSigma_n, mK, mG, mMcur, mzcum);
+	GetElasticModuli(mState.committed.Sigma, mK, mG, mMcur, mzcum);
 	mCe = mCep = mCep_Consistent = GetStiffness(mK, mG);
 	mKp = 100 * mG;
-	mAlpha = mAlpha_n;
-	mAlpha_in_n = mAlpha_n;
-	mAlpha_in_p = mAlpha_n;
-	mAlpha_in_p_n.Zero();
-	mAlpha_in_true = mAlpha_n;
-	mAlpha_in_true_n = mAlpha_n;
-	mAlpha_in_max = mAlpha_n;
-	mAlpha_in_max_n = mAlpha_n;
-	mAlpha_in_min = mAlpha_n;
-	mAlpha_in_min_n = mAlpha_n;
-	mFabric.Zero();
-	mFabric_in.Zero();
-	mFabric_in_n.Zero();
-	mFabric_n.Zero();
+	mState.trial.Alpha = mState.committed.Alpha;
+	mState.committed.Alpha_in = mState.committed.Alpha;
+	mState.trial.Alpha_in_p = mState.committed.Alpha;
+	mState.committed.Alpha_in_p.Zero();
+	mState.trial.Alpha_in_true = mState.committed.Alpha;
+	mState.committed.Alpha_in_true = mState.committed.Alpha;
+	mState.trial.Alpha_in_max = mState.committed.Alpha;
+	mState.committed.Alpha_in_max = mState.committed.Alpha;
+	mState.trial.Alpha_in_min = mState.committed.Alpha;
+	mState.committed.Alpha_in_min = mState.committed.Alpha;
+	mState.trial.Fabric.Zero();
+	mState.trial.Fabric_in.Zero();
+	mState.committed.Fabric_in.Zero();
+	mState.committed.Fabric.Zero();
 	mzpeak = m_z_max / 100000.0;
 	mpzp = fmax(p0, m_Pmin) / 100.0;
 	mzxp = 0.0;
@@ -925,7 +863,7 @@ int
 PM4Silt::initialize()
 {
 	// set Initial parameters with p = p_atm
-	Vector mSig(3);
+	VoigtVector mSig;
 	m_Pmin = m_P_atm / 200.0;
 	mSig(0) = m_P_atm;
 	mSig(1) = m_P_atm;
@@ -939,7 +877,8 @@ PM4Silt::initialize()
 
 int
 PM4Silt::setTrialStrain(const Vector &strain_from_element) {
-	mEpsilon = -1.0 * strain_from_element;   // -1.0 is for geotechnical sign convention
+	mState.revert();   // the step starts from the last committed state
+	mState.trial.Epsilon = -1.0 * VoigtVector(strain_from_element);   // -1.0 is for geotechnical sign convention
 	integrate();
 	return 0;
 }
@@ -956,12 +895,14 @@ const Vector
 PM4Silt::getState()
 {
 	Vector result(16);
-	result.Assemble(mEpsilonE, 0, 1.0);
-	result.Assemble(mAlpha, 3, 1.0);
-	result.Assemble(mFabric, 6, 1.0);
-	result.Assemble(mAlpha_in, 9, 1.0);
+	for (int i = 0; i < 3; i++) {
+		result(i) = mState.trial.EpsilonE(i);
+		result(3 + i) = mState.trial.Alpha(i);
+		result(6 + i) = mState.trial.Fabric(i);
+		result(9 + i) = mState.trial.Alpha_in(i);
+	}
 	result(12) = mVoidRatio;
-	result(13) = mDGamma;
+	result(13) = mState.trial.DGamma;
 	result(14) = mG;
 	result(15) = mKp;
 
@@ -971,19 +912,25 @@ PM4Silt::getState()
 const Vector
 PM4Silt::getAlpha()
 {
-	return mAlpha_n;
+	Vector result(3);
+	mState.committed.Alpha.copyTo(result);
+	return result;
 }
 //send back fabric tensor
 const Vector
 PM4Silt::getFabric()
 {
-	return mFabric_n;
+	Vector result(3);
+	mState.committed.Fabric.copyTo(result);
+	return result;
 }
 //send back alpha_in tensor
 const Vector
 PM4Silt::getAlpha_in()
 {
-	return mAlpha_in_n;
+	Vector result(3);
+	mState.committed.Alpha_in.copyTo(result);
+	return result;
 }
 //send back internal parameter for tracking
 const Vector
@@ -1008,44 +955,49 @@ PM4Silt::getG()
 const Vector
 PM4Silt::getAlpha_in_p()
 {
-	return mAlpha_in_p_n;
+	Vector result(3);
+	mState.committed.Alpha_in_p.copyTo(result);
+	return result;
 }
 //send back previous L
 double
 PM4Silt::getDGamma()
 {
-	return mDGamma;
+	return mState.trial.DGamma;
 }
 /*************************************************************/
 const Matrix&
 PM4Silt::getTangent() {
 	if (mTangType == 0)
-		return mCe;
+		mCe.copyTo(mTangent_r);
 	else if (mTangType == 1)
-		return mCep;
-	else return mCep_Consistent;
+		mCep.copyTo(mTangent_r);
+	else
+		mCep_Consistent.copyTo(mTangent_r);
+	return mTangent_r;
 }
 /*************************************************************/
 const Matrix &
 PM4Silt::getInitialTangent() {
-	return mCe;
+	mCe.copyTo(mInitialTangent_r);
+	return mInitialTangent_r;
 }
 /*************************************************************/
 const Vector &
 PM4Silt::getStress() {
-	mSigma_r = -1.0 * (mSigma + mSigma_b);
+	(-1.0 * (mState.trial.Sigma + mSigma_b)).copyTo(mSigma_r);
 	return  mSigma_r;  // -1.0 is for geotechnical sign convention
 }
 /*************************************************************/
 const Vector &
 PM4Silt::getStrain() {
-	mEpsilon_r = -1.0 * mEpsilon;   // -1.0 is for geotechnical sign convention
+	(-1.0 * mState.trial.Epsilon).copyTo(mEpsilon_r);   // -1.0 is for geotechnical sign convention
 	return mEpsilon_r;
 }
 /*************************************************************/
 const Vector &
 PM4Silt::getElasticStrain() {
-	mEpsilonE_r = -1.0 * mEpsilonE;   // -1.0 is for geotechnical sign convention
+	(-1.0 * mState.trial.EpsilonE).copyTo(mEpsilonE_r);   // -1.0 is for geotechnical sign convention
 	return mEpsilonE_r;
 }
 // -------------------------------------------------------------------------------------------------------
@@ -1054,27 +1006,19 @@ PM4Silt::getElasticStrain() {
 /*************************************************************/
 void PM4Silt::integrate()
 {
-	mAlpha = mAlpha_n;
-	mAlpha_in = mAlpha_in_n;
-	mAlpha_in_true = mAlpha_in_true_n;
-	mAlpha_in_p = mAlpha_in_p_n;
-	mAlpha_in_max = mAlpha_in_max_n;
-	mAlpha_in_min = mAlpha_in_min_n;
-	mFabric = mFabric_n;
-	mFabric_in = mFabric_in_n;
-
-	Vector n_tr(3);
-	n_tr = GetNormalToYield(mSigma_n + mCe*(mEpsilon - mEpsilon_n), mAlpha);
-	// n_tr = GetNormalToYield(mSigma_n, mAlpha);
-	if ((DoubleDot2_2_Contr(mAlpha - mAlpha_in_true, n_tr) < 0.0) && me2p) {
-		mAlpha_in_p = mAlpha_in;
-		mAlpha_in_true = mAlpha;
-		mFabric_in = mFabric;
+	mIter = 0;
+	VoigtVector n_tr;
+	n_tr = GetNormalToYield(mState.committed.Sigma + mCe*(mState.trial.Epsilon - mState.committed.Epsilon), mState.trial.Alpha);
+	// n_tr = GetNormalToYield(mState.committed.Sigma, mState.trial.Alpha);
+	if ((DoubleDot2_2_Contr(mState.trial.Alpha - mState.trial.Alpha_in_true, n_tr) < 0.0) && me2p) {
+		mState.trial.Alpha_in_p = mState.trial.Alpha_in;
+		mState.trial.Alpha_in_true = mState.trial.Alpha;
+		mState.trial.Fabric_in = mState.trial.Fabric;
 		// This is a loading reversal
 		// update pzp
-		double p = 0.5 * GetTrace(mSigma_n);
+		double p = 0.5 * GetTrace(mState.committed.Sigma);
 		p = (p <= m_Pmin) ? (m_Pmin) : p;
-		double zxpTemp = GetNorm_Contr(mFabric_n) * p;
+		double zxpTemp = GetNorm_Contr(mState.committed.Fabric) * p;
 		if (((zxpTemp > mzxp) && (p > mpzp)) || m_pzpFlag) {
 			mzxp = zxpTemp;
 			mpzp = p;
@@ -1082,37 +1026,37 @@ void PM4Silt::integrate()
 		}
 		// track initial back-stress ratio history 
 		for (int ii = 0; ii < 3; ii++) {
-			if (mAlpha_in(ii) > 0.0)
+			if (mState.trial.Alpha_in(ii) > 0.0)
 				// minimum positive value
-				mAlpha_in_min(ii) = fmin(mAlpha_in_min(ii), mAlpha(ii));
+				mState.trial.Alpha_in_min(ii) = fmin(mState.trial.Alpha_in_min(ii), mState.trial.Alpha(ii));
 			else
 				// maximum negative value
-				mAlpha_in_max(ii) = fmax(mAlpha_in_max(ii), mAlpha(ii));
+				mState.trial.Alpha_in_max(ii) = fmax(mState.trial.Alpha_in_max(ii), mState.trial.Alpha(ii));
 		}
-		if (mAlpha(2) * mAlpha_in_p(2) > 0) {
+		if (mState.trial.Alpha(2) * mState.trial.Alpha_in_p(2) > 0) {
 			for (int ii = 0; ii < 3; ii++) {
 				if (n_tr(ii) > 0.0)
 					// positive loading direction
-					mAlpha_in(ii) = fmax(0.0, mAlpha_in_min(ii));
+					mState.trial.Alpha_in(ii) = fmax(0.0, mState.trial.Alpha_in_min(ii));
 				else
 					// negative loading direction
-					mAlpha_in(ii) = fmin(0.0, mAlpha_in_max(ii));
+					mState.trial.Alpha_in(ii) = fmin(0.0, mState.trial.Alpha_in_max(ii));
 			}
 		}
 		else
-			mAlpha_in = mAlpha;
+			mState.trial.Alpha_in = mState.trial.Alpha;
 	}
 
 	// Force elastic response
 	if (me2p == 0) {
-		elastic_integrator(mSigma_n, mEpsilon_n, mEpsilonE_n, mEpsilon, mEpsilonE, mSigma, mAlpha,
+		elastic_integrator(mState.committed.Sigma, mState.committed.Epsilon, mState.committed.EpsilonE, mState.trial.Epsilon, mState.trial.EpsilonE, mState.trial.Sigma, mState.trial.Alpha,
 			mVoidRatio, mG, mK, mCe, mCep, mCep_Consistent);
 	}
 	// ElastoPlastic response
 	else {
 		// explicit schemes
-		explicit_integrator(mSigma_n, mEpsilon_n, mEpsilonE_n, mAlpha_n, mFabric_n, mAlpha_in,
-			mAlpha_in_p, mEpsilon, mEpsilonE, mSigma, mAlpha, mFabric, mDGamma, mVoidRatio, mG,
+		explicit_integrator(mState.committed.Sigma, mState.committed.Epsilon, mState.committed.EpsilonE, mState.committed.Alpha, mState.committed.Fabric, mState.trial.Alpha_in,
+			mState.trial.Alpha_in_p, mState.trial.Epsilon, mState.trial.EpsilonE, mState.trial.Sigma, mState.trial.Alpha, mState.trial.Fabric, mState.trial.DGamma, mVoidRatio, mG,
 			mK, mCe, mCep, mCep_Consistent);
 	}
 
@@ -1121,11 +1065,11 @@ void PM4Silt::integrate()
 /*************************************************************/
 // Elastic Integrator
 /*************************************************************/
-void PM4Silt::elastic_integrator(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
-	const Vector& NextStrain, Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha,
-	double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent)
+void PM4Silt::elastic_integrator(const VoigtVector& CurStress, const VoigtVector& CurStrain, const VoigtVector& CurElasticStrain,
+	const VoigtVector& NextStrain, VoigtVector& NextElasticStrain, VoigtVector& NextStress, VoigtVector& NextAlpha,
+	double& NextVoidRatio, double& G, double& K, VoigtMatrix& aC, VoigtMatrix& aCep, VoigtMatrix& aCep_Consistent)
 {
-	Vector dStrain(3);
+	VoigtVector dStrain;
 
 	// calculate elastic response
 	dStrain = NextStrain - CurStrain;
@@ -1143,15 +1087,15 @@ void PM4Silt::elastic_integrator(const Vector& CurStress, const Vector& CurStrai
 /*************************************************************/
 // Explicit Integrator
 /*************************************************************/
-void PM4Silt::explicit_integrator(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
-	const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& alpha_in_p, const Vector& NextStrain,
-	Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
-	double& NextL, double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent)
+void PM4Silt::explicit_integrator(const VoigtVector& CurStress, const VoigtVector& CurStrain, const VoigtVector& CurElasticStrain,
+	const VoigtVector& CurAlpha, const VoigtVector& CurFabric, const VoigtVector& alpha_in, const VoigtVector& alpha_in_p, const VoigtVector& NextStrain,
+	VoigtVector& NextElasticStrain, VoigtVector& NextStress, VoigtVector& NextAlpha, VoigtVector& NextFabric,
+	double& NextL, double& NextVoidRatio, double& G, double& K, VoigtMatrix& aC, VoigtMatrix& aCep, VoigtMatrix& aCep_Consistent)
 {
 	// function pointer to the integration scheme
-	void (PM4Silt::*exp_int) (const Vector&, const Vector&, const Vector&, const Vector&, const Vector&, const Vector&,
-		const Vector&, const Vector&, Vector&, Vector&, Vector&, Vector&, double&, double&, double&, double&,
-		Matrix&, Matrix&, Matrix&);
+	void (PM4Silt::*exp_int) (const VoigtVector&, const VoigtVector&, const VoigtVector&, const VoigtVector&, const VoigtVector&, const VoigtVector&,
+		const VoigtVector&, const VoigtVector&, VoigtVector&, VoigtVector&, VoigtVector&, VoigtVector&, double&, double&, double&, double&,
+		VoigtMatrix&, VoigtMatrix&, VoigtMatrix&);
 
 	switch (mScheme) {
 	case INT_ForwardEuler:	// Forward Euler
@@ -1175,7 +1119,7 @@ void PM4Silt::explicit_integrator(const Vector& CurStress, const Vector& CurStra
 	}
 
 	double elasticRatio, f, fn, dVolStrain;
-	Vector dSigma(3), dDevStrain(3), n(3);
+	VoigtVector dSigma, dDevStrain, n;
 
 	NextVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(NextStrain);
 	NextElasticStrain = CurElasticStrain + NextStrain - CurStrain;
@@ -1247,14 +1191,15 @@ void PM4Silt::explicit_integrator(const Vector& CurStress, const Vector& CurStra
 /*************************************************************/
 // Forward-Euler Integrator
 /*************************************************************/
-void PM4Silt::ForwardEuler(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
-	const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& alpha_in_p, const Vector& NextStrain,
-	Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
-	double& NextL, double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent)
+void PM4Silt::ForwardEuler(const VoigtVector& CurStress, const VoigtVector& CurStrain, const VoigtVector& CurElasticStrain,
+	const VoigtVector& CurAlpha, const VoigtVector& CurFabric, const VoigtVector& alpha_in, const VoigtVector& alpha_in_p, const VoigtVector& NextStrain,
+	VoigtVector& NextElasticStrain, VoigtVector& NextStress, VoigtVector& NextAlpha, VoigtVector& NextFabric,
+	double& NextL, double& NextVoidRatio, double& G, double& K, VoigtMatrix& aC, VoigtMatrix& aCep, VoigtMatrix& aCep_Consistent)
 {
 	double CurVoidRatio, Cka, h, p, dVolStrain, D, AlphaAlphaBDotN;
-	Vector n(3), R(3), alphaD(3), dPStrain(3), b(3), dDevStrain(3), r(3);
-	Vector dSigma(3), dAlpha(3), dFabric(3);
+	VoigtVector n, R, alphaD, dPStrain, b, dDevStrain, r;
+	VoigtVector dSigma, dAlpha, dFabric;
+	mIter++;
 
 	CurVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(CurStrain);
 	p = 0.5 * GetTrace(CurStress);
@@ -1262,7 +1207,7 @@ void PM4Silt::ForwardEuler(const Vector& CurStress, const Vector& CurStrain, con
 	NextVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(NextStrain);
 	NextElasticStrain = CurElasticStrain + (NextStrain - CurStrain);
 	// using NextStress instead of CurStress to get correct n
-	GetStateDependent(NextStress, CurAlpha, alpha_in, alpha_in_p, CurFabric, mFabric_in, mG, mzcum
+	GetStateDependent(NextStress, CurAlpha, alpha_in, alpha_in_p, CurFabric, mState.trial.Fabric_in, mG, mzcum
 		, mzpeak, mpzp, mMcur, CurVoidRatio, n, D, R, mKp, alphaD, Cka, h, b, AlphaAlphaBDotN);
 	dVolStrain = GetTrace(NextStrain - CurStrain);
 	dDevStrain = (NextStrain - CurStrain) - dVolStrain / 3.0 * mI1;
@@ -1282,7 +1227,7 @@ void PM4Silt::ForwardEuler(const Vector& CurStress, const Vector& CurStrain, con
 	}
 	else {
 		NextL = (2 * mG * DoubleDot2_2_Mixed(n, dDevStrain) - DoubleDot2_2_Contr(n, r) * mK * dVolStrain) / temp4;
-		mDGamma = NextL;
+		mState.trial.DGamma = NextL;
 		if (NextL < 0) {
 			if (debugFlag) {
 				opserr << "NextL is smaller than 0\n";
@@ -1319,15 +1264,15 @@ void PM4Silt::ForwardEuler(const Vector& CurStress, const Vector& CurStrain, con
 /*************************************************************/
 // Integrator Constraining Maximum Strain Increment
 /*************************************************************/
-void PM4Silt::MaxStrainInc(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
-	const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& alpha_in_p, const Vector& NextStrain,
-	Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
-	double& NextL, double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent)
+void PM4Silt::MaxStrainInc(const VoigtVector& CurStress, const VoigtVector& CurStrain, const VoigtVector& CurElasticStrain,
+	const VoigtVector& CurAlpha, const VoigtVector& CurFabric, const VoigtVector& alpha_in, const VoigtVector& alpha_in_p, const VoigtVector& NextStrain,
+	VoigtVector& NextElasticStrain, VoigtVector& NextStress, VoigtVector& NextAlpha, VoigtVector& NextFabric,
+	double& NextL, double& NextVoidRatio, double& G, double& K, VoigtMatrix& aC, VoigtMatrix& aCep, VoigtMatrix& aCep_Consistent)
 {
 	// function pointer to the integration scheme
-	void (PM4Silt::*exp_int) (const Vector&, const Vector&, const Vector&, const Vector&, const Vector&, const Vector&,
-		const Vector&, const Vector&, Vector&, Vector&, Vector&, Vector&, double&, double&, double&, double&,
-		Matrix&, Matrix&, Matrix&);
+	void (PM4Silt::*exp_int) (const VoigtVector&, const VoigtVector&, const VoigtVector&, const VoigtVector&, const VoigtVector&, const VoigtVector&,
+		const VoigtVector&, const VoigtVector&, VoigtVector&, VoigtVector&, VoigtVector&, VoigtVector&, double&, double&, double&, double&,
+		VoigtMatrix&, VoigtMatrix&, VoigtMatrix&);
 
 	switch (mScheme)
 	{
@@ -1341,7 +1286,7 @@ void PM4Silt::MaxStrainInc(const Vector& CurStress, const Vector& CurStrain, con
 		exp_int = &PM4Silt::ForwardEuler;
 		break;
 	}
-	Vector StrainInc(3); StrainInc = NextStrain - CurStrain;
+	VoigtVector StrainInc; StrainInc = NextStrain - CurStrain;
 	double maxInc = StrainInc(0);
 
 	for (int ii = 1; ii < 3; ii++)
@@ -1352,9 +1297,9 @@ void PM4Silt::MaxStrainInc(const Vector& CurStress, const Vector& CurStrain, con
 		int numSteps = (int)floor(fabs(maxInc) / maxStrainInc) + 1;
 		StrainInc = (NextStrain - CurStrain) / (double)numSteps;
 
-		Vector cStress(3), cStrain(3), cAlpha(3), cFabric(3), cAlpha_in(3), cAlpha_in_p(3), cEStrain(3);
-		Vector nStrain(3);
-		Matrix nCe(3, 3), nCep(3, 3), nCepC(3, 3);
+		VoigtVector cStress, cStrain, cAlpha, cFabric, cAlpha_in, cAlpha_in_p, cEStrain;
+		VoigtVector nStrain;
+		VoigtMatrix nCe, nCep, nCepC;
 		double nL, nVoidRatio, nG, nK;
 
 		// create temporary variables
@@ -1383,15 +1328,15 @@ void PM4Silt::MaxStrainInc(const Vector& CurStress, const Vector& CurStrain, con
 /*************************************************************/
 // Modified-Euler Integrator
 /*************************************************************/
-void PM4Silt::ModifiedEuler(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
-	const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& alpha_in_p, const Vector& NextStrain,
-	Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
-	double& NextL, double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent)
+void PM4Silt::ModifiedEuler(const VoigtVector& CurStress, const VoigtVector& CurStrain, const VoigtVector& CurElasticStrain,
+	const VoigtVector& CurAlpha, const VoigtVector& CurFabric, const VoigtVector& alpha_in, const VoigtVector& alpha_in_p, const VoigtVector& NextStrain,
+	VoigtVector& NextElasticStrain, VoigtVector& NextStress, VoigtVector& NextAlpha, VoigtVector& NextFabric,
+	double& NextL, double& NextVoidRatio, double& G, double& K, VoigtMatrix& aC, VoigtMatrix& aCep, VoigtMatrix& aCep_Consistent)
 {
 	double dVolStrain, p, Cka, temp4, curStepError, q, stressNorm, h, D, AlphaAlphaBDotN;
-	Vector n(3), R1(3), R2(3), alphaD(3), dDevStrain(3), r(3), b(3);
-	Vector nStress(3), nAlpha(3), nFabric(3);
-	Vector dSigma1(3), dSigma2(3), dAlpha1(3), dAlpha2(3), dAlpha(3), dFabric1(3), dFabric2(3), dPStrain1(3), dPStrain2(3);
+	VoigtVector n, R1, R2, alphaD, dDevStrain, r, b;
+	VoigtVector nStress, nAlpha, nFabric;
+	VoigtVector dSigma1, dSigma2, dAlpha1, dAlpha2, dAlpha, dFabric1, dFabric2, dPStrain1, dPStrain2;
 	double T = 0.0, dT = 1.0, dT_min = 1e-4, TolE = 1e-5;
 
 	NextElasticStrain = CurElasticStrain + (NextStrain - CurStrain);
@@ -1410,12 +1355,13 @@ void PM4Silt::ModifiedEuler(const Vector& CurStress, const Vector& CurStrain, co
 	}
 	while (T < 1.0)
 	{
+		mIter++;
 		NextVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(CurStrain + T*(NextStrain - CurStrain));
 		dVolStrain = dT * GetTrace(NextStrain - CurStrain);
 		dDevStrain = dT * (NextStrain - CurStrain) - dVolStrain / 3.0 * mI1;
 		p = 0.5 * GetTrace(NextStress);
 		// Calc Delta 1
-		GetStateDependent(NextStress, NextAlpha, alpha_in, alpha_in_p, NextFabric, mFabric_in, G, mzcum
+		GetStateDependent(NextStress, NextAlpha, alpha_in, alpha_in_p, NextFabric, mState.trial.Fabric_in, G, mzcum
 			, mzpeak, mpzp, mMcur, NextVoidRatio, n, D, R1, mKp, alphaD, Cka, h, b, AlphaAlphaBDotN);
 
 		r = GetDevPart(NextStress) / p;
@@ -1473,7 +1419,7 @@ void PM4Silt::ModifiedEuler(const Vector& CurStress, const Vector& CurStrain, co
 			continue;
 		}
 
-		GetStateDependent(NextStress + dSigma1, NextAlpha + dAlpha1, alpha_in, alpha_in_p, NextFabric + dFabric1, mFabric_in, G, mzcum
+		GetStateDependent(NextStress + dSigma1, NextAlpha + dAlpha1, alpha_in, alpha_in_p, NextFabric + dFabric1, mState.trial.Fabric_in, G, mzcum
 			, mzpeak, mpzp, mMcur, NextVoidRatio, n, D, R2, mKp, alphaD, Cka, h, b, AlphaAlphaBDotN);
 		r = GetDevPart(NextStress + dSigma1) / p;
 
@@ -1487,7 +1433,7 @@ void PM4Silt::ModifiedEuler(const Vector& CurStress, const Vector& CurStrain, co
 		}
 		else {
 			NextL = (2 * G * DoubleDot2_2_Mixed(n, dDevStrain) - DoubleDot2_2_Contr(n, r) * K * dVolStrain) / temp4;
-			mDGamma = NextL;
+			mState.trial.DGamma = NextL;
 			if (NextL < 0)
 			{
 				if (debugFlag) {
@@ -1574,17 +1520,17 @@ void PM4Silt::ModifiedEuler(const Vector& CurStress, const Vector& CurStrain, co
 /*************************************************************/
 // Runge-Kutta Integrator
 /*************************************************************/
-void PM4Silt::RungeKutta4(const Vector& CurStress, const Vector& CurStrain, const Vector& CurElasticStrain,
-	const Vector& CurAlpha, const Vector& CurFabric, const Vector& alpha_in, const Vector& alpha_in_p, const Vector& NextStrain,
-	Vector& NextElasticStrain, Vector& NextStress, Vector& NextAlpha, Vector& NextFabric,
-	double& NextL, double& NextVoidRatio, double& G, double& K, Matrix& aC, Matrix& aCep, Matrix& aCep_Consistent)
+void PM4Silt::RungeKutta4(const VoigtVector& CurStress, const VoigtVector& CurStrain, const VoigtVector& CurElasticStrain,
+	const VoigtVector& CurAlpha, const VoigtVector& CurFabric, const VoigtVector& alpha_in, const VoigtVector& alpha_in_p, const VoigtVector& NextStrain,
+	VoigtVector& NextElasticStrain, VoigtVector& NextStress, VoigtVector& NextAlpha, VoigtVector& NextFabric,
+	double& NextL, double& NextVoidRatio, double& G, double& K, VoigtMatrix& aC, VoigtMatrix& aCep, VoigtMatrix& aCep_Consistent)
 {
 	double dVolStrain, p, Cka, D, K_p, temp4, h, AlphaAlphaBDotN;
-	Vector n(3), R1(3), R2(3), R3(3), R4(3), alphaD(3), dDevStrain(3), r(3), b(3);
-	Vector nStress(3), nAlpha(3), nFabric(3);
-	Vector dSigma1(3), dSigma2(3), dSigma3(3), dSigma4(3), dSigma(3), dAlpha1(3), dAlpha2(3),
-		dAlpha3(3), dAlpha4(3), dAlpha(3), dFabric1(3), dFabric2(3), dFabric3(3), dFabric4(3),
-		dFabric(3), dPStrain1(3), dPStrain2(3), dPStrain3(3), dPStrain4(3), dPStrain(3);
+	VoigtVector n, R1, R2, R3, R4, alphaD, dDevStrain, r, b;
+	VoigtVector nStress, nAlpha, nFabric;
+	VoigtVector dSigma1, dSigma2, dSigma3, dSigma4, dSigma, dAlpha1, dAlpha2,
+		dAlpha3, dAlpha4, dAlpha, dFabric1, dFabric2, dFabric3, dFabric4,
+		dFabric, dPStrain1, dPStrain2, dPStrain3, dPStrain4, dPStrain;
 	double T = 0.0, dT = 0.5, dT_min = 1.0e-4, TolE = 1.0e-5;
 
 	NextElasticStrain = CurElasticStrain + (NextStrain - CurStrain);
@@ -1601,12 +1547,13 @@ void PM4Silt::RungeKutta4(const Vector& CurStress, const Vector& CurStrain, cons
 	}
 	while (T < 1.0)
 	{
+		mIter++;
 		NextVoidRatio = m_e_init - (1 + m_e_init) * GetTrace(CurStrain + T*(NextStrain - CurStrain));
 		dVolStrain = dT * GetTrace(NextStrain - CurStrain);
 		dDevStrain = dT * (NextStrain - CurStrain) - dVolStrain / 3.0 * mI1;
 		p = 0.5 * GetTrace(NextStress);
 		// Calc Delta 1
-		GetStateDependent(NextStress, NextAlpha, alpha_in, alpha_in_p, NextFabric, mFabric_in, mG, mzcum
+		GetStateDependent(NextStress, NextAlpha, alpha_in, alpha_in_p, NextFabric, mState.trial.Fabric_in, mG, mzcum
 			, mzpeak, mpzp, mMcur, NextVoidRatio, n, D, R1, K_p, alphaD, Cka, h, b, AlphaAlphaBDotN);
 
 		r = GetDevPart(NextStress) / p;
@@ -1652,7 +1599,7 @@ void PM4Silt::RungeKutta4(const Vector& CurStress, const Vector& CurStrain, cons
 		//Calc Delta 2
 		p = 0.5 * GetTrace(NextStress + 0.5 * dSigma1);
 
-		GetStateDependent(NextStress + 0.5 * dSigma1, CurAlpha + 0.5 * dAlpha1, alpha_in, alpha_in_p, NextFabric + 0.5 * dFabric1, mFabric_in, mG, mzcum
+		GetStateDependent(NextStress + 0.5 * dSigma1, CurAlpha + 0.5 * dAlpha1, alpha_in, alpha_in_p, NextFabric + 0.5 * dFabric1, mState.trial.Fabric_in, mG, mzcum
 			, mzpeak, mpzp, mMcur, NextVoidRatio, n, D, R2, K_p, alphaD, Cka, h, b, AlphaAlphaBDotN);
 		r = GetDevPart(NextStress + 0.5 * dSigma1) / p;
 
@@ -1693,7 +1640,7 @@ void PM4Silt::RungeKutta4(const Vector& CurStress, const Vector& CurStrain, cons
 		//Calc Delta 3
 		p = 0.5 * GetTrace(NextStress + 0.5 * dSigma2);
 
-		GetStateDependent(NextStress + 0.5 * dSigma2, CurAlpha + 0.5 * dAlpha2, alpha_in, alpha_in_p, NextFabric + 0.5 * dFabric2, mFabric_in, mG, mzcum
+		GetStateDependent(NextStress + 0.5 * dSigma2, CurAlpha + 0.5 * dAlpha2, alpha_in, alpha_in_p, NextFabric + 0.5 * dFabric2, mState.trial.Fabric_in, mG, mzcum
 			, mzpeak, mpzp, mMcur, NextVoidRatio, n, D, R3, K_p, alphaD, Cka, h, b, AlphaAlphaBDotN);
 		r = GetDevPart(NextStress + 0.5 * dSigma2) / p;
 
@@ -1734,7 +1681,7 @@ void PM4Silt::RungeKutta4(const Vector& CurStress, const Vector& CurStrain, cons
 		//Calc Delta 4
 		p = 0.5 * GetTrace(NextStress + dSigma3);
 
-		GetStateDependent(NextStress + dSigma3, CurAlpha + dAlpha3, alpha_in, alpha_in_p, NextFabric + dFabric3, mFabric_in, mG, mzcum
+		GetStateDependent(NextStress + dSigma3, CurAlpha + dAlpha3, alpha_in, alpha_in_p, NextFabric + dFabric3, mState.trial.Fabric_in, mG, mzcum
 			, mzpeak, mpzp, mMcur, NextVoidRatio, n, D, R4, K_p, alphaD, Cka, h, b, AlphaAlphaBDotN);
 		r = GetDevPart(NextStress + dSigma3) / p;
 
@@ -1801,12 +1748,12 @@ void PM4Silt::RungeKutta4(const Vector& CurStress, const Vector& CurStrain, cons
 //            Pegasus Iterations                             //
 /*************************************************************/
 double
-PM4Silt::IntersectionFactor(const Vector& CurStress, const Vector& CurStrain, const Vector& NextStrain, const Vector& CurAlpha,
+PM4Silt::IntersectionFactor(const VoigtVector& CurStress, const VoigtVector& CurStrain, const VoigtVector& NextStrain, const VoigtVector& CurAlpha,
 	double a0 = 0.0, double a1 = 1.0)
 {
 	double a = a0;
 	double f, f0, f1;
-	Vector dSigma(3), dSigma0(3), dSigma1(3), strainInc(3);
+	VoigtVector dSigma, dSigma0, dSigma1, strainInc;
 
 	strainInc = NextStrain - CurStrain;
 
@@ -1861,12 +1808,12 @@ PM4Silt::IntersectionFactor(const Vector& CurStress, const Vector& CurStrain, co
 //      Pegasus Iterations  (ElastoPlastic Unloading)        //
 /*************************************************************/
 double
-PM4Silt::IntersectionFactor_Unloading(const Vector& CurStress, const Vector& CurStrain, const Vector& NextStrain, const Vector& CurAlpha)
+PM4Silt::IntersectionFactor_Unloading(const VoigtVector& CurStress, const VoigtVector& CurStrain, const VoigtVector& NextStrain, const VoigtVector& CurAlpha)
 {
 	double a = 0.0, a0 = 0.0, a1 = 1.0, da;
 	double f, f0, f1, fs;
 	int nSub = 20;
-	Vector dSigma(3), dSigma0(3), dSigma1(3), strainInc(3);
+	VoigtVector dSigma, dSigma0, dSigma1, strainInc;
 	bool flag = false;
 
 	strainInc = NextStrain - CurStrain;
@@ -1917,13 +1864,13 @@ PM4Silt::IntersectionFactor_Unloading(const Vector& CurStress, const Vector& Cur
 //            Stress Correction                              //
 /*************************************************************/
 void
-PM4Silt::Stress_Correction(Vector& NextStress, Vector& NextAlpha, const Vector& alpha_in, const Vector& alpha_in_p,
-	const Vector& CurFabric, double& NextVoidRatio)
+PM4Silt::Stress_Correction(VoigtVector& NextStress, VoigtVector& NextAlpha, const VoigtVector& alpha_in, const VoigtVector& alpha_in_p,
+	const VoigtVector& CurFabric, double& NextVoidRatio)
 {
-	Vector dSigmaP(3), dfrOverdSigma(3), dfrOverdAlpha(3), n(3), R(3), alphaD(3), b(3), aBar(3), r(3);
+	VoigtVector dSigmaP, dfrOverdSigma, dfrOverdAlpha, n, R, alphaD, b, aBar, r;
 	double lambda, D, K_p, Cka, h, p, fr, AlphaAlphaBDotN;
-	Matrix aC(3, 3);
-	// Vector CurStress = NextStress;
+	VoigtMatrix aC;
+	// VoigtVector CurStress = NextStress;
 
 	int maxIter = 25;
 	p = 0.5 * GetTrace(NextStress);
@@ -1949,14 +1896,14 @@ PM4Silt::Stress_Correction(Vector& NextStress, Vector& NextAlpha, const Vector&
 			return;
 		}
 		else {
-			Vector nStress = NextStress;
-			Vector nAlpha = NextAlpha;
+			VoigtVector nStress = NextStress;
+			VoigtVector nAlpha = NextAlpha;
 			for (int i = 1; i <= maxIter; i++) {
 				r = GetDevPart(nStress) / p;
-				GetStateDependent(nStress, nAlpha, alpha_in, alpha_in_p, CurFabric, mFabric_in, mG, mzcum
+				GetStateDependent(nStress, nAlpha, alpha_in, alpha_in_p, CurFabric, mState.trial.Fabric_in, mG, mzcum
 					, mzpeak, mpzp, mMcur, NextVoidRatio, n, D, R, K_p, alphaD, Cka, h, b, AlphaAlphaBDotN);
 				aC = GetStiffness(mK, mG);
-				dSigmaP = DoubleDot4_2(aC, mDGamma * ToCovariant(R));
+				dSigmaP = DoubleDot4_2(aC, mState.trial.DGamma * ToCovariant(R));
 				aBar = two3 * h * b;
 				dfrOverdSigma = n - 0.5 * DoubleDot2_2_Contr(n, r) * mI1;
 				dfrOverdAlpha = -p * n;
@@ -1990,11 +1937,11 @@ PM4Silt::Stress_Correction(Vector& NextStress, Vector& NextAlpha, const Vector&
 				opserr << "NextAlpha = " << NextAlpha;
 			}
 
-			Vector dSigma = NextStress - mSigma;
+			VoigtVector dSigma = NextStress - mState.trial.Sigma;
 			double alpha_up = 1.0;
 			double alpha_mid = 0.5;
 			double alpha_down = 0.0;
-			double fr_old = GetF(mSigma + alpha_mid * dSigma, NextAlpha);
+			double fr_old = GetF(mState.trial.Sigma + alpha_mid * dSigma, NextAlpha);
 			for (int jj = 0; jj < maxIter; jj++) {
 				if (fr_old < 0.0) {
 					alpha_down = alpha_mid;
@@ -2005,22 +1952,22 @@ PM4Silt::Stress_Correction(Vector& NextStress, Vector& NextAlpha, const Vector&
 					alpha_mid = 0.5 * (alpha_down + alpha_mid);
 				}
 
-				fr_old = GetF(mSigma + alpha_mid * dSigma, NextAlpha);
+				fr_old = GetF(mState.trial.Sigma + alpha_mid * dSigma, NextAlpha);
 				if (fabs(fr_old) < mTolF) {
-					NextStress = mSigma + alpha_mid * dSigma;
+					NextStress = mState.trial.Sigma + alpha_mid * dSigma;
 					break;
 				}
 			}
 
 			// // stress state ouside yield surface
 			// double CurDr = (m_emax - NextVoidRatio) / (m_emax - m_emin);
-			// Vector nStress = NextStress;
-			// Vector nAlpha = NextAlpha;
+			// VoigtVector nStress = NextStress;
+			// VoigtVector nAlpha = NextAlpha;
 			// for (int i = 1; i <= maxIter; i++) {
 			// 	// Sloan, Abbo, Sheng 2001, Refined explicit integration of elastoplastic models with automatic 
 			// 	// error control
 			// 	r = GetDevPart(nStress) / p;
-			// 	GetStateDependent(nStress, nAlpha, alpha_in, alpha_in_p, CurFabric, mFabric_in, mG, mzcum
+			// 	GetStateDependent(nStress, nAlpha, alpha_in, alpha_in_p, CurFabric, mState.trial.Fabric_in, mG, mzcum
 			// 		, mzpeak, mpzp, mMcur, CurDr, n, D, R, K_p, alphaD, Cka, h, b);
 			// 	dSigmaP = DoubleDot4_2(mCe, ToCovariant(R));
 			// 	aBar = h * b;
@@ -2055,7 +2002,7 @@ PM4Silt::Stress_Correction(Vector& NextStress, Vector& NextAlpha, const Vector&
 			// 	if (i == maxIter) {
 			// 		if (debugFlag)
 			// 			opserr << "Still outside with f =  " << fr << endln;
-			// 		Vector dSigma = NextStress - CurStress;
+			// 		VoigtVector dSigma = NextStress - CurStress;
 			// 		double alpha_up = 1.0;
 			// 		double alpha_mid = 0.5;
 			// 		double alpha_down = 0.0;
@@ -2088,10 +2035,10 @@ PM4Silt::Stress_Correction(Vector& NextStress, Vector& NextAlpha, const Vector&
 /************************************************************/
 /************************************************************/
 void
-PM4Silt::Stress_Correction(Vector& NextStress, Vector& NextAlpha, const Vector& dAlpha,
-	const double m, const Vector& R, const Vector& n, const Vector& r)
+PM4Silt::Stress_Correction(VoigtVector& NextStress, VoigtVector& NextAlpha, const VoigtVector& dAlpha,
+	const double m, const VoigtVector& R, const VoigtVector& n, const VoigtVector& r)
 {
-	Vector dfrOverdSigma(3);
+	VoigtVector dfrOverdSigma;
 	double lambda;
 	int maxIter = 50;
 	double f = GetF(NextStress, NextAlpha);
@@ -2100,7 +2047,7 @@ PM4Silt::Stress_Correction(Vector& NextStress, Vector& NextAlpha, const Vector&
 	else {
 		// Method C from Potts and Gens 1983. 
 		for (int i = 1; i <= maxIter; i++) {
-			// GetStateDependent(CurStress, CurAlpha, alpha_in, CurFabric, mFabric_in, mG, mzcum
+			// GetStateDependent(CurStress, CurAlpha, alpha_in, CurFabric, mState.trial.Fabric_in, mG, mzcum
 			// 	, mzpeak, mpzp, mMcur, ksi, CurDr, n, D, R, K_p, alphaD, Cka, h, b);
 			dfrOverdSigma = n - 0.5 * DoubleDot2_2_Contr(n, r)*mI1;
 			lambda = f / DoubleDot2_2_Contr(dfrOverdSigma, R);
@@ -2137,10 +2084,10 @@ double PM4Silt::MacauleyIndex(double x)
 /*************************************************************/
 // GetF() -----------------------------------------------------
 double
-PM4Silt::GetF(const Vector& nStress, const Vector& nAlpha)
+PM4Silt::GetF(const VoigtVector& nStress, const VoigtVector& nAlpha)
 {
 	// PM4Silt's yield function
-	Vector s(3); s = GetDevPart(nStress);
+	VoigtVector s; s = GetDevPart(nStress);
 	double p = 0.5 * GetTrace(nStress);
 	s = s - p * nAlpha;
 	double f = GetNorm_Contr(s) - root12 * m_m * p;
@@ -2159,7 +2106,7 @@ PM4Silt::GetKsi(const double& e, const double& p)
 /*************************************************************/
 // GetElasticModuli() ---------------------------------------------
 void
-PM4Silt::GetElasticModuli(const Vector& sigma, double &K, double &G, double &Mcur, const double& zcum)
+PM4Silt::GetElasticModuli(const VoigtVector& sigma, double &K, double &G, double &Mcur, const double& zcum)
 // Calculates G, K, including effects of fabric and current stress ratio
 {
 	int msr = 4;
@@ -2187,7 +2134,7 @@ PM4Silt::GetElasticModuli(const Vector& sigma, double &K, double &G, double &Mcu
 	K = two3 * (1 + m_nu) / (1 - 2 * m_nu) * G;
 }
 void
-PM4Silt::GetElasticModuli(const Vector& sigma, double &K, double &G)
+PM4Silt::GetElasticModuli(const VoigtVector& sigma, double &K, double &G)
 // Calculates G, K
 {
 	double pn = 0.5 * GetTrace(sigma);
@@ -2202,11 +2149,11 @@ PM4Silt::GetElasticModuli(const Vector& sigma, double &K, double &G)
 }
 /*************************************************************/
 // GetStiffness() ---------------------------------------------
-Matrix
+VoigtMatrix
 PM4Silt::GetStiffness(const double& K, const double& G)
 // returns the stiffness matrix in its contravarinat-contravariant form
 {
-	Matrix C(3, 3);
+	VoigtMatrix C;
 	double a = K + 4.0*one3 * G;
 	double b = K - 2.0*one3 * G;
 	C(0, 0) = C(1, 1) = a;
@@ -2216,11 +2163,11 @@ PM4Silt::GetStiffness(const double& K, const double& G)
 }
 /*************************************************************/
 // GetCompliance() ---------------------------------------------
-Matrix
+VoigtMatrix
 PM4Silt::GetCompliance(const double& K, const double& G)
 // returns the compliance matrix in its covariant-covariant form
 {
-	Matrix D(3, 3);
+	VoigtMatrix D;
 	double a = (K + 4.0 / 3.0 * G) / (4.0 * G * K + 4.0 / 3.0 * pow(G, 2));
 	double b = (K - 2.0 / 3.0 * G) / (4.0 * G * K + 4.0 / 3.0 * pow(G, 2));
 	double c = 1 / G;
@@ -2231,17 +2178,17 @@ PM4Silt::GetCompliance(const double& K, const double& G)
 }
 /*************************************************************/
 // GetElastoPlasticTangent()---------------------------------------
-Matrix
-PM4Silt::GetElastoPlasticTangent(const Vector& NextStress, const Matrix& aCe, const Vector& R,
-	const Vector& n, const double K_p)
+VoigtMatrix
+PM4Silt::GetElastoPlasticTangent(const VoigtVector& NextStress, const VoigtMatrix& aCe, const VoigtVector& R,
+	const VoigtVector& n, const double K_p)
 {
 	double p = 0.5 * GetTrace(NextStress);
 	if (p < m_Pmin) p = m_Pmin;
-	Vector r = GetDevPart(NextStress) / p;
-	Matrix aCep(3, 3);
+	VoigtVector r = GetDevPart(NextStress) / p;
+	VoigtMatrix aCep;
 	aCep.Zero();
-	Vector temp1 = DoubleDot4_2(aCe, R);
-	Vector temp2 = DoubleDot2_4(n - 1 / 2 * DoubleDot2_2_Contr(n, r)*mI1, aCe*mIIco);
+	VoigtVector temp1 = DoubleDot4_2(aCe, R);
+	VoigtVector temp2 = DoubleDot2_4(n - 1 / 2 * DoubleDot2_2_Contr(n, r)*mI1, aCe*mIIco);
 	double temp3 = DoubleDot2_2_Contr(temp2, R) + K_p;
 	if (temp3 < small) {
 		aCep = aCe;
@@ -2254,12 +2201,12 @@ PM4Silt::GetElastoPlasticTangent(const Vector& NextStress, const Matrix& aCe, co
 }
 /*************************************************************/
 // GetNormalToYield() ----------------------------------------
-Vector
-PM4Silt::GetNormalToYield(const Vector &stress, const Vector &alpha)
+VoigtVector
+PM4Silt::GetNormalToYield(const VoigtVector &stress, const VoigtVector &alpha)
 {
-	Vector devStress(3); devStress = GetDevPart(stress);
+	VoigtVector devStress; devStress = GetDevPart(stress);
 	double p = 0.5 * GetTrace(stress);
-	Vector n(3);
+	VoigtVector n;
 	if (fabs(p) < small) {
 		n.Zero();
 	}
@@ -2274,7 +2221,7 @@ PM4Silt::GetNormalToYield(const Vector &stress, const Vector &alpha)
 /*************************************************************/
 // Check() ---------------------------------------------------
 int
-PM4Silt::Check(const Vector& TrialStress, const Vector& stress, const Vector& CurAlpha, const Vector& NextAlpha)
+PM4Silt::Check(const VoigtVector& TrialStress, const VoigtVector& stress, const VoigtVector& CurAlpha, const VoigtVector& NextAlpha)
 // Check if the solution of implicit integration makes sense
 {
 	return 0;
@@ -2282,10 +2229,10 @@ PM4Silt::Check(const Vector& TrialStress, const Vector& stress, const Vector& Cu
 /*************************************************************/
 // GetStateDependent() ----------------------------------------
 void
-PM4Silt::GetStateDependent(const Vector &stress, const Vector &alpha, const Vector &alpha_in, const Vector &alpha_in_p
-	, const Vector &fabric, const Vector &fabric_in, const double &G, const double &zcum, const double &zpeak
-	, const double &pzp, const double &Mcur, const double &CurVoidRatio, Vector &n, double &D, Vector &R, double &K_p
-	, Vector &alphaD, double &Cka, double &h, Vector &b, double &AlphaAlphaBDotN)
+PM4Silt::GetStateDependent(const VoigtVector &stress, const VoigtVector &alpha, const VoigtVector &alpha_in, const VoigtVector &alpha_in_p
+	, const VoigtVector &fabric, const VoigtVector &fabric_in, const double &G, const double &zcum, const double &zpeak
+	, const double &pzp, const double &Mcur, const double &CurVoidRatio, VoigtVector &n, double &D, VoigtVector &R, double &K_p
+	, VoigtVector &alphaD, double &Cka, double &h, VoigtVector &b, double &AlphaAlphaBDotN)
 {
 	double p = 0.5 * GetTrace(stress);
 	if (p <= m_Pmin) p = m_Pmin;
@@ -2301,7 +2248,7 @@ PM4Silt::GetStateDependent(const Vector &stress, const Vector &alpha, const Vect
 		//loose of critical
 		mMb = m_Mc * exp(-1.0 * m_nbwet * ksi / m_lambda);
 	}
-	Vector alphaB = root12 * (mMb - m_m) * n;
+	VoigtVector alphaB = root12 * (mMb - m_m) * n;
 	alphaD = root12 * (mMd - m_m) * n;
 	double Czpk1 = zpeak / (zcum + m_z_max / 5.0);
 	double Czpk2 = zpeak / (zcum + m_z_max / 100.0);
@@ -2311,10 +2258,10 @@ PM4Silt::GetStateDependent(const Vector &stress, const Vector &alpha, const Vect
 
 	b = alphaB - alpha;
 	AlphaAlphaBDotN = DoubleDot2_2_Contr(b, n);
-	double AlphaAlphaInDotN = Macauley(DoubleDot2_2_Contr(alpha - mAlpha_in, n));
-	double AlphaAlphaInTrueDotN = Macauley(DoubleDot2_2_Contr(alpha - mAlpha_in_true, n));
+	double AlphaAlphaInDotN = Macauley(DoubleDot2_2_Contr(alpha - mState.trial.Alpha_in, n));
+	double AlphaAlphaInTrueDotN = Macauley(DoubleDot2_2_Contr(alpha - mState.trial.Alpha_in_true, n));
 	Cka = 1.0 + m_Ckaf / (1.0 + pow(2.5*AlphaAlphaInTrueDotN, 2)) * Cpzp2 * Czpk1;
-	// updataed K_p formulation following PM4Silt V1. mAlpha_in is the apparent back-stress ratio.
+	// updataed K_p formulation following PM4Silt V1. mState.trial.Alpha_in is the apparent back-stress ratio.
 	if (DoubleDot2_2_Contr(alpha - alpha_in_p, n) <= 0) {
 		h = 1.5 * G * m_h0 / p / (exp(AlphaAlphaInDotN) - 1 + Cg1) / sqrt(fabs(AlphaAlphaBDotN)) *
 			Cka / (1 + Ckp * zpeak / m_z_max * Macauley(AlphaAlphaBDotN) * sqrt(1 - Czpk2));
@@ -2331,7 +2278,7 @@ PM4Silt::GetStateDependent(const Vector &stress, const Vector &alpha, const Vect
 	double temp = Macauley(DoubleDot2_2_Contr(-1.0 * fabric, n)) * root12;
 	double Crot1 = fmax((1.0 + 2 * temp / m_z_max * (1 - Czin1)), 1.0);
 	double Mdr = mMd / Crot1;
-	Vector alphaDr = root12 * (Mdr - m_m) * n;
+	VoigtVector alphaDr = root12 * (Mdr - m_m) * n;
 	// dilation
 	if (DoubleDot2_2_Contr(alphaDr - alpha, n) <= 0) {
 		double Cpzp = 1.0 / (1.0 + pow((2.5* p / mpzp), 5.0));
@@ -2357,7 +2304,7 @@ PM4Silt::GetStateDependent(const Vector &stress, const Vector &alpha, const Vect
 		double Cwet = fmin(1.0, (1.0 / (1 + pow(0.02 / AlphaAlphaBDotN, 4.0)) + 1.0 / (1 + pow(ksi / m_lambda / 0.1, 2.0))));
 		double Adc = m_Ado * (1 + Macauley(DoubleDot2_2_Contr(fabric, n))) / (hp * Cdz * Cwet);
 		double Cin = 2.0 * Macauley(DoubleDot2_2_Contr(fabric, n)) * root12 / m_z_max;
-		D = fmin(Adc * pow((DoubleDot2_2_Contr(alpha - mAlpha_in, n) + Cin), 2.0), m_Ado) *
+		D = fmin(Adc * pow((DoubleDot2_2_Contr(alpha - mState.trial.Alpha_in, n) + Cin), 2.0), m_Ado) *
 			DoubleDot2_2_Contr(alphaD - alpha, n) / (DoubleDot2_2_Contr(alphaD - alpha, n) + 0.10);
 		// Apply a factor to D so it doesn't go very big when p is small
 		double C_pmin;
@@ -2389,24 +2336,20 @@ PM4Silt::GetStateDependent(const Vector &stress, const Vector &alpha, const Vect
 
 //  GetTrace() ---------------------------------------------
 double
-PM4Silt::GetTrace(const Vector& v)
+PM4Silt::GetTrace(const VoigtVector& v)
 // computes the trace of the input argument
 {
-	if (v.Size() != 3)
-		opserr << "\n ERROR! PM4Silt::GetTrace requires vector of size(3)!" << endln;
 
 	return (v(0) + v(1));
 }
 /*************************************************************/
 //  GetDevPart() ---------------------------------------------
-Vector
-PM4Silt::GetDevPart(const Vector& aV)
+VoigtVector
+PM4Silt::GetDevPart(const VoigtVector& aV)
 // computes the deviatoric part of the input tensor
 {
-	if (aV.Size() != 3)
-		opserr << "\n ERROR! PM4Silt::GetDevPart requires vector of size(3)!" << endln;
 
-	Vector result(3);
+	VoigtVector result;
 	double p = GetTrace(aV);
 	result = aV;
 	result(0) -= 0.5 * p;
@@ -2417,11 +2360,9 @@ PM4Silt::GetDevPart(const Vector& aV)
 /*************************************************************/
 // DoubleDot2_2_Contr() ---------------------------------------
 double
-PM4Silt::DoubleDot2_2_Contr(const Vector& v1, const Vector& v2)
+PM4Silt::DoubleDot2_2_Contr(const VoigtVector& v1, const VoigtVector& v2)
 // computes doubledot product for vector-vector arguments, both "contravariant"
 {
-	if ((v1.Size() != 3) || (v2.Size() != 3))
-		opserr << "\n ERROR! PM4Silt::DoubleDot2_2_Contr requires vector of size(3)!" << endln;
 
 	double result = 0.0;
 	for (int i = 0; i < v1.Size(); i++) {
@@ -2433,11 +2374,9 @@ PM4Silt::DoubleDot2_2_Contr(const Vector& v1, const Vector& v2)
 /*************************************************************/
 // DoubleDot2_2_Cov() ---------------------------------------
 double
-PM4Silt::DoubleDot2_2_Cov(const Vector& v1, const Vector& v2)
+PM4Silt::DoubleDot2_2_Cov(const VoigtVector& v1, const VoigtVector& v2)
 // computes doubledot product for vector-vector arguments, both "covariant"
 {
-	if ((v1.Size() != 3) || (v2.Size() != 3))
-		opserr << "\n ERROR! PM4Silt::DoubleDot2_2_Cov requires vector of size(3)!" << endln;
 
 	double result = 0.0;
 	for (int i = 0; i < v1.Size(); i++) {
@@ -2449,11 +2388,9 @@ PM4Silt::DoubleDot2_2_Cov(const Vector& v1, const Vector& v2)
 /*************************************************************/
 // DoubleDot2_2_Mixed() ---------------------------------------
 double
-PM4Silt::DoubleDot2_2_Mixed(const Vector& v1, const Vector& v2)
+PM4Silt::DoubleDot2_2_Mixed(const VoigtVector& v1, const VoigtVector& v2)
 // computes doubledot product for vector-vector arguments, one "covariant" and the other "contravariant"
 {
-	if ((v1.Size() != 3) || (v2.Size() != 3))
-		opserr << "\n ERROR! PM4Silt::DoubleDot2_2_Mixed requires vector of size(3)!" << endln;
 
 	double result = 0.0;
 	for (int i = 0; i < v1.Size(); i++) {
@@ -2465,11 +2402,9 @@ PM4Silt::DoubleDot2_2_Mixed(const Vector& v1, const Vector& v2)
 /*************************************************************/
 // GetNorm_Contr() ---------------------------------------------
 double
-PM4Silt::GetNorm_Contr(const Vector& v)
+PM4Silt::GetNorm_Contr(const VoigtVector& v)
 // computes contravariant (stress-like) norm of input 6x1 tensor
 {
-	if (v.Size() != 3)
-		opserr << "\n ERROR! PM4Silt::GetNorm_Contr requires vector of size(3)!" << endln;
 
 	double result = 0.0;
 	result = sqrt(DoubleDot2_2_Contr(v, v));
@@ -2479,11 +2414,9 @@ PM4Silt::GetNorm_Contr(const Vector& v)
 /*************************************************************/
 // GetNorm_Cov() ---------------------------------------------
 double
-PM4Silt::GetNorm_Cov(const Vector& v)
+PM4Silt::GetNorm_Cov(const VoigtVector& v)
 // computes covariant (strain-like) norm of input 6x1 tensor
 {
-	if (v.Size() != 3)
-		opserr << "\n ERROR! PM4Silt::GetNorm_Cov requires vector of size(3)!" << endln;
 
 	double result = 0.0;
 	result = sqrt(DoubleDot2_2_Cov(v, v));
@@ -2492,15 +2425,13 @@ PM4Silt::GetNorm_Cov(const Vector& v)
 }
 /*************************************************************/
 // Dyadic2_2() ---------------------------------------------
-Matrix
-PM4Silt::Dyadic2_2(const Vector& v1, const Vector& v2)
+VoigtMatrix
+PM4Silt::Dyadic2_2(const VoigtVector& v1, const VoigtVector& v2)
 // computes dyadic product for two vector-storage arguments
 // the coordinate form of the result depends on the coordinate form of inputs
 {
-	if ((v1.Size() != 3) || (v2.Size() != 3))
-		opserr << "\n ERROR! PM4Silt::Dyadic2_2 requires vector of size(3)!" << endln;
 
-	Matrix result(3, 3);
+	VoigtMatrix result;
 
 	for (int i = 0; i < v1.Size(); i++) {
 		for (int j = 0; j < v2.Size(); j++)
@@ -2511,66 +2442,52 @@ PM4Silt::Dyadic2_2(const Vector& v1, const Vector& v2)
 }
 /*************************************************************/
 // DoubleDot4_2() ---------------------------------------------
-Vector
-PM4Silt::DoubleDot4_2(const Matrix& m1, const Vector& v1)
+VoigtVector
+PM4Silt::DoubleDot4_2(const VoigtMatrix& m1, const VoigtVector& v1)
 // computes doubledot product for matrix-vector arguments
 // caution: second coordinate of the matrix should be in opposite variant form of vector
 {
-	if (v1.Size() != 3)
-		opserr << "\n ERROR! PM4Silt::DoubleDot4_2 requires vector of size(3)!" << endln;
-	if ((m1.noCols() != 3) || (m1.noRows() != 3))
-		opserr << "\n ERROR! PM4Silt::DoubleDot4_2 requires 3-by-3 matrix " << endln;
 
 	return m1*v1;
 }
 /*************************************************************/
 // DoubleDot2_4() ---------------------------------------------
-Vector
-PM4Silt::DoubleDot2_4(const Vector& v1, const Matrix& m1)
+VoigtVector
+PM4Silt::DoubleDot2_4(const VoigtVector& v1, const VoigtMatrix& m1)
 // computes doubledot product for matrix-vector arguments
 // caution: first coordinate of the matrix should be in opposite 
 // variant form of vector
 {
-	if (v1.Size() != 3)
-		opserr << "\n ERROR! PM4Silt::DoubleDot2_4 requires vector of size(3)!" << endln;
-	if ((m1.noCols() != 3) || (m1.noRows() != 3))
-		opserr << "\n ERROR! PM4Silt::DoubleDot2_4 requires 3-by-3 matrix " << endln;
 
 	return  m1^v1;
 }
 /*************************************************************/
 // DoubleDot4_4() ---------------------------------------------
-Matrix
-PM4Silt::DoubleDot4_4(const Matrix& m1, const Matrix& m2)
+VoigtMatrix
+PM4Silt::DoubleDot4_4(const VoigtMatrix& m1, const VoigtMatrix& m2)
 // computes doubledot product for matrix-matrix arguments
 // caution: second coordinate of the first matrix should be in opposite 
 // variant form of the first coordinate of second matrix
 {
-	if ((m1.noCols() != 3) || (m1.noRows() != 3) || (m2.noCols() != 3) || (m2.noRows() != 3))
-		opserr << "\n ERROR! PM4Silt::DoubleDot4_4 requires 3-by-3 matrices " << endln;
 
 	return m1*m2;
 }
 /*************************************************************/
 // ToContraviant() ---------------------------------------------
-Vector PM4Silt::ToContraviant(const Vector& v1)
+VoigtVector PM4Silt::ToContraviant(const VoigtVector& v1)
 {
-	if (v1.Size() != 3)
-		opserr << "\n ERROR! PM4Silt::ToContraviant requires vector of size(3)!" << endln;
 	// aV(i) -> T(i,j) 1 = 11, 2=22, 3=12
-	Vector res = v1;
+	VoigtVector res = v1;
 	res(2) *= 0.5;
 
 	return res;
 }
 /*************************************************************/
 // ToCovariant() ---------------------------------------------
-Vector PM4Silt::ToCovariant(const Vector& v1)
+VoigtVector PM4Silt::ToCovariant(const VoigtVector& v1)
 {
-	if (v1.Size() != 3)
-		opserr << "\n ERROR! PM4Silt::ToCovariant requires vector of size(3)!" << endln;
 	// aV(i) -> T(i,j) 1 = 11, 2=22, 3=12
-	Vector res = v1;
+	VoigtVector res = v1;
 	res(2) *= 2.0;
 
 	return res;
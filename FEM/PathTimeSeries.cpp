@@ -49,7 +49,7 @@ using std::ios;
 PathTimeSeries::PathTimeSeries()	
   :TimeSeries(TSERIES_TAG_PathTimeSeries),
    thePath(0), time(0), currentTimeLoc(0), cFactor(0.0),
-   dbTag1(0), dbTag2(0), lastSendCommitTag(-1)
+   dbTag1(0), dbTag2(0), lastSendCommitTag(-1), timeIncr(0.0)
 {
   // does nothing
 }
@@ -62,7 +62,7 @@ PathTimeSeries::PathTimeSeries(int tag,
   :TimeSeries(tag, TSERIES_TAG_PathTimeSeries),
    thePath(0), time(0), currentTimeLoc(0), cFactor(theFactor),
    dbTag1(0), dbTag2(0), lastSendCommitTag(-1), lastChannel(0),
-   useLast(last)
+   useLast(last), timeIncr(0.0)
 {
   // check vectors are of same size
   if (theLoadPath.Size() != theTimePath.Size()) {
@@ -87,6 +87,8 @@ PathTimeSeries::PathTimeSeries(int tag,
       time = 0;
     }
   }
+
+  this->setTimeIncr();
 }
 
 PathTimeSeries::PathTimeSeries(int tag,
@@ -97,7 +99,7 @@ PathTimeSeries::PathTimeSeries(int tag,
   :TimeSeries(tag, TSERIES_TAG_PathTimeSeries),
    thePath(0), time(0), currentTimeLoc(0), cFactor(theFactor),
    dbTag1(0), dbTag2(0), lastSendCommitTag(-1), lastChannel(0),
-   useLast(last)
+   useLast(last), timeIncr(0.0)
 {
   // determine the number of data points
   int numDataPoints1 =0;
@@ -196,6 +198,8 @@ PathTimeSeries::PathTimeSeries(int tag,
       }   // read in the path data and then do the time
     }
   }
+
+  this->setTimeIncr();
 }
 
 PathTimeSeries::PathTimeSeries(int tag,
@@ -204,7 +208,7 @@ PathTimeSeries::PathTimeSeries(int tag,
 			       bool last)
   :TimeSeries(tag, TSERIES_TAG_PathTimeSeries),
    thePath(0), time(0), currentTimeLoc(0), cFactor(theFactor),
-   dbTag1(0), dbTag2(0), lastChannel(0), useLast(last)
+   dbTag1(0), dbTag2(0), lastChannel(0), useLast(last), timeIncr(0.0)
 {
   // determine the number of data points
   int numDataPoints = 0;
@@ -278,6 +282,8 @@ PathTimeSeries::PathTimeSeries(int tag,
       theFile1.close();
     } 
   }
+
+  this->setTimeIncr();
 }
 
 PathTimeSeries::~PathTimeSeries()
@@ -304,18 +310,43 @@ PathTimeSeries::getTimeIncr (double pseudoTime)
 double
 PathTimeSeries::getFactor(double pseudoTime)
 {
+  double dTime, dTimeInterval;
+  int loc = this->getInterval(pseudoTime, dTime, dTimeInterval);
+  if (loc < 0)
+    return 0.0;
+
+  return this->getFactor(loc, dTime, dTimeInterval);
+}
+
+double
+PathTimeSeries::getFactor(int loc, double dTime, double dTimeInterval)
+{
+  double value1 = (*thePath)[loc];
+  if (loc == thePath->Size()-1)
+    return cFactor*value1;
+
+  double value2 = (*thePath)[loc+1];
+  return cFactor*(value1 + (value2-value1)*dTime/dTimeInterval);
+}
+
+int
+PathTimeSeries::getInterval(double pseudoTime, double &dTime, double &dTimeInterval)
+{
+  dTime = 0.0;
+  dTimeInterval = 1.0;
+
   // check for a quick return
   if (thePath == 0)
-    return 0.0;
+    return -1;
 
   // determine indexes into the data array whose boundary holds the time
   double time1 = (*time)(currentTimeLoc);
 
   // check for another quick return
   if (pseudoTime < time1 && currentTimeLoc == 0)
-    return 0.0;
+    return -1;
   if (pseudoTime == time1)
-    return cFactor * (*thePath)[currentTimeLoc];
+    return currentTimeLoc;
 
   int size = time->Size();
   int sizem1 = size - 1;
@@ -324,13 +355,55 @@ PathTimeSeries::getFactor(double pseudoTime)
   // check we are not at the end
   if (pseudoTime > time1 && currentTimeLoc == sizem1) {
     if (useLast == false)
-      return 0.0;
+      return -1;
     else
-      return cFactor*(*thePath)[sizem1];
+      return sizem1;
+  }
+
+  double time2;
+  if (timeIncr > 0.0) {
+
+    // equally spaced points: start from the computed interval and step to
+    // the one the search below would find, the intervals are open on the
+    // side the time comes from
+    int loc = (int)((pseudoTime - (*time)(0))/timeIncr);
+    if (loc < 0)
+      loc = 0;
+    else if (loc > sizem2)
+      loc = sizem2;
+
+    if (pseudoTime > time1) {
+      while (loc > 0 && pseudoTime <= (*time)(loc))
+	loc--;
+      while (loc < sizem2 && pseudoTime > (*time)(loc+1))
+	loc++;
+    } else {
+      while (loc < sizem2 && pseudoTime >= (*time)(loc+1))
+	loc++;
+      while (loc > 0 && pseudoTime < (*time)(loc))
+	loc--;
+    }
+
+    currentTimeLoc = loc;
+    time1 = (*time)(loc);
+    time2 = (*time)(loc+1);
+
+    if (pseudoTime > time2) {
+      if (useLast == false)
+        return -1;
+      else
+        return sizem1;
+    }
+    if (pseudoTime < time1)
+      return -1;
+
+    dTime = pseudoTime-time1;
+    dTimeInterval = time2-time1;
+    return currentTimeLoc;
   }
 
   // otherwise go find the current interval
-  double time2 = (*time)(currentTimeLoc+1);
+  time2 = (*time)(currentTimeLoc+1);
   if (pseudoTime > time2) {
     while ((pseudoTime > time2) && (currentTimeLoc < sizem2)) {
       currentTimeLoc++;
@@ -340,9 +413,9 @@ PathTimeSeries::getFactor(double pseudoTime)
     // if pseudo time greater than ending time return 0
     if (pseudoTime > time2) {
       if (useLast == false)
-        return 0.0;
+        return -1;
       else
-        return cFactor*(*thePath)[sizem1];
+        return sizem1;
     }
 
   } else if (pseudoTime < time1) {
@@ -353,12 +426,49 @@ PathTimeSeries::getFactor(double pseudoTime)
     }
     // if starting time less than initial starting time return 0
     if (pseudoTime < time1)
-      return 0.0;
+      return -1;
+  }
+
+  dTime = pseudoTime-time1;
+  dTimeInterval = time2-time1;
+  return currentTimeLoc;
+}
+
+bool
+PathTimeSeries::hasSameTime(const PathTimeSeries &other) const
+{
+  if (time == 0 || other.time == 0 || time->Size() != other.time->Size() ||
+      useLast != other.useLast)
+    return false;
+
+  int size = time->Size();
+  for (int i=0; i<size; i++)
+    if ((*time)(i) != (*other.time)(i))
+      return false;
+
+  return true;
+}
+
+void
+PathTimeSeries::setTimeIncr(void)
+{
+  // the time increment if the points are equally spaced, 0 otherwise
+  timeIncr = 0.0;
+  if (time == 0 || time->Size() < 3)
+    return;
+
+  int size = time->Size();
+  double incr = ((*time)(size-1) - (*time)(0))/(size-1);
+  if (incr <= 0.0)
+    return;
+
+  for (int i=1; i<size; i++) {
+    double dt = (*time)(i) - (*time)(i-1);
+    if (dt <= 0.0 || fabs(dt - incr) > 1.0e-3*incr)
+      return;
   }
 
-  double value1 = (*thePath)[currentTimeLoc];
-  double value2 = (*thePath)[currentTimeLoc+1];
-  return cFactor*(value1 + (value2-value1)*(pseudoTime-time1)/(time2 - time1));
+  timeIncr = incr;
 }
 
 double
@@ -513,6 +623,7 @@ PathTimeSeries::recvSelf(int commitTag, Channel &theChannel,
       opserr << "channel failed to receive tha time Vector\n";
       return result;  
     }
+    this->setTimeIncr();
   }
   return 0;    
 }
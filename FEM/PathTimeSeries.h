@@ -76,6 +76,15 @@ class PathTimeSeries : public TimeSeries
     double getPeakFactor ();
     double getTimeIncr (double pseudoTime);
 
+    // the interval of the path points holding pseudoTime, for series with
+    // the same time points and useLast (see hasSameTime) the factors can be found
+    // from one search: getFactor(loc, dTime, dTimeInterval) is the factor
+    // at dTime into the interval loc of length dTimeInterval. Returns -1
+    // if the factor is 0.
+    int getInterval(double pseudoTime, double &dTime, double &dTimeInterval);
+    double getFactor(int loc, double dTime, double dTimeInterval);
+    bool hasSameTime(const PathTimeSeries &other) const;
+
     // methods for output
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, 
@@ -86,6 +95,8 @@ class PathTimeSeries : public TimeSeries
   protected:
     
   private:
+    void setTimeIncr(void);
+
     Vector *thePath;      // vector containg the data points
     Vector *time;		  // vector containg the time values of data points
     int currentTimeLoc;   // current location in time
@@ -94,6 +105,7 @@ class PathTimeSeries : public TimeSeries
     int lastSendCommitTag;
     Channel *lastChannel;
     bool useLast;
+    double timeIncr;      // time increment of equally spaced points, 0 if not
 };
 
 #endif
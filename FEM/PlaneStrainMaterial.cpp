@@ -70,8 +70,8 @@ void* OPS_PlaneStrain()
 }
 
 //static vector and matrices
-Vector  PlaneStrainMaterial::stress(3) ;
-Matrix  PlaneStrainMaterial::tangent(3,3) ;
+thread_local Vector  PlaneStrainMaterial::stress(3) ;
+thread_local Matrix  PlaneStrainMaterial::tangent(3,3) ;
 
 //null constructor
 PlaneStrainMaterial::PlaneStrainMaterial( ) : 
@@ -182,7 +182,7 @@ PlaneStrainMaterial::setTrialStrain( const Vector &strainFromElement )
   this->strain(1) = strainFromElement(1) ;
   this->strain(2) = strainFromElement(2) ;
 
-  static Vector threeDstrain(6) ;
+  static thread_local Vector threeDstrain(6) ;
 
     //set three dimensional strain
     threeDstrain(0) = this->strain(0) ;
@@ -228,9 +228,9 @@ PlaneStrainMaterial::getStress( )
 const Matrix&  
 PlaneStrainMaterial::getTangent( )
 {
-  static Matrix dd11(3,3) ;
+  static thread_local Matrix dd11(3,3) ;
 
-  static Matrix threeDtangentCopy(6,6);
+  static thread_local Matrix threeDtangentCopy(6,6);
 
   //three dimensional tangent 
   const Matrix &threeDtangent = theMaterial->getTangent( ) ;
@@ -254,9 +254,9 @@ const Matrix&
 PlaneStrainMaterial::getInitialTangent
 ( )
 {
-  static Matrix dd11(3,3) ;
+  static thread_local Matrix dd11(3,3) ;
 
-  static Matrix threeDtangentCopy(6,6);
+  static thread_local Matrix threeDtangentCopy(6,6);
 
   //three dimensional tangent 
   const Matrix &threeDtangent = theMaterial->getInitialTangent( ) ;
@@ -296,7 +296,7 @@ PlaneStrainMaterial::sendSelf(int commitTag, Channel &theChannel)
   int res = 0;
 
   // put tag and associated materials class and database tags into an id and send it
-  static ID idData(3);
+  static thread_local ID idData(3);
   idData(0) = this->getTag();
   idData(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -326,7 +326,7 @@ PlaneStrainMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBrok
   int res = 0;
 
   // recv an id containg the tag and associated materials class and db tags
-  static ID idData(3);
+  static thread_local ID idData(3);
   res = theChannel.sendID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
     opserr << "PlaneStrainMaterial::sendSelf() - failed to send id data\n";
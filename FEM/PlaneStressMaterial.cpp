@@ -35,8 +35,8 @@
 #include <elementAPI.h>
 
 //static vector and matrices
-Vector  PlaneStressMaterial::stress(3) ;
-Matrix  PlaneStressMaterial::tangent(3,3) ;
+thread_local Vector  PlaneStressMaterial::stress(3) ;
+thread_local Matrix  PlaneStressMaterial::tangent(3,3) ;
 
 //      0  1  2  3  4  5
 // ND: 11 22 33 12 23 31
@@ -214,10 +214,10 @@ PlaneStressMaterial::setTrialStrain( const Vector &strainFromElement )
   this->strain(2) = strainFromElement(2) ;
 
   double norm ;
-  static Vector condensedStress(3);
-  static Vector strainIncrement(3);
-  static Vector threeDstrain(6);
-  static Matrix dd22(3,3);
+  static thread_local Vector condensedStress(3);
+  static thread_local Vector strainIncrement(3);
+  static thread_local Vector threeDstrain(6);
+  static thread_local Matrix dd22(3,3);
 
   int count = 0;
   const int maxCount = 20;
@@ -317,7 +317,7 @@ PlaneStressMaterial::getStressSensitivity(int gradIndex,
 
   const Matrix &threeDtangent = theMaterial->getTangent();
 
-  static Matrix dd12(3,3);
+  static thread_local Matrix dd12(3,3);
   dd12(0,0) = threeDtangent(0,2);
   dd12(1,0) = threeDtangent(1,2);
   dd12(2,0) = threeDtangent(3,2);
@@ -331,7 +331,7 @@ PlaneStressMaterial::getStressSensitivity(int gradIndex,
   dd12(2,2) = threeDtangent(3,5);
 
 
-  static Matrix dd22(3,3);
+  static thread_local Matrix dd22(3,3);
   dd22(0,0) = threeDtangent(2,2);
   dd22(1,0) = threeDtangent(4,2);
   dd22(2,0) = threeDtangent(5,2);
@@ -345,12 +345,12 @@ PlaneStressMaterial::getStressSensitivity(int gradIndex,
   dd22(2,2) = threeDtangent(5,5);
 
   
-  static Vector sigma2(3);
+  static thread_local Vector sigma2(3);
   sigma2(0) = threeDstress(2);
   sigma2(1) = threeDstress(4);
   sigma2(2) = threeDstress(5);
 
-  static Vector dd22sigma2(3);
+  static thread_local Vector dd22sigma2(3);
   dd22.Solve(sigma2,dd22sigma2);
 
   stress.addMatrixVector(1.0, dd12, dd22sigma2, -1.0);
@@ -364,7 +364,7 @@ PlaneStressMaterial::getTangent( )
 {
   const Matrix &threeDtangent = theMaterial->getTangent();
 
-  static Matrix dd11(3,3);
+  static thread_local Matrix dd11(3,3);
   dd11(0,0) = threeDtangent(0,0);
   dd11(1,0) = threeDtangent(1,0);
   dd11(2,0) = threeDtangent(3,0);
@@ -378,7 +378,7 @@ PlaneStressMaterial::getTangent( )
   dd11(2,2) = threeDtangent(3,3);
 
 
-  static Matrix dd12(3,3);
+  static thread_local Matrix dd12(3,3);
   dd12(0,0) = threeDtangent(0,2);
   dd12(1,0) = threeDtangent(1,2);
   dd12(2,0) = threeDtangent(3,2);
@@ -391,7 +391,7 @@ PlaneStressMaterial::getTangent( )
   dd12(1,2) = threeDtangent(1,5);
   dd12(2,2) = threeDtangent(3,5);
 
-  static Matrix dd21(3,3);
+  static thread_local Matrix dd21(3,3);
   dd21(0,0) = threeDtangent(2,0);
   dd21(1,0) = threeDtangent(4,0);
   dd21(2,0) = threeDtangent(5,0);
@@ -405,7 +405,7 @@ PlaneStressMaterial::getTangent( )
   dd21(2,2) = threeDtangent(5,3);
 
 
-  static Matrix dd22(3,3);
+  static thread_local Matrix dd22(3,3);
   dd22(0,0) = threeDtangent(2,2);
   dd22(1,0) = threeDtangent(4,2);
   dd22(2,0) = threeDtangent(5,2);
@@ -422,7 +422,7 @@ PlaneStressMaterial::getTangent( )
   //int Solve(const Vector &V, Vector &res) const;
   //int Solve(const Matrix &M, Matrix &res) const;
   //condensation 
-  static Matrix dd22invdd21(3,3);
+  static thread_local Matrix dd22invdd21(3,3);
   dd22.Solve(dd21, dd22invdd21);
 
   //this->tangent   = dd11 ; 
@@ -440,7 +440,7 @@ PlaneStressMaterial::getInitialTangent( )
 {
   const Matrix &threeDtangent = theMaterial->getInitialTangent();
 
-  static Matrix dd11(3,3);
+  static thread_local Matrix dd11(3,3);
   dd11(0,0) = threeDtangent(0,0);
   dd11(1,0) = threeDtangent(1,0);
   dd11(2,0) = threeDtangent(3,0);
@@ -454,7 +454,7 @@ PlaneStressMaterial::getInitialTangent( )
   dd11(2,2) = threeDtangent(3,3);
 
 
-  static Matrix dd12(3,3);
+  static thread_local Matrix dd12(3,3);
   dd12(0,0) = threeDtangent(0,2);
   dd12(1,0) = threeDtangent(1,2);
   dd12(2,0) = threeDtangent(3,2);
@@ -467,7 +467,7 @@ PlaneStressMaterial::getInitialTangent( )
   dd12(1,2) = threeDtangent(1,5);
   dd12(2,2) = threeDtangent(3,5);
 
-  static Matrix dd21(3,3);
+  static thread_local Matrix dd21(3,3);
   dd21(0,0) = threeDtangent(2,0);
   dd21(1,0) = threeDtangent(4,0);
   dd21(2,0) = threeDtangent(5,0);
@@ -481,7 +481,7 @@ PlaneStressMaterial::getInitialTangent( )
   dd21(2,2) = threeDtangent(5,3);
 
 
-  static Matrix dd22(3,3);
+  static thread_local Matrix dd22(3,3);
   dd22(0,0) = threeDtangent(2,2);
   dd22(1,0) = threeDtangent(4,2);
   dd22(2,0) = threeDtangent(5,2);
@@ -498,7 +498,7 @@ PlaneStressMaterial::getInitialTangent( )
   //int Solve(const Vector &V, Vector &res) const;
   //int Solve(const Matrix &M, Matrix &res) const;
   //condensation 
-  static Matrix dd22invdd21(3,3);
+  static thread_local Matrix dd22invdd21(3,3);
   dd22.Solve(dd21, dd22invdd21);
 
   //this->tangent   = dd11 ; 
@@ -530,7 +530,7 @@ PlaneStressMaterial::sendSelf(int commitTag, Channel &theChannel)
   int res = 0;
 
   // put tag and assocaited materials class and database tags into an id and send it
-  static ID idData(3);
+  static thread_local ID idData(3);
   idData(0) = this->getTag();
   idData(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -547,7 +547,7 @@ PlaneStressMaterial::sendSelf(int commitTag, Channel &theChannel)
   }
 
   // put the strains in a vector and send it
-  static Vector vecData(3);
+  static thread_local Vector vecData(3);
   vecData(0) = Cstrain22;
   vecData(1) = Cgamma02;
   vecData(2) = Cgamma12;
@@ -572,7 +572,7 @@ PlaneStressMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBrok
   int res = 0;
 
   // recv an id containg the tag and associated materials class and db tags
-  static ID idData(3);
+  static thread_local ID idData(3);
   res = theChannel.sendID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
     opserr << "PlaneStressMaterial::sendSelf() - failed to send id data\n";
@@ -596,7 +596,7 @@ PlaneStressMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBrok
   theMaterial->setDbTag(idData(2));
 
   // recv a vector containing strains and set the strains
-  static Vector vecData(3);
+  static thread_local Vector vecData(3);
   res = theChannel.recvVector(this->getDbTag(), commitTag, vecData);
   if (res < 0) {
     opserr << "PlaneStressMaterial::sendSelf() - failed to send vector data\n";
@@ -0,0 +1,257 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/recorder/PorePressureRatioRecorder.cpp
+//
+// Written: fmk
+//
+// Description: This file contains the implementation of
+// PorePressureRatioRecorder.
+//
+// What: "@(#) PorePressureRatioRecorder.cpp, revA"
+
+#include <PorePressureRatioRecorder.h>
+#include <Domain.h>
+#include <Element.h>
+#include <Node.h>
+#include <Response.h>
+#include <Information.h>
+#include <DummyStream.h>
+#include <classTags.h>
+
+#include <math.h>
+
+PorePressureRatioRecorder::PorePressureRatioRecorder()
+:Recorder(RECORDER_TAGS_PorePressureRatioRecorder),
+ eleID(0), theElements(0), numValidEle(0),
+ theDomain(0), theOutputHandler(0), theEnvelopeHandler(0),
+ echoTimeFlag(true), deltaT(0.0), nextTimeStampToRecord(0.0),
+ initializationDone(false)
+{
+
+}
+
+PorePressureRatioRecorder::PorePressureRatioRecorder(const ID &ele,
+						     Domain &theDom,
+						     OPS_Stream *outputHandler,
+						     OPS_Stream *envelopeHandler,
+						     double dT,
+						     bool echoTime)
+:Recorder(RECORDER_TAGS_PorePressureRatioRecorder),
+ eleID(ele), theElements(0), numValidEle(0),
+ theDomain(&theDom), theOutputHandler(outputHandler), theEnvelopeHandler(envelopeHandler),
+ echoTimeFlag(echoTime), deltaT(dT), nextTimeStampToRecord(0.0),
+ initializationDone(false)
+{
+
+}
+
+PorePressureRatioRecorder::~PorePressureRatioRecorder()
+{
+  if (theEnvelopeHandler != 0) {
+    this->writeEnvelope();
+    theEnvelopeHandler->endTag(); // Data
+    delete theEnvelopeHandler;
+  }
+
+  if (theOutputHandler != 0) {
+    theOutputHandler->endTag(); // Data
+    delete theOutputHandler;
+  }
+
+  if (theElements != 0)
+    delete [] theElements;
+}
+
+// the pore pressure is the third dof of the SSPquadUP nodes, found in the
+// velocity as in the pore pressure recorders of the model
+double
+PorePressureRatioRecorder::getPorePressure(Element *theEle)
+{
+  Node **theNodes = theEle->getNodePtrs();
+  int numNodes = theEle->getNumExternalNodes();
+
+  double p = 0.0;
+  for (int i=0; i<numNodes; i++) {
+    const Vector &vel = theNodes[i]->getTrialVel();
+    if (vel.Size() > 2)
+      p += vel(2);
+  }
+
+  return p/numNodes;
+}
+
+int
+PorePressureRatioRecorder::setInitialState(void)
+{
+  if (theDomain == 0)
+    return -1;
+
+  if (theElements != 0)
+    delete [] theElements;
+
+  int numEle = eleID.Size();
+  theElements = new Element *[numEle];
+  numValidEle = 0;
+  for (int i=0; i<numEle; i++) {
+    Element *theEle = theDomain->getElement(eleID(i));
+    if (theEle != 0 && theEle->getClassTag() == ELE_TAG_SSPquadUP)
+      theElements[numValidEle++] = theEle;
+  }
+
+  if (numValidEle == 0) {
+    opserr << "WARNING PorePressureRatioRecorder::setInitialState() - no SSPquadUP elements\n";
+    return -1;
+  }
+
+  u0.resize(numValidEle);
+  sigmaV0.resize(numValidEle);
+  maxExcess.resize(numValidEle);
+  maxRu.resize(numValidEle);
+  maxRuTime.resize(numValidEle);
+  data.resize(numValidEle + (echoTimeFlag ? 1 : 0));
+  data.Zero();
+
+  // the stresses are obtained through the element response, the column
+  // description goes to a dummy stream
+  DummyStream theDummyStream;
+  const char *stressArgs[] = {"stress"};
+  for (int i=0; i<numValidEle; i++) {
+    u0(i) = this->getPorePressure(theElements[i]);
+    sigmaV0(i) = 0.0;
+    Response *theResponse = theElements[i]->setResponse(stressArgs, 1, theDummyStream);
+    if (theResponse != 0) {
+      if (theResponse->getResponse() >= 0) {
+	const Vector &stress = theResponse->getInformation().getData();
+	if (stress.Size() > 1)
+	  sigmaV0(i) = -stress(1);
+      }
+      delete theResponse;
+    }
+    if (sigmaV0(i) <= 0.0)
+      opserr << "WARNING PorePressureRatioRecorder::setInitialState() - element " << theElements[i]->getTag()
+	     << " has no vertical effective stress, its ru is zero\n";
+  }
+
+  // describe the columns
+  OPS_Stream *theHandlers[2] = {theOutputHandler, theEnvelopeHandler};
+  for (int k=0; k<2; k++) {
+    if (theHandlers[k] == 0)
+      continue;
+    if (k == 0 && echoTimeFlag == true) {
+      theHandlers[k]->tag("TimeOutput");
+      theHandlers[k]->tag("ResponseType", "time");
+      theHandlers[k]->endTag();
+    }
+    for (int i=0; i<numValidEle; i++) {
+      theHandlers[k]->tag("ElementOutput");
+      theHandlers[k]->attr("eleType", theElements[i]->getClassType());
+      theHandlers[k]->attr("eleTag", theElements[i]->getTag());
+      theHandlers[k]->tag("ResponseType", "ru");
+      theHandlers[k]->endTag();
+    }
+    theHandlers[k]->tag("Data");
+  }
+
+  initializationDone = true;
+
+  return this->restart();
+}
+
+int
+PorePressureRatioRecorder::record(int commitTag, double timeStamp)
+{
+  if (initializationDone == false) {
+    if (this->setInitialState() != 0) {
+      opserr << "PorePressureRatioRecorder::record() - failed to initialize\n";
+      return -1;
+    }
+  }
+
+  // the envelope is updated at every commit
+  int offset = echoTimeFlag ? 1 : 0;
+  for (int i=0; i<numValidEle; i++) {
+    double excess = this->getPorePressure(theElements[i]) - u0(i);
+    double ru = (sigmaV0(i) > 0.0) ? excess/sigmaV0(i) : 0.0;
+    data(i + offset) = ru;
+
+    if (excess > maxExcess(i))
+      maxExcess(i) = excess;
+    if (ru > maxRu(i)) {
+      maxRu(i) = ru;
+      maxRuTime(i) = timeStamp;
+    }
+  }
+
+  // the tolerance keeps round-off in the accumulated time from skipping a record
+  if (theOutputHandler != 0 &&
+      (deltaT == 0.0 || timeStamp - nextTimeStampToRecord >= -deltaT * 1.0e-5)) {
+    if (deltaT != 0.0)
+      nextTimeStampToRecord = timeStamp + deltaT;
+    if (echoTimeFlag == true)
+      data(0) = timeStamp;
+    theOutputHandler->write(data);
+  }
+
+  return 0;
+}
+
+int
+PorePressureRatioRecorder::restart(void)
+{
+  maxExcess.Zero();
+  maxRu.Zero();
+  maxRuTime.Zero();
+  return 0;
+}
+
+int
+PorePressureRatioRecorder::writeEnvelope(void)
+{
+  if (initializationDone == false)
+    return 0;
+
+  theEnvelopeHandler->write(sigmaV0);
+  theEnvelopeHandler->write(maxExcess);
+  theEnvelopeHandler->write(maxRu);
+  theEnvelopeHandler->write(maxRuTime);
+
+  return 0;
+}
+
+int
+PorePressureRatioRecorder::setDomain(Domain &theDom)
+{
+  theDomain = &theDom;
+  return 0;
+}
+
+int
+PorePressureRatioRecorder::sendSelf(int commitTag, Channel &theChannel)
+{
+  return 0;
+}
+
+int
+PorePressureRatioRecorder::recvSelf(int commitTag, Channel &theChannel,
+				    FEM_ObjectBroker &theBroker)
+{
+  return 0;
+}
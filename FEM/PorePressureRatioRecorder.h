@@ -0,0 +1,101 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/recorder/PorePressureRatioRecorder.h
+//
+// Written: fmk
+//
+// Description: This file contains the class definition for
+// PorePressureRatioRecorder. A PorePressureRatioRecorder records the
+// excess pore pressure ratio
+//
+//   ru = (u - u0) / sigma'v0
+//
+// of SSPquadUP elements, where u is the mean pore pressure of the element
+// nodes and u0 and sigma'v0 (the vertical effective stress of the element
+// material) are taken when setInitialState() is called, i.e. when the
+// dynamic stage starts. The ru of every element is written every deltaT,
+// and on destruction the envelope is written: the rows sigma'v0, max
+// (u - u0), max ru and the time of max ru. Other elements are ignored.
+//
+// What: "@(#) PorePressureRatioRecorder.h, revA"
+
+#ifndef PorePressureRatioRecorder_h
+#define PorePressureRatioRecorder_h
+
+#include <Recorder.h>
+#include <ID.h>
+#include <Vector.h>
+
+class Domain;
+class Element;
+
+class PorePressureRatioRecorder: public Recorder
+{
+  public:
+    PorePressureRatioRecorder();
+    PorePressureRatioRecorder(const ID &eleID,
+			      Domain &theDomain,
+			      OPS_Stream *theOutputHandler,
+			      OPS_Stream *theEnvelopeHandler,
+			      double deltaT = 0.0,
+			      bool echoTimeFlag = true);
+
+    ~PorePressureRatioRecorder();
+
+    int setInitialState(void);
+
+    int record(int commitTag, double timeStamp);
+    int restart(void);
+
+    int setDomain(Domain &theDomain);
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
+
+  protected:
+
+  private:
+    double getPorePressure(Element *theEle);
+    int writeEnvelope(void);
+
+    ID eleID;
+    Element **theElements;
+    int numValidEle;
+
+    Domain *theDomain;
+    OPS_Stream *theOutputHandler;
+    OPS_Stream *theEnvelopeHandler;
+
+    bool echoTimeFlag;
+    double deltaT;
+    double nextTimeStampToRecord;
+
+    Vector u0;           // initial mean pore pressure
+    Vector sigmaV0;      // initial vertical effective stress
+    Vector data;         // time and ru of the elements
+    Vector maxExcess;
+    Vector maxRu;
+    Vector maxRuTime;
+
+    bool initializationDone;
+};
+
+#endif
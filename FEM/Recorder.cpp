@@ -33,11 +33,17 @@
 
 #include <Recorder.h>
 #include <OPS_Globals.h>
+#include <Node.h>
+#include <Vector.h>
+#include <float.h>
+#include <math.h>
 
-int Recorder::lastRecorderTag(0);
+thread_local int Recorder::lastRecorderTag(0);
 
 Recorder::Recorder(int classTag)
-  :MovableObject(classTag), TaggedObject(lastRecorderTag)
+  :MovableObject(classTag), TaggedObject(lastRecorderTag),
+   decimation(1), rowCount(0), startTime(-DBL_MAX), endTime(DBL_MAX),
+   triggerNode(0), triggerDof(0), triggerAccel(0.0), triggered(true)
 {
   lastRecorderTag++;
 }
@@ -85,3 +91,66 @@ Recorder::Print(OPS_Stream &s, int flag)
 {
   return;
 }
+
+int
+Recorder::setDecimation(int factor)
+{
+  if (factor < 1) {
+    opserr << "WARNING Recorder::setDecimation() - factor " << factor << " < 1, using 1\n";
+    factor = 1;
+  }
+  decimation = factor;
+  rowCount = 0;
+  return 0;
+}
+
+int
+Recorder::setTimeWindow(double start, double end)
+{
+  if (end < start) {
+    opserr << "WARNING Recorder::setTimeWindow() - end time " << end << " before start time " << start << endln;
+    return -1;
+  }
+  startTime = start;
+  endTime = end;
+  return 0;
+}
+
+int
+Recorder::setTrigger(Node *theNode, int dof, double accel)
+{
+  triggerNode = theNode;
+  triggerDof = dof;
+  triggerAccel = accel;
+  triggered = (theNode == 0);
+  return 0;
+}
+
+// false if the row at timeStamp is outside the time window or before the
+// trigger; the trigger is checked at every call, so recorders invoke this
+// before their deltaT test
+bool
+Recorder::isRecording(double timeStamp)
+{
+  if (triggered == false) {
+    const Vector &accel = triggerNode->getTrialAccel();
+    if (accel.Size() > triggerDof && fabs(accel(triggerDof)) >= triggerAccel)
+      triggered = true;
+    else
+      return false;
+  }
+
+  return (timeStamp >= startTime && timeStamp <= endTime);
+}
+
+// true if the row is dropped by the decimation
+bool
+Recorder::isDecimated(void)
+{
+  if (decimation == 1)
+    return false;
+
+  bool dropped = (rowCount % decimation != 0);
+  rowCount++;
+  return dropped;
+}
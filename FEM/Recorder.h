@@ -37,6 +37,7 @@
 // What: "@(#) Recorder.h, revA"
 
 class Domain;
+class Node;
 #include <MovableObject.h>
 #include <TaggedObject.h>
 
@@ -58,10 +59,28 @@ class Recorder: public MovableObject, public TaggedObject
 
     virtual void Print(OPS_Stream &s, int flag); 
 
+    // controls on the rows a recorder writes: only every factor-th row,
+    // only rows in [startTime, endTime], and only once the acceleration of
+    // dof of theNode has reached triggerAccel in absolute value
+    int setDecimation(int factor);
+    int setTimeWindow(double startTime, double endTime);
+    int setTrigger(Node *theNode, int dof, double triggerAccel);
+
   protected:
+    bool isRecording(double timeStamp);
+    bool isDecimated(void);
     
   private:	
-    static int lastRecorderTag;
+    static thread_local int lastRecorderTag;
+
+    int decimation;
+    int rowCount;
+    double startTime;
+    double endTime;
+    Node *triggerNode;
+    int triggerDof;
+    double triggerAccel;
+    bool triggered;
 };
 
 
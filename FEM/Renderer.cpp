@@ -142,8 +142,8 @@ int
 Renderer::drawCube(const Matrix &points, const Vector &values, int tag, int mode)
 {
 
-  static Matrix polyData(4,3);
-  static Vector polyValues(4);
+  static thread_local Matrix polyData(4,3);
+  static thread_local Vector polyValues(4);
   // draw the 6 faces
 
   int a,b,c,d;
@@ -39,8 +39,8 @@
 #include <Node.h>
 #include <ID.h>
 
-static int numSPs = 0;
-static int nextTag = 0;
+static thread_local int numSPs = 0;
+static thread_local int nextTag = 0;
 
 int OPS_HomogeneousBC()
 {
@@ -348,7 +348,7 @@ SP_Constraint::getLoadPatternTag(void) const
 int 
 SP_Constraint::sendSelf(int cTag, Channel &theChannel)
 {
-    static Vector data(8);  // we send as double to avoid having 
+    static thread_local Vector data(8);  // we send as double to avoid having 
                      // to send two messages.
     data(0) = this->getTag(); 
     data(1) = nodeTag;
@@ -376,7 +376,7 @@ int
 SP_Constraint::recvSelf(int cTag, Channel &theChannel, 
 			FEM_ObjectBroker &theBroker)
 {
-    static Vector data(8);  // we sent the data as double to avoid having to send
+    static thread_local Vector data(8);  // we sent the data as double to avoid having to send
                      // two messages
     int result = theChannel.recvVector(this->getDbTag(), cTag, data);
     if (result < 0) {
@@ -45,7 +45,7 @@
 
 #define OPS_Export
 
-static int num_SSPbrick = 0;
+static thread_local int num_SSPbrick = 0;
 
 OPS_Export void *
 OPS_SSPbrick(void)
@@ -628,7 +628,7 @@ SSPbrick::addInertiaLoadToUnbalance(const Vector &accel)
 	const Vector &Raccel7 = theNodes[6]->getRV(accel);
 	const Vector &Raccel8 = theNodes[7]->getRV(accel);
 
-	static double ra[24];
+	static thread_local double ra[24];
 	ra[0] =  Raccel1(0);
 	ra[1] =  Raccel1(1);
 	ra[2] =  Raccel1(2);
@@ -772,7 +772,7 @@ SSPbrick::getResistingForceIncInertia()
   const Vector &accel7 = theNodes[6]->getTrialAccel();
   const Vector &accel8 = theNodes[7]->getTrialAccel();
   
-  static double a[24];
+  static thread_local double a[24];
   a[0] =  accel1(0);
   a[1] =  accel1(1);
   a[2] =  accel1(2);
@@ -828,7 +828,7 @@ SSPbrick::sendSelf(int commitTag, Channel &theChannel)
   
   // SSPbrick packs its data into a Vector and sends this to theChannel
   // along with its dbTag and the commitTag passed in the arguments
-  static Vector data(751);
+  static thread_local Vector data(751);
   data(0) = this->getTag();
   data(1) = b[0];
   data(2) = b[1];
@@ -902,7 +902,7 @@ SSPbrick::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBrok
   
   // SSPbrick creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
-  static Vector data(751);
+  static thread_local Vector data(751);
   res = theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING SSPbrick::recvSelf() - failed to receive Vector\n";
@@ -995,9 +995,9 @@ SSPbrick::displaySelf(Renderer &theViewer, int displayMode, float fact, const ch
     const Vector &end7Crd = theNodes[6]->getCrds();	
     const Vector &end8Crd = theNodes[7]->getCrds();	
 
-    static Matrix coords(8,3);
-    static Vector values(8);
-    static Vector P(24) ;
+    static thread_local Matrix coords(8,3);
+    static thread_local Vector values(8);
+    static thread_local Vector P(24) ;
     
     for (int i=0; i<8; i++)
       values(i) = 1.0;
@@ -1069,8 +1069,18 @@ SSPbrick::Print(OPS_Stream &s, int flag)
 Response*
 SSPbrick::setResponse(const char **argv, int argc, OPS_Stream &eleInfo)
 {
+	Response *theResponse = 0;
+
+	eleInfo.tag("ElementOutput");
+	eleInfo.attr("eleType", this->getClassType());
+	eleInfo.attr("eleTag", this->getTag());
+
 	// no special recorders for this element, call the method in the material class
-	return theMaterial->setResponse(argv, argc, eleInfo);
+	theResponse = theMaterial->setResponse(argv, argc, eleInfo);
+
+	eleInfo.endTag(); // ElementOutput
+
+	return theResponse;
 }
 
 int
@@ -53,7 +53,7 @@
 #define OPS_PRINT_CURRENTSTATE 1
 #define OPS_PRINT_PRINTMODEL_JSON 1
 
-static int num_SSPquad = 0;
+static thread_local int num_SSPquad = 0;
 
 OPS_Export void *
 OPS_SSPquad(void)
@@ -417,7 +417,7 @@ SSPquad::addInertiaLoadToUnbalance(const Vector &accel)
     	return -1;
 	}
 
-	static double ra[8];
+	static thread_local double ra[8];
 	ra[0] = Raccel1(0);
 	ra[1] = Raccel1(1);
 	ra[2] = Raccel2(0);
@@ -513,7 +513,7 @@ SSPquad::getResistingForceIncInertia()
 	const Vector &accel3 = theNodes[2]->getTrialAccel();
 	const Vector &accel4 = theNodes[3]->getTrialAccel();
 	
-	static double a[8];
+	static thread_local double a[8];
 	a[0] = accel1(0);
 	a[1] = accel1(1);
 	a[2] = accel2(0);
@@ -553,7 +553,7 @@ SSPquad::sendSelf(int commitTag, Channel &theChannel)
   
   // SSPquad packs its data into a Vector and sends this to theChannel
   // along with its dbTag and the commitTag passed in the arguments
-  static Vector data(10);
+  static thread_local Vector data(10);
   data(0) = this->getTag();
   data(1) = mThickness;
   data(2) = b[0];
@@ -607,7 +607,7 @@ SSPquad::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroke
   
   // SSPquad creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
-  static Vector data(10);
+  static thread_local Vector data(10);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING SSPquad::recvSelf() - failed to receive Vector\n";
@@ -699,8 +699,18 @@ SSPquad::Print(OPS_Stream &s, int flag)
 Response*
 SSPquad::setResponse(const char **argv, int argc, OPS_Stream &eleInfo)
 {
+	Response *theResponse = 0;
+
+	eleInfo.tag("ElementOutput");
+	eleInfo.attr("eleType", this->getClassType());
+	eleInfo.attr("eleTag", this->getTag());
+
 	// no special recorders for this element, call the method in the material class
-	return theMaterial->setResponse(argv, argc, eleInfo);
+	theResponse = theMaterial->setResponse(argv, argc, eleInfo);
+
+	eleInfo.endTag(); // ElementOutput
+
+	return theResponse;
 }
 
 int
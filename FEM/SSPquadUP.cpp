@@ -62,7 +62,7 @@
 #define OPS_PRINT_CURRENTSTATE 1
 #define OPS_PRINT_PRINTMODEL_JSON 1
 
-static int num_SSPquadUP = 0;
+static thread_local int num_SSPquadUP = 0;
 
 OPS_Export void *
 OPS_SSPquadUP(void)
@@ -152,6 +152,7 @@ SSPquadUP::SSPquadUP(int tag, int Nd1, int Nd2, int Nd3, int Nd4, NDMaterial &th
     mTangentStiffness(SQUP_NUM_DOF,SQUP_NUM_DOF),
     mInternalForces(SQUP_NUM_DOF),
     Q(SQUP_NUM_DOF),
+    mStrain(3),
     mMass(SQUP_NUM_DOF,SQUP_NUM_DOF),
     mDamp(SQUP_NUM_DOF,SQUP_NUM_DOF),
     mNodeCrd(2,4),
@@ -226,6 +227,7 @@ SSPquadUP::SSPquadUP()
     mTangentStiffness(SQUP_NUM_DOF,SQUP_NUM_DOF),
     mInternalForces(SQUP_NUM_DOF),
     Q(SQUP_NUM_DOF),
+    mStrain(3),
     mMass(SQUP_NUM_DOF,SQUP_NUM_DOF),
     mDamp(SQUP_NUM_DOF,SQUP_NUM_DOF),
     mNodeCrd(2,4),
@@ -362,6 +364,17 @@ SSPquadUP::revertToStart(void)
 int
 SSPquadUP::update(void)
 // this function updates variables for an incremental step n to n+1
+{
+    const Vector *strain;
+    this->formMaterialStrain(strain);
+    theMaterial->setTrialStrain(*strain);
+
+    return 0;
+}
+
+NDMaterial *
+SSPquadUP::formMaterialStrain(const Vector *&theStrain)
+// this function computes the trial strain of the material
 {
     // get trial displacement
     const Vector &mDisp_1 = theNodes[0]->getTrialDisp();
@@ -380,11 +393,10 @@ SSPquadUP::update(void)
     u(6) = mDisp_4(0);
     u(7) = mDisp_4(1);
 
-    Vector strain(3);
-    strain = Mmem*u;
-    theMaterial->setTrialStrain(strain);
+    mStrain = Mmem*u;
+    theStrain = &mStrain;
 
-    return 0;
+    return theMaterial;
 }
 
 const Matrix &
@@ -600,7 +612,7 @@ SSPquadUP::addInertiaLoadToUnbalance(const Vector &accel)
     	return -1;
 	}
 
-	static double ra[12];
+	static thread_local double ra[12];
 	ra[0]  = Raccel1(0);
 	ra[1]  = Raccel1(1);
 	ra[2]  = 0.0;
@@ -793,7 +805,7 @@ SSPquadUP::sendSelf(int commitTag, Channel &theChannel)
     // SSPquadUP packs its data into a Vector and sends this to theChannel
     // along with its dbTag and the commitTag passed in the arguments
     //LM change
-	static Vector data(15);
+	static thread_local Vector data(15);
     data(0) = this->getTag();
     data(1) = mThickness;
     data(2) = fBulk;
@@ -813,7 +825,7 @@ SSPquadUP::sendSelf(int commitTag, Channel &theChannel)
     // Now SSPquadUP sends the ids of its materials
     int matDbTag = theMaterial->getDbTag();
   
-    static ID idData(12);
+    static thread_local ID idData(12);
   
     // NOTE: we do have to ensure that the material has a database
     // tag if we are sending to a database channel.
@@ -856,7 +868,7 @@ SSPquadUP::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBro
 
     // SSPquadUP creates a Vector, receives the Vector and then sets the 
     // internal data with the data in the Vector
-    static Vector data(6);
+    static thread_local Vector data(15);
     res += theChannel.recvVector(dataTag, commitTag, data);
     if (res < 0) {
         opserr << "WARNING SSPquadUP::recvSelf() - failed to receive Vector\n";
@@ -956,8 +968,18 @@ SSPquadUP::Print(OPS_Stream &s, int flag)
 Response*
 SSPquadUP::setResponse(const char **argv, int argc, OPS_Stream &eleInfo)
 {
+    Response *theResponse = 0;
+
+    eleInfo.tag("ElementOutput");
+    eleInfo.attr("eleType", this->getClassType());
+    eleInfo.attr("eleTag", this->getTag());
+
     // no special recorders for this element, call the method in the material class
-    return theMaterial->setResponse(argv, argc, eleInfo);
+    theResponse = theMaterial->setResponse(argv, argc, eleInfo);
+
+    eleInfo.endTag(); // ElementOutput
+
+    return theResponse;
 }
 
 int
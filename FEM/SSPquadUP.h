@@ -79,6 +79,7 @@ class SSPquadUP : public Element
     int revertToLastCommit(void);
     int revertToStart(void);
     int update(void);
+    NDMaterial *formMaterialStrain(const Vector *&theStrain);
 
     // public methods to obtain stiffness, mass, damping, and residual info
     const Matrix &getTangentStiff(void);
@@ -129,6 +130,7 @@ class SSPquadUP : public Element
     Matrix mTangentStiffness;                  // tangent stiffness matrix
     Vector mInternalForces;                    // vector of internal forces
     Vector Q;                                  // vector of applied nodal forces
+    Vector mStrain;                            // trial strain of the material
     Matrix mDamp;                              // damping matrix
     Matrix mMass;                              // mass matrix
     // LM change
@@ -47,7 +47,7 @@ void invertMatrix(int n, const Matrix &a, Matrix &b);
 #include <TaggedObject.h>
 #include <MapOfTaggedObjects.h>
 
-static MapOfTaggedObjects theSectionForceDeformationObjects;
+static thread_local MapOfTaggedObjects theSectionForceDeformationObjects;
 
 bool OPS_addSectionForceDeformation(SectionForceDeformation *newComponent) {
   return theSectionForceDeformationObjects.addComponent(newComponent);
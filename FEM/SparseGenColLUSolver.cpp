@@ -0,0 +1,419 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+// File: ~/system_of_eqn/linearSOE/sparseGEN/SparseGenColLUSolver.cpp
+//
+// Written: fmk
+//
+// Description: This file contains the implementation of
+// SparseGenColLUSolver. The elimination tree based symbolic and
+// up-looking numeric factorizations follow the LDL package of T. Davis,
+// extended to unsymmetric values on a structurally symmetric pattern.
+//
+// What: "@(#) SparseGenColLUSolver.cpp, revA"
+
+#include <SparseGenColLUSolver.h>
+#include <SparseGenColLinSOE.h>
+#include <math.h>
+#include <float.h>
+#include <iostream>
+using std::nothrow;
+
+void* OPS_SparseGenColLU()
+{
+    SparseGenColLinSolver *theSolver = new SparseGenColLUSolver();
+    SparseGenColLinSOE *theSOE = new SparseGenColLinSOE(*theSolver);
+    return theSOE;
+}
+
+SparseGenColLUSolver::SparseGenColLUSolver()
+:SparseGenColLinSolver(SOLVER_TAGS_SparseGenColLUSolver),
+ n(0), lnz(0), parent(0), Lp(0), Lfill(0), Li(0), Rp(0), Rj(0), flag(0),
+ transA(0), Lx(0), Ux(0), D(0), Y(0), Z(0), numPerturbed(0)
+{
+
+}
+
+SparseGenColLUSolver::~SparseGenColLUSolver()
+{
+    this->freeStorage();
+}
+
+void
+SparseGenColLUSolver::freeStorage(void)
+{
+    if (parent != 0) delete [] parent;
+    if (Lp != 0) delete [] Lp;
+    if (Lfill != 0) delete [] Lfill;
+    if (Li != 0) delete [] Li;
+    if (Rp != 0) delete [] Rp;
+    if (Rj != 0) delete [] Rj;
+    if (flag != 0) delete [] flag;
+    if (transA != 0) delete [] transA;
+    if (Lx != 0) delete [] Lx;
+    if (Ux != 0) delete [] Ux;
+    if (D != 0) delete [] D;
+    if (Y != 0) delete [] Y;
+    if (Z != 0) delete [] Z;
+
+    parent = Lp = Lfill = Li = Rp = Rj = flag = transA = 0;
+    Lx = Ux = D = Y = Z = 0;
+    n = 0; lnz = 0; numPerturbed = 0;
+}
+
+
+int
+SparseGenColLUSolver::setSize()
+{
+    this->freeStorage();
+
+    n = theSOE->size;
+    if (n == 0)
+	return 0;
+
+    int nnz = theSOE->nnz;
+    int *Ap = theSOE->colStartA;
+    int *Ai = theSOE->rowA;
+
+    parent = new (nothrow) int[n];
+    Lp = new (nothrow) int[n+1];
+    Lfill = new (nothrow) int[n];
+    Rp = new (nothrow) int[n+1];
+    flag = new (nothrow) int[n];
+    transA = new (nothrow) int[nnz];
+    D = new (nothrow) double[n];
+    Y = new (nothrow) double[n];
+    Z = new (nothrow) double[n];
+
+    if (parent == 0 || Lp == 0 || Lfill == 0 || Rp == 0 || flag == 0 ||
+	transA == 0 || D == 0 || Y == 0 || Z == 0) {
+	opserr << "WARNING SparseGenColLUSolver::setSize() ";
+	opserr << " - ran out of memory for n = " << n << endln;
+	this->freeStorage();
+	return -1;
+    }
+
+    //
+    // elimination tree and number of entries in each column of L
+    //
+
+    for (int k=0; k<n; k++) {
+	parent[k] = -1;
+	flag[k] = k;
+	Lfill[k] = 0;
+	for (int p=Ap[k]; p<Ap[k+1]; p++) {
+	    int i = Ai[p];
+	    if (i < k) {
+		// follow path from i to root of etree, stop at flagged node
+		for ( ; flag[i] != k; i = parent[i]) {
+		    if (parent[i] == -1)
+			parent[i] = k;
+		    Lfill[i]++;
+		    flag[i] = k;
+		}
+	    }
+	}
+    }
+
+    Lp[0] = 0;
+    for (int k=0; k<n; k++)
+	Lp[k+1] = Lp[k] + Lfill[k];
+    lnz = Lp[n];
+
+    Li = new (nothrow) int[lnz];
+    Rj = new (nothrow) int[lnz];
+    Lx = new (nothrow) double[lnz];
+    Ux = new (nothrow) double[lnz];
+
+    if ((Li == 0 || Rj == 0 || Lx == 0 || Ux == 0) && lnz != 0) {
+	opserr << "WARNING SparseGenColLUSolver::setSize() ";
+	opserr << " - ran out of memory for factors with nnz = " << lnz << endln;
+	this->freeStorage();
+	return -1;
+    }
+
+    //
+    // row patterns of L, stored in the topological order needed by the
+    // numeric factorization, and location of the transposed entries of A
+    //
+
+    Rp[0] = 0;
+
+    int *stack = new (nothrow) int[n];
+    if (stack == 0) {
+	opserr << "WARNING SparseGenColLUSolver::setSize() ";
+	opserr << " - ran out of memory for n = " << n << endln;
+	this->freeStorage();
+	return -1;
+    }
+
+    int next = 0;
+    for (int k=0; k<n; k++) {
+	flag[k] = k;
+	int start = next;
+	for (int p=Ap[k]; p<Ap[k+1]; p++) {
+	    int i = Ai[p];
+
+	    if (i != k) {
+		transA[p] = theSOE->findEntry(k, i);
+		if (transA[p] < 0) {
+		    opserr << "WARNING SparseGenColLUSolver::setSize() ";
+		    opserr << " - pattern of A is not structurally symmetric\n";
+		    delete [] stack;
+		    this->freeStorage();
+		    return -1;
+		}
+	    } else
+		transA[p] = p;
+
+	    if (i < k) {
+		int len = 0;
+		for ( ; flag[i] != k; i = parent[i]) {
+		    stack[len++] = i;
+		    flag[i] = k;
+		}
+		// append the path reversed, so that it is in topological
+		// order once the whole row is reversed below
+		while (len > 0)
+		    Rj[next++] = stack[--len];
+	    }
+	}
+
+	// the paths were appended in the order they were found, each
+	// reversed; reversing the whole row gives the topological order
+	for (int a=start, b=next-1; a<b; a++, b--) {
+	    int tmp = Rj[a];
+	    Rj[a] = Rj[b];
+	    Rj[b] = tmp;
+	}
+	Rp[k+1] = next;
+    }
+
+    delete [] stack;
+
+    return 0;
+}
+
+
+int
+SparseGenColLUSolver::factor(void)
+{
+    int *Ap = theSOE->colStartA;
+    int *Ai = theSOE->rowA;
+    double *Ax = theSOE->A;
+
+    for (int k=0; k<n; k++) {
+	Y[k] = 0.0;
+	Z[k] = 0.0;
+	Lfill[k] = 0;
+    }
+
+    numPerturbed = 0;
+
+    for (int k=0; k<n; k++) {
+
+	// scatter upper part of column k into Y and left part of row k into Z
+	double colMax = 0.0;
+	for (int p=Ap[k]; p<Ap[k+1]; p++) {
+	    int i = Ai[p];
+	    if (fabs(Ax[p]) > colMax)
+		colMax = fabs(Ax[p]);
+	    if (i <= k) {
+		Y[i] += Ax[p];
+		if (i < k)
+		    Z[i] += Ax[transA[p]];
+	    }
+	}
+
+	double d = Y[k];
+	Y[k] = 0.0;
+
+	// sparse triangular solves for column k of U and row k of L
+	for (int t=Rp[k]; t<Rp[k+1]; t++) {
+	    int j = Rj[t];
+	    double yj = Y[j];
+	    double zj = Z[j];
+	    Y[j] = 0.0;
+	    Z[j] = 0.0;
+
+	    int pEnd = Lp[j] + Lfill[j];
+	    for (int p=Lp[j]; p<pEnd; p++) {
+		int i = Li[p];
+		Y[i] -= Lx[p] * yj;
+		Z[i] -= Ux[p] * zj;
+	    }
+
+	    double lkj = zj / D[j];
+	    d -= lkj * yj;
+
+	    Li[pEnd] = k;
+	    Lx[pEnd] = lkj;
+	    Ux[pEnd] = yj / D[j];
+	    Lfill[j]++;
+	}
+
+	// static pivoting: as the equations are eliminated in the given
+	// order, a pivot that has cancelled to the round-off of its column of
+	// A is replaced by eps*max|A(:,k)| and solve() refines the solution
+	// against the unperturbed A. The threshold is per column as the
+	// entries of A can be many orders of magnitude apart (e.g. u-p DOFs).
+	double tiny = DBL_EPSILON * colMax;
+	if (d != d || tiny == 0.0) {
+	    opserr << "WARNING SparseGenColLUSolver::factor() -";
+	    opserr << " zero pivot in equation " << k << endln;
+	    return -(k+1);
+	}
+
+	if (fabs(d) < tiny) {
+	    d = (d < 0.0) ? -tiny : tiny;
+	    numPerturbed++;
+	}
+
+	D[k] = d;
+    }
+
+    return 0;
+}
+
+
+int
+SparseGenColLUSolver::solve(void)
+{
+    if (theSOE == 0) {
+	opserr << "WARNING SparseGenColLUSolver::solve(void)- ";
+	opserr << " No LinearSOE object has been set\n";
+	return -1;
+    }
+
+    if (n != theSOE->size) {
+	opserr << "WARNING SparseGenColLUSolver::solve(void)- ";
+	opserr << " size mismatch - has setSize() been called?\n";
+	return -1;
+    }
+
+    double *Xptr = theSOE->X;
+    double *Bptr = theSOE->B;
+
+    // numeric factorization only if A has changed since the last solve
+    if (theSOE->factored == false) {
+	int info = this->factor();
+	if (info != 0)
+	    return info;
+	theSOE->factored = true;
+    }
+
+    // first copy B into X
+    for (int i=0; i<n; i++)
+	Xptr[i] = Bptr[i];
+
+    this->substitute(Xptr);
+
+    if (numPerturbed == 0)
+	return 0;
+
+    // iterative refinement with the residual of the unperturbed A
+    int *Ap = theSOE->colStartA;
+    int *Ai = theSOE->rowA;
+    double *Ax = theSOE->A;
+
+    double lastNormDX = 0.0;
+    for (int iter=0; iter<maxRefineIter; iter++) {
+	for (int i=0; i<n; i++)
+	    Y[i] = Bptr[i];
+	for (int j=0; j<n; j++) {
+	    double xj = Xptr[j];
+	    for (int p=Ap[j]; p<Ap[j+1]; p++)
+		Y[Ai[p]] -= Ax[p] * xj;
+	}
+
+	this->substitute(Y);
+
+	double normDX = 0.0;
+	for (int i=0; i<n; i++)
+	    if (fabs(Y[i]) > normDX)
+		normDX = fabs(Y[i]);
+
+	// a growing correction means the perturbed factors can not solve A,
+	// keep the last solution
+	if (iter > 0 && normDX > lastNormDX) {
+	    opserr << "WARNING SparseGenColLUSolver::solve(void)- ";
+	    opserr << " iterative refinement diverged with " << numPerturbed;
+	    opserr << " perturbed pivots\n";
+	    return -3;
+	}
+	lastNormDX = normDX;
+
+	double normX = 0.0;
+	for (int i=0; i<n; i++) {
+	    Xptr[i] += Y[i];
+	    if (fabs(Xptr[i]) > normX)
+		normX = fabs(Xptr[i]);
+	}
+
+	if (normDX <= DBL_EPSILON * normX)
+	    return 0;
+    }
+
+    opserr << "WARNING SparseGenColLUSolver::solve(void)- ";
+    opserr << " iterative refinement did not converge in " << maxRefineIter;
+    opserr << " iterations with " << numPerturbed << " perturbed pivots\n";
+    return -2;
+}
+
+
+void
+SparseGenColLUSolver::substitute(double *x)
+{
+    // forward substitution L*y = b
+    for (int j=0; j<n; j++) {
+	double xj = x[j];
+	for (int p=Lp[j]; p<Lp[j+1]; p++)
+	    x[Li[p]] -= Lx[p] * xj;
+    }
+
+    // diagonal
+    for (int j=0; j<n; j++)
+	x[j] /= D[j];
+
+    // backward substitution U*x = z, column j of Ux holds row j of U
+    for (int j=n-1; j>=0; j--) {
+	double xj = x[j];
+	for (int p=Lp[j]; p<Lp[j+1]; p++)
+	    xj -= Ux[p] * x[Li[p]];
+	x[j] = xj;
+    }
+}
+
+
+int
+SparseGenColLUSolver::sendSelf(int commitTag, Channel &theChannel)
+{
+    return 0;
+}
+
+int
+SparseGenColLUSolver::recvSelf(int commitTag,
+			       Channel &theChannel,
+			       FEM_ObjectBroker &theBroker)
+{
+    // nothing to do
+    return 0;
+}
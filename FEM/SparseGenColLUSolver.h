@@ -0,0 +1,81 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+// File: ~/system_of_eqn/linearSOE/sparseGEN/SparseGenColLUSolver.h
+//
+// Written: fmk
+//
+// Description: This file contains the class definition for
+// SparseGenColLUSolver. It solves the SparseGenColLinSOE object by an
+// up-looking sparse LDU factorization, A = L*D*U, performed in the
+// equation order given by the DOF_Numberer. As the pattern of A is
+// structurally symmetric the pattern of U is that of L transposed, and
+// both are stored by column using the same index arrays.
+//
+// The symbolic factorization (elimination tree, column counts of L and the
+// row patterns of L in topological order) only depends on the pattern of A
+// and is done once in setSize(). Each call to solve() with a matrix that has
+// been re-formed does only the numeric factorization, followed by the
+// forward and backward substitutions. The equations are not reordered;
+// instead a pivot smaller than eps times the largest entry of its column of
+// A is replaced by that value (static pivoting) and the solution is then
+// improved by a few steps of iterative refinement with the residual of the
+// original A. Only a NaN pivot, or a zero column, is reported as an error.
+//
+// What: "@(#) SparseGenColLUSolver.h, revA"
+
+#ifndef SparseGenColLUSolver_h
+#define SparseGenColLUSolver_h
+
+#include <SparseGenColLinSolver.h>
+
+class SparseGenColLUSolver : public SparseGenColLinSolver
+{
+  public:
+    SparseGenColLUSolver();
+    ~SparseGenColLUSolver();
+
+    int solve(void);
+    int setSize(void);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
+
+  protected:
+    int factor(void);
+
+  private:
+    void freeStorage(void);
+    void substitute(double *x);    // x = inv(L*D*U) * x
+
+    int n, lnz;
+    int *parent, *Lp, *Lfill, *Li, *Rp, *Rj, *flag;
+    int *transA;          // location of A(j,i) for each entry A(i,j)
+    double *Lx, *Ux, *D;
+    double *Y, *Z;        // work arrays for column and row of A
+    int numPerturbed;     // number of pivots replaced in the last factor()
+
+    static const int maxRefineIter = 3;
+};
+
+#endif
+
@@ -0,0 +1,463 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+// Written: fmk
+//
+// Description: This file contains the implementation for SparseGenColLinSOE
+
+#include <stdlib.h>
+
+#include <SparseGenColLinSOE.h>
+#include <SparseGenColLinSolver.h>
+#include <Matrix.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <VertexIter.h>
+#include <math.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <algorithm>
+#include <iostream>
+using std::nothrow;
+
+SparseGenColLinSOE::SparseGenColLinSOE(SparseGenColLinSolver &theSolvr)
+:LinearSOE(theSolvr, LinSOE_TAGS_SparseGenColLinSOE),
+ size(0), nnz(0), A(0), B(0), X(0), rowA(0), colStartA(0),
+ vectX(0), vectB(0), Asize(0), Bsize(0), factored(false)
+{
+    theSolvr.setLinearSOE(*this);
+}
+
+SparseGenColLinSOE::SparseGenColLinSOE()
+:LinearSOE(LinSOE_TAGS_SparseGenColLinSOE),
+ size(0), nnz(0), A(0), B(0), X(0), rowA(0), colStartA(0),
+ vectX(0), vectB(0), Asize(0), Bsize(0), factored(false)
+{
+
+}
+
+SparseGenColLinSOE::SparseGenColLinSOE(int classTag)
+:LinearSOE(classTag),
+ size(0), nnz(0), A(0), B(0), X(0), rowA(0), colStartA(0),
+ vectX(0), vectB(0), Asize(0), Bsize(0), factored(false)
+{
+
+}
+
+int
+SparseGenColLinSOE::getNumEqn(void) const
+{
+    return size;
+}
+
+SparseGenColLinSOE::~SparseGenColLinSOE()
+{
+    if (A != 0) delete [] A;
+    if (B != 0) delete [] B;
+    if (X != 0) delete [] X;
+    if (rowA != 0) delete [] rowA;
+    if (colStartA != 0) delete [] colStartA;
+    if (vectX != 0) delete vectX;
+    if (vectB != 0) delete vectB;
+}
+
+
+int
+SparseGenColLinSOE::setSize(Graph &theGraph)
+{
+    int result = 0;
+    int oldSize = size;
+    size = theGraph.getNumVertex();
+
+    /*
+     * determine the number of non-zeros: each column holds the diagonal
+     * and one entry for every adjacent vertex
+     */
+
+    int newNNZ = 0;
+    Vertex *vertexPtr;
+    VertexIter &theVertices = theGraph.getVertices();
+    while ((vertexPtr = theVertices()) != 0)
+	newNNZ += 1 + vertexPtr->getAdjacency().Size();
+
+    nnz = newNNZ;
+
+    if (nnz > Asize) { // we have to get more space for A and rowA
+
+	if (A != 0)
+	    delete [] A;
+	if (rowA != 0)
+	    delete [] rowA;
+
+	A = new (nothrow) double[nnz];
+	rowA = new (nothrow) int[nnz];
+
+        if (A == 0 || rowA == 0) {
+            opserr << "WARNING SparseGenColLinSOE::setSize :";
+	    opserr << " ran out of memory for A and rowA with nnz = ";
+	    opserr << nnz << endln;
+	    size = 0; Asize = 0; nnz = 0;
+	    result =  -1;
+        }
+	else
+	    Asize = nnz;
+    }
+
+    if (size > Bsize || colStartA == 0) { // we have to get space for the vectors
+
+	// delete the old
+	if (B != 0) delete [] B;
+	if (X != 0) delete [] X;
+	if (colStartA != 0) delete [] colStartA;
+
+	// create the new
+	B = new (nothrow) double[size];
+	X = new (nothrow) double[size];
+	colStartA = new (nothrow) int[size+1];
+
+        if (B == 0 || X == 0 || colStartA == 0) {
+            opserr << "WARNING SparseGenColLinSOE::setSize :";
+	    opserr << " ran out of memory for vectors (size) (";
+	    opserr << size << ") \n";
+	    Bsize = 0; size = 0; nnz = 0;
+	    result = -1;
+        }
+	else
+	    Bsize = size;
+    }
+
+    if (result < 0)
+	return result;
+
+    /*
+     * fill in colStartA and rowA, the rows in each column being sorted
+     */
+
+    // first count the entries in each column
+    for (int i=0; i<=size; i++)
+	colStartA[i] = 0;
+
+    VertexIter &theVertices2 = theGraph.getVertices();
+    while ((vertexPtr = theVertices2()) != 0) {
+	int col = vertexPtr->getTag();
+	if (col < 0 || col >= size) {
+	    opserr << "WARNING SparseGenColLinSOE::setSize :";
+	    opserr << " vertex " << col << " outside range 0 to " << size-1 << endln;
+	    size = 0; nnz = 0;
+	    return -1;
+	}
+	colStartA[col+1] = 1 + vertexPtr->getAdjacency().Size();
+    }
+    for (int i=0; i<size; i++)
+	colStartA[i+1] += colStartA[i];
+
+    // now fill in the row numbers and sort them
+    VertexIter &theVertices3 = theGraph.getVertices();
+    while ((vertexPtr = theVertices3()) != 0) {
+	int col = vertexPtr->getTag();
+	const ID &theAdjacency = vertexPtr->getAdjacency();
+	int *rowPtr = &rowA[colStartA[col]];
+	rowPtr[0] = col;
+	for (int i=0; i<theAdjacency.Size(); i++)
+	    rowPtr[i+1] = theAdjacency(i);
+	std::sort(rowPtr, rowPtr + 1 + theAdjacency.Size());
+    }
+
+    // zero the matrix and vectors
+    for (int i=0; i<nnz; i++)
+	A[i] = 0;
+
+    factored = false;
+
+    for (int j=0; j<size; j++) {
+	B[j] = 0;
+	X[j] = 0;
+    }
+
+    // get new Vector objects if size has changes
+    if (oldSize != size) {
+	if (vectX != 0)
+	    delete vectX;
+
+	if (vectB != 0)
+	    delete vectB;
+
+	vectX = new Vector(X,size);
+	vectB = new Vector(B,size);
+    }
+
+    // invoke setSize() on the Solver; this is where the symbolic work is done
+    LinearSOESolver *theSolvr = this->getSolver();
+    int solverOK = theSolvr->setSize();
+    if (solverOK < 0) {
+	opserr << "WARNING:SparseGenColLinSOE::setSize :";
+	opserr << " solver failed setSize()\n";
+	return solverOK;
+    }
+
+    return result;
+}
+
+
+int
+SparseGenColLinSOE::findEntry(int row, int col) const
+{
+    // binary search for row in the sorted rows of col
+    int lo = colStartA[col];
+    int hi = colStartA[col+1] - 1;
+    while (lo <= hi) {
+	int mid = (lo + hi) / 2;
+	int midRow = rowA[mid];
+	if (midRow == row)
+	    return mid;
+	else if (midRow < row)
+	    lo = mid + 1;
+	else
+	    hi = mid - 1;
+    }
+    return -1;
+}
+
+
+int
+SparseGenColLinSOE::addA(const Matrix &m, const ID &id, double fact)
+{
+    // check for a quick return
+    if (fact == 0.0)  return 0;
+
+    // check that m and id are of similar size
+    int idSize = id.Size();
+    if (idSize != m.noRows() && idSize != m.noCols()) {
+	opserr << "SparseGenColLinSOE::addA()	- Matrix and ID not of similar sizes\n";
+	return -1;
+    }
+
+    for (int i=0; i<idSize; i++) {
+	int col = id(i);
+	if (col < size && col >= 0) {
+	    for (int j=0; j<idSize; j++) {
+		int row = id(j);
+		if (row < size && row >= 0) {
+		    int loc = this->findEntry(row, col);
+		    if (loc >= 0) {
+			if (fact == 1.0)
+			    A[loc] += m(j,i);
+			else
+			    A[loc] += m(j,i) * fact;
+		    }
+		}
+	    }  // for j
+	}
+    }  // for i
+
+    return 0;
+}
+
+
+int
+SparseGenColLinSOE::addColA(const Vector &colData, int col, double fact)
+{
+    if (fact == 0.0)  return 0;
+
+    if (colData.Size() != size) {
+	opserr << "SparseGenColLinSOE::addColA() - colData size not equal to n\n";
+	return -1;
+    }
+
+    if (col >= size || col < 0) {
+	opserr << "SparseGenColLinSOE::addColA() - col " << col << "outside range 0 to " << size << endln;
+	return -1;
+    }
+
+    // only the entries in the sparsity pattern can be added
+    for (int loc=colStartA[col]; loc<colStartA[col+1]; loc++)
+	A[loc] += colData(rowA[loc]) * fact;
+
+    return 0;
+}
+
+
+int
+SparseGenColLinSOE::addB(const Vector &v, const ID &id, double fact)
+{
+    // check for a quick return
+    if (fact == 0.0)  return 0;
+
+    // check that m and id are of similar size
+    int idSize = id.Size();
+    if (idSize != v.Size() ) {
+	opserr << "SparseGenColLinSOE::addB()	- Vector and ID not of similar sizes\n";
+	return -1;
+    }
+
+    if (fact == 1.0) { // do not need to multiply if fact == 1.0
+	for (int i=0; i<idSize; i++) {
+	    int pos = id(i);
+	    if (pos <size && pos >= 0)
+		B[pos] += v(i);
+	}
+    } else if (fact == -1.0) {
+	for (int i=0; i<idSize; i++) {
+	    int pos = id(i);
+	    if (pos <size && pos >= 0)
+		B[pos] -= v(i);
+	}
+    } else {
+	for (int i=0; i<idSize; i++) {
+	    int pos = id(i);
+	    if (pos <size && pos >= 0)
+		B[pos] += v(i) * fact;
+	}
+    }
+    return 0;
+}
+
+
+int
+SparseGenColLinSOE::setB(const Vector &v, double fact)
+{
+    // check for a quick return
+    if (fact == 0.0)  return 0;
+
+    if (v.Size() != size) {
+	opserr << "WARNING SparseGenColLinSOE::setB() -";
+	opserr << " incomptable sizes " << size << " and " << v.Size() << endln;
+	return -1;
+    }
+
+    if (fact == 1.0) { // do not need to multiply if fact == 1.0
+	for (int i=0; i<size; i++) {
+	    B[i] = v(i);
+	}
+    } else if (fact == -1.0) {
+	for (int i=0; i<size; i++) {
+	    B[i] = -v(i);
+	}
+    } else {
+	for (int i=0; i<size; i++) {
+	    B[i] = v(i) * fact;
+	}
+    }
+    return 0;
+}
+
+
+void
+SparseGenColLinSOE::zeroA(void)
+{
+    double *Aptr = A;
+    for (int i=0; i<nnz; i++)
+	*Aptr++ = 0;
+
+    factored = false;
+}
+
+void
+SparseGenColLinSOE::zeroB(void)
+{
+    double *Bptr = B;
+    for (int i=0; i<size; i++)
+	*Bptr++ = 0;
+}
+
+
+const Vector &
+SparseGenColLinSOE::getX(void)
+{
+    if (vectX == 0) {
+	opserr << "FATAL SparseGenColLinSOE::getX - vectX == 0!";
+	exit(-1);
+    }
+
+    return *vectX;
+}
+
+
+const Vector &
+SparseGenColLinSOE::getB(void)
+{
+    if (vectB == 0) {
+	opserr << "FATAL SparseGenColLinSOE::getB - vectB == 0!";
+	exit(-1);
+    }
+
+    return *vectB;
+}
+
+
+double
+SparseGenColLinSOE::normRHS(void)
+{
+    double norm =0.0;
+    double *Bptr = B;
+    for (int i=0; i<size; i++) {
+	double Yi = *Bptr++;
+	norm += Yi*Yi;
+    }
+    return sqrt(norm);
+}
+
+
+void
+SparseGenColLinSOE::setX(int loc, double value)
+{
+    if (loc < size && loc >= 0)
+	X[loc] = value;
+}
+
+void
+SparseGenColLinSOE::setX(const Vector &x)
+{
+    if (x.Size() == size && vectX != 0)
+      *vectX = x;
+}
+
+
+int
+SparseGenColLinSOE::setSparseGenColSolver(SparseGenColLinSolver &newSolver)
+{
+    newSolver.setLinearSOE(*this);
+
+    if (size != 0) {
+	int solverOK = newSolver.setSize();
+	if (solverOK < 0) {
+	    opserr << "WARNING:SparseGenColLinSOE::setSolver :";
+	    opserr << "the new solver could not setSeize() - staying with old\n";
+	    return solverOK;
+	}
+    }
+
+    return this->setSolver(newSolver);
+}
+
+
+int
+SparseGenColLinSOE::sendSelf(int commitTag, Channel &theChannel)
+{
+    return 0;
+}
+
+
+int
+SparseGenColLinSOE::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+    return 0;
+}
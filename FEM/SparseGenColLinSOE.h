@@ -0,0 +1,91 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+
+#ifndef SparseGenColLinSOE_h
+#define SparseGenColLinSOE_h
+
+// Written: fmk
+//
+// Description: This file contains the class definition for SparseGenColLinSOE
+// SparseGenColLinSOE is a subclass of LinearSOE. It stores the A matrix
+// in compressed column form (colStartA, rowA, A). The sparsity pattern is
+// obtained from the Graph in setSize() and includes both triangles, so that
+// the stored pattern is structurally symmetric, as is the case for the
+// matrices assembled by the finite element method.
+//
+// What: "@(#) SparseGenColLinSOE.h, revA"
+
+
+#include <LinearSOE.h>
+#include <Vector.h>
+
+class SparseGenColLinSolver;
+
+class SparseGenColLinSOE : public LinearSOE
+{
+  public:
+    SparseGenColLinSOE();
+    SparseGenColLinSOE(int classTag);
+    SparseGenColLinSOE(SparseGenColLinSolver &theSolver);
+
+    virtual ~SparseGenColLinSOE();
+
+    virtual int getNumEqn(void) const;
+    virtual int setSize(Graph &theGraph);
+
+    virtual int addA(const Matrix &, const ID &, double fact = 1.0);
+    virtual int addColA(const Vector &col, int colIndex, double fact = 1.0);
+    virtual int addB(const Vector &, const ID &, double fact = 1.0);
+    virtual int setB(const Vector &, double fact = 1.0);
+
+    virtual void zeroA(void);
+    virtual void zeroB(void);
+
+    virtual const Vector &getX(void);
+    virtual const Vector &getB(void);
+    virtual double normRHS(void);
+
+    virtual void setX(int loc, double value);
+    virtual void setX(const Vector &x);
+
+    virtual int setSparseGenColSolver(SparseGenColLinSolver &newSolver);
+
+    virtual int sendSelf(int commitTag, Channel &theChannel);
+    virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+    friend class SparseGenColLUSolver;
+
+  protected:
+    int findEntry(int row, int col) const;
+
+    int size, nnz;
+    double *A, *B, *X;
+    int *rowA, *colStartA;
+    Vector *vectX;
+    Vector *vectB;
+    int Asize, Bsize;
+    bool factored;
+
+  private:
+};
+
+
+#endif
+
@@ -0,0 +1,365 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/recorder/SpectrumRecorder.cpp
+//
+// Written: fmk
+//
+// Description: This file contains the implementation of SpectrumRecorder.
+//
+// What: "@(#) SpectrumRecorder.cpp, revA"
+
+#include <SpectrumRecorder.h>
+#include <Domain.h>
+#include <Node.h>
+#include <TimeSeries.h>
+#include <OPS_Stream.h>
+#include <classTags.h>
+
+#include <math.h>
+
+SpectrumRecorder::SpectrumRecorder()
+:Recorder(RECORDER_TAGS_SpectrumRecorder),
+ numNodes(0), dof(0), damping(0.05),
+ theDomain(0), theSpectrumHandler(0), theFourierHandler(0), groundAccel(0),
+ lastTime(0.0), lastDt(0.0), numSteps(0), initializationDone(false)
+{
+  nodeTags[0] = nodeTags[1] = -1;
+  theNodes[0] = theNodes[1] = 0;
+  lastAccel[0] = lastAccel[1] = 0.0;
+}
+
+SpectrumRecorder::SpectrumRecorder(int nodeTag,
+				   int theDof,
+				   const Vector &thePeriods,
+				   const Vector &theFrequencies,
+				   Domain &theDom,
+				   OPS_Stream *spectrumHandler,
+				   OPS_Stream *fourierHandler,
+				   double xi,
+				   int refNodeTag,
+				   TimeSeries *theSeries)
+:Recorder(RECORDER_TAGS_SpectrumRecorder),
+ numNodes(1), dof(theDof), damping(xi),
+ theDomain(&theDom), theSpectrumHandler(spectrumHandler), theFourierHandler(fourierHandler),
+ groundAccel(theSeries), periods(thePeriods), frequencies(theFrequencies),
+ lastTime(0.0), lastDt(0.0), numSteps(0), initializationDone(false)
+{
+  nodeTags[0] = nodeTag;
+  nodeTags[1] = refNodeTag;
+  if (refNodeTag >= 0)
+    numNodes = 2;
+  theNodes[0] = theNodes[1] = 0;
+  lastAccel[0] = lastAccel[1] = 0.0;
+
+  if (damping <= 0.0 || damping >= 1.0) {
+    opserr << "WARNING SpectrumRecorder::SpectrumRecorder - damping " << damping;
+    opserr << " not in (0,1), using 0.05\n";
+    damping = 0.05;
+  }
+
+  int numPeriods = periods.Size();
+  for (int i=0; i<numPeriods; i++)
+    if (periods(i) <= 0.0) {
+      opserr << "WARNING SpectrumRecorder::SpectrumRecorder - invalid period " << periods(i) << endln;
+      periods(i) = 1.0;
+    }
+}
+
+SpectrumRecorder::~SpectrumRecorder()
+{
+  this->writeSpectra();
+
+  if (theSpectrumHandler != 0)
+    delete theSpectrumHandler;
+  if (theFourierHandler != 0)
+    delete theFourierHandler;
+  if (groundAccel != 0)
+    delete groundAccel;
+}
+
+int 
+SpectrumRecorder::record(int commitTag, double timeStamp)
+{
+  if (theDomain == 0)
+    return 0;
+
+  if (initializationDone == false) {
+    if (this->initialize() != 0) {
+      opserr << "SpectrumRecorder::record() - failed in initialize()\n";
+      return -1;
+    }
+  }
+
+  // absolute acceleration of the nodes
+  double accel[2];
+  double ground = 0.0;
+  if (groundAccel != 0)
+    ground = groundAccel->getFactor(timeStamp);
+  for (int k=0; k<numNodes; k++) {
+    const Vector &theAccel = theNodes[k]->getTrialAccel();
+    accel[k] = ground;
+    if (theAccel.Size() > dof)
+      accel[k] += theAccel(dof);
+  }
+
+  int numPeriods = periods.Size();
+  int numFrequencies = frequencies.Size();
+  double pi = 4.0*atan(1.0);
+
+  if (numSteps == 0) {
+    for (int j=0; j<numFrequencies; j++) {
+      double w = 2.0*pi*frequencies(j);
+      phaseCos(j) = cos(w*timeStamp);
+      phaseSin(j) = -sin(w*timeStamp);
+    }
+    lastTime = timeStamp;
+    lastDt = 0.0;
+    for (int k=0; k<numNodes; k++)
+      lastAccel[k] = accel[k];
+    numSteps = 1;
+    return 0;
+  }
+
+  double dt = timeStamp - lastTime;
+  if (dt <= 0.0)
+    return 0;
+
+  // keep the old exp(-i w t) for the trapezoidal rule
+  oldCos = phaseCos;
+  oldSin = phaseSin;
+
+  if (fabs(dt - lastDt) > 1.0e-10 * dt)
+    this->setTimeStep(dt, timeStamp);
+  else {
+    for (int j=0; j<numFrequencies; j++) {
+      double c = phaseCos(j)*rotCos(j) - phaseSin(j)*rotSin(j);
+      double s = phaseSin(j)*rotCos(j) + phaseCos(j)*rotSin(j);
+      phaseCos(j) = c;
+      phaseSin(j) = s;
+    }
+  }
+
+  for (int k=0; k<numNodes; k++) {
+    double a0 = lastAccel[k];
+    double a1 = accel[k];
+
+    for (int i=0; i<numPeriods; i++) {
+      int loc = k*numPeriods + i;
+      double u0 = u(loc);
+      double v0 = v(loc);
+      u(loc) = coefA(i)*u0 + coefB(i)*v0 - coefC(i)*a0 - coefD(i)*a1;
+      v(loc) = coefAv(i)*u0 + coefBv(i)*v0 - coefCv(i)*a0 - coefDv(i)*a1;
+      if (fabs(u(loc)) > maxU(loc))
+	maxU(loc) = fabs(u(loc));
+    }
+
+    for (int j=0; j<numFrequencies; j++) {
+      int loc = k*numFrequencies + j;
+      fourierRe(loc) += 0.5 * dt * (a0*oldCos(j) + a1*phaseCos(j));
+      fourierIm(loc) += 0.5 * dt * (a0*oldSin(j) + a1*phaseSin(j));
+    }
+
+    lastAccel[k] = a1;
+  }
+
+  lastTime = timeStamp;
+  numSteps++;
+
+  return 0;
+}
+
+// the coefficients of the exact solution over a step dt for a linearly
+// varying base acceleration (Chopra, Dynamics of Structures, Table 5.2.1),
+// and exp(-i w t) at timeStamp
+void
+SpectrumRecorder::setTimeStep(double dt, double timeStamp)
+{
+  double pi = 4.0*atan(1.0);
+  double xi = damping;
+  double sq = sqrt(1.0 - xi*xi);
+
+  int numPeriods = periods.Size();
+  for (int i=0; i<numPeriods; i++) {
+    double w = 2.0*pi/periods(i);
+    double k = w*w;
+    double wD = w*sq;
+    double e = exp(-xi*w*dt);
+    double s = sin(wD*dt);
+    double c = cos(wD*dt);
+
+    coefA(i) = e*(xi/sq*s + c);
+    coefB(i) = e*s/wD;
+    coefC(i) = (2.0*xi/(w*dt) + e*(((1.0 - 2.0*xi*xi)/(wD*dt) - xi/sq)*s - (1.0 + 2.0*xi/(w*dt))*c))/k;
+    coefD(i) = (1.0 - 2.0*xi/(w*dt) + e*((2.0*xi*xi - 1.0)/(wD*dt)*s + 2.0*xi/(w*dt)*c))/k;
+
+    coefAv(i) = -e*w/sq*s;
+    coefBv(i) = e*(c - xi/sq*s);
+    coefCv(i) = (-1.0/dt + e*((w/sq + xi/(dt*sq))*s + c/dt))/k;
+    coefDv(i) = (1.0 - e*(xi/sq*s + c))/(k*dt);
+  }
+
+  int numFrequencies = frequencies.Size();
+  for (int j=0; j<numFrequencies; j++) {
+    double w = 2.0*pi*frequencies(j);
+    rotCos(j) = cos(w*dt);
+    rotSin(j) = -sin(w*dt);
+    phaseCos(j) = cos(w*timeStamp);
+    phaseSin(j) = -sin(w*timeStamp);
+  }
+
+  lastDt = dt;
+}
+
+int
+SpectrumRecorder::restart(void)
+{
+  u.Zero();
+  v.Zero();
+  maxU.Zero();
+  fourierRe.Zero();
+  fourierIm.Zero();
+  numSteps = 0;
+  lastDt = 0.0;
+
+  return 0;
+}
+
+int
+SpectrumRecorder::writeSpectra(void)
+{
+  if (initializationDone == false)
+    return 0;
+
+  double pi = 4.0*atan(1.0);
+
+  if (theSpectrumHandler != 0) {
+    theSpectrumHandler->tag("ResponseType", "period");
+    for (int k=0; k<numNodes; k++) {
+      theSpectrumHandler->tag("NodeOutput");
+      theSpectrumHandler->attr("nodeTag", nodeTags[k]);
+      theSpectrumHandler->tag("ResponseType", "PSA");
+      theSpectrumHandler->endTag();
+    }
+    if (numNodes == 2)
+      theSpectrumHandler->tag("ResponseType", "ratio");
+
+    int numPeriods = periods.Size();
+    Vector row(numNodes == 2 ? 4 : 2);
+    for (int i=0; i<numPeriods; i++) {
+      double w = 2.0*pi/periods(i);
+      row(0) = periods(i);
+      for (int k=0; k<numNodes; k++)
+	row(k+1) = w*w*maxU(k*numPeriods + i);
+      if (numNodes == 2)
+	row(3) = (row(2) != 0.0) ? row(1)/row(2) : 0.0;
+      theSpectrumHandler->write(row);
+    }
+    theSpectrumHandler->flush();
+  }
+
+  if (theFourierHandler != 0) {
+    theFourierHandler->tag("ResponseType", "frequency");
+    for (int k=0; k<numNodes; k++) {
+      theFourierHandler->tag("NodeOutput");
+      theFourierHandler->attr("nodeTag", nodeTags[k]);
+      theFourierHandler->tag("ResponseType", "FAS");
+      theFourierHandler->endTag();
+    }
+    if (numNodes == 2)
+      theFourierHandler->tag("ResponseType", "ratio");
+
+    int numFrequencies = frequencies.Size();
+    Vector row(numNodes == 2 ? 4 : 2);
+    for (int j=0; j<numFrequencies; j++) {
+      row(0) = frequencies(j);
+      for (int k=0; k<numNodes; k++) {
+	int loc = k*numFrequencies + j;
+	row(k+1) = sqrt(fourierRe(loc)*fourierRe(loc) + fourierIm(loc)*fourierIm(loc));
+      }
+      if (numNodes == 2)
+	row(3) = (row(2) != 0.0) ? row(1)/row(2) : 0.0;
+      theFourierHandler->write(row);
+    }
+    theFourierHandler->flush();
+  }
+
+  return 0;
+}
+
+int
+SpectrumRecorder::domainChanged(void)
+{
+  return 0;
+}
+
+int
+SpectrumRecorder::setDomain(Domain &theDom)
+{
+  theDomain = &theDom;
+  initializationDone = false;
+  return 0;
+}
+
+int
+SpectrumRecorder::sendSelf(int commitTag, Channel &theChannel)
+{
+  return 0;
+}
+
+int
+SpectrumRecorder::recvSelf(int commitTag, Channel &theChannel, 
+			   FEM_ObjectBroker &theBroker)
+{
+  return 0;
+}
+
+int
+SpectrumRecorder::initialize(void)
+{
+  for (int k=0; k<numNodes; k++) {
+    theNodes[k] = theDomain->getNode(nodeTags[k]);
+    if (theNodes[k] == 0) {
+      opserr << "WARNING SpectrumRecorder::initialize() - no node " << nodeTags[k] << endln;
+      return -1;
+    }
+  }
+
+  int numPeriods = periods.Size();
+  int numFrequencies = frequencies.Size();
+
+  coefA.resize(numPeriods); coefB.resize(numPeriods);
+  coefC.resize(numPeriods); coefD.resize(numPeriods);
+  coefAv.resize(numPeriods); coefBv.resize(numPeriods);
+  coefCv.resize(numPeriods); coefDv.resize(numPeriods);
+  u.resize(numNodes*numPeriods);
+  v.resize(numNodes*numPeriods);
+  maxU.resize(numNodes*numPeriods);
+
+  phaseCos.resize(numFrequencies); phaseSin.resize(numFrequencies);
+  oldCos.resize(numFrequencies); oldSin.resize(numFrequencies);
+  rotCos.resize(numFrequencies); rotSin.resize(numFrequencies);
+  fourierRe.resize(numNodes*numFrequencies);
+  fourierIm.resize(numNodes*numFrequencies);
+
+  initializationDone = true;
+
+  return this->restart();
+}
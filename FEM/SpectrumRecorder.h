@@ -0,0 +1,116 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/recorder/SpectrumRecorder.h
+//
+// Written: fmk
+//
+// Description: This file contains the class definition for
+// SpectrumRecorder. A SpectrumRecorder computes the pseudo-acceleration
+// response spectrum and the Fourier amplitude spectrum of the acceleration
+// of one dof of a node while the analysis runs. At every commit the linear
+// SDOF oscillators, one per period, are advanced with the exact solution
+// for a linearly varying base acceleration (Nigam & Jennings) and the
+// Fourier transform at the requested frequencies is accumulated with the
+// trapezoidal rule, so the time step may change during the analysis.
+// Only the final spectra are written, when the recorder is destroyed.
+// If a reference node is given, its spectra and the ratio of the two
+// (e.g. surface/base) are written as well.
+//
+// What: "@(#) SpectrumRecorder.h, revA"
+
+#ifndef SpectrumRecorder_h
+#define SpectrumRecorder_h
+
+#include <Recorder.h>
+#include <Vector.h>
+
+class Domain;
+class Node;
+class TimeSeries;
+
+class SpectrumRecorder: public Recorder
+{
+  public:
+    SpectrumRecorder();
+    SpectrumRecorder(int nodeTag,
+		     int dof,
+		     const Vector &periods,
+		     const Vector &frequencies,
+		     Domain &theDomain,
+		     OPS_Stream *theSpectrumHandler,
+		     OPS_Stream *theFourierHandler,
+		     double damping = 0.05,
+		     int refNodeTag = -1,
+		     TimeSeries *groundAccel = 0);
+
+    ~SpectrumRecorder();
+
+    int record(int commitTag, double timeStamp);
+    int restart(void);
+
+    int domainChanged(void);
+    int setDomain(Domain &theDomain);
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
+
+  protected:
+
+  private:
+    int initialize(void);
+    void setTimeStep(double dt, double timeStamp);
+    int writeSpectra(void);
+
+    int nodeTags[2];
+    Node *theNodes[2];
+    int numNodes;
+    int dof;
+    double damping;
+
+    Domain *theDomain;
+    OPS_Stream *theSpectrumHandler;
+    OPS_Stream *theFourierHandler;
+    TimeSeries *groundAccel;
+
+    Vector periods;
+    Vector frequencies;
+
+    // oscillator state, numNodes*numPeriods
+    Vector u, v, maxU;
+    // u(n+1) = a u + b v - c acc(n) - d acc(n+1), v(n+1) likewise
+    Vector coefA, coefB, coefC, coefD;
+    Vector coefAv, coefBv, coefCv, coefDv;
+
+    // Fourier transform, numNodes*numFrequencies, and exp(-i w t)
+    Vector fourierRe, fourierIm;
+    Vector phaseCos, phaseSin;
+    Vector oldCos, oldSin;
+    Vector rotCos, rotSin;
+
+    double lastAccel[2];
+    double lastTime;
+    double lastDt;
+    int numSteps;
+
+    bool initializationDone;
+};
+
+#endif
@@ -0,0 +1,173 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/analysis/analysis/SubSteppingDirectIntegrationAnalysis.cpp
+//
+// Written: fmk
+//
+// Description: This file contains the implementation of the
+// SubSteppingDirectIntegrationAnalysis class.
+//
+// What: "@(#) SubSteppingDirectIntegrationAnalysis.cpp, revA"
+
+#include <SubSteppingDirectIntegrationAnalysis.h>
+#include <ConvergenceTest.h>
+#include <Domain.h>
+#include <OPS_Stream.h>
+#include <math.h>
+
+// Constructor
+SubSteppingDirectIntegrationAnalysis::SubSteppingDirectIntegrationAnalysis(
+			      Domain &the_Domain,
+			      ConstraintHandler &theHandler,
+			      DOF_Numberer &theNumberer,
+			      AnalysisModel &theModel,
+			      EquiSolnAlgo &theSolnAlgo,
+			      LinearSOE &theLinSOE,
+			      TransientIntegrator &theTransientIntegrator,
+			      ConvergenceTest *theTest,
+			      int maxBisect, int easyI, int numEasy)
+
+:DirectIntegrationAnalysis(the_Domain, theHandler, theNumberer, theModel,
+			   theSolnAlgo, theLinSOE, theTransientIntegrator, theTest),
+ maxBisections(maxBisect), easyIter(easyI), numEasySteps(numEasy),
+ level(0), easyCount(0)
+{
+    // the sub-steps are counted in units of dT/2^maxBisections
+    if (maxBisections < 0)
+	maxBisections = 0;
+    else if (maxBisections > 30)
+	maxBisections = 30;
+
+    if (numEasySteps < 1)
+	numEasySteps = 1;
+
+    this->resetStatistics();
+}
+
+SubSteppingDirectIntegrationAnalysis::~SubSteppingDirectIntegrationAnalysis()
+{
+
+}
+
+int
+SubSteppingDirectIntegrationAnalysis::analyze(int numStepsToDo, double dT)
+{
+    Domain *theDom = this->getDomainPtr();
+
+    int numUnits = 1 << maxBisections;
+
+    for (int i=0; i<numStepsToDo; i++) {
+
+	double endTime = theDom->getCurrentTime() + dT;
+	int unitsDone = 0;
+
+	while (unitsDone < numUnits) {
+
+	    int stepUnits = 1 << (maxBisections - level);
+	    if (stepUnits > numUnits - unitsDone)
+		stepUnits = numUnits - unitsDone;
+
+	    // the last of several sub-steps ends at the end of the step, unless
+	    // it only differs from the others by round-off: a changed dt makes
+	    // the algorithm drop its tangent
+	    double subDt;
+	    if (stepUnits == numUnits)
+		subDt = dT;
+	    else {
+		subDt = dT * stepUnits / numUnits;
+		if (unitsDone + stepUnits == numUnits) {
+		    double lastDt = endTime - theDom->getCurrentTime();
+		    if (fabs(lastDt - subDt) > 1.0e-10 * subDt)
+			subDt = lastDt;
+		}
+	    }
+
+	    int result = this->DirectIntegrationAnalysis::analyze(1, subDt);
+
+	    if (result < 0) {
+		// DirectIntegrationAnalysis has reverted to the last commit
+		numFailedSubSteps++;
+		easyCount = 0;
+
+		if (level == maxBisections) {
+		    opserr << "SubSteppingDirectIntegrationAnalysis::analyze() - failed at time ";
+		    opserr << theDom->getCurrentTime() << " with dt = " << subDt << endln;
+		    return result;
+		}
+
+		level++;
+		if (level > maxLevel)
+		    maxLevel = level;
+
+		opserr << "SubSteppingDirectIntegrationAnalysis::analyze() - try dt = ";
+		opserr << dT / (1 << level) << " at time " << theDom->getCurrentTime() << endln;
+		continue;
+	    }
+
+	    unitsDone += stepUnits;
+	    numSubSteps++;
+	    if (subDt < minSubStep)
+		minSubStep = subDt;
+
+	    // double the sub-step again after some easy sub-steps
+	    if (level > 0) {
+		ConvergenceTest *theTest = this->getConvergenceTest();
+		if (theTest == 0 || theTest->getNumTests() <= easyIter)
+		    easyCount++;
+		else
+		    easyCount = 0;
+
+		if (easyCount >= numEasySteps) {
+		    level--;
+		    easyCount = 0;
+		}
+	    }
+	}
+
+	numSteps++;
+    }
+
+    return 0;
+}
+
+
+void
+SubSteppingDirectIntegrationAnalysis::resetStatistics(void)
+{
+    numSteps = 0;
+    numSubSteps = 0;
+    numFailedSubSteps = 0;
+    maxLevel = level;
+    minSubStep = 1.0e100;
+}
+
+
+void
+SubSteppingDirectIntegrationAnalysis::printStatistics(OPS_Stream &s)
+{
+    s << "SubSteppingDirectIntegrationAnalysis: " << numSteps << " steps, ";
+    s << numSubSteps << " converged and " << numFailedSubSteps << " failed sub-steps";
+    if (numFailedSubSteps > 0) {
+	s << ", max bisections " << maxLevel;
+	s << ", smallest dt " << minSubStep;
+    }
+    s << endln;
+}
@@ -0,0 +1,88 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/analysis/analysis/SubSteppingDirectIntegrationAnalysis.h
+//
+// Written: fmk
+//
+// Description: This file contains the class definition for
+// SubSteppingDirectIntegrationAnalysis. SubSteppingDirectIntegrationAnalysis
+// is a subclass of DirectIntegrationAnalysis which performs each of the
+// numSteps steps of size dT in analyze() in sub-steps. A sub-step that fails
+// is bisected, up to maxBisections times. The sub-step is doubled again
+// after numEasySteps consecutive sub-steps which have converged within
+// easyIter iterations, but is never larger than dT. The sub-steps always end
+// exactly at the end of the step of size dT, so that recorders using a
+// multiple of dT see the same time stamps as without sub-stepping.
+//
+// What: "@(#) SubSteppingDirectIntegrationAnalysis.h, revA"
+
+#ifndef SubSteppingDirectIntegrationAnalysis_h
+#define SubSteppingDirectIntegrationAnalysis_h
+
+#include <DirectIntegrationAnalysis.h>
+
+class OPS_Stream;
+
+class SubSteppingDirectIntegrationAnalysis: public DirectIntegrationAnalysis
+{
+  public:
+    SubSteppingDirectIntegrationAnalysis(Domain &theDomain,
+					 ConstraintHandler &theHandler,
+					 DOF_Numberer &theNumberer,
+					 AnalysisModel &theModel,
+					 EquiSolnAlgo &theSolnAlgo,
+					 LinearSOE &theSOE,
+					 TransientIntegrator &theIntegrator,
+					 ConvergenceTest *theTest = 0,
+					 int maxBisections = 10,
+					 int easyIter = 4,
+					 int numEasySteps = 2);
+    virtual ~SubSteppingDirectIntegrationAnalysis();
+
+    int analyze(int numSteps, double dT);
+
+    // retry statistics since construction or the last resetStatistics()
+    int getNumSteps(void) const {return numSteps;};
+    int getNumSubSteps(void) const {return numSubSteps;};
+    int getNumFailedSubSteps(void) const {return numFailedSubSteps;};
+    int getMaxLevel(void) const {return maxLevel;};
+    double getMinSubStep(void) const {return minSubStep;};
+    void resetStatistics(void);
+    void printStatistics(OPS_Stream &s);
+
+  protected:
+
+  private:
+    int maxBisections;
+    int easyIter;
+    int numEasySteps;
+
+    int level;        // current number of bisections of dT
+    int easyCount;    // consecutive easy sub-steps at this level
+
+    int numSteps;
+    int numSubSteps;
+    int numFailedSubSteps;
+    int maxLevel;
+    double minSubStep;
+};
+
+#endif
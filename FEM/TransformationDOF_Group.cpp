@@ -45,19 +45,12 @@
 #include <SP_ConstraintIter.h>
 #include <TransformationConstraintHandler.h>
 
-#define MAX_NUM_DOF 16
-
-// static variables initialisation
-Matrix **TransformationDOF_Group::modMatrices; 
-Vector **TransformationDOF_Group::modVectors;  
-int TransformationDOF_Group::numTransDOFs(0);     // number of objects
-TransformationConstraintHandler *TransformationDOF_Group::theHandler = 0;     // number of objects
 
 TransformationDOF_Group::TransformationDOF_Group(int tag, Node *node, 
 						 MP_Constraint *mp,
 						 TransformationConstraintHandler *theTHandler)  
 :DOF_Group(tag,node),
- theMP(mp),Trans(0),modTangent(0),modUnbalance(0),modID(0),theSPs(0)
+ theMP(mp),Trans(0),modTangent(0),modUnbalance(0),modID(0),theSPs(0),theHandler(theTHandler)
 {
     // determine the number of DOF 
     int numNodalDOF = node->getNumberDOF();
@@ -119,59 +112,17 @@ TransformationDOF_Group::TransformationDOF_Group(int tag, Node *node,
     for (int k=numConstrainedNodeRetainedDOF; k<modNumDOF; k++)
 	(*modID)(k) = -1;
     
-    // if this is the first TransformationDOF_Group we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return modTangent and residual
-    if (numTransDOFs == 0) {
-	modMatrices = new Matrix *[MAX_NUM_DOF+1];
-	modVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	if (modMatrices == 0 || modVectors == 0) {
-	    opserr << "TransformationDOF_Group::TransformationDOF_Group(Node *) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    modMatrices[i] = 0;
-	    modVectors[i] = 0;
-	}
-    }    
-
-    // set the pointers for the modTangent and residual
-    if (modNumDOF <= MAX_NUM_DOF) {
-	// use class wide objects
-	if (modVectors[modNumDOF] == 0) {
-	    // have to create matrix and vector of size as none yet created
-	    modVectors[modNumDOF] = new Vector(modNumDOF);
-	    modMatrices[modNumDOF] = new Matrix(modNumDOF,modNumDOF);
-	    modUnbalance = modVectors[modNumDOF];
-	    modTangent = modMatrices[modNumDOF];
-	    if (modUnbalance == 0 || modUnbalance->Size() != modNumDOF ||	
-		modTangent == 0 || modTangent->noCols() != modNumDOF)	{  
-		opserr << "TransformationDOF_Group::TransformationDOF_Group(Node *) ";
-		opserr << " ran out of memory for vector/Matrix of size :";
-		opserr << modNumDOF << endln;
-		exit(-1);
-	    }
-	} else {
-	    modUnbalance = modVectors[modNumDOF];
-	    modTangent = modMatrices[modNumDOF];
-	}
-    } else {
-	// create matrices and vectors for each object instance
-	modUnbalance = new Vector(modNumDOF);
-	modTangent = new Matrix(modNumDOF, modNumDOF);
-	if (modUnbalance == 0 || modTangent ==0 ||
-	    modTangent ==0 || modTangent->noRows() ==0) {
-	    
-	    opserr << "TransformationDOF_Group::TransformationDOF_Group(Node *) ";
-	    opserr << " ran out of memory for vector/Matrix of size :";
-	    opserr << modNumDOF << endln;
-	    exit(-1);
-	}
+    // create the modTangent and residual, a copy for each object so
+    // that the DOF_Groups can be used by more than one thread at a time
+    modUnbalance = new Vector(modNumDOF);
+    modTangent = new Matrix(modNumDOF, modNumDOF);
+    if (modUnbalance == 0 || modUnbalance->Size() != modNumDOF ||	
+	modTangent == 0 || modTangent->noCols() != modNumDOF)	{  
+	opserr << "TransformationDOF_Group::TransformationDOF_Group(Node *) ";
+	opserr << " ran out of memory for vector/Matrix of size :";
+	opserr << modNumDOF << endln;
+	exit(-1);
     }
-    
-    numTransDOFs++;
-    theHandler = theTHandler;
 }
 
 void 
@@ -189,7 +140,7 @@ TransformationDOF_Group::TransformationDOF_Group(int tag,
 						 Node *node, 
 						 TransformationConstraintHandler *theTHandler)
 :DOF_Group(tag,node),
- theMP(0),Trans(0),modTangent(0),modUnbalance(0),modID(0),theSPs(0) 
+ theMP(0),Trans(0),modTangent(0),modUnbalance(0),modID(0),theSPs(0),theHandler(theTHandler) 
 {
     modNumDOF = node->getNumberDOF();
     // create space for the SP_Constraint array
@@ -209,25 +160,6 @@ TransformationDOF_Group::TransformationDOF_Group(int tag,
 	}
     }    
     
-    // if this is the first TransformationDOF_Group we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return modTangent and residual
-    if (numTransDOFs == 0) {
-	modMatrices = new Matrix *[MAX_NUM_DOF+1];
-	modVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	if (modMatrices == 0 || modVectors == 0) {
-	    opserr << "TransformationDOF_Group::TransformationDOF_Group(Node *) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    modMatrices[i] = 0;
-	    modVectors[i] = 0;
-	}
-    }    
-
-    numTransDOFs++;
-    theHandler = theTHandler;
 }
 
 
@@ -236,30 +168,11 @@ TransformationDOF_Group::TransformationDOF_Group(int tag,
 
 TransformationDOF_Group::~TransformationDOF_Group()
 {
-    numTransDOFs--;
-
-    // delete modTangent and residual if created specially
-    if (modNumDOF > MAX_NUM_DOF) {
-	if (modTangent != 0) delete modTangent;
-	if (modUnbalance != 0) delete modUnbalance;
-    }
-    
+    if (modTangent != 0) delete modTangent;
+    if (modUnbalance != 0) delete modUnbalance;
     if (modID != 0) delete modID;
     if (Trans != 0) delete Trans;
     if (theSPs != 0) delete [] theSPs;
-
-    // if this is the last FE_Element, clean up the
-    // storage for the matrix and vector objects
-    if (numTransDOFs == 0) {
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    if (modVectors[i] != 0)
-		delete modVectors[i];
-	    if (modMatrices[i] != 0)
-		delete modMatrices[i];
-	}	
-	delete [] modMatrices;
-	delete [] modVectors;
-    }    
 }    
 
 
@@ -790,39 +703,20 @@ TransformationDOF_Group::doneID(void)
 	}
     }
 	
-    // set the pointers for the tangent and residual
-    if (modNumDOF <= MAX_NUM_DOF) {
-	// use class wide objects
-	if (modVectors[modNumDOF] == 0) {
-	    // have to create matrix and vector of size as none yet created
-	    modVectors[modNumDOF] = new Vector(modNumDOF);
-	    modMatrices[modNumDOF] = new Matrix(modNumDOF,modNumDOF);
-	    modUnbalance = modVectors[modNumDOF];
-	    modTangent = modMatrices[modNumDOF];
-	    if (modUnbalance == 0 || modUnbalance->Size() != modNumDOF ||	
-		modTangent == 0 || modTangent->noCols() != modNumDOF)	{  
-		opserr << "DOF_Group::DOF_Group(Node *) ";
-		opserr << " ran out of memory for vector/Matrix of size :";
-		opserr << modNumDOF << endln;
-		exit(-1);
-	    }
-	} else {
-	    modUnbalance = modVectors[modNumDOF];
-	    modTangent = modMatrices[modNumDOF];
-	}
-    } else {
-	// create matrices and vectors for each object instance
+    // create the tangent and residual if not yet of the right size
+    if (modUnbalance == 0 || modUnbalance->Size() != modNumDOF) {
+	if (modUnbalance != 0) delete modUnbalance;
+	if (modTangent != 0) delete modTangent;
 	modUnbalance = new Vector(modNumDOF);
 	modTangent = new Matrix(modNumDOF, modNumDOF);
-	if (modUnbalance == 0 || modUnbalance->Size() ==0 ||
-	    modTangent ==0 || modTangent->noRows() ==0) {
-	    
-	    opserr << "DOF_Group::DOF_Group(Node *) ";
+	if (modUnbalance == 0 || modUnbalance->Size() != modNumDOF ||	
+	    modTangent == 0 || modTangent->noCols() != modNumDOF)	{  
+	    opserr << "TransformationDOF_Group::doneID() ";
 	    opserr << " ran out of memory for vector/Matrix of size :";
 	    opserr << modNumDOF << endln;
 	    exit(-1);
 	}
-    }    
+    }
 
     if (modID != 0) {
       for (int i=numConstrainedNodeRetainedDOF; i<modNumDOF; i++)
@@ -118,12 +118,7 @@ class TransformationDOF_Group: public DOF_Group
     int numConstrainedNodeRetainedDOF; 
     int needRetainedData;
     SP_Constraint **theSPs;
-    
-    // static variables - single copy for all objects of the class	    
-    static Matrix **modMatrices; // array of pointers to class wide matrices
-    static Vector **modVectors;  // array of pointers to class widde vectors
-    static int numTransDOFs;           // number of objects        
-    static TransformationConstraintHandler *theHandler;
+    TransformationConstraintHandler *theHandler;
 };
 
 #endif
@@ -45,16 +45,16 @@
 #define MAX_NUM_DOF 64
 
 // static variables initialisation
-Matrix **TransformationFE::modMatrices; 
-Vector **TransformationFE::modVectors;  
-Matrix **TransformationFE::theTransformations; 
-int TransformationFE::numTransFE(0);           
-int TransformationFE::transCounter(0);           
-int TransformationFE::sizeTransformations(0);          
-double *TransformationFE::dataBuffer = 0;          
-double *TransformationFE::localKbuffer = 0;          
-int    *TransformationFE::dofData = 0;    ;          
-int TransformationFE::sizeBuffer(0);            
+thread_local Matrix **TransformationFE::modMatrices; 
+thread_local Vector **TransformationFE::modVectors;  
+thread_local Matrix **TransformationFE::theTransformations; 
+thread_local int TransformationFE::numTransFE(0);           
+thread_local int TransformationFE::transCounter(0);           
+thread_local int TransformationFE::sizeTransformations(0);          
+thread_local double *TransformationFE::dataBuffer = 0;          
+thread_local double *TransformationFE::localKbuffer = 0;          
+thread_local int    *TransformationFE::dofData = 0;    ;          
+thread_local int TransformationFE::sizeBuffer(0);            
 
 //  TransformationFE(Element *, Integrator *theIntegrator);
 //	construictor that take the corresponding model element.
@@ -293,7 +293,7 @@ TransformationFE::getTangent(Integrator *theNewIntegrator)
 {
     const Matrix &theTangent = this->FE_Element::getTangent(theNewIntegrator);
 
-    static ID numDOFs(dofData, 1);
+    static thread_local ID numDOFs(dofData, 1);
     numDOFs.setData(dofData, numGroups);
     
     // DO THE SP STUFF TO THE TANGENT 
@@ -317,7 +317,7 @@ TransformationFE::getTangent(Integrator *theNewIntegrator)
     int noRowsTransformed = 0;
     int noRowsOriginal = 0;
 
-    static Matrix localK;
+    static thread_local Matrix localK;
 
     // foreach block row, for each block col do
     for (int i=0; i<numNode; i++) {
@@ -342,7 +342,7 @@ TransformationFE::getTangent(Integrator *theNewIntegrator)
 	    // now perform the matrix computation T(i)^T localK T(j)
 	    // note: if T == 0 then the Identity is assumed
 	    int noColsTransformed = 0;
-	    static Matrix localTtKT;
+	    static thread_local Matrix localTtKT;
 	    
 	    if (Ti != 0 && Tj != 0) {
 		noRowsTransformed = Ti->noCols();
@@ -459,7 +459,7 @@ TransformationFE::getK_Force(const Vector &accel, double fact)
   this->FE_Element::addKtToTang();    
   const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-  static ID numDOFs(dofData, 1);
+  static thread_local ID numDOFs(dofData, 1);
   numDOFs.setData(dofData, numGroups);
     
   // DO THE SP STUFF TO THE TANGENT 
@@ -483,7 +483,7 @@ TransformationFE::getK_Force(const Vector &accel, double fact)
   int noRowsTransformed = 0;
   int noRowsOriginal = 0;
   
-  static Matrix localK;
+  static thread_local Matrix localK;
   
   // foreach block row, for each block col do
   for (int i=0; i<numNode; i++) {
@@ -508,7 +508,7 @@ TransformationFE::getK_Force(const Vector &accel, double fact)
       // now perform the matrix computation T(i)^T localK T(j)
       // note: if T == 0 then the Identity is assumed
       int noColsTransformed = 0;
-      static Matrix localTtKT;
+      static thread_local Matrix localTtKT;
       
       if (Ti != 0 && Tj != 0) {
 	noRowsTransformed = Ti->noCols();
@@ -574,7 +574,7 @@ TransformationFE::getKi_Force(const Vector &accel, double fact)
   this->FE_Element::addKiToTang();    
   const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-  static ID numDOFs(dofData, 1);
+  static thread_local ID numDOFs(dofData, 1);
   numDOFs.setData(dofData, numGroups);
     
   // DO THE SP STUFF TO THE TANGENT 
@@ -598,7 +598,7 @@ TransformationFE::getKi_Force(const Vector &accel, double fact)
   int noRowsTransformed = 0;
   int noRowsOriginal = 0;
   
-  static Matrix localK;
+  static thread_local Matrix localK;
   
   // foreach block row, for each block col do
   for (int i=0; i<numNode; i++) {
@@ -623,7 +623,7 @@ TransformationFE::getKi_Force(const Vector &accel, double fact)
       // now perform the matrix computation T(i)^T localK T(j)
       // note: if T == 0 then the Identity is assumed
       int noColsTransformed = 0;
-      static Matrix localTtKT;
+      static thread_local Matrix localTtKT;
       
       if (Ti != 0 && Tj != 0) {
 	noRowsTransformed = Ti->noCols();
@@ -688,7 +688,7 @@ TransformationFE::getM_Force(const Vector &accel, double fact)
   this->FE_Element::addMtoTang();    
   const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-  static ID numDOFs(dofData, 1);
+  static thread_local ID numDOFs(dofData, 1);
   numDOFs.setData(dofData, numGroups);
     
   // DO THE SP STUFF TO THE TANGENT 
@@ -712,7 +712,7 @@ TransformationFE::getM_Force(const Vector &accel, double fact)
   int noRowsTransformed = 0;
   int noRowsOriginal = 0;
   
-  static Matrix localK;
+  static thread_local Matrix localK;
   
   // foreach block row, for each block col do
   for (int i=0; i<numNode; i++) {
@@ -737,7 +737,7 @@ TransformationFE::getM_Force(const Vector &accel, double fact)
       // now perform the matrix computation T(i)^T localK T(j)
       // note: if T == 0 then the Identity is assumed
       int noColsTransformed = 0;
-      static Matrix localTtKT;
+      static thread_local Matrix localTtKT;
       
       if (Ti != 0 && Tj != 0) {
 	noRowsTransformed = Ti->noCols();
@@ -802,7 +802,7 @@ TransformationFE::getC_Force(const Vector &accel, double fact)
   this->FE_Element::addCtoTang();    
   const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-  static ID numDOFs(dofData, 1);
+  static thread_local ID numDOFs(dofData, 1);
   numDOFs.setData(dofData, numGroups);
     
   // DO THE SP STUFF TO THE TANGENT 
@@ -826,7 +826,7 @@ TransformationFE::getC_Force(const Vector &accel, double fact)
   int noRowsTransformed = 0;
   int noRowsOriginal = 0;
   
-  static Matrix localK;
+  static thread_local Matrix localK;
   
   // foreach block row, for each block col do
   for (int i=0; i<numNode; i++) {
@@ -851,7 +851,7 @@ TransformationFE::getC_Force(const Vector &accel, double fact)
       // now perform the matrix computation T(i)^T localK T(j)
       // note: if T == 0 then the Identity is assumed
       int noColsTransformed = 0;
-      static Matrix localTtKT;
+      static thread_local Matrix localTtKT;
       
       if (Ti != 0 && Tj != 0) {
 	noRowsTransformed = Ti->noCols();
@@ -916,7 +916,7 @@ TransformationFE::addD_Force(const Vector &disp,  double fact)
     if (fact == 0.0)
 	return;
 
-    static Vector response;
+    static thread_local Vector response;
     response.setData(dataBuffer, numOriginalDOF);
 		    
     for (int i=0; i<numTransformedDOF; i++) {
@@ -936,7 +936,7 @@ TransformationFE::addM_Force(const Vector &disp,  double fact)
     if (fact == 0.0)
 	return;
 
-    static Vector response;
+    static thread_local Vector response;
     response.setData(dataBuffer, numOriginalDOF);
 		    
     for (int i=0; i<numTransformedDOF; i++) {
@@ -1019,7 +1019,7 @@ TransformationFE::addD_ForceSensitivity(int gradNumber, const Vector &disp,  dou
     if (fact == 0.0)
 	return;
 
-    static Vector response;
+    static thread_local Vector response;
     response.setData(dataBuffer, numOriginalDOF);
 		    
     for (int i=0; i<numTransformedDOF; i++) {
@@ -1039,7 +1039,7 @@ TransformationFE::addM_ForceSensitivity(int gradNumber, const Vector &disp,  dou
     if (fact == 0.0)
 	return;
 
-    static Vector response;
+    static thread_local Vector response;
     response.setData(dataBuffer, numOriginalDOF);
 		    
     for (int i=0; i<numTransformedDOF; i++) {
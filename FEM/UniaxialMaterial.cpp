@@ -43,7 +43,7 @@
 #include <TaggedObject.h>
 #include <MapOfTaggedObjects.h>
 
-static MapOfTaggedObjects theUniaxialMaterialObjects;
+static thread_local MapOfTaggedObjects theUniaxialMaterialObjects;
 
 bool OPS_addUniaxialMaterial(UniaxialMaterial *newComponent) {
   return theUniaxialMaterialObjects.addComponent(newComponent);
@@ -278,10 +278,10 @@ UniaxialMaterial::setResponse(const char **argv, int argc,
 int 
 UniaxialMaterial::getResponse(int responseID, Information &matInfo)
 {
-  static Vector stressStrain(2);
-  static Vector stressStrainTangent(3);
+  static thread_local Vector stressStrain(2);
+  static thread_local Vector stressStrainTangent(3);
 
-  static Vector tempData(2);  //L.jiang [SIF]
+  static thread_local Vector tempData(2);  //L.jiang [SIF]
   static Information infoData(tempData);  //L.jiang [SIF]
 
   // each subclass must implement its own stuff   
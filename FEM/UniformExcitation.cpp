@@ -370,7 +370,7 @@ UniformExcitation::sendSelf(int commitTag, Channel &theChannel)
 {
   int dbTag = this->getDbTag();
 
-  static Vector data(6);
+  static thread_local Vector data(6);
   data(0) = this->getTag();
   data(1) = theDof;
   data(2) = vel0;
@@ -406,7 +406,7 @@ UniformExcitation::recvSelf(int commitTag, Channel &theChannel,
 {
   int dbTag = this->getDbTag();
 
-  static Vector data(6);
+  static thread_local Vector data(6);
   int res = theChannel.recvVector(dbTag, commitTag, data);
   if (res < 0) {
     opserr << "UniformExcitation::recvSelf() - channel failed to recv data\n";
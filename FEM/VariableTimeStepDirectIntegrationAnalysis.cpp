@@ -83,6 +83,9 @@ VariableTimeStepDirectIntegrationAnalysis::analyze(int numSteps, double dT, doub
 
   opserr << "currentDt = " << currentDt << endln;
 
+  // a tangent kept by the algorithm may be of another dt
+  theAlgo->integratorChanged();
+
   // loop until analysis has performed the total time incr requested
   while (currentTimeIncr < totalTimeIncr) {
 
@@ -145,7 +148,10 @@ VariableTimeStepDirectIntegrationAnalysis::analyze(int numSteps, double dT, doub
     }
 
     // now we determine a new delta T for next loop
+    double lastDt = currentDt;
     currentDt = this->determineDt(currentDt, dtMin, dtMax, Jd, theTest);
+    if (currentDt != lastDt)
+      theAlgo->integratorChanged();
   }
 
 
@@ -121,6 +121,30 @@ Vector::Vector(const Vector &other)
 }	
 
 
+// Vector(Vector &&):
+//	Constructor taking over the data of a temporary Vector, the data
+//	is copied if the other Vector does not own it.
+
+Vector::Vector(Vector &&other)
+: sz(other.sz),theData(other.theData),fromFree(0)
+{
+  if (other.fromFree == 0) {
+    other.sz = 0;
+    other.theData = 0;
+    return;
+  }
+
+  theData = (sz != 0) ? new (nothrow) double [sz] : 0;
+  if (sz != 0 && theData == 0) {
+    opserr << "Vector::Vector(Vector &&) - out of memory creating vector of size " << sz << endln;
+    sz = 0;
+  }
+
+  for (int i=0; i<sz; i++)
+    theData[i] = other.theData[i];
+}
+
+
 // ~Vector():
 // 	destructor, deletes the [] data
 
@@ -742,6 +766,27 @@ Vector::operator=(const Vector &V)
 }
 
 
+// Vector &operator=(Vector &&V):
+//	The data of V and this are swapped if both own their data, otherwise
+//	(this wraps the data of another object) the data of V is copied.
+
+Vector &
+Vector::operator=(Vector &&V) 
+{
+  if (this != &V && fromFree == 0 && V.fromFree == 0) {
+    int tmpSz = sz;
+    double *tmpData = theData;
+    sz = V.sz;
+    theData = V.theData;
+    V.sz = tmpSz;
+    V.theData = tmpData;
+    return *this;
+  }
+
+  return *this = static_cast<const Vector &>(V);
+}
+
+
 // Vector &operator+=(double fact):
 //	The += operator adds fact to each element of the vector, data[i] = data[i]+fact.
 
@@ -834,42 +879,6 @@ Vector::operator-(double fact) const
 
 
 
-// Vector operator*(double fact):
-//	The + operator returns a Vector of the same size as current, whose components
-//	are return(i) = theData[i]*fact;
-
-Vector 
-Vector::operator*(double fact) const
-{
-    Vector result(*this);
-    if (result.Size() != sz) 
-      opserr << "Vector::operator*(double) - ran out of memory for new Vector\n";
-
-    result *= fact;
-    return result;
-}
-
-
-// Vector operator/(double fact):
-//	The + operator returns a Vector of the same size as current, whose components
-//	are return(i) = theData[i]/fact; Exits if divide-by-zero error.
-
-Vector 
-Vector::operator/(double fact) const
-{
-    if (fact == 0.0) 
-      opserr << "Vector::operator/(double fact) - divide-by-zero error coming\n";
-
-    Vector result(*this);
-    if (result.Size() != sz) 
-      opserr << "Vector::operator/(double) - ran out of memory for new Vector\n";
-
-    result /= fact;
-    return result;
-}
-
-
-
 // Vector &operator+=(const Vector &V):
 //	The += operator adds V's data to data, data[i]+=V(i). A check to see if
 //	vectors are of same size is performed if VECTOR_CHECK is defined.
@@ -912,60 +921,6 @@ Vector::operator-=(const Vector &other)
 
 
 
-// Vector operator+(const Vector &V):
-//	The + operator checks the two vectors are of the same size if VECTOR_CHECK is defined.
-// 	Then returns a Vector whose components are the vector sum of current and V's data.
-
-Vector 
-Vector::operator+(const Vector &b) const
-{
-#ifdef _G3DEBUG
-  if (sz != b.sz) {
-    opserr << "WARNING Vector::operator+=(Vector):Vectors not of same sizes: " << sz << " != " << b.sz << endln;
-    return *this;
-  }
-#endif
-
-    Vector result(*this);
-
-    // check new Vector of correct size
-  if (result.Size() != sz) {
-    opserr << "Vector::operator-(Vector): new Vector not of correct size \n";
-    return result;
-  }
-  result += b;
-  return result;
-}
-
-
-// Vector operator-(const Vector &V):
-//	The - operator checks the two vectors are of the same size and then returns a Vector
-//	whose components are the vector difference of current and V's data.
-
-Vector 
-Vector::operator-(const Vector &b) const
-{
-#ifdef _G3DEBUG
-  if (sz != b.sz) {
-    opserr << "WARNING Vector::operator+=(Vector):Vectors not of same sizes: " << sz << " != " << b.sz << endln;
-    return *this;
-  }
-#endif
-
-  Vector result(*this);
-
-  // check new Vector of correct size
-  if (result.Size() != sz) {
-    opserr << "Vector::operator-(Vector): new Vector not of correct size \n";
-    return result;
-  }
-
-  result -= b;
-  return result;
-}
-
-
-
 // double operator^(const Vector &V) const;
 //	Method to perform (Vector)transposed * vector.
 double
@@ -1103,12 +1058,6 @@ istream &operator>>(istream &s, Vector &V)
 */
 
 
-Vector operator*(double a, const Vector &V)
-{
-  return V * a;
-}
-
-
 int
 Vector::Assemble(const Vector &V, int init_pos, double fact) 
 {
@@ -32,22 +32,28 @@
 #define Vector_h 
 
 #include <OPS_Globals.h>
+#include <new>
+#include <utility>
 
 #define VECTOR_VERY_LARGE_VALUE 1.0e200
 
+#include <VectorExpression.h>
+
 class Matrix; 
 class Message;
 class SystemOfEqn;
 class ID;
 
-class Vector
+class Vector : public VectorExpression<Vector>
 {
   public:
     // constructors and destructor
     Vector();
     Vector(int);
     Vector(const Vector &);    
+    Vector(Vector &&);
     Vector(double *data, int size);
+    template <class E> Vector(const VectorExpression<E> &);
     ~Vector();
 
     // utility methods
@@ -72,6 +78,8 @@ class Vector
     double &operator[](int x);
     Vector operator()(const ID &rows) const;
     Vector &operator=(const Vector  &V);
+    Vector &operator=(Vector &&V);
+    template <class E> Vector &operator=(const VectorExpression<E> &V);
     
     Vector &operator+=(double fact);
     Vector &operator-=(double fact);
@@ -80,14 +88,13 @@ class Vector
 
     Vector operator+(double fact) const;
     Vector operator-(double fact) const;
-    Vector operator*(double fact) const;
-    Vector operator/(double fact) const;
     
     Vector &operator+=(const Vector &V);
     Vector &operator-=(const Vector &V);
+    template <class E> Vector &operator+=(const VectorExpression<E> &V);
+    template <class E> Vector &operator-=(const VectorExpression<E> &V);
     
-    Vector operator+(const Vector &V) const;
-    Vector operator-(const Vector &V) const;
+    // V*fact, fact*V, V/fact, V+V and V-V are expressions, see VectorExpression.h
     double operator^(const Vector &V) const;
     Vector operator/(const Matrix &M) const;
 
@@ -103,9 +110,12 @@ class Vector
     int  Assemble(const Vector &V, int init_row, double fact = 1.0);
     int  Extract (const Vector &V, int init_row, double fact = 1.0); 
   
+    // used by the expression templates
+    bool aliases(const double *data) const {return theData == data;}
+    bool crossAliases(const double *data) const {return false;}
+
     friend OPS_Stream &operator<<(OPS_Stream &s, const Vector &V);
     // friend istream &operator>>(istream &s, Vector &V);    
-    friend Vector operator*(double a, const Vector &V);
     
     friend class Message;
     friend class SystemOfEqn;
@@ -117,6 +127,7 @@ class Vector
     friend class MPI_Channel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
+    friend class BinaryFileDatastore;
     
   private:
     static double VECTOR_NOT_VALID_ENTRY;
@@ -170,5 +181,88 @@ Vector::operator()(int x)
 }
 
 
+template <class E>
+Vector::Vector(const VectorExpression<E> &V)
+: sz(V.self().Size()), theData(0), fromFree(0)
+{
+  const E &expr = V.self();
+  if (sz > 0) {
+    theData = new (std::nothrow) double [sz];
+
+    if (theData == 0) {
+      opserr << "Vector::Vector(expression) - out of memory creating vector of size " << sz << endln;
+      sz = 0;
+    }
+  }
+
+  for (int i=0; i<sz; i++)
+    theData[i] = expr(i);
+}
+
+
+// the components are computed in place unless the sizes differ or a
+// Matrix-Vector product in the expression reads this Vector
+template <class E>
+Vector &
+Vector::operator=(const VectorExpression<E> &V)
+{
+  const E &expr = V.self();
+  if (expr.Size() != sz || expr.crossAliases(theData)) {
+    Vector result(V);
+    return *this = std::move(result);
+  }
+
+  for (int i=0; i<sz; i++)
+    theData[i] = expr(i);
+  return *this;
+}
+
+
+template <class E>
+Vector &
+Vector::operator+=(const VectorExpression<E> &V)
+{
+  const E &expr = V.self();
+  if (expr.crossAliases(theData)) {
+    Vector result(V);
+    return *this += result;
+  }
+
+#ifdef _G3DEBUG
+  if (sz != expr.Size()) {
+    opserr << "WARNING Vector::operator+=(Vector):Vectors not of same sizes: " << sz << " != " << expr.Size() << endln;
+    return *this;
+  }    
+#endif
+
+  for (int i=0; i<sz; i++)
+    theData[i] += expr(i);
+  return *this;
+}
+
+
+template <class E>
+Vector &
+Vector::operator-=(const VectorExpression<E> &V)
+{
+  const E &expr = V.self();
+  if (expr.crossAliases(theData)) {
+    Vector result(V);
+    return *this -= result;
+  }
+
+#ifdef _G3DEBUG
+  if (sz != expr.Size()) {
+    opserr << "WARNING Vector::operator-=(Vector):Vectors not of same sizes: " << sz << " != " << expr.Size() << endln;
+    return *this;
+  }    
+#endif
+
+  for (int i=0; i<sz; i++)
+    theData[i] -= expr(i);
+  return *this;
+}
+
+
 #endif
 
@@ -0,0 +1,200 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/matrix/VectorExpression.h
+//
+// Written: fmk
+//
+// Description: This file contains the expression templates for the
+// Vector operators +, -, * and / (and the Matrix-Vector products in
+// Matrix.h). An operator returns a small object that remembers its
+// operands instead of a new Vector; the expression is evaluated component
+// by component when it is assigned to, or used to construct, a Vector,
+// so a + b*c makes no temporary Vectors. Every component is computed with
+// the operations, in the order, of the Vector operators it replaces.
+//
+// An expression class E provides Size(), operator()(int), and
+//   aliases(data)      - it reads the Vector with this data
+//   crossAliases(data) - component i reads other components of the
+//                        Vector with this data (Matrix-Vector products),
+//                        so it can not be evaluated into that Vector.
+//
+// This file is included by Vector.h.
+//
+// What: "@(#) VectorExpression.h, revA"
+
+#ifndef VectorExpression_h
+#define VectorExpression_h
+
+#include <OPS_Globals.h>
+
+class Vector;
+
+template <class E>
+class VectorExpression
+{
+  public:
+    const E &self(void) const {return static_cast<const E &>(*this);}
+};
+
+// Vectors are kept by reference, the expressions by value as they are
+// temporaries that live to the end of the full expression.
+template <class E>
+struct VectorOperand
+{
+  typedef const E type;
+};
+
+template <>
+struct VectorOperand<Vector>
+{
+  typedef const Vector &type;
+};
+
+
+template <class L, class R>
+class VectorSum : public VectorExpression<VectorSum<L, R> >
+{
+  public:
+    VectorSum(const L &l, const R &r) :left(l), right(r) {}
+
+    int Size(void) const {return left.Size();}
+    double operator()(int i) const {return left(i) + right(i);}
+    bool aliases(const double *data) const {return left.aliases(data) || right.aliases(data);}
+    bool crossAliases(const double *data) const {return left.crossAliases(data) || right.crossAliases(data);}
+
+  private:
+    typename VectorOperand<L>::type left;
+    typename VectorOperand<R>::type right;
+};
+
+
+template <class L, class R>
+class VectorDifference : public VectorExpression<VectorDifference<L, R> >
+{
+  public:
+    VectorDifference(const L &l, const R &r) :left(l), right(r) {}
+
+    int Size(void) const {return left.Size();}
+    double operator()(int i) const {return left(i) - right(i);}
+    bool aliases(const double *data) const {return left.aliases(data) || right.aliases(data);}
+    bool crossAliases(const double *data) const {return left.crossAliases(data) || right.crossAliases(data);}
+
+  private:
+    typename VectorOperand<L>::type left;
+    typename VectorOperand<R>::type right;
+};
+
+
+template <class E>
+class VectorScaled : public VectorExpression<VectorScaled<E> >
+{
+  public:
+    VectorScaled(const E &v, double f) :vect(v), fact(f) {}
+
+    int Size(void) const {return vect.Size();}
+    double operator()(int i) const {return vect(i) * fact;}
+    bool aliases(const double *data) const {return vect.aliases(data);}
+    bool crossAliases(const double *data) const {return vect.crossAliases(data);}
+
+  private:
+    typename VectorOperand<E>::type vect;
+    double fact;
+};
+
+
+// as Vector::operator/=(), a 0 factor gives VECTOR_VERY_LARGE_VALUE
+template <class E>
+class VectorQuotient : public VectorExpression<VectorQuotient<E> >
+{
+  public:
+    VectorQuotient(const E &v, double f) :vect(v), fact(f) {}
+
+    int Size(void) const {return vect.Size();}
+    double operator()(int i) const {return (fact == 0.0) ? VECTOR_VERY_LARGE_VALUE : vect(i) / fact;}
+    bool aliases(const double *data) const {return vect.aliases(data);}
+    bool crossAliases(const double *data) const {return vect.crossAliases(data);}
+
+  private:
+    typename VectorOperand<E>::type vect;
+    double fact;
+};
+
+
+template <class L, class R>
+inline VectorSum<L, R>
+operator+(const VectorExpression<L> &a, const VectorExpression<R> &b)
+{
+#ifdef _G3DEBUG
+  if (a.self().Size() != b.self().Size())
+    opserr << "WARNING Vector::operator+(Vector):Vectors not of same sizes: " << a.self().Size() << " != " << b.self().Size() << endln;
+#endif
+  return VectorSum<L, R>(a.self(), b.self());
+}
+
+template <class L, class R>
+inline VectorDifference<L, R>
+operator-(const VectorExpression<L> &a, const VectorExpression<R> &b)
+{
+#ifdef _G3DEBUG
+  if (a.self().Size() != b.self().Size())
+    opserr << "WARNING Vector::operator-(Vector):Vectors not of same sizes: " << a.self().Size() << " != " << b.self().Size() << endln;
+#endif
+  return VectorDifference<L, R>(a.self(), b.self());
+}
+
+template <class E>
+inline VectorScaled<E>
+operator*(const VectorExpression<E> &V, double fact)
+{
+  return VectorScaled<E>(V.self(), fact);
+}
+
+template <class E>
+inline VectorScaled<E>
+operator*(double fact, const VectorExpression<E> &V)
+{
+  return VectorScaled<E>(V.self(), fact);
+}
+
+template <class E>
+inline VectorQuotient<E>
+operator/(const VectorExpression<E> &V, double fact)
+{
+  if (fact == 0.0)
+    opserr << "Vector::operator/(double fact) - divide-by-zero error coming\n";
+  return VectorQuotient<E>(V.self(), fact);
+}
+
+// (Vector)transposed * vector of two expressions, as Vector::operator^()
+template <class L, class R>
+inline double
+operator^(const VectorExpression<L> &a, const VectorExpression<R> &b)
+{
+  const L &left = a.self();
+  const R &right = b.self();
+  double result = 0.0;
+  int sz = left.Size();
+  for (int i=0; i<sz; i++)
+    result += left(i) * right(i);
+  return result;
+}
+
+#endif
@@ -144,7 +144,7 @@ int
 Vertex::sendSelf(int commitTag, Channel &theChannel)
 {
   // send the tag/ref/color/degree/tmp, an indication if weighted & size of adjacency
-  static ID idData(7);
+  static thread_local ID idData(7);
   idData(0) = this->getTag();
   idData(1) = myRef;
   idData(2) = myColor;
@@ -163,7 +163,7 @@ Vertex::sendSelf(int commitTag, Channel &theChannel)
 
   // if weighted, send the weight
   if (myWeight != 0.0) {
-    static Vector vectData(1);
+    static thread_local Vector vectData(1);
     vectData(0) = myWeight;
     if (theChannel.sendVector(0, commitTag, vectData) < 0) {
       opserr << "Graph::rendSelf() - failed to receive the weight\n";
@@ -185,7 +185,7 @@ int
 Vertex::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
   // recv the tag/ref/color/degree/tmp, an indication if weighted & size of adjacency
-  static ID idData(7);
+  static thread_local ID idData(7);
   if (theChannel.recvID(0, commitTag, idData) < 0) {
     opserr << "Graph::recvSelf() - failed to receive the initial data\n";
     return -1;
@@ -198,7 +198,7 @@ Vertex::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker
 
   // if weighted, receive the weight
   if (idData(5) == 1) {
-    static Vector vectData(1);
+    static thread_local Vector vectData(1);
     if (theChannel.recvVector(0, commitTag, vectData) < 0) {
       opserr << "Graph::recvSelf() - failed to receive the weight\n";
       return -2;
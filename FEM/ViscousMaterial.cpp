@@ -214,7 +214,7 @@ int
 ViscousMaterial::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
-  static Vector data(6);
+  static thread_local Vector data(6);
   data(0) = this->getTag();
   data(1) = C;
   data(2) = Alpha;
@@ -233,7 +233,7 @@ ViscousMaterial::recvSelf(int cTag, Channel &theChannel,
 			       FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(6);
+  static thread_local Vector data(6);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   
   if (res < 0) {
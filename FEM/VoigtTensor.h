@@ -0,0 +1,352 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/matrix/VoigtTensor.h
+//
+// Written: fmk
+//
+// Description: This file contains the class definitions for VoigtVector
+// and VoigtMatrix. A VoigtVector is a symmetric 2nd order tensor in 2D
+// stored in Voigt form, (11, 22, 12), and a VoigtMatrix a 4th order tensor
+// acting on it, a 3x3 matrix. Both keep their components in the object
+// itself, so unlike Vector and Matrix they never touch the heap and the
+// temporaries of the constitutive updates cost nothing to create. The
+// operators do the arithmetic in the same order as those of Vector and
+// Matrix and give bitwise the same results. Conversions to and from
+// Vector and Matrix are explicit.
+//
+// What: "@(#) VoigtTensor.h, revA"
+
+#ifndef VoigtTensor_h
+#define VoigtTensor_h
+
+#include <Vector.h>
+#include <Matrix.h>
+#include <OPS_Stream.h>
+
+class VoigtVector
+{
+  public:
+    // constructors
+    VoigtVector() { theData[0] = 0.0; theData[1] = 0.0; theData[2] = 0.0; }
+    VoigtVector(double v0, double v1, double v2) { theData[0] = v0; theData[1] = v1; theData[2] = v2; }
+    explicit VoigtVector(const Vector &other);
+
+    // utility methods
+    int Size(void) const { return 3; }
+    void Zero(void) { theData[0] = 0.0; theData[1] = 0.0; theData[2] = 0.0; }
+    void copyTo(Vector &res) const;
+
+    // overloaded operators
+    double operator()(int x) const { return theData[x]; }
+    double &operator()(int x) { return theData[x]; }
+
+    VoigtVector &operator*=(double fact);
+    VoigtVector &operator/=(double fact);
+    VoigtVector operator*(double fact) const;
+    VoigtVector operator/(double fact) const;
+
+    VoigtVector &operator+=(const VoigtVector &V);
+    VoigtVector &operator-=(const VoigtVector &V);
+    VoigtVector operator+(const VoigtVector &V) const;
+    VoigtVector operator-(const VoigtVector &V) const;
+    double operator^(const VoigtVector &V) const;
+
+    friend OPS_Stream &operator<<(OPS_Stream &s, const VoigtVector &V);
+
+  private:
+    double theData[3];
+};
+
+class VoigtMatrix
+{
+  public:
+    // constructors
+    VoigtMatrix() { this->Zero(); }
+    explicit VoigtMatrix(const Matrix &other);
+
+    // utility methods
+    int noRows() const { return 3; }
+    int noCols() const { return 3; }
+    void Zero(void) { for (int i = 0; i < 9; i++) data[i] = 0.0; }
+    void copyTo(Matrix &res) const;
+
+    // overloaded operators, the components are stored column by column
+    // as in Matrix
+    double operator()(int row, int col) const { return data[col*3 + row]; }
+    double &operator()(int row, int col) { return data[col*3 + row]; }
+
+    VoigtMatrix &operator*=(double fact);
+    VoigtMatrix &operator/=(double fact);
+    VoigtMatrix operator*(double fact) const;
+    VoigtMatrix operator/(double fact) const;
+
+    VoigtVector operator*(const VoigtVector &V) const;
+    VoigtVector operator^(const VoigtVector &V) const;
+
+    VoigtMatrix &operator+=(const VoigtMatrix &M);
+    VoigtMatrix &operator-=(const VoigtMatrix &M);
+    VoigtMatrix operator+(const VoigtMatrix &M) const;
+    VoigtMatrix operator-(const VoigtMatrix &M) const;
+    VoigtMatrix operator*(const VoigtMatrix &M) const;
+
+  private:
+    double data[9];
+};
+
+/********* INLINED VOIGTVECTOR FUNCTIONS ***********/
+inline
+VoigtVector::VoigtVector(const Vector &other)
+{
+  for (int i = 0; i < 3; i++)
+    theData[i] = other(i);
+}
+
+inline void
+VoigtVector::copyTo(Vector &res) const
+{
+  for (int i = 0; i < 3; i++)
+    res(i) = theData[i];
+}
+
+inline VoigtVector &
+VoigtVector::operator*=(double fact)
+{
+  for (int i = 0; i < 3; i++)
+    theData[i] *= fact;
+  return *this;
+}
+
+inline VoigtVector &
+VoigtVector::operator/=(double fact)
+{
+  // as Vector: no divide-by-zero, all entries set to VECTOR_VERY_LARGE_VALUE
+  if (fact == 0.0) {
+    for (int i = 0; i < 3; i++)
+      theData[i] = VECTOR_VERY_LARGE_VALUE;
+  } else {
+    for (int i = 0; i < 3; i++)
+      theData[i] /= fact;
+  }
+  return *this;
+}
+
+inline VoigtVector
+VoigtVector::operator*(double fact) const
+{
+  VoigtVector result(*this);
+  result *= fact;
+  return result;
+}
+
+inline VoigtVector
+VoigtVector::operator/(double fact) const
+{
+  VoigtVector result(*this);
+  result /= fact;
+  return result;
+}
+
+inline VoigtVector &
+VoigtVector::operator+=(const VoigtVector &other)
+{
+  for (int i = 0; i < 3; i++)
+    theData[i] += other.theData[i];
+  return *this;
+}
+
+inline VoigtVector &
+VoigtVector::operator-=(const VoigtVector &other)
+{
+  for (int i = 0; i < 3; i++)
+    theData[i] -= other.theData[i];
+  return *this;
+}
+
+inline VoigtVector
+VoigtVector::operator+(const VoigtVector &b) const
+{
+  VoigtVector result(*this);
+  result += b;
+  return result;
+}
+
+inline VoigtVector
+VoigtVector::operator-(const VoigtVector &b) const
+{
+  VoigtVector result(*this);
+  result -= b;
+  return result;
+}
+
+inline double
+VoigtVector::operator^(const VoigtVector &V) const
+{
+  double result = 0.0;
+  for (int i = 0; i < 3; i++)
+    result += theData[i] * V.theData[i];
+  return result;
+}
+
+inline VoigtVector
+operator*(double a, const VoigtVector &V)
+{
+  return V * a;
+}
+
+inline OPS_Stream &
+operator<<(OPS_Stream &s, const VoigtVector &V)
+{
+  return s.write(V.theData, 3);
+}
+
+/********* INLINED VOIGTMATRIX FUNCTIONS ***********/
+inline
+VoigtMatrix::VoigtMatrix(const Matrix &other)
+{
+  for (int j = 0; j < 3; j++)
+    for (int i = 0; i < 3; i++)
+      data[j*3 + i] = other(i, j);
+}
+
+inline void
+VoigtMatrix::copyTo(Matrix &res) const
+{
+  for (int j = 0; j < 3; j++)
+    for (int i = 0; i < 3; i++)
+      res(i, j) = data[j*3 + i];
+}
+
+inline VoigtMatrix &
+VoigtMatrix::operator*=(double fact)
+{
+  for (int i = 0; i < 9; i++)
+    data[i] *= fact;
+  return *this;
+}
+
+inline VoigtMatrix &
+VoigtMatrix::operator/=(double fact)
+{
+  // as Matrix: multiply by the inverse of fact
+  if (fact == 1.0)
+    return *this;
+  if (fact != 0.0) {
+    double val = 1.0/fact;
+    for (int i = 0; i < 9; i++)
+      data[i] *= val;
+  } else {
+    for (int i = 0; i < 9; i++)
+      data[i] = MATRIX_VERY_LARGE_VALUE;
+  }
+  return *this;
+}
+
+inline VoigtMatrix
+VoigtMatrix::operator*(double fact) const
+{
+  VoigtMatrix result(*this);
+  result *= fact;
+  return result;
+}
+
+inline VoigtMatrix
+VoigtMatrix::operator/(double fact) const
+{
+  VoigtMatrix result(*this);
+  result /= fact;
+  return result;
+}
+
+inline VoigtVector
+VoigtMatrix::operator*(const VoigtVector &V) const
+{
+  VoigtVector result;
+  const double *dataPtr = data;
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      result(j) += *dataPtr++ * V(i);
+  return result;
+}
+
+inline VoigtVector
+VoigtMatrix::operator^(const VoigtVector &V) const
+{
+  VoigtVector result;
+  const double *dataPtr = data;
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      result(i) += *dataPtr++ * V(j);
+  return result;
+}
+
+inline VoigtMatrix &
+VoigtMatrix::operator+=(const VoigtMatrix &M)
+{
+  for (int i = 0; i < 9; i++)
+    data[i] += M.data[i];
+  return *this;
+}
+
+inline VoigtMatrix &
+VoigtMatrix::operator-=(const VoigtMatrix &M)
+{
+  for (int i = 0; i < 9; i++)
+    data[i] -= M.data[i];
+  return *this;
+}
+
+inline VoigtMatrix
+VoigtMatrix::operator+(const VoigtMatrix &M) const
+{
+  VoigtMatrix result(*this);
+  result += M;
+  return result;
+}
+
+inline VoigtMatrix
+VoigtMatrix::operator-(const VoigtMatrix &M) const
+{
+  VoigtMatrix result(*this);
+  result -= M;
+  return result;
+}
+
+inline VoigtMatrix
+VoigtMatrix::operator*(const VoigtMatrix &M) const
+{
+  // looping as in Matrix::addMatrixProduct(): j,k,i
+  VoigtMatrix result;
+  for (int j = 0; j < 3; j++)
+    for (int k = 0; k < 3; k++) {
+      double tmp = M.data[j*3 + k];
+      for (int i = 0; i < 3; i++)
+	result.data[j*3 + i] += data[k*3 + i] * tmp;
+    }
+  return result;
+}
+
+inline VoigtMatrix
+operator*(double a, const VoigtMatrix &M)
+{
+  return M * a;
+}
+
+#endif
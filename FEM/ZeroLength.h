@@ -160,6 +160,7 @@ class ZeroLength : public Element
 
     // private methods
     void   setUp ( int Nd1, int Nd2, const Vector& x, const Vector& y);
+    void   setWorkArea (void);
     void   checkDirection (  ID& dir ) const;
     
     void   setTran1d ( Etype e, int n );
@@ -174,8 +175,8 @@ class ZeroLength : public Element
 	
     Node *theNodes[2];
 
-    Matrix *theMatrix; 	    	// pointer to objects matrix (a class Matrix)
-    Vector *theVector;      	// pointer to objects vector (a class Vector)
+    Matrix *theMatrix; 	    	// objects matrix (a class Matrix)
+    Vector *theVector;      	// objects vector (a class Vector)
 
     // Storage for uniaxial material models
     int numMaterials1d;			   // number of 1d materials
@@ -187,16 +188,6 @@ class ZeroLength : public Element
     Vector *d0;
     Vector *v0;
 
-    // static data - single copy for all objects of the class	
-    static Matrix ZeroLengthM2;   // class wide matrix for 2*2
-    static Matrix ZeroLengthM4;   // class wide matrix for 4*4
-    static Matrix ZeroLengthM6;   // class wide matrix for 6*6
-    static Matrix ZeroLengthM12;  // class wide matrix for 12*12
-    static Vector ZeroLengthV2;   // class wide Vector for size 2
-    static Vector ZeroLengthV4;   // class wide Vector for size 4
-    static Vector ZeroLengthV6;   // class wide Vector for size 6
-    static Vector ZeroLengthV12;  // class wide Vector for size 12
-
     int mInitialize;  // tag to fix bug in recvSelf/setDomain when using database command
 };
 
@@ -105,6 +105,7 @@
 #define TSERIES_TAG_PeerMotion       11
 #define TSERIES_TAG_PeerNGAMotion       12
 #define TSERIES_TAG_PathTimeSeriesThermal  13  //L.Jiang [ SIF ]
+#define TSERIES_TAG_GroundMotionSeries     14
 
 #define PARAMETER_TAG_Parameter			   1
 #define PARAMETER_TAG_MaterialStageParameter       2
@@ -923,6 +924,7 @@
 #define LinSOE_TAGS_PFEMLinSOE 26
 #define LinSOE_TAGS_SProfileSPDLinSOE		27
 #define LinSOE_TAGS_PFEMCompressibleLinSOE 28
+#define LinSOE_TAGS_BlockTriDiagLinSOE 29
 
 
 #define SOLVER_TAGS_FullGenLinLapackSolver  	1
@@ -956,6 +958,8 @@
 #define SOLVER_TAGS_CulaSparseS4                        29
 #define SOLVER_TAGS_CulaSparseS5                        30
 #define SOLVER_TAGS_CuSP                                31
+#define SOLVER_TAGS_SparseGenColLUSolver                32
+#define SOLVER_TAGS_BlockTriDiagLinLapackSolver         33
 
 #define RECORDER_TAGS_ElementRecorder		1
 #define RECORDER_TAGS_NodeRecorder		2
@@ -977,6 +981,8 @@
 #define RECORDER_TAGS_NormEnvelopeElementRecorder	18
 #define RECORDER_TAGS_PVDRecorder               19
 #define RECORDER_TAGS_MPCORecorder               20
+#define RECORDER_TAGS_SpectrumRecorder           21
+#define RECORDER_TAGS_PorePressureRatioRecorder  22
 
 #define OPS_STREAM_TAGS_FileStream		1
 #define OPS_STREAM_TAGS_StandardStream		2
@@ -989,6 +995,9 @@
 #define OPS_STREAM_TAGS_ChannelStream           9
 #define OPS_STREAM_TAGS_DataTurbineStream      10
 #define OPS_STREAM_TAGS_DataFileStreamAdd      11
+#define OPS_STREAM_TAGS_ChunkedBinaryStream    12
+#define OPS_STREAM_TAGS_MemoryStream           13
+#define OPS_STREAM_TAGS_AsyncStream            14
 
 
 #define DomDecompALGORITHM_TAGS_DomainDecompAlgo 1
@@ -18,7 +18,7 @@ BOOL APIENTRY DllMain(HANDLE hModule,
     return TRUE;
 }
 
-OPS_Stream *opserrPtr = 0;
+thread_local OPS_Stream *opserrPtr = 0;
 SimulationInformation *theSimulationInfo = 0;
 //Domain *ops_TheActiveDomain = 0;
 
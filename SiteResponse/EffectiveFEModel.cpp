@@ -46,6 +46,9 @@
 #include "NodeIter.h"
 #include "ElementIter.h"
 #include "DataFileStream.h"
+#include "ChunkedBinaryStream.h"
+#include "AsyncStream.h"
+#include "ChunkedBinaryReader.h"
 #include "Recorder.h"
 #include "UniaxialMaterial.h"
 #include "ElementStateParameter.h"
@@ -59,36 +62,63 @@
 #include "PM4Sand.h"
 #include "ElasticMaterial.h"
 #include "NewtonRaphson.h"
+#include "ModifiedNewton.h"
+#include "KrylovNewton.h"
 #include "LoadControl.h"
 #include "Newmark.h"
 #include "PenaltyConstraintHandler.h"
 #include "TransformationConstraintHandler.h"
 #include "BandGenLinLapackSolver.h"
 #include "BandGenLinSOE.h"
+#include "SparseGenColLinSOE.h"
+#include "SparseGenColLUSolver.h"
+#include "BlockTriDiagLinSOE.h"
+#include "BlockTriDiagLinLapackSolver.h"
 #include "GroundMotion.h"
 #include "ImposedMotionSP.h"
 #include "TimeSeriesIntegrator.h"
 #include "MultiSupportPattern.h"
 #include "UniformExcitation.h"
 #include "VariableTimeStepDirectIntegrationAnalysis.h"
+#include "SubSteppingDirectIntegrationAnalysis.h"
 #include "NodeRecorder.h"
 #include "ElementRecorder.h"
+#include "SpectrumRecorder.h"
+#include "EnvelopeNodeRecorder.h"
+#include "EnvelopeElementRecorder.h"
+#include "PorePressureRatioRecorder.h"
 #include "ViscousMaterial.h"
 #include "ZeroLength.h"
 #include "SingleDomParamIter.h"
+#include "BinaryFileDatastore.h"
+#include "FEM_ObjectBroker.h"
 
 #include "Information.h"
 #include <vector> 
 #include <map>
 
 #include <fstream>
+#include <cstdio>
 #include <string>
 #include <iomanip>
 #include <nlohmann/json.hpp>
 using json = nlohmann::json;
 #include <exception>
+#include <chrono>
 #include <cmath>
 
+#if !defined(WIN32) && !defined(_WIN32)
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include "FileStream.h"
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 
 
 
@@ -100,10 +130,110 @@ using json = nlohmann::json;
 #define PATH_SEPARATOR "/"
 #endif
 
+// create the system of equations named in the json file:
+// SparseGeneral (default), BlockTriDiagonal or BandGeneral
+static LinearSOE *createLinearSOE(const std::string &systemType)
+{
+	if (!systemType.compare("BlockTriDiagonal"))
+	{
+		BlockTriDiagLinSolver *theSolver = new BlockTriDiagLinLapackSolver();
+		return new BlockTriDiagLinSOE(*theSolver);
+	}
+	else if (!systemType.compare("BandGeneral"))
+	{
+		BandGenLinSolver *theSolver = new BandGenLinLapackSolver();
+		return new BandGenLinSOE(*theSolver);
+	}
+
+	if (systemType.compare("SparseGeneral"))
+		opserr << "Unknown system " << systemType.c_str() << ", using SparseGeneral." << endln;
+	SparseGenColLinSolver *theSolver = new SparseGenColLUSolver();
+	return new SparseGenColLinSOE(*theSolver);
+}
+
+// create the output stream of a recorder, a text or a chunked binary file.
+// When restarting from a checkpoint at restartTime the rows after
+// restartTime written by the interrupted run are removed and the stream
+// appends to the file.
+static OPS_Stream *createRecordStream(const std::string &fileName, double restartTime, double tol, bool binary)
+{
+	if (binary)
+	{
+		if (restartTime < 0.0)
+			return new ChunkedBinaryStream(fileName.c_str(), OVERWRITE);
+
+		// the time is the first column
+		ChunkedBinaryReader theReader;
+		if (theReader.open(fileName.c_str()) == 0)
+		{
+			Vector time;
+			theReader.getColumn(0, time);
+			int numRows = 0;
+			while (numRows < time.Size() && time(numRows) <= restartTime + tol)
+				numRows++;
+			if (numRows < theReader.getNumRows())
+			{
+				std::string tmpName = fileName + ".tmp";
+				theReader.writeRows(tmpName.c_str(), numRows);
+				theReader.close();
+				remove(fileName.c_str());
+				rename(tmpName.c_str(), fileName.c_str());
+			}
+		}
+		return new ChunkedBinaryStream(fileName.c_str(), APPEND);
+	}
+
+	if (restartTime < 0.0)
+		return new DataFileStream(fileName.c_str(), OVERWRITE, 2, 0, false, 6, false);
+
+	std::vector<std::string> rows;
+	std::ifstream in(fileName.c_str());
+	std::string row;
+	while (std::getline(in, row))
+	{
+		// the last row may be cut by the interruption
+		if (in.eof())
+			break;
+		if (atof(row.c_str()) > restartTime + tol)
+			break;
+		rows.push_back(row);
+	}
+	in.close();
+
+	std::ofstream out(fileName.c_str(), std::ofstream::out | std::ofstream::trunc);
+	for (unsigned int i = 0; i < rows.size(); i++)
+		out << rows[i] << "\n";
+	out.close();
+
+	return new DataFileStream(fileName.c_str(), APPEND, 2, 0, false, 6, false);
+}
+
+// create the solution algorithm named in the json file:
+// Newton (default), ModifiedNewton or KrylovNewton. The last two keep the
+// factored tangent over the following steps until a step needs more than
+// maxReuseIter iterations.
+static EquiSolnAlgo *createSolnAlgo(const std::string &algorithmType)
+{
+	const int maxReuseIter = 10;
+
+	if (!algorithmType.compare("KrylovNewton"))
+		return new KrylovNewton(CURRENT_TANGENT, 3, maxReuseIter);
+	else if (!algorithmType.compare("ModifiedNewton"))
+		return new ModifiedNewton(CURRENT_TANGENT, maxReuseIter);
+
+	if (algorithmType.compare("Newton"))
+		opserr << "Unknown algorithm " << algorithmType.c_str() << ", using Newton." << endln;
+	return new NewtonRaphson();
+}
+
 SiteResponseModel::SiteResponseModel() : theModelType("2D"),
 										 theMotionX(0),
 										 theMotionZ(0),
-										 theOutputDir(".")
+										 theOutputDir("."),
+										 theNumWorkers(0),
+										 theRecordToMemory(false),
+										 theAsyncWriter(0),
+										 theStopFlag(NULL)
 {
 }
 
@@ -111,7 +241,11 @@ SiteResponseModel::SiteResponseModel(SiteLayering layering, std::string modelTyp
 																																	 theModelType(modelType),
 																																	 theMotionX(motionX),
 																																	 theMotionZ(motionY),
-																																	 theOutputDir(".")
+																																	 theOutputDir("."),
+																																	 theNumWorkers(0),
+																																	 theRecordToMemory(false),
+																																	 theAsyncWriter(0),
+																																	 theStopFlag(NULL)
 {
 	if (theMotionX->isInitialized() || theMotionZ->isInitialized())
 		theDomain = new Domain();
@@ -125,7 +259,11 @@ SiteResponseModel::SiteResponseModel(SiteLayering layering, std::string modelTyp
 SiteResponseModel::SiteResponseModel(SiteLayering layering, std::string modelType, OutcropMotion *motionX) : SRM_layering(layering),
 																											 theModelType(modelType),
 																											 theMotionX(motionX),
-																											 theOutputDir(".")
+																											 theOutputDir("."),
+																											 theNumWorkers(0),
+																											 theRecordToMemory(false),
+																											 theAsyncWriter(0),
+																											 theStopFlag(NULL)
 {
 	if (theMotionX->isInitialized())
 		theDomain = new Domain();
@@ -141,6 +279,180 @@ SiteResponseModel::~SiteResponseModel()
 	if (theDomain != NULL)
 		delete theDomain;
 	theDomain = NULL;
+
+	// after the domain, the recorders may still have rows to write
+	if (theAsyncWriter != NULL)
+		delete theAsyncWriter;
+}
+
+void SiteResponseModel::addBatchMotion(OutcropMotion *motion, std::string outDir)
+{
+	theBatchMotions.push_back(motion);
+	theBatchOutputDirs.push_back(outDir);
+}
+
+const ResponseHistory *SiteResponseModel::getResponse(const std::string &name) const
+{
+	std::map<std::string, ResponseHistory>::const_iterator it = theResponses.find(name);
+	if (it == theResponses.end())
+		return NULL;
+	return &(it->second);
+}
+
+std::vector<std::string> SiteResponseModel::getResponseNames() const
+{
+	std::vector<std::string> names;
+	std::map<std::string, ResponseHistory>::const_iterator it;
+	for (it = theResponses.begin(); it != theResponses.end(); ++it)
+		names.push_back(it->first);
+	return names;
+}
+
+// the stream of a recorder: a file, written by the writer thread with
+// asynchronous output, or with in-memory output a ResponseHistory named
+// after the file and preallocated for expectedRows
+OPS_Stream *SiteResponseModel::openRecordStream(const std::string &fileName, double restartTime, double tol, bool binary, int expectedRows)
+{
+	if (!theRecordToMemory)
+	{
+		OPS_Stream *theStream = createRecordStream(fileName, restartTime, tol, binary);
+		if (theAsyncWriter != NULL)
+			theStream = new AsyncStream(theStream, *theAsyncWriter);
+		return theStream;
+	}
+
+	std::string name = fileName;
+	size_t pos = name.rfind(PATH_SEPARATOR);
+	if (pos != std::string::npos)
+		name = name.substr(pos + 1);
+	return new MemoryStream(theResponses[name], expectedRows);
+}
+
+// the stop flag is checked between the stages, the progress callback after
+// every step of the dynamic analysis
+bool SiteResponseModel::stopRequested() const
+{
+	if (theStopFlag != NULL && *theStopFlag)
+	{
+		opserr << "Site response analysis stopped" << endln;
+		return true;
+	}
+	return false;
+}
+
+// Forks one worker process per batch motion, with at most theNumWorkers
+// running at a time. Every worker starts from a copy of the committed
+// post-gravity state of the parent. Returns the index of the motion in a
+// worker, and -1 in the parent once all workers are done, with batchStatus
+// set to 0 if all of them succeeded.
+//
+// With OpenMP the parent must not have run a parallel region with more
+// than one thread before the fork: the thread pool of libgomp is not
+// copied to the children, which then hang in their first parallel region.
+// buildEffectiveStressModel2D runs the static stages on one thread when
+// batch motions are queued; every worker gets numThreads / numWorkers
+// threads back.
+int SiteResponseModel::forkBatchWorkers(int &batchStatus, int numThreads)
+{
+	batchStatus = -1;
+#if defined(WIN32) || defined(_WIN32)
+	opserr << "WARNING SiteResponseModel::forkBatchWorkers - batch mode is not supported on this platform" << endln;
+	return -1;
+#else
+	int numMotions = theBatchMotions.size();
+	const int maxForkRetries = 3;
+	int numWorkers = theNumWorkers;
+	if (numWorkers <= 0)
+		numWorkers = sysconf(_SC_NPROCESSORS_ONLN);
+	if (numWorkers <= 0)
+		numWorkers = 1;
+
+	for (int i = 0; i < numMotions; i++)
+		mkdir(theBatchOutputDirs[i].c_str(), 0755);
+
+	opserr << "Running " << numMotions << " motions on " << numWorkers << " workers" << endln;
+
+	// anything still buffered would be written again by every worker
+	opserr.flush();
+	opsout.flush();
+	std::cout.flush();
+	std::cerr.flush();
+
+	std::map<pid_t, int> running;
+	int numFailed = 0;
+	int next = 0;
+	bool waitForWorker = false;
+	int numForkRetries = 0;
+	while (next < numMotions || !running.empty())
+	{
+		if (next < numMotions && (int)running.size() < numWorkers && !waitForWorker)
+		{
+			pid_t pid = fork();
+			if (pid == 0)
+			{
+				// worker: send the output of this motion to its own log
+				std::string logFile = theBatchOutputDirs[next] + PATH_SEPARATOR + "log";
+				FileStream *theLog = new FileStream(logFile.c_str(), OVERWRITE);
+				opserrPtr = theLog;
+				opsoutPtr = theLog;
+#ifdef _OPENMP
+				omp_set_num_threads(numThreads > numWorkers ? numThreads / numWorkers : 1);
+#endif
+				return next;
+			}
+			else if (pid < 0)
+			{
+				// out of processes or memory for now: the motion is tried
+				// again once a running worker is done, or after a second if
+				// none is running, and only fails after maxForkRetries
+				if (!running.empty())
+				{
+					waitForWorker = true;
+					continue;
+				}
+				if (numForkRetries++ < maxForkRetries)
+				{
+					opserr << "WARNING SiteResponseModel::forkBatchWorkers - fork failed for motion " << next << ", trying again" << endln;
+					sleep(1);
+					continue;
+				}
+				opserr << "WARNING SiteResponseModel::forkBatchWorkers - fork failed for motion " << next << endln;
+				numForkRetries = 0;
+				numFailed++;
+				next++;
+				continue;
+			}
+			numForkRetries = 0;
+			running[pid] = next++;
+			continue;
+		}
+
+		int status = 0;
+		pid_t pid = waitpid(-1, &status, 0);
+		if (pid < 0)
+			break;
+		waitForWorker = false;
+		std::map<pid_t, int>::iterator it = running.find(pid);
+		if (it == running.end())
+			continue;
+
+		int motion = it->second;
+		running.erase(it);
+		if (WIFEXITED(status) && WEXITSTATUS(status) == 0)
+			opserr << "Motion " << motion << " done: " << theBatchOutputDirs[motion].c_str() << endln;
+		else
+		{
+			opserr << "WARNING Motion " << motion << " failed: " << theBatchOutputDirs[motion].c_str() << endln;
+			numFailed++;
+		}
+		opserr.flush();
+	}
+
+	opserr << "Batch done, " << numMotions - numFailed << " of " << numMotions << " motions succeeded" << endln;
+	if (numFailed == 0)
+		batchStatus = 0;
+	return -1;
+#endif
 }
 
 
@@ -164,11 +476,33 @@ int SiteResponseModel::buildEffectiveStressModel2D()
 	// ------------------------------------------
 	//std::string configFile = "/Users/simcenter/Codes/SimCenter/SiteResponseTool/bin/SRT.json";
 	std::string configFile = "/Users/simcenter/Codes/SimCenter/build-SiteResponseTool-Desktop_Qt_5_11_1_clang_64bit-Debug/SiteResponseTool.app/Contents/MacOS/SRT.json";
+	if (!theConfigFile.empty())
+		configFile = theConfigFile;
     std::ifstream i(configFile);
     if(!i)
-        return false;// failed to open SRT.json TODO: print to log
+    {
+        opserr << "WARNING SiteResponseModel::buildEffectiveStressModel2D - can not open " << configFile.c_str() << endln;
+        return -1;
+    }
     json SRT;
-    i >> SRT;
+    try
+    {
+        i >> SRT;
+    }
+    catch (std::exception& e)
+    {
+        opserr << "WARNING SiteResponseModel::buildEffectiveStressModel2D - can not parse " << configFile.c_str() << ": " << e.what() << endln;
+        return -1;
+    }
+
+	// batch mode forks the workers after the static stages; those must run
+	// on one thread (see forkBatchWorkers)
+	int numThreads = 1;
+#ifdef _OPENMP
+	numThreads = omp_get_max_threads();
+	if (!theBatchMotions.empty())
+		omp_set_num_threads(1);
+#endif
 
 	// set outputs for tcl 
 	ofstream s ("/Users/simcenter/Codes/SimCenter/build-SiteResponseTool-Desktop_Qt_5_11_1_clang_64bit-Debug/SiteResponseTool.app/Contents/MacOS/model.tcl", std::ofstream::out);
@@ -185,6 +519,23 @@ int SiteResponseModel::buildEffectiveStressModel2D()
     json basicSettings;
     double dampingCoeff,dashpotCoeff,groundWaterTable,rockDen,rockVs;
     std::string groundMotion;
+    std::string systemType;
+    std::string algorithmType;
+    std::string gravityStateFile;
+    std::string outputFormat;
+    int checkpointInterval = 0;
+    bool restart = false;
+    bool recordHistories = true;
+    int recordDecimation = 1;
+    double recordStartTime = 0.0;
+    double recordEndTime = 1.0e30;
+    double recordTriggerAccel = 0.0;
+    bool asyncOutput = false;
+    bool motionPrecompute = false;
+    int baselineOrder = -1;
+    double motionPadTime = 0.0;
+    double motionTaperTime = 0.0;
+    int materialBatchSize = 0;
     try
     {
         basicSettings = SRT["basicSettings"];
@@ -195,13 +546,30 @@ int SiteResponseModel::buildEffectiveStressModel2D()
         rockDen = basicSettings["rockDen"];
         rockVs = basicSettings["rockVs"];
 		sElemX = basicSettings["eSizeH"];
+		systemType = basicSettings.value("system", std::string("SparseGeneral"));
+		algorithmType = basicSettings.value("algorithm", std::string("Newton"));
+		gravityStateFile = basicSettings.value("gravityState", std::string(""));
+		checkpointInterval = basicSettings.value("checkpointInterval", 0);
+		restart = basicSettings.value("restart", false);
+		outputFormat = basicSettings.value("outputFormat", std::string("text"));
+		recordHistories = basicSettings.value("recordHistories", true);
+		recordDecimation = basicSettings.value("recordDecimation", 1);
+		recordStartTime = basicSettings.value("recordStartTime", 0.0);
+		recordEndTime = basicSettings.value("recordEndTime", 1.0e30);
+		recordTriggerAccel = basicSettings.value("recordTriggerAccel", 0.0);
+		asyncOutput = basicSettings.value("asyncOutput", false);
+		motionPrecompute = basicSettings.value("motionPrecompute", false);
+		baselineOrder = basicSettings.value("baselineOrder", -1);
+		motionPadTime = basicSettings.value("motionPadTime", 0.0);
+		motionTaperTime = basicSettings.value("motionTaperTime", 0.0);
+		materialBatchSize = basicSettings.value("materialBatchSize", 0);
         if (sElemX<minESizeH)
         {
             std::string err = "eSizeH is tool small. change it in the json file.";throw err;
         }
     }
-    catch (std::exception& e){std::cerr << "Standard exception: " << e.what() << std::endl;return false;}
-    catch(std::string str){std::cerr << str << std::endl;return false;}
+    catch (std::exception& e){std::cerr << "Standard exception: " << e.what() << std::endl;return -1;}
+    catch(std::string str){std::cerr << str << std::endl;return -1;}
 
 
 	std::vector<int> layerNumElems;
@@ -326,7 +694,7 @@ int SiteResponseModel::buildEffectiveStressModel2D()
 				nb<< " " <<nd<< " " <<Ado<< " " <<z_max<< " " <<cz<< " " <<ce<< " " <<phic<< " " <<nu<< " " <<cgd<< " " <<cdr<< " " <<ckaf<< " " <<
 				Q<< " " <<R<< " " <<m<< " " <<Fsed_min<< " " <<p_sedo << endln;
 			}
-			OPS_addNDMaterial(theMat);
+			else {std::string err = "unknown material type " + matType + ".";throw err;}
 			if (PRINTDEBUG) opserr << "Material " << matType.c_str() << ", tag = " << matTag << endln;
 
 
@@ -376,11 +744,15 @@ int SiteResponseModel::buildEffectiveStressModel2D()
                 numNodes += 2;
 				numElems += 1;
             }
+			// the elements keep their own copies of the material. It is not
+			// added to the process-wide material map (OPS_addNDMaterial), which
+			// models built on other threads would write to at the same time.
+			delete theMat;
             std::cout << "layer tag: " << lTag << std::endl;
         }
     }
-    catch (std::exception& e){std::cerr << "Standard exception: " << e.what() << std::endl;return false;}
-    catch(std::string str){std::cerr << str << std::endl;return false;}
+    catch (std::exception& e){std::cerr << "Standard exception: " << e.what() << std::endl;return -1;}
+    catch(std::string str){std::cerr << str << std::endl;return -1;}
 	s << "\n\n";
 
 
@@ -458,6 +830,10 @@ int SiteResponseModel::buildEffectiveStressModel2D()
 	for (int i=0; i != soilMatTags.size(); i++)
 		s << "updateMaterialStage -material "<< soilMatTags[i] <<" -stage 0" << endln << endln ; 
 
+	// the strains of the materials of a layer are set in batches of
+	// materialBatchSize integration points, 0 sets them one by one
+	theDomain->setMaterialBatchSize(materialBatchSize);
+
 
 
 	// create the output streams
@@ -484,9 +860,9 @@ int SiteResponseModel::buildEffectiveStressModel2D()
 
 	s << "constraints Transformation" << endln;
 	s << "test NormDispIncr 1.0e-4 35 1" << endln;
-	s << "algorithm   Newton" << endln;
+	s << "algorithm   " << algorithmType << endln;
 	s << "numberer RCM" << endln;
-	s << "system BandGeneral" << endln;
+	s << "system " << (systemType.compare("BandGeneral") ? "SparseGeneral" : "BandGeneral") << endln; // no block tridiagonal system in tcl
 	s << "set gamma " << gamma << endln;
 	s << "set beta " << beta << endln;
 	s << "integrator  Newmark $gamma $beta" << endln;
@@ -499,15 +875,14 @@ int SiteResponseModel::buildEffectiveStressModel2D()
 	// create analysis objects - I use static analysis for gravity
 	AnalysisModel *theModel = new AnalysisModel();
 	CTestNormDispIncr *theTest = new CTestNormDispIncr(1.0e-4, 35, 1);                    // 2. test NormDispIncr 1.0e-7 30 1
-	EquiSolnAlgo *theSolnAlgo = new NewtonRaphson(*theTest);                              // 3. algorithm   Newton (TODO: another option: KrylovNewton) 
+	EquiSolnAlgo *theSolnAlgo = createSolnAlgo(algorithmType);                            // 3. algorithm   Newton (other options: ModifiedNewton, KrylovNewton)
 	//StaticIntegrator *theIntegrator = new LoadControl(0.05, 1, 0.05, 1.0); // *
 	//ConstraintHandler *theHandler = new TransformationConstraintHandler(); // *
 	TransientIntegrator* theIntegrator = new Newmark(5./6., 4./9.);// * Newmark(0.5, 0.25) // 6. integrator  Newmark $gamma $beta
 	ConstraintHandler* theHandler = new PenaltyConstraintHandler(1.0e16, 1.0e16);          // 1. constraints Penalty 1.0e15 1.0e15
 	RCM *theRCM = new RCM();
 	DOF_Numberer *theNumberer = new DOF_Numberer(*theRCM);                                 // 4. numberer RCM (another option: Plain)
-	BandGenLinSolver *theSolver = new BandGenLinLapackSolver();                            // 5. system BandGeneral (TODO: switch to SparseGeneral)
-	LinearSOE *theSOE = new BandGenLinSOE(*theSolver);
+	LinearSOE *theSOE = createLinearSOE(systemType);                                      // 5. system SparseGeneral (other options: BlockTriDiagonal, BandGeneral)
 
 	DirectIntegrationAnalysis* theAnalysis;												   // 7. analysis    Transient
 	theAnalysis = new DirectIntegrationAnalysis(*theDomain, *theHandler, *theNumberer, *theModel, *theSolnAlgo, *theSOE, *theIntegrator, theTest);
@@ -519,15 +894,35 @@ int SiteResponseModel::buildEffectiveStressModel2D()
 	//theAnalysis = new StaticAnalysis(*theDomain, *theHandler, *theNumberer, *theModel, *theSolnAlgo, *theSOE, *theIntegrator); // *
 	theAnalysis->setConvergenceTest(*theTest);
 
-	int converged = theAnalysis->analyze(10,1.0); 
-	if (!converged)
+	// the post gravity state is read from gravityStateFile if it exists,
+	// otherwise it is written to it after the gravity analysis
+	FEM_ObjectBroker theBroker;
+	bool restoreGravity = false;
+	if (!gravityStateFile.empty())
 	{
-		opserr << "Converged at time " << theDomain->getCurrentTime() << endln;
-	} else
+		BinaryFileDatastore theGravityState(gravityStateFile.c_str(), *theDomain, theBroker);
+		restoreGravity = (theGravityState.getCommitTag() == 0);
+	}
+
+	int converged = 0;
+	if (this->stopRequested())
+		return -2;
+	if (restoreGravity)
+		opserr << "Gravity analysis skipped, the post gravity state is read from " << gravityStateFile.c_str() << endln;
+	else
 	{
-		opserr << "Didn't converge at time " << theDomain->getCurrentTime() << endln;
+		converged = theAnalysis->analyze(10,1.0); 
+		if (!converged)
+		{
+			opserr << "Converged at time " << theDomain->getCurrentTime() << endln;
+		} else
+		{
+			opserr << "Didn't converge at time " << theDomain->getCurrentTime() << endln;
+		}
+		opserr << "Finished with elastic gravity analysis..." << endln << endln;
 	}
-	opserr << "Finished with elastic gravity analysis..." << endln << endln;
+	if (this->stopRequested())
+		return -2;
 
 
 
@@ -594,16 +989,21 @@ int SiteResponseModel::buildEffectiveStressModel2D()
 	}
 	s << endln;
 
-	converged = theAnalysis->analyze(10,1.0); 
 	s << "analyze     10 1.0" << endln;
-	if (!converged)
-	{
-		opserr << "Converged at time " << theDomain->getCurrentTime() << endln;
-	} else
+	if (!restoreGravity)
 	{
-		opserr << "Didn't converge at time " << theDomain->getCurrentTime() << endln;
+		converged = theAnalysis->analyze(10,1.0); 
+		if (!converged)
+		{
+			opserr << "Converged at time " << theDomain->getCurrentTime() << endln;
+		} else
+		{
+			opserr << "Didn't converge at time " << theDomain->getCurrentTime() << endln;
+		}
+		opserr << "Finished with plastic gravity analysis..." endln;
 	}
-	opserr << "Finished with plastic gravity analysis..." endln;
+	if (this->stopRequested())
+		return -2;
 	s << "puts \"Finished with plastic gravity analysis...\"" << endln << endln;
 	
 
@@ -677,7 +1077,6 @@ int SiteResponseModel::buildEffectiveStressModel2D()
 	int numberTheViscousMats = 1; // for 3D it's 2
 	UniaxialMaterial *theViscousMats[numberTheViscousMats];
 	theViscousMats[0] = new ViscousMaterial(dashMatTag, vis_C, 1.0);
-	OPS_addUniaxialMaterial(theViscousMats[0]);
 	
 	s << "set colThickness "<< colThickness << endln;
 	s << "set sElemX " << sElemX << endln;
@@ -692,7 +1091,6 @@ int SiteResponseModel::buildEffectiveStressModel2D()
 	if (theModelType.compare("2D")) // 3D
 	{
 		theViscousMats[1] = new ViscousMaterial(numLayers + 20, vis_C, 1.0);
-		OPS_addUniaxialMaterial(theViscousMats[1]);
 		// TODO: s << 
 	}
 	*/
@@ -781,6 +1179,9 @@ int SiteResponseModel::buildEffectiveStressModel2D()
 	//element zeroLength [expr $nElemT+1]  $dashF $dashS -mat [expr $numLayers+1]  -dir 1
 	theEle = new ZeroLength(numElems + 1, 2, numNodes + 1, numNodes + 2, x, y, 1, theViscousMats, directions); //TODO ?
 	theDomain->addElement(theEle);
+	// the element keeps its own copies, as for the soil materials
+	for (int i = 0; i < numberTheViscousMats; i++)
+		delete theViscousMats[i];
 	s << "element zeroLength "<<numElems + 1 <<" "<< numNodes + 1 <<" "<< numNodes + 2<<" -mat "<<dashMatTag<<"  -dir 1" << endln;
 	s << "\n\n\n";
 	
@@ -798,6 +1199,53 @@ int SiteResponseModel::buildEffectiveStressModel2D()
 	delete theAnalysis;
 	theDomain->removeRecorders();
 
+	if (!gravityStateFile.empty())
+	{
+		BinaryFileDatastore theGravityState(gravityStateFile.c_str(), *theDomain, theBroker);
+		if (restoreGravity)
+		{
+			if (theGravityState.restoreState(0) < 0)
+			{
+				opserr << "WARNING SiteResponseModel - failed to read the post gravity state from " << gravityStateFile.c_str() << endln;
+				return -1;
+			}
+		}
+		else if (theGravityState.commitState(0) < 0)
+			opserr << "WARNING SiteResponseModel - failed to write the post gravity state to " << gravityStateFile.c_str() << endln;
+	}
+
+	if (this->stopRequested())
+		return -2;
+
+	// batch mode: from here on every motion runs in its own worker process
+	if (!theBatchMotions.empty())
+	{
+		s.close();
+
+		int batchStatus;
+		int motion = forkBatchWorkers(batchStatus, numThreads);
+		if (motion < 0)
+			return batchStatus;
+
+		theMotionX = theBatchMotions[motion];
+		theOutputDir = theBatchOutputDirs[motion];
+	}
+
+	// a checkpoint of the dynamic analysis is written every checkpointInterval
+	// steps, and read again when the analysis is restarted
+	std::string checkpointFile = theOutputDir + PATH_SEPARATOR + "checkpoint.bin";
+	BinaryFileDatastore theCheckpoint(checkpointFile.c_str(), *theDomain, theBroker);
+	int restartStep = 0;
+	if (restart)
+	{
+		restartStep = theCheckpoint.getCommitTag();
+		if (restartStep < 0)
+		{
+			opserr << "No checkpoint found in " << checkpointFile.c_str() << ", starting from the beginning" << endln;
+			restartStep = 0;
+		}
+	}
+
 
 
 
@@ -817,14 +1265,46 @@ int SiteResponseModel::buildEffectiveStressModel2D()
 	s << "# ------------------------------------------------------------\n";
 	s << "# 5.1 Apply the rock motion                                    \n";
 	s << "# ------------------------------------------------------------\n\n";
-	int numSteps = 0;
-	std::vector<double> dt;
-
+	// the steps of the record being run (in batch mode the one of this
+	// worker); the analysis runs over the whole record, and the padding of
+	// a precomputed motion
+	std::vector<double> recordDT = theMotionX->getDTvector();
+	int nSteps = theMotionX->getNumSteps(); // number of motions in the record
+	if (nSteps < 1 || recordDT.empty())
+	{
+		opserr << "WARNING SiteResponseModel - the motion has no time steps" << endln;
+		return -1;
+	}
+	double motionDuration = 0.0;
+	for (unsigned int i = 0; i < recordDT.size(); i++)
+		motionDuration += recordDT[i];
+	if (motionPrecompute)
+		motionDuration += motionPadTime;
 
 	double dT = 0.001; // This is the time step in solution
-	double motionDT =  0.005; // This is the time step in the motion record. TODO: use a funciton to get it
-	int nSteps = 1998;//theMotionX->getNumSteps() ; //1998; // number of motions in the record. TODO: use a funciton to get it
-	int remStep = nSteps * motionDT / dT;
+	double motionDT = recordDT[0]; // This is the time step in the motion record, the recorders record at it
+	int remStep = (int)(motionDuration / dT + 0.5);
+
+	// keep the checkpoints on the steps that are recorded, so a restarted
+	// analysis records at the same times
+	int recordInterval = (int)(motionDT / dT + 0.5);
+	if (checkpointInterval > 0 && recordInterval > 1)
+		checkpointInterval = ((checkpointInterval + recordInterval - 1) / recordInterval) * recordInterval;
+	double restartTime = (restartStep > 0) ? restartStep * dT : -1.0;
+	std::vector<OPS_Stream *> theRecordStreams;
+	std::vector<Recorder *> theHistoryRecorders;
+	// the recorders write text (precision 6) or chunked binary files
+	bool binaryOutput = !outputFormat.compare("binary");
+	// or kept in memory, preallocated for the steps of the motion
+	if (!outputFormat.compare("memory"))
+		theRecordToMemory = true;
+	theResponses.clear();
+	// the recorders write a row every recordInterval analysis steps (every
+	// step when the record is finer than dT), over the whole motion
+	int numRecordRows = ((recordInterval > 1) ? remStep / recordInterval : remStep) + 1;
+	// the rows of the files are formatted and written on another thread
+	if (asyncOutput && !theRecordToMemory && theAsyncWriter == NULL)
+		theAsyncWriter = new AsyncStreamWriter();
 	s << "set dT " << dT << endln;
 	s << "set motionDT " << motionDT << endln;
 	s << "set mSeries \"Path -dt $motionDT -filePath /Users/simcenter/Codes/SimCenter/SiteResponseTool/test/RSN766_G02_000_VEL.txt -factor $cFactor\""<<endln;
@@ -832,7 +1312,18 @@ int SiteResponseModel::buildEffectiveStressModel2D()
 	if (theMotionX->isInitialized())
 	{
 		LoadPattern *theLP = new LoadPattern(1, vis_C);
-		theLP->setTimeSeries(theMotionX->getVelSeries());
+		TimeSeries *theVelSeries = theMotionX->getVelSeries();
+		// integrate the motion once now, not in the first steps, on the
+		// first time step of the record, as the equivalent linear model
+		if (motionPrecompute)
+		{
+			GroundMotion *theGroundMotion = theMotionX->getGroundMotion();
+			if (theGroundMotion->precompute(motionDT, baselineOrder, motionPadTime, motionTaperTime) == 0)
+				theVelSeries = theGroundMotion->getPrecomputedSeries(1);
+			else
+				opserr << "WARNING SiteResponseModel - could not precompute the motion, using the velocity record" << endln;
+		}
+		theLP->setTimeSeries(theVelSeries);
 
 		NodalLoad *theLoad;
 		int numLoads = 3; // for 3D it's 4
@@ -850,14 +1341,6 @@ int SiteResponseModel::buildEffectiveStressModel2D()
 		s << "pattern Plain 10 $mSeries {"<<endln;
 		s << "    load 1  1.0 0.0 0.0" << endln;
 		s << "}" << endln << endln;
-
-		// update the number of steps as well as the dt vector
-		int temp = theMotionX->getNumSteps();
-		if (temp > numSteps)
-		{
-			numSteps = temp;
-			dt = theMotionX->getDTvector();
-		}
 	}
 
 
@@ -874,9 +1357,9 @@ int SiteResponseModel::buildEffectiveStressModel2D()
 
 	s << "constraints Transformation" << endln; 
 	s << "test NormDispIncr 1.0e-4 35 0" << endln; // TODO
-	s << "algorithm   Newton" << endln;
+	s << "algorithm   " << algorithmType << endln;
 	s << "numberer    RCM" << endln;
-	s << "system BandGeneral" << endln;
+	s << "system " << (systemType.compare("BandGeneral") ? "SparseGeneral" : "BandGeneral") << endln; // no block tridiagonal system in tcl
 
 
 
@@ -885,15 +1368,14 @@ int SiteResponseModel::buildEffectiveStressModel2D()
 	// create analysis objects - I use static analysis for gravity
 	theModel = new AnalysisModel();
 	theTest = new CTestNormDispIncr(1.0e-4, 35, 1);                    // 2. test NormDispIncr 1.0e-7 30 1
-	theSolnAlgo = new NewtonRaphson(*theTest);                              // 3. algorithm   Newton (TODO: another option: KrylovNewton) 
+	theSolnAlgo = createSolnAlgo(algorithmType);                            // 3. algorithm   Newton (other options: ModifiedNewton, KrylovNewton)
 	//StaticIntegrator *theIntegrator = new LoadControl(0.05, 1, 0.05, 1.0); // *
 	//ConstraintHandler *theHandler = new TransformationConstraintHandler(); // *
 	//TransientIntegrator* theIntegrator = new Newmark(5./6., 4./9.);// * Newmark(0.5, 0.25) // 6. integrator  Newmark $gamma $beta
 	theHandler = new PenaltyConstraintHandler(1.0e16, 1.0e16);          // 1. constraints Penalty 1.0e15 1.0e15
 	theRCM = new RCM();
 	theNumberer = new DOF_Numberer(*theRCM);                                 // 4. numberer RCM (another option: Plain)
-	theSolver = new BandGenLinLapackSolver();                            // 5. system BandGeneral (TODO: switch to SparseGeneral)
-	theSOE = new BandGenLinSOE(*theSolver);
+	theSOE = createLinearSOE(systemType);                                // 5. system SparseGeneral (other options: BlockTriDiagonal, BandGeneral)
 
 
 	//VariableTimeStepDirectIntegrationAnalysis* theAnalysis;
@@ -938,8 +1420,9 @@ int SiteResponseModel::buildEffectiveStressModel2D()
 	}
 	theDomain->setRayleighDampingFactors(a0, a1, 0.0, 0.0);
 
-	DirectIntegrationAnalysis* theTransientAnalysis;
-	theTransientAnalysis = new DirectIntegrationAnalysis(*theDomain, *theHandler, *theNumberer, *theModel, *theSolnAlgo, *theSOE, *theTransientIntegrator, theTest);
+	// steps that do not converge are bisected (up to 10 times, as in the tcl subStepAnalyze proc)
+	SubSteppingDirectIntegrationAnalysis* theTransientAnalysis;
+	theTransientAnalysis = new SubSteppingDirectIntegrationAnalysis(*theDomain, *theHandler, *theNumberer, *theModel, *theSolnAlgo, *theSOE, *theTransientIntegrator, theTest, 10);
 
 	//VariableTimeStepDirectIntegrationAnalysis *theTransientAnalysis;
 	//theTransientAnalysis = new VariableTimeStepDirectIntegrationAnalysis(*theDomain, *theHandler, *theNumberer, *theModel, *theSolnAlgo, *theSOE, *theTransientIntegrator, theTest);
@@ -975,19 +1458,25 @@ int SiteResponseModel::buildEffectiveStressModel2D()
 
 	// Record the response at the surface
 	std::string outFile = theOutputDir + PATH_SEPARATOR + "surface.acc";
-	theOutputStream = new DataFileStream(outFile.c_str(), OVERWRITE, 2, 0, false, 6, false);
+	theOutputStream = this->openRecordStream(outFile, restartTime, 0.5 * dT, binaryOutput, numRecordRows);
+	theRecordStreams.push_back(theOutputStream);
 	theRecorder = new NodeRecorder(dofToRecord, &nodesToRecord, 0, "accel", *theDomain, *theOutputStream, motionDT, true, NULL);
 	theDomain->addRecorder(*theRecorder);
+	theHistoryRecorders.push_back(theRecorder);
 
 	outFile = theOutputDir + PATH_SEPARATOR + "surface.vel";
-	theOutputStream = new DataFileStream(outFile.c_str(), OVERWRITE, 2, 0, false, 6, false);
+	theOutputStream = this->openRecordStream(outFile, restartTime, 0.5 * dT, binaryOutput, numRecordRows);
+	theRecordStreams.push_back(theOutputStream);
 	theRecorder = new NodeRecorder(dofToRecord, &nodesToRecord, 0, "vel", *theDomain, *theOutputStream, motionDT, true, NULL);
 	theDomain->addRecorder(*theRecorder);
+	theHistoryRecorders.push_back(theRecorder);
 
 	outFile = theOutputDir + PATH_SEPARATOR + "surface.disp";
-	theOutputStream = new DataFileStream(outFile.c_str(), OVERWRITE, 2, 0, false, 6, false);
+	theOutputStream = this->openRecordStream(outFile, restartTime, 0.5 * dT, binaryOutput, numRecordRows);
+	theRecordStreams.push_back(theOutputStream);
 	theRecorder = new NodeRecorder(dofToRecord, &nodesToRecord, 0, "disp", *theDomain, *theOutputStream, motionDT, true, NULL);
 	theDomain->addRecorder(*theRecorder);
+	theHistoryRecorders.push_back(theRecorder);
 
 	s<< "eval \"recorder Node -file out_tcl/surface.disp -time -dT $motionDT -node "<<numNodes<<" -dof 1 2 3  disp\""<<endln;// 1 2
 	s<< "eval \"recorder Node -file out_tcl/surface.acc -time -dT $motionDT -node "<<numNodes<<" -dof 1 2 3  accel\""<<endln;// 1 2
@@ -1003,19 +1492,46 @@ int SiteResponseModel::buildEffectiveStressModel2D()
 	dofToRecord(0) = 0; // only record the x dof
 
 	outFile = theOutputDir + PATH_SEPARATOR + "base.acc";
-	theOutputStream = new DataFileStream(outFile.c_str(), OVERWRITE, 2, 0, false, 6, false);
+	theOutputStream = this->openRecordStream(outFile, restartTime, 0.5 * dT, binaryOutput, numRecordRows);
+	theRecordStreams.push_back(theOutputStream);
 	theRecorder = new NodeRecorder(dofToRecord, &nodesToRecord, 0, "accel", *theDomain, *theOutputStream, motionDT, true, NULL);
 	theDomain->addRecorder(*theRecorder);
+	theHistoryRecorders.push_back(theRecorder);
 
 	outFile = theOutputDir + PATH_SEPARATOR + "base.vel";
-	theOutputStream = new DataFileStream(outFile.c_str(), OVERWRITE, 2, 0, false, 6, false);
+	theOutputStream = this->openRecordStream(outFile, restartTime, 0.5 * dT, binaryOutput, numRecordRows);
+	theRecordStreams.push_back(theOutputStream);
 	theRecorder = new NodeRecorder(dofToRecord, &nodesToRecord, 0, "vel", *theDomain, *theOutputStream, motionDT, true, NULL);
 	theDomain->addRecorder(*theRecorder);
+	theHistoryRecorders.push_back(theRecorder);
 
 	outFile = theOutputDir + PATH_SEPARATOR + "base.disp";
-	theOutputStream = new DataFileStream(outFile.c_str(), OVERWRITE, 2, 0, false, 6, false);
+	theOutputStream = this->openRecordStream(outFile, restartTime, 0.5 * dT, binaryOutput, numRecordRows);
+	theRecordStreams.push_back(theOutputStream);
 	theRecorder = new NodeRecorder(dofToRecord, &nodesToRecord, 0, "disp", *theDomain, *theOutputStream, motionDT, true, NULL);
 	theDomain->addRecorder(*theRecorder);
+	theHistoryRecorders.push_back(theRecorder);
+
+	// response and Fourier spectra of the surface acceleration and their ratio to the base ones.
+	// The oscillator state is not in the checkpoint, so a restarted run has no spectra.
+	if (restartTime < 0.0)
+	{
+		int numPeriods = 100;
+		Vector periods(numPeriods);
+		for (int i = 0; i < numPeriods; i++)
+			periods(i) = 0.01 * pow(1000.0, i / (numPeriods - 1.0));
+		int numFrequencies = 200;
+		Vector frequencies(numFrequencies);
+		for (int i = 0; i < numFrequencies; i++)
+			frequencies(i) = 0.1 * pow(MAX_FREQUENCY / 0.1, i / (numFrequencies - 1.0));
+
+		OPS_Stream *theSpectrumStream = this->openRecordStream(theOutputDir + PATH_SEPARATOR + "surface.psa", -1.0, 0.0, binaryOutput, 0);
+		OPS_Stream *theFourierStream = this->openRecordStream(theOutputDir + PATH_SEPARATOR + "surface.fas", -1.0, 0.0, binaryOutput, 0);
+		theRecorder = new SpectrumRecorder(numNodes, 0, periods, frequencies, *theDomain, theSpectrumStream, theFourierStream, 0.05, 1);
+		theDomain->addRecorder(*theRecorder);
+	}
+	else
+		opserr << "Restarted analysis: surface.psa and surface.fas are not written" << endln;
 
 	s<< "eval \"recorder Node -file out_tcl/base.disp -time -dT $motionDT -node 1 -dof 1 2 3  disp\""<<endln;// 1 2
 	s<< "eval \"recorder Node -file out_tcl/base.acc -time -dT $motionDT -node 1 -dof 1 2 3  accel\""<<endln;// 1 2
@@ -1027,42 +1543,71 @@ int SiteResponseModel::buildEffectiveStressModel2D()
 	ID pwpNodesToRecord(1);
 	pwpNodesToRecord(0) = 17;
 	outFile = theOutputDir + PATH_SEPARATOR + "pwpLiq.out";
-	theOutputStream = new DataFileStream(outFile.c_str(), OVERWRITE, 2, 0, false, 6, false);
+	theOutputStream = this->openRecordStream(outFile, restartTime, 0.5 * dT, binaryOutput, numRecordRows);
+	theRecordStreams.push_back(theOutputStream);
 	theRecorder = new NodeRecorder(dofToRecord, &pwpNodesToRecord, 0, "vel", *theDomain, *theOutputStream, motionDT, true, NULL);
 	theDomain->addRecorder(*theRecorder);
+	theHistoryRecorders.push_back(theRecorder);
 
 	s<< "eval \"recorder Node -file out_tcl/pwpLiq.out -time -dT $motionDT -node 17 -dof 3 vel\""<<endln;
 
 
-	// Record the response of all nodes
+	// Record the response of all nodes, the full histories unless
+	// recordHistories is false, and their envelopes
 	nodesToRecord.resize(numNodes);
 	for (int i=0;i<numNodes;i++)
 		nodesToRecord(i) = i;
 	dofToRecord.resize(2);
 	dofToRecord(0) = 0;
 	dofToRecord(1) = 1;
+	ID ppDofToRecord(1);
+	ppDofToRecord(0) = 2;
 
-	outFile = theOutputDir + PATH_SEPARATOR + "displacement.out";
-	theOutputStream = new DataFileStream(outFile.c_str(), OVERWRITE, 2, 0, false, 6, false);
-	theRecorder = new NodeRecorder(dofToRecord, &nodesToRecord, 0, "disp", *theDomain, *theOutputStream, motionDT, true, NULL);
-	theDomain->addRecorder(*theRecorder);
-
-	outFile = theOutputDir + PATH_SEPARATOR + "velocity.out";
-	theOutputStream = new DataFileStream(outFile.c_str(), OVERWRITE, 2, 0, false, 6, false);
-	theRecorder = new NodeRecorder(dofToRecord, &nodesToRecord, 0, "vel", *theDomain, *theOutputStream, motionDT, true, NULL);
-	theDomain->addRecorder(*theRecorder);
-
-	outFile = theOutputDir + PATH_SEPARATOR + "acceleration.out";
-	theOutputStream = new DataFileStream(outFile.c_str(), OVERWRITE, 2, 0, false, 6, false);
-	theRecorder = new NodeRecorder(dofToRecord, &nodesToRecord, 0, "accel", *theDomain, *theOutputStream, motionDT, true, NULL);
-	theDomain->addRecorder(*theRecorder);
+	if (recordHistories)
+	{
+		outFile = theOutputDir + PATH_SEPARATOR + "displacement.out";
+		theOutputStream = this->openRecordStream(outFile, restartTime, 0.5 * dT, binaryOutput, numRecordRows);
+		theRecordStreams.push_back(theOutputStream);
+		theRecorder = new NodeRecorder(dofToRecord, &nodesToRecord, 0, "disp", *theDomain, *theOutputStream, motionDT, true, NULL);
+		theDomain->addRecorder(*theRecorder);
+		theHistoryRecorders.push_back(theRecorder);
+
+		outFile = theOutputDir + PATH_SEPARATOR + "velocity.out";
+		theOutputStream = this->openRecordStream(outFile, restartTime, 0.5 * dT, binaryOutput, numRecordRows);
+		theRecordStreams.push_back(theOutputStream);
+		theRecorder = new NodeRecorder(dofToRecord, &nodesToRecord, 0, "vel", *theDomain, *theOutputStream, motionDT, true, NULL);
+		theDomain->addRecorder(*theRecorder);
+		theHistoryRecorders.push_back(theRecorder);
+
+		outFile = theOutputDir + PATH_SEPARATOR + "acceleration.out";
+		theOutputStream = this->openRecordStream(outFile, restartTime, 0.5 * dT, binaryOutput, numRecordRows);
+		theRecordStreams.push_back(theOutputStream);
+		theRecorder = new NodeRecorder(dofToRecord, &nodesToRecord, 0, "accel", *theDomain, *theOutputStream, motionDT, true, NULL);
+		theDomain->addRecorder(*theRecorder);
+		theHistoryRecorders.push_back(theRecorder);
+
+		outFile = theOutputDir + PATH_SEPARATOR + "porePressure.out";
+		theOutputStream = this->openRecordStream(outFile, restartTime, 0.5 * dT, binaryOutput, numRecordRows);
+		theRecordStreams.push_back(theOutputStream);
+		theRecorder = new NodeRecorder(ppDofToRecord, &nodesToRecord, 0, "vel", *theDomain, *theOutputStream, motionDT, true, NULL);
+		theDomain->addRecorder(*theRecorder);
+		theHistoryRecorders.push_back(theRecorder);
+	}
 
-	dofToRecord.resize(1);
-	dofToRecord(0) = 2;
-	outFile = theOutputDir + PATH_SEPARATOR + "porePressure.out";
-	theOutputStream = new DataFileStream(outFile.c_str(), OVERWRITE, 2, 0, false, 6, false);
-	theRecorder = new NodeRecorder(dofToRecord, &nodesToRecord, 0, "vel", *theDomain, *theOutputStream, motionDT, true, NULL);
-	theDomain->addRecorder(*theRecorder);
+	// the envelopes are kept in memory and written when the analysis ends,
+	// a restarted run does not have the part before the restart
+	if (restartTime < 0.0)
+	{
+		const char *envelopeFiles[] = {"displacementEnvelope.out", "velocityEnvelope.out", "accelerationEnvelope.out", "porePressureEnvelope.out"};
+		const char *envelopeData[] = {"disp", "vel", "accel", "vel"};
+		for (int i = 0; i < 4; i++)
+		{
+			outFile = theOutputDir + PATH_SEPARATOR + envelopeFiles[i];
+			theOutputStream = this->openRecordStream(outFile, -1.0, 0.0, binaryOutput, 0);
+			theRecorder = new EnvelopeNodeRecorder((i < 3) ? dofToRecord : ppDofToRecord, &nodesToRecord, envelopeData[i], *theDomain, *theOutputStream, motionDT, true, NULL);
+			theDomain->addRecorder(*theRecorder);
+		}
+	}
 
 	s<< "eval \"recorder Node -file out_tcl/displacement.out -time -dT $motionDT -nodeRange 1 "<<numNodes<<" -dof 1 2  disp\""<<endln;
 	s<< "eval \"recorder Node -file out_tcl/velocity.out -time -dT $motionDT -nodeRange 1 "<<numNodes<<" -dof 1 2  vel\""<<endln;
@@ -1076,16 +1621,65 @@ int SiteResponseModel::buildEffectiveStressModel2D()
 	for (int i=0;i<quadElem.size();i+=1)
 		elemsToRecord(i) = quadElem[i];
 	const char* eleArgs = "stress";
-	outFile = theOutputDir + PATH_SEPARATOR + "stress.out";
-	theOutputStream2 = new DataFileStream(outFile.c_str(), OVERWRITE, 2, 0, false, 6, false);
-	theRecorder = new ElementRecorder(&elemsToRecord, &eleArgs, 1, true, *theDomain, *theOutputStream2, motionDT, NULL);
-	theDomain->addRecorder(*theRecorder);
-
 	const char* eleArgsStrain = "strain";
-	outFile = theOutputDir + PATH_SEPARATOR + "strain.out";
-	theOutputStream2 = new DataFileStream(outFile.c_str(), OVERWRITE, 2, 0, false, 6, false);
-	theRecorder = new ElementRecorder(&elemsToRecord, &eleArgsStrain, 1, true, *theDomain, *theOutputStream2, motionDT, NULL);
-	theDomain->addRecorder(*theRecorder);
+	if (recordHistories)
+	{
+		outFile = theOutputDir + PATH_SEPARATOR + "stress.out";
+		theOutputStream2 = this->openRecordStream(outFile, restartTime, 0.5 * dT, binaryOutput, numRecordRows);
+		theRecordStreams.push_back(theOutputStream2);
+		theRecorder = new ElementRecorder(&elemsToRecord, &eleArgs, 1, true, *theDomain, *theOutputStream2, motionDT, NULL);
+		theDomain->addRecorder(*theRecorder);
+		theHistoryRecorders.push_back(theRecorder);
+
+		outFile = theOutputDir + PATH_SEPARATOR + "strain.out";
+		theOutputStream2 = this->openRecordStream(outFile, restartTime, 0.5 * dT, binaryOutput, numRecordRows);
+		theRecordStreams.push_back(theOutputStream2);
+		theRecorder = new ElementRecorder(&elemsToRecord, &eleArgsStrain, 1, true, *theDomain, *theOutputStream2, motionDT, NULL);
+		theDomain->addRecorder(*theRecorder);
+		theHistoryRecorders.push_back(theRecorder);
+	}
+
+	if (restartTime < 0.0)
+	{
+		outFile = theOutputDir + PATH_SEPARATOR + "stressEnvelope.out";
+		theOutputStream2 = this->openRecordStream(outFile, -1.0, 0.0, binaryOutput, 0);
+		theRecorder = new EnvelopeElementRecorder(elemsToRecord, &eleArgs, 1, *theDomain, *theOutputStream2, motionDT, true);
+		theDomain->addRecorder(*theRecorder);
+
+		outFile = theOutputDir + PATH_SEPARATOR + "strainEnvelope.out";
+		theOutputStream2 = this->openRecordStream(outFile, -1.0, 0.0, binaryOutput, 0);
+		theRecorder = new EnvelopeElementRecorder(elemsToRecord, &eleArgsStrain, 1, *theDomain, *theOutputStream2, motionDT, true);
+		theDomain->addRecorder(*theRecorder);
+	}
+	else
+		opserr << "Restarted analysis: the envelope files are not written" << endln;
+
+	// excess pore pressure ratio of the SSPquadUP elements with respect to
+	// the state at the start of the dynamic stage, which is the one now
+	if (restartTime < 0.0)
+	{
+		OPS_Stream *theRuStream = this->openRecordStream(theOutputDir + PATH_SEPARATOR + "ru.out", -1.0, 0.0, binaryOutput, numRecordRows);
+		OPS_Stream *theRuEnvelopeStream = this->openRecordStream(theOutputDir + PATH_SEPARATOR + "ruEnvelope.out", -1.0, 0.0, binaryOutput, 0);
+		PorePressureRatioRecorder *theRuRecorder = new PorePressureRatioRecorder(elemsToRecord, *theDomain, theRuStream, theRuEnvelopeStream, motionDT, true);
+		if (theRuRecorder->setInitialState() == 0)
+		{
+			theDomain->addRecorder(*theRuRecorder);
+			theRecordStreams.push_back(theRuStream);
+		}
+		else
+			delete theRuRecorder; // deletes its streams as well
+	}
+
+	// decimation, time window and trigger on the surface acceleration of the
+	// history recorders. The trigger is not in the checkpoint, a restarted
+	// run waits for it again.
+	Node *theTriggerNode = (recordTriggerAccel > 0.0) ? theDomain->getNode(numNodes) : 0;
+	for (unsigned int i = 0; i < theHistoryRecorders.size(); i++)
+	{
+		theHistoryRecorders[i]->setDecimation(recordDecimation);
+		theHistoryRecorders[i]->setTimeWindow(recordStartTime, recordEndTime);
+		theHistoryRecorders[i]->setTrigger(theTriggerNode, 0, recordTriggerAccel);
+	}
 
 	s<< "recorder Element -file out_tcl/stress.out -time -dT $motionDT  -eleRange 1 "<<numQuadEles<<"  stress 3"<<endln;
 	s<< "recorder Element -file out_tcl/strain.out -time -dT $motionDT  -eleRange 1 "<<numQuadEles<<"  strain"<<endln;
@@ -1195,19 +1789,47 @@ int SiteResponseModel::buildEffectiveStressModel2D()
 	double totalTime = dT * nSteps;
 	int success = 0;
 
+	if (restartStep > 0)
+	{
+		if (theCheckpoint.restoreState(restartStep) < 0)
+		{
+			opserr << "WARNING SiteResponseModel - failed to read the checkpoint " << checkpointFile.c_str() << endln;
+			return -1;
+		}
+		opserr << "Restarting at step " << restartStep << ", time " << theDomain->getCurrentTime() << endln;
+	}
+
 	opserr << "Analysis started:" << endln;
 	std::stringstream progressBar;
-	for (int analysisCount = 0; analysisCount < remStep; ++analysisCount)
+	for (int analysisCount = restartStep; analysisCount < remStep; ++analysisCount)
 	{
 		//int converged = theAnalysis->analyze(1, 0.01, 0.005, 0.02, 1);
-		double stepDT = dt[analysisCount];
 		//int converged = theTransientAnalysis->analyze(1, stepDT, stepDT / 2.0, stepDT * 2.0, 1); // *
 		//int converged = theTransientAnalysis->analyze(1, 0.01, 0.005, 0.02, 1);
+		std::chrono::steady_clock::time_point stepStart = std::chrono::steady_clock::now();
 		int converged = theTransientAnalysis->analyze(1, dT);
 		if (!converged)
 		{
 			opserr << "Converged at time " << theDomain->getCurrentTime() << endln;
 
+			if (theProgressCallback)
+			{
+				AnalysisProgress progress;
+				progress.step = analysisCount + 1;
+				progress.numSteps = remStep;
+				progress.time = theDomain->getCurrentTime();
+				progress.stepTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - stepStart).count();
+				progress.numIterations = theTest->getNumTests();
+				progress.numSubSteps = theTransientAnalysis->getNumSubSteps();
+				progress.numFailedSubSteps = theTransientAnalysis->getNumFailedSubSteps();
+				if (!theProgressCallback(progress))
+				{
+					opserr << "Site response analysis stopped at time " << theDomain->getCurrentTime() << endln;
+					theTransientAnalysis->printStatistics(opserr);
+					return -2;
+				}
+			}
+
 			if (analysisCount % (int)(remStep / 20) == 0)
 			{
 				progressBar << "\r[";
@@ -1221,14 +1843,31 @@ int SiteResponseModel::buildEffectiveStressModel2D()
 				opsout << progressBar.str().c_str();
 				opsout.flush();
 			}
+
+			if (checkpointInterval > 0 && (analysisCount + 1) % checkpointInterval == 0)
+			{
+				// the recorded rows up to the checkpoint have to be in the files
+				for (unsigned int i = 0; i < theRecordStreams.size(); i++)
+					theRecordStreams[i]->flush();
+				if (theCheckpoint.commitState(analysisCount + 1) < 0)
+					opserr << "WARNING SiteResponseModel - failed to write the checkpoint " << checkpointFile.c_str() << endln;
+			}
 		}
 		else
 		{
-			opserr << "Site response analysis did not converge." << endln;
-			exit(-1);
+			opserr << "Site response analysis did not converge at time " << theDomain->getCurrentTime() << endln;
+			theTransientAnalysis->printStatistics(opserr);
+			return -1;
 		}
 	}
 	opserr << "Site response analysis done..." << endln;
+	theTransientAnalysis->printStatistics(opserr);
+
+	// close the recorders, the spectrum recorder writes the spectra now
+	theDomain->removeRecorders();
+	if (theAsyncWriter != NULL)
+		delete theAsyncWriter;
+	theAsyncWriter = NULL;
 	progressBar << "\r[";
 	for (int ii = 0; ii < 20; ii++)
 		progressBar << "-";
@@ -1245,21 +1884,6 @@ int SiteResponseModel::buildEffectiveStressModel2D()
 
 
 
-int SiteResponseModel::subStepAnalyze(double dT, int subStep, int success, int remStep, DirectIntegrationAnalysis* theTransientAnalysis)
-{
-	if (subStep > 10)
-		return -10;
-	for (int i; i < 3; i++)
-	{
-		opserr << "Try dT = " << dT << endln;
-		success = theTransientAnalysis->analyze(remStep, dT);// 0 means success
-		//success = subStepAnalyze(int(dT/2), subStep +1, success);
-	}
-	
-	return 0;
-
-}
-
 int SiteResponseModel::runEffectiveStressModel2D()
 {
 
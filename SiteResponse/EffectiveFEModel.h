@@ -24,10 +24,34 @@
 #include "outcropMotion.h"
 
 #include "DirectIntegrationAnalysis.h"
+#include "MemoryStream.h"
+
+#include <string>
+#include <vector>
+#include <map>
+#include <functional>
+#include <atomic>
+
+class AsyncStreamWriter;
 
 #define MAX_FREQUENCY 50.0
 #define NODES_PER_WAVELENGTH 10
 
+// progress of the dynamic analysis, reported after every step
+struct AnalysisProgress
+{
+	int step;               // number of steps done
+	int numSteps;           // total number of steps
+	double time;            // current analysis time
+	double stepTime;        // wall clock time of the last step [s]
+	int numIterations;      // iterations in the last sub-step
+	int numSubSteps;        // converged sub-steps so far
+	int numFailedSubSteps;  // failed sub-steps so far
+};
+
+// return false to stop the analysis
+typedef std::function<bool(const AnalysisProgress &)> ProgressCallback;
+
 class SiteResponseModel {
 
 public:
@@ -39,15 +63,46 @@ public:
 	int   buildEffectiveStressModel2D();
 	int   runEffectiveStressModel2D();
 	void  setOutputDir(std::string outDir) { theOutputDir = outDir; };
-	int subStepAnalyze(double dT, int subStep, int success, int remStep, DirectIntegrationAnalysis* theTransientAnalysis);
+	void  setConfigFile(std::string configFile) { theConfigFile = configFile; };
+	void  setProgressCallback(ProgressCallback callback) { theProgressCallback = callback; };
+	// set from another thread to stop the analysis between its stages
+	void  setStopFlag(const std::atomic<bool> *stopFlag) { theStopFlag = stopFlag; };
+
+	// batch mode: the static stages are run once and the dynamic stage is
+	// run for every motion added here, each in its own output directory
+	void  addBatchMotion(OutcropMotion* motion, std::string outDir);
+	void  setNumWorkers(int numWorkers) { theNumWorkers = numWorkers; };
+
+	// in-memory output: the recorders keep their rows in memory instead of
+	// writing files. After the run the history of a recorder is found by the
+	// name of the file it would have written (e.g. "surface.acc"). Not
+	// available in batch mode, where the motions run in other processes.
+	void  setRecordToMemory(bool toMemory) { theRecordToMemory = toMemory; };
+	const ResponseHistory *getResponse(const std::string &name) const;
+	std::vector<std::string> getResponseNames() const;
 
 private:
+	int   forkBatchWorkers(int &batchStatus, int numThreads);
+	bool  stopRequested() const;
+	OPS_Stream *openRecordStream(const std::string &fileName, double restartTime, double tol, bool binary, int expectedRows);
+
 	Domain *theDomain;
 	SiteLayering    SRM_layering;
 	OutcropMotion*  theMotionX;
 	OutcropMotion*  theMotionZ;
 	std::string     theOutputDir;
 	std::string 	theModelType;
+	std::string     theConfigFile;
+	ProgressCallback theProgressCallback;
+
+	std::vector<OutcropMotion*> theBatchMotions;
+	std::vector<std::string>    theBatchOutputDirs;
+	int             theNumWorkers;
+
+	bool            theRecordToMemory;
+	std::map<std::string, ResponseHistory> theResponses;
+	AsyncStreamWriter *theAsyncWriter;
+	const std::atomic<bool> *theStopFlag;
 };
 
 
@@ -0,0 +1,450 @@
+/* ********************************************************************* **
+**                 Site Response Analysis Tool                           **
+**   -----------------------------------------------------------------   **
+**                                                                       **
+**   Developed by: Alborz Ghofrani (alborzgh@uw.edu)                     **
+**                 University of Washington                              **
+**                                                                       **
+**   Date: October 2026                                                  **
+**                                                                       **
+** ********************************************************************* */
+
+
+
+
+
+#include "EquivalentLinearModel.h"
+#include "Vector.h"
+#include "PathTimeSeries.h"
+#include "DataFileStream.h"
+#include "OPS_Globals.h"
+
+#include <fstream>
+#include <iomanip>
+#include <cmath>
+
+#if defined(WIN32) || defined(_WIN32)
+#define PATH_SEPARATOR "\\"
+#else
+#define PATH_SEPARATOR "/"
+#endif
+
+// Darendeli (2001) curves for PI = 0, OCR = 1, 10 cycles at 1 Hz
+#define DARENDELI_CURVATURE 0.9190
+#define DARENDELI_N_CYCLES  10.0
+#define ATM_PRESSURE        101.3   // kPa
+#define EARTH_K0            0.5
+#define ROCK_DAMPING        0.01
+
+// in-place radix-2 FFT of x, the size of x must be a power of two.
+// The forward transform is X_j = sum x_n exp(-2 pi i j n / N) and the
+// inverse one is scaled by 1/N.
+static void fft(std::vector<std::complex<double> > &x, bool inverse)
+{
+	int n = x.size();
+	for (int i = 1, j = 0; i < n; i++)
+	{
+		int bit = n >> 1;
+		for (; j & bit; bit >>= 1)
+			j ^= bit;
+		j ^= bit;
+		if (i < j)
+			std::swap(x[i], x[j]);
+	}
+
+	double pi = 4.0 * atan(1.0);
+	for (int len = 2; len <= n; len <<= 1)
+	{
+		double ang = 2.0 * pi / len * (inverse ? 1.0 : -1.0);
+		std::complex<double> wLen(cos(ang), sin(ang));
+		for (int i = 0; i < n; i += len)
+		{
+			std::complex<double> w(1.0, 0.0);
+			for (int j = 0; j < len / 2; j++)
+			{
+				std::complex<double> u = x[i + j];
+				std::complex<double> v = x[i + j + len / 2] * w;
+				x[i + j] = u + v;
+				x[i + j + len / 2] = u - v;
+				w *= wLen;
+			}
+		}
+	}
+
+	if (inverse)
+		for (int i = 0; i < n; i++)
+			x[i] /= n;
+}
+
+// time history of a real signal from the positive frequencies of its spectrum
+static void realInverse(std::vector<std::complex<double> > &spec, int numPoints, std::vector<double> &out)
+{
+	int n = spec.size();
+	for (int j = n / 2 + 1; j < n; j++)
+		spec[j] = std::conj(spec[n - j]);
+	fft(spec, true);
+
+	out.resize(numPoints);
+	for (int i = 0; i < numPoints; i++)
+		out[i] = spec[i].real();
+}
+
+// Darendeli reference strain in %
+static double darendeliRefStrain(double meanStress)
+{
+	return 0.0352 * pow(meanStress / ATM_PRESSURE, 0.3483);
+}
+
+// Darendeli small strain damping ratio
+static double darendeliMinDamping(double meanStress)
+{
+	return 0.8005 * pow(meanStress / ATM_PRESSURE, -0.2889) / 100.0;
+}
+
+// modulus reduction and damping ratio at the strain gamma (in %)
+static void darendeliCurves(double gamma, double refStrain, double minDamping, double &GRatio, double &damping)
+{
+	double a = DARENDELI_CURVATURE;
+	GRatio = 1.0 / (1.0 + pow(gamma / refStrain, a));
+
+	double masing = 0.0;
+	if (gamma > 1.0e-6 * refStrain)
+	{
+		double pi = 4.0 * atan(1.0);
+		double masing1 = 100.0 / pi * (4.0 * (gamma - refStrain * log((gamma + refStrain) / refStrain)) / (gamma * gamma / (gamma + refStrain)) - 2.0);
+		double c1 = -1.1143 * a * a + 1.8618 * a + 0.2523;
+		double c2 = 0.0805 * a * a - 0.0710 * a - 0.0095;
+		double c3 = -0.0005 * a * a + 0.0002 * a + 0.0003;
+		masing = c1 * masing1 + c2 * masing1 * masing1 + c3 * masing1 * masing1 * masing1;
+	}
+	double b = 0.6329 - 0.0057 * log(DARENDELI_N_CYCLES);
+
+	damping = b * pow(GRatio, 0.1) * masing / 100.0 + minDamping;
+}
+
+EquivalentLinearModel::EquivalentLinearModel(SiteLayering layering, OutcropMotion* motion) :
+	EQL_layering(layering),
+	theMotion(motion),
+	theOutputDir("."),
+	theMaxIterations(15),
+	theStrainRatio(0.65),
+	theTolerance(0.02),
+	rockRho(0.0),
+	rockVs(0.0),
+	rockDamping(ROCK_DAMPING)
+{
+
+}
+
+EquivalentLinearModel::~EquivalentLinearModel()
+{
+
+}
+
+int
+EquivalentLinearModel::setupSublayers()
+{
+	subThickness.clear();
+	subDepth.clear();
+	subRho.clear();
+	subGmax.clear();
+	subRefStrain.clear();
+	subMinDamping.clear();
+
+	int numSoilLayers = EQL_layering.getNumLayers();
+	rockRho = 0.0;
+	if (numSoilLayers > 0 && EQL_layering.getLayer(numSoilLayers - 1).getThickness() == 0.0)
+	{
+		SoilLayer rock = EQL_layering.getLayer(numSoilLayers - 1);
+		rockRho = rock.getRho();
+		rockVs = rock.getShearVelocity();
+		numSoilLayers--;
+	}
+
+	// the vertical stress is the total overburden, the layering has no water table
+	double g = 9.81;
+	double depth = 0.0;
+	double sigmaV = 0.0;
+	for (int i = 0; i < numSoilLayers; i++)
+	{
+		SoilLayer layer = EQL_layering.getLayer(i);
+		int numSub = layer.getNumEle();
+		if (numSub < 1)
+			numSub = 1;
+		double h = layer.getThickness() / numSub;
+		bool isLinear = !layer.getMatType().compare("Elastic");
+
+		for (int j = 0; j < numSub; j++)
+		{
+			double meanStress = (1.0 + 2.0 * EARTH_K0) / 3.0 * (sigmaV + 0.5 * h * layer.getRho() * g);
+
+			subThickness.push_back(h);
+			subDepth.push_back(depth + 0.5 * h);
+			subRho.push_back(layer.getRho());
+			subGmax.push_back(layer.getMatShearModulus());
+			subRefStrain.push_back(isLinear ? -1.0 : darendeliRefStrain(meanStress));
+			subMinDamping.push_back(darendeliMinDamping(meanStress));
+
+			depth += h;
+			sigmaV += h * layer.getRho() * g;
+		}
+	}
+
+	if (subThickness.empty())
+	{
+		opserr << "WARNING EquivalentLinearModel::setupSublayers - no soil layers" << endln;
+		return -1;
+	}
+
+	subG = subGmax;
+	subDamping = subMinDamping;
+
+	return 0;
+}
+
+int
+EquivalentLinearModel::getInputMotion(std::vector<double> &acc, double &dt)
+{
+	std::vector<double> dtVector = theMotion->getDTvector();
+	int numSteps = theMotion->getNumSteps();
+	if (numSteps < 2 || dtVector.empty())
+	{
+		opserr << "WARNING EquivalentLinearModel::getInputMotion - the motion has no time steps" << endln;
+		return -1;
+	}
+	dt = dtVector[0];
+
+	// the motion is resampled at the first time step
+	int numPoints = numSteps + 1;
+	acc.resize(numPoints);
+	if (theMotion->getAccSeries() != NULL)
+	{
+		PathTimeSeries *theSeries = theMotion->getAccSeries();
+		for (int i = 0; i < numPoints; i++)
+			acc[i] = theSeries->getFactor(i * dt);
+	}
+	else if (theMotion->getVelSeries() != NULL)
+	{
+		PathTimeSeries *theSeries = theMotion->getVelSeries();
+		std::vector<double> vel(numPoints);
+		for (int i = 0; i < numPoints; i++)
+			vel[i] = theSeries->getFactor(i * dt);
+		for (int i = 0; i < numPoints; i++)
+		{
+			int i0 = (i > 0) ? i - 1 : 0;
+			int i1 = (i < numPoints - 1) ? i + 1 : numPoints - 1;
+			acc[i] = (vel[i1] - vel[i0]) / ((i1 - i0) * dt);
+		}
+	}
+	else
+	{
+		PathTimeSeries *theSeries = theMotion->getDispSeries();
+		std::vector<double> disp(numPoints);
+		for (int i = 0; i < numPoints; i++)
+			disp[i] = theSeries->getFactor(i * dt);
+		acc[0] = acc[numPoints - 1] = 0.0;
+		for (int i = 1; i < numPoints - 1; i++)
+			acc[i] = (disp[i + 1] - 2.0 * disp[i] + disp[i - 1]) / (dt * dt);
+	}
+
+	return 0;
+}
+
+// transfer the outcrop acceleration spectrum to the surface and find the
+// maximum shear strain in the middle of every sublayer. The displacement in
+// a layer is u = A exp(i k z) + B exp(-i k z) with A = B = 1 at the surface.
+void
+EquivalentLinearModel::propagate(const std::vector<Complex> &inputAcc, double dOmega,
+                                 std::vector<Complex> &surfaceAcc, std::vector<double> &maxStrain)
+{
+	int nfft = inputAcc.size();
+	int numSub = subThickness.size();
+	Complex I(0.0, 1.0);
+
+	// complex shear wave velocities and impedances
+	std::vector<Complex> vs(numSub + 1);
+	std::vector<Complex> impedance(numSub + 1);
+	for (int m = 0; m < numSub; m++)
+	{
+		vs[m] = sqrt(subG[m] * (1.0 + 2.0 * I * subDamping[m]) / subRho[m]);
+		impedance[m] = subRho[m] * vs[m];
+	}
+	bool rigidBase = (rockRho <= 0.0);
+	if (!rigidBase)
+	{
+		vs[numSub] = rockVs * sqrt(1.0 + 2.0 * I * rockDamping);
+		impedance[numSub] = rockRho * vs[numSub];
+	}
+
+	std::vector<std::vector<Complex> > strain(numSub, std::vector<Complex>(nfft, Complex(0.0, 0.0)));
+	surfaceAcc.assign(nfft, Complex(0.0, 0.0));
+	surfaceAcc[0] = inputAcc[0];
+
+	std::vector<Complex> A(numSub + 1);
+	std::vector<Complex> B(numSub + 1);
+	for (int j = 1; j <= nfft / 2; j++)
+	{
+		double omega = j * dOmega;
+		A[0] = B[0] = 1.0;
+		for (int m = 0; m < numSub; m++)
+		{
+			Complex e = exp(I * omega / vs[m] * subThickness[m]);
+			// on a rigid base only A + B at the base is used
+			Complex alpha = rigidBase && m == numSub - 1 ? 1.0 : impedance[m] / impedance[m + 1];
+			A[m + 1] = 0.5 * (A[m] * (1.0 + alpha) * e + B[m] * (1.0 - alpha) / e);
+			B[m + 1] = 0.5 * (A[m] * (1.0 - alpha) * e + B[m] * (1.0 + alpha) / e);
+		}
+
+		Complex base = rigidBase ? A[numSub] + B[numSub] : 2.0 * A[numSub];
+		Complex inputDisp = -inputAcc[j] / (omega * omega) / base;
+		surfaceAcc[j] = 2.0 / base * inputAcc[j];
+
+		for (int m = 0; m < numSub; m++)
+		{
+			Complex k = omega / vs[m];
+			Complex e = exp(I * k * 0.5 * subThickness[m]);
+			strain[m][j] = I * k * (A[m] * e - B[m] / e) * inputDisp;
+		}
+	}
+
+	maxStrain.assign(numSub, 0.0);
+	std::vector<double> history;
+	for (int m = 0; m < numSub; m++)
+	{
+		realInverse(strain[m], nfft, history);
+		for (int i = 0; i < nfft; i++)
+			if (fabs(history[i]) > maxStrain[m])
+				maxStrain[m] = fabs(history[i]);
+	}
+}
+
+void
+EquivalentLinearModel::updateProperties(const std::vector<double> &maxStrain, double &maxChange)
+{
+	maxChange = 0.0;
+	for (unsigned int m = 0; m < subG.size(); m++)
+	{
+		if (subRefStrain[m] < 0.0)
+			continue;
+
+		double GRatio, damping;
+		darendeliCurves(100.0 * theStrainRatio * maxStrain[m], subRefStrain[m], subMinDamping[m], GRatio, damping);
+
+		double G = GRatio * subGmax[m];
+		maxChange = fmax(maxChange, fabs(G - subG[m]) / G);
+		maxChange = fmax(maxChange, fabs(damping - subDamping[m]) / damping);
+		subG[m] = G;
+		subDamping[m] = damping;
+	}
+}
+
+int
+EquivalentLinearModel::writeOutput(const std::string &fileName, const std::vector<double> &response, double dt)
+{
+	// same columns as the surface recorders of the FE model: time and 3 dofs
+	DataFileStream theStream(fileName.c_str(), OVERWRITE, 2, 0, false, 6, false);
+	Vector row(4);
+	for (unsigned int i = 0; i < response.size(); i++)
+	{
+		row(0) = i * dt;
+		row(1) = response[i];
+		if (theStream.write(row) < 0)
+			return -1;
+	}
+	theStream.close();
+
+	return 0;
+}
+
+int
+EquivalentLinearModel::writeProfile(const std::vector<double> &maxStrain)
+{
+	std::string fileName = theOutputDir + PATH_SEPARATOR + "eqlProfile.out";
+	std::ofstream out(fileName.c_str(), std::ofstream::out);
+	if (!out)
+		return -1;
+
+	out << "# depth maxStrain[%] G/Gmax damping" << std::endl;
+	for (unsigned int m = 0; m < subG.size(); m++)
+		out << subDepth[m] << " " << 100.0 * maxStrain[m] << " " << subG[m] / subGmax[m] << " " << subDamping[m] << std::endl;
+	out.close();
+
+	return 0;
+}
+
+int
+EquivalentLinearModel::runEquivalentLinearAnalysis()
+{
+	if (theMotion == NULL || !theMotion->isInitialized())
+	{
+		opserr << "WARNING EquivalentLinearModel::runEquivalentLinearAnalysis - no motion" << endln;
+		return -1;
+	}
+
+	if (this->setupSublayers() < 0)
+		return -1;
+
+	std::vector<double> acc;
+	double dt;
+	if (this->getInputMotion(acc, dt) < 0)
+		return -1;
+
+	// pad with zeros to at least twice the duration to avoid wrap around
+	int numPoints = acc.size();
+	int nfft = 1;
+	while (nfft < 2 * numPoints)
+		nfft <<= 1;
+	double dOmega = 8.0 * atan(1.0) / (nfft * dt);
+
+	std::vector<Complex> inputAcc(nfft, Complex(0.0, 0.0));
+	for (int i = 0; i < numPoints; i++)
+		inputAcc[i] = acc[i];
+	fft(inputAcc, false);
+
+	std::vector<Complex> surfaceAcc;
+	std::vector<double> maxStrain;
+	bool converged = false;
+	for (int iter = 1; iter <= theMaxIterations; iter++)
+	{
+		this->propagate(inputAcc, dOmega, surfaceAcc, maxStrain);
+
+		double maxChange;
+		this->updateProperties(maxStrain, maxChange);
+		opserr << "Equivalent linear iteration " << iter << ": max change in G and damping " << maxChange << endln;
+
+		if (maxChange < theTolerance)
+		{
+			converged = true;
+			break;
+		}
+	}
+	if (!converged)
+		opserr << "WARNING EquivalentLinearModel::runEquivalentLinearAnalysis - no convergence in " << theMaxIterations << " iterations" << endln;
+
+	// velocity and displacement are integrated in the frequency domain
+	std::vector<Complex> surfaceVel(nfft, Complex(0.0, 0.0));
+	std::vector<Complex> surfaceDisp(nfft, Complex(0.0, 0.0));
+	for (int j = 1; j <= nfft / 2; j++)
+	{
+		double omega = j * dOmega;
+		surfaceVel[j] = surfaceAcc[j] / Complex(0.0, omega);
+		surfaceDisp[j] = -surfaceAcc[j] / (omega * omega);
+	}
+
+	std::vector<double> response;
+	realInverse(surfaceAcc, numPoints, response);
+	int res = this->writeOutput(theOutputDir + PATH_SEPARATOR + "surface.acc", response, dt);
+	realInverse(surfaceVel, numPoints, response);
+	res += this->writeOutput(theOutputDir + PATH_SEPARATOR + "surface.vel", response, dt);
+	realInverse(surfaceDisp, numPoints, response);
+	res += this->writeOutput(theOutputDir + PATH_SEPARATOR + "surface.disp", response, dt);
+	res += this->writeProfile(maxStrain);
+
+	if (res < 0)
+	{
+		opserr << "WARNING EquivalentLinearModel::runEquivalentLinearAnalysis - failed to write the output in " << theOutputDir.c_str() << endln;
+		return -1;
+	}
+
+	return converged ? 0 : 1;
+}
@@ -0,0 +1,89 @@
+/* ********************************************************************* **
+**                 Site Response Analysis Tool                           **
+**   -----------------------------------------------------------------   **
+**                                                                       **
+**   Developed by: Alborz Ghofrani (alborzgh@uw.edu)                     **
+**                 University of Washington                              **
+**                                                                       **
+**   Date: October 2026                                                  **
+**                                                                       **
+** ********************************************************************* */
+
+
+
+
+
+// Equivalent-linear analysis of a layered soil column in the frequency
+// domain (SHAKE type). The outcrop motion is propagated through the layers
+// with the exact transfer functions of vertically travelling shear waves and
+// the shear modulus and damping of every sublayer are iterated until they
+// are compatible with the effective strain,
+//
+//   gamma_eff = strainRatio * max |gamma(t)|
+//
+// The modulus reduction and damping curves are those of Darendeli (2001)
+// for PI = 0 and OCR = 1, evaluated at the mean effective stress at the
+// middle of every sublayer. Layers with an "Elastic" material are linear.
+// The last layer of the SiteLayering is the elastic bedrock if its thickness
+// is zero; otherwise the motion is applied at a rigid base.
+
+#ifndef EQUIVALENTLINEARMODEL_H
+#define EQUIVALENTLINEARMODEL_H
+
+#include "siteLayering.h"
+#include "soillayer.h"
+#include "outcropMotion.h"
+
+#include <string>
+#include <vector>
+#include <complex>
+
+class EquivalentLinearModel {
+
+public:
+	EquivalentLinearModel(SiteLayering, OutcropMotion*);
+	~EquivalentLinearModel();
+
+	int   runEquivalentLinearAnalysis();
+	void  setOutputDir(std::string outDir) { theOutputDir = outDir; };
+	void  setMaxIterations(int maxIter) { theMaxIterations = maxIter; };
+	void  setStrainRatio(double ratio) { theStrainRatio = ratio; };
+	void  setTolerance(double tol) { theTolerance = tol; };
+
+private:
+	typedef std::complex<double> Complex;
+
+	int   setupSublayers();
+	int   getInputMotion(std::vector<double> &acc, double &dt);
+	void  propagate(const std::vector<Complex> &inputAcc, double dOmega,
+	                std::vector<Complex> &surfaceAcc, std::vector<double> &maxStrain);
+	void  updateProperties(const std::vector<double> &maxStrain, double &maxChange);
+	int   writeOutput(const std::string &fileName, const std::vector<double> &response, double dt);
+	int   writeProfile(const std::vector<double> &maxStrain);
+
+	SiteLayering    EQL_layering;
+	OutcropMotion*  theMotion;
+	std::string     theOutputDir;
+
+	int    theMaxIterations;
+	double theStrainRatio;
+	double theTolerance;
+
+	// sublayer properties, top to bottom
+	std::vector<double> subThickness;
+	std::vector<double> subDepth;       // depth of the middle of the sublayer
+	std::vector<double> subRho;
+	std::vector<double> subGmax;
+	std::vector<double> subRefStrain;   // Darendeli reference strain, < 0 if linear
+	std::vector<double> subMinDamping;
+	std::vector<double> subG;
+	std::vector<double> subDamping;
+
+	// bedrock, rockRho <= 0 for a rigid base
+	double rockRho;
+	double rockVs;
+	double rockDamping;
+};
+
+
+#endif
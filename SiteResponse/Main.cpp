@@ -14,7 +14,10 @@
 
 #include <fstream>
 #include <iostream>
+#include <sstream>
+#include <vector>
 #include "EffectiveFEModel.h"
+#include "EquivalentLinearModel.h"
 #include "siteLayering.h"
 #include "soillayer.h"
 #include "outcropMotion.h"
@@ -26,8 +29,8 @@
 
 StandardStream sserr;
 FileStream ferr("log");
-OPS_Stream *opserrPtr = &ferr;
-OPS_Stream *opsoutPtr = &sserr;
+thread_local OPS_Stream *opserrPtr = &ferr;
+thread_local OPS_Stream *opsoutPtr = &sserr;
 
 /*
 SiteLayering setupDummyLayers()
@@ -59,6 +62,99 @@ int main(int argc, char** argv)
 	std::string bbpOName(".");
 	SiteLayering siteLayers(layersFN.c_str());
 
+	if (strcmp(argv[2], "-batch") == 0 || strcmp(argv[2], "-batchCache") == 0)
+	{
+		// siteresponse layers -batch motionList [numWorkers [logFile]]
+		// every line of motionList is: motionFile outputDir
+		// -batchCache keeps the numbers of the motion files in binary
+		// sidecar files (.srtcache) that the next batches read instead
+		//
+		// with OpenMP the static stages run on one thread and the workers
+		// share the threads (OMP_NUM_THREADS / numWorkers each)
+		bool useCache = (strcmp(argv[2], "-batchCache") == 0);
+		if (argc < 4)
+		{
+			opserr << ">>> SiteResponseTool: -batch needs a motion list. <<<" << endln;
+			return -1;
+		}
+		int numWorkers = (argc > 4) ? atoi(argv[4]) : 0;
+		if (argc > 5)
+			ferr.setFile(argv[5], APPEND);
+
+		std::vector<std::string> motionFNs;
+		std::vector<std::string> outDirs;
+		std::ifstream motionList(argv[3]);
+		std::string line;
+		while (std::getline(motionList, line))
+		{
+			std::istringstream lineStream(line);
+			std::string motionFN, outDir;
+			if (!(lineStream >> motionFN >> outDir) || motionFN[0] == '#')
+				continue;
+			motionFNs.push_back(motionFN);
+			outDirs.push_back(outDir);
+		}
+		if (motionFNs.empty())
+		{
+			opserr << ">>> SiteResponseTool: no motions in " << argv[3] << " <<<" << endln;
+			return -1;
+		}
+
+		std::vector<OutcropMotion*> motions;
+		for (unsigned int i = 0; i < motionFNs.size(); i++)
+		{
+			motions.push_back(new OutcropMotion());
+			motions[i]->setUseCache(useCache);
+			motions[i]->setMotion(motionFNs[i].c_str());
+		}
+
+		int res = 0;
+#if defined(WIN32) || defined(_WIN32)
+		// no fork(): build the model again for every motion
+		for (unsigned int i = 0; i < motions.size(); i++)
+		{
+			SiteResponseModel model(siteLayers, "2D", motions[i]);
+			model.setOutputDir(outDirs[i]);
+			if (model.buildEffectiveStressModel2D() < 0)
+				res = -1;
+		}
+#else
+		{
+			SiteResponseModel model(siteLayers, "2D", motions[0]);
+			for (unsigned int i = 0; i < motions.size(); i++)
+				model.addBatchMotion(motions[i], outDirs[i]);
+			model.setNumWorkers(numWorkers);
+			res = model.buildEffectiveStressModel2D();
+		}
+#endif
+		for (unsigned int i = 0; i < motions.size(); i++)
+			delete motions[i];
+
+		return (res < 0) ? -1 : 0;
+	}
+
+	if (strcmp(argv[2], "-eql") == 0)
+	{
+		// siteresponse layers -eql motion outputDir [logFile]
+		if (argc < 5)
+		{
+			opserr << ">>> SiteResponseTool: -eql needs a motion and an output directory. <<<" << endln;
+			return -1;
+		}
+		if (argc > 5)
+			ferr.setFile(argv[5], APPEND);
+
+		OutcropMotion motion;
+		motion.setMotion(argv[3]);
+
+		EquivalentLinearModel model(siteLayers, &motion);
+		model.setOutputDir(argv[4]);
+		if (model.runEquivalentLinearAnalysis() < 0)
+			return -1;
+
+		return 0;
+	}
+
 	// read the motion
 	OutcropMotion motionX;
 	OutcropMotion motionZ;
@@ -106,7 +202,8 @@ int main(int argc, char** argv)
 	//model.runTotalStressModel();
 	//model.runEffectiveStressModel();
 
-	model.buildEffectiveStressModel2D();
+	if (model.buildEffectiveStressModel2D() < 0)
+		return -1;
 	//model.runEffectiveStressModel2D();
 
 
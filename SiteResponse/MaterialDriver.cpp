@@ -0,0 +1,460 @@
+/* ********************************************************************* **
+**                 Site Response Analysis Tool                           **
+**   -----------------------------------------------------------------   **
+**                                                                       **
+**   Developed by: Alborz Ghofrani (alborzgh@uw.edu)                     **
+**                 University of Washington                              **
+**                                                                       **
+**   Date: October 2026                                                  **
+**                                                                       **
+** ********************************************************************* */
+
+
+
+
+// Single element constitutive driver and micro-benchmark for the nDMaterials
+// used by the site response models. The material is K0 consolidated in its
+// elastic stage (drained, stress controlled) and then switched to its
+// elastoplastic stage and loaded along an undrained cyclic path:
+//
+//   DSS    : shear strain gamma_xy, the normal strains are held fixed
+//   triax  : axial (vertical) strain with isochoric lateral strains
+//
+// The path is strain controlled (amplitude of the strain) or stress
+// controlled (amplitude of tau_xy or q, solved with Newton iterations on the
+// material tangent). Every setTrialStrain() is followed by getTangent() the
+// way an element calls them, and the driver reports the time per call, the
+// number of integration sub-steps (PM4Sand and PM4Silt) and the heap
+// allocations of the cyclic phase. The stress path is written to a file.
+//
+// materialdriver -mat PM4Sand|PM4Silt|J2Cyclic|Elastic [parameters]
+//                [-test DSS|triax] [-control strain|stress] [-amp amplitude]
+//                [-cycles numCycles] [-steps stepsPerCycle]
+//                [-sv verticalStress] [-K0 K0] [-out stressPathFile]
+//
+// The optional material parameters are the leading arguments of the
+// material constructors:
+//
+//   PM4Sand  Dr G0 hp0 rho
+//   PM4Silt  Su Su_rate G0 hpo rho
+//   J2Cyclic G K su rho h m chi beta
+//   Elastic  E nu rho
+//
+// The number of strain components is taken from getStrain(), PM4Silt and
+// J2CyclicBoundingSurface do not implement getOrder().
+
+
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "PM4Sand.h"
+#include "PM4Silt.h"
+#include "J2CyclicBoundingSurface.h"
+#include "ElasticIsotropicMaterial.h"
+#include "Parameter.h"
+#include "Vector.h"
+#include "Matrix.h"
+
+#include "StandardStream.h"
+#include "OPS_Stream.h"
+
+
+StandardStream sserr;
+thread_local OPS_Stream *opserrPtr = &sserr;
+thread_local OPS_Stream *opsoutPtr = &sserr;
+
+
+// every heap allocation of the program goes through these, Vector and
+// Matrix use the nothrow versions
+static unsigned long numAllocations = 0;
+
+void *operator new(std::size_t size)
+{
+	numAllocations++;
+	void *p = std::malloc(size == 0 ? 1 : size);
+	if (p == 0)
+		throw std::bad_alloc();
+	return p;
+}
+
+void *operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+	numAllocations++;
+	return std::malloc(size == 0 ? 1 : size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &tag) noexcept
+{
+	return operator new(size, tag);
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, const std::nothrow_t &) noexcept { std::free(p); }
+void operator delete[](void *p, const std::nothrow_t &) noexcept { std::free(p); }
+
+
+struct DriverOptions {
+	std::string         matType;
+	std::vector<double> matParams;
+	std::string         testType = "DSS";
+	bool                stressControl = false;
+	double              amplitude = -1.0;     // < 0 : default for the path
+	int                 numCycles = 10;
+	int                 numSteps = 100;       // steps per cycle
+	double              sv = 100.0;           // vertical effective stress (kPa)
+	double              K0 = 0.5;
+	std::string         outFile = "stressPath.out";
+};
+
+struct DriverResults {
+	long   numCalls = 0;           // setTrialStrain + getTangent pairs
+	long   numSubSteps = 0;
+	int    maxSubSteps = 0;
+	int    numNotConverged = 0;    // stress controlled steps
+	double seconds = 0.0;
+	unsigned long numAllocations = 0;
+};
+
+
+static double param(const std::vector<double> &par, unsigned int i, double def)
+{
+	return (i < par.size()) ? par[i] : def;
+}
+
+NDMaterial *createMaterial(const std::string &type, const std::vector<double> &par)
+{
+	if (type == "PM4Sand")
+		return new PM4Sand(1, param(par, 0, 0.5), param(par, 1, 677.0), param(par, 2, 0.4), param(par, 3, 1.7));
+	if (type == "PM4Silt")
+		return new PM4Silt(1, param(par, 0, 40.0), param(par, 1, 0.0), param(par, 2, 476.0), param(par, 3, 0.53), param(par, 4, 1.7));
+	if (type == "J2Cyclic")
+		return new J2CyclicBoundingSurface(1, param(par, 0, 20000.0), param(par, 1, 25000.0), param(par, 2, 100.0), param(par, 3, 0.0),
+			param(par, 4, 20000.0), param(par, 5, 1.0), param(par, 6, 0.0), param(par, 7, 0.5));
+	if (type == "Elastic")
+	{
+		ElasticIsotropicMaterial theMaterial(1, param(par, 0, 100000.0), param(par, 1, 0.3), param(par, 2, 0.0));
+		return theMaterial.getCopy("PlaneStrain");
+	}
+
+	opserr << "WARNING createMaterial - unknown material " << type.c_str() << endln;
+	return 0;
+}
+
+// same route as the "setParameter" and "updateMaterialStage" commands
+int updateMaterialParameter(NDMaterial *theMat, const char *name, double value)
+{
+	char tagStr[16];
+	sprintf(tagStr, "%d", theMat->getTag());
+	const char *argv[2] = {name, tagStr};
+
+	Parameter theParameter(1, 0, 0, 0);
+	if (theMat->setParameter(argv, 2, theParameter) < 0)
+		return -1;
+	return theParameter.update(value);
+}
+
+// drained K0 consolidation to sv in the elastic stage, the normal strains
+// are found with Newton iterations on the normal part of the tangent
+int consolidate(NDMaterial *theMat, const DriverOptions &opts, Vector &strain)
+{
+	int order = theMat->getStrain().Size();
+	int numNormal = (order == 3) ? 2 : 3;
+	int numIncr = 10;
+	double tol = 1.0e-8 * opts.sv;
+
+	Vector target(numNormal);
+	for (int i = 0; i < numNormal; i++)
+		target(i) = -opts.K0 * opts.sv;
+	target(1) = -opts.sv;
+
+	Matrix Kn(numNormal, numNormal);
+	Vector residual(numNormal);
+	Vector dStrain(numNormal);
+	strain.Zero();
+
+	for (int incr = 1; incr <= numIncr; incr++)
+	{
+		bool converged = false;
+		for (int iter = 0; iter < 50 && !converged; iter++)
+		{
+			theMat->setTrialStrain(strain);
+			const Vector &stress = theMat->getStress();
+			const Matrix &C = theMat->getTangent();
+
+			double norm = 0.0;
+			for (int i = 0; i < numNormal; i++)
+			{
+				residual(i) = (double)incr / numIncr * target(i) - stress(i);
+				norm += residual(i) * residual(i);
+				for (int j = 0; j < numNormal; j++)
+					Kn(i, j) = C(i, j);
+			}
+			if (sqrt(norm) <= tol)
+			{
+				converged = true;
+				break;
+			}
+			if (Kn.Solve(residual, dStrain) < 0)
+				break;
+			for (int i = 0; i < numNormal; i++)
+				strain(i) += dStrain(i);
+		}
+		if (!converged)
+		{
+			opserr << "WARNING consolidate - no convergence in increment " << incr << endln;
+			return -1;
+		}
+		theMat->commitState();
+	}
+
+	return 0;
+}
+
+// the undrained cyclic path, strain = strain0 + lambda * dir
+int runCyclicPath(NDMaterial *theMat, const DriverOptions &opts, const Vector &strain0,
+	std::vector<double> &path, DriverResults &results)
+{
+	int order = theMat->getStrain().Size();
+	int vertical = 1;
+	Vector dir(order);         // strain direction
+	Vector measure(order);     // stress measure, tau_xy or q
+	if (opts.testType == "DSS")
+	{
+		int shear = (order == 3) ? 2 : 3;
+		dir(shear) = 1.0;
+		measure(shear) = 1.0;
+	}
+	else
+	{
+		int numNormal = (order == 3) ? 2 : 3;
+		for (int i = 0; i < numNormal; i++)
+			dir(i) = -1.0 / (numNormal - 1);
+		dir(vertical) = 1.0;
+		measure = dir;
+	}
+
+	double amp = opts.amplitude;
+	if (amp < 0.0)
+		amp = opts.stressControl ? 0.1 * opts.sv : 0.001;
+	double tol = 1.0e-6 * opts.sv;
+	double pi = 4.0 * atan(1.0);
+	int numTotal = opts.numCycles * opts.numSteps;
+
+	PM4Sand *theSand = dynamic_cast<PM4Sand *>(theMat);
+	PM4Silt *theSilt = dynamic_cast<PM4Silt *>(theMat);
+
+	Vector strain(strain0);
+	Vector Cdir(order);
+	double lambda = 0.0;
+	path.reserve((numTotal + 1) * (1 + 2 * order));
+
+	unsigned long allocStart = numAllocations;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	for (int step = 1; step <= numTotal; step++)
+	{
+		double value = amp * sin(2.0 * pi * step / opts.numSteps);
+		if (!opts.stressControl)
+			lambda = value;
+
+		bool converged = false;
+		for (int iter = 0; iter < 50 && !converged; iter++)
+		{
+			strain = strain0;
+			strain.addVector(1.0, dir, lambda);
+			theMat->setTrialStrain(strain);
+			const Matrix &C = theMat->getTangent();
+			results.numCalls++;
+
+			int subSteps = 0;
+			if (theSand != 0)
+				subSteps = theSand->getNumIterations();
+			else if (theSilt != 0)
+				subSteps = theSilt->getNumIterations();
+			results.numSubSteps += subSteps;
+			if (subSteps > results.maxSubSteps)
+				results.maxSubSteps = subSteps;
+
+			if (!opts.stressControl)
+				break;
+
+			double residual = value - (measure ^ theMat->getStress());
+			if (fabs(residual) <= tol)
+			{
+				converged = true;
+				break;
+			}
+			Cdir.addMatrixVector(0.0, C, dir, 1.0);
+			double slope = measure ^ Cdir;
+			if (slope <= 0.0)
+			{
+				Cdir.addMatrixVector(0.0, theMat->getInitialTangent(), dir, 1.0);
+				slope = measure ^ Cdir;
+			}
+			lambda += residual / slope;
+		}
+		if (opts.stressControl && !converged)
+			results.numNotConverged++;
+
+		theMat->commitState();
+
+		const Vector &theStrain = theMat->getStrain();
+		const Vector &theStress = theMat->getStress();
+		path.push_back(lambda);
+		for (int i = 0; i < order; i++)
+			path.push_back(theStrain(i));
+		for (int i = 0; i < order; i++)
+			path.push_back(theStress(i));
+	}
+
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	results.seconds = std::chrono::duration<double>(end - start).count();
+	results.numAllocations = numAllocations - allocStart;
+
+	return 0;
+}
+
+int writeStressPath(const std::string &fileName, int order, const std::vector<double> &path)
+{
+	std::ofstream outFile(fileName.c_str());
+	if (!outFile.is_open())
+	{
+		opserr << "WARNING writeStressPath - cannot open " << fileName.c_str() << endln;
+		return -1;
+	}
+
+	const char *names2D[] = {"xx", "yy", "xy"};
+	const char *names3D[] = {"xx", "yy", "zz", "xy", "yz", "zx"};
+	const char **names = (order == 3) ? names2D : names3D;
+
+	outFile << "# step lambda";
+	for (int i = 0; i < order; i++)
+		outFile << " eps_" << names[i];
+	for (int i = 0; i < order; i++)
+		outFile << " sig_" << names[i];
+	outFile << std::endl;
+
+	int numColumns = 1 + 2 * order;
+	outFile << std::setprecision(17);
+	for (unsigned int row = 0; row * numColumns < path.size(); row++)
+	{
+		outFile << row + 1;
+		for (int j = 0; j < numColumns; j++)
+			outFile << " " << path[row * numColumns + j];
+		outFile << std::endl;
+	}
+
+	return 0;
+}
+
+static bool isNumber(const char *arg, double &value)
+{
+	char *end;
+	value = strtod(arg, &end);
+	return end != arg && *end == '\0';
+}
+
+int main(int argc, char** argv)
+{
+	DriverOptions opts;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-mat") == 0 && i + 1 < argc)
+		{
+			opts.matType = argv[++i];
+			double value;
+			while (i + 1 < argc && isNumber(argv[i + 1], value))
+			{
+				opts.matParams.push_back(value);
+				i++;
+			}
+		}
+		else if (strcmp(argv[i], "-test") == 0 && i + 1 < argc)
+			opts.testType = argv[++i];
+		else if (strcmp(argv[i], "-control") == 0 && i + 1 < argc)
+			opts.stressControl = (strcmp(argv[++i], "stress") == 0);
+		else if (strcmp(argv[i], "-amp") == 0 && i + 1 < argc)
+			opts.amplitude = atof(argv[++i]);
+		else if (strcmp(argv[i], "-cycles") == 0 && i + 1 < argc)
+			opts.numCycles = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-steps") == 0 && i + 1 < argc)
+			opts.numSteps = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-sv") == 0 && i + 1 < argc)
+			opts.sv = atof(argv[++i]);
+		else if (strcmp(argv[i], "-K0") == 0 && i + 1 < argc)
+			opts.K0 = atof(argv[++i]);
+		else if (strcmp(argv[i], "-out") == 0 && i + 1 < argc)
+			opts.outFile = argv[++i];
+		else
+		{
+			opserr << ">>> MaterialDriver: unknown argument " << argv[i] << " <<<" << endln;
+			return -1;
+		}
+	}
+
+	if (opts.matType.empty() || (opts.testType != "DSS" && opts.testType != "triax") ||
+		opts.numCycles < 1 || opts.numSteps < 1 || opts.sv <= 0.0)
+	{
+		opserr << ">>> MaterialDriver: usage: materialdriver -mat PM4Sand|PM4Silt|J2Cyclic|Elastic [parameters] "
+			<< "[-test DSS|triax] [-control strain|stress] [-amp amplitude] [-cycles numCycles] "
+			<< "[-steps stepsPerCycle] [-sv verticalStress] [-K0 K0] [-out stressPathFile] <<<" << endln;
+		return -1;
+	}
+
+	NDMaterial *theMat = createMaterial(opts.matType, opts.matParams);
+	if (theMat == 0)
+		return -1;
+	int order = theMat->getStrain().Size();
+
+	// gravity in the elastic stage, then the elastoplastic stage
+	Vector strain0(order);
+	updateMaterialParameter(theMat, "materialState", 0.0);
+	if (consolidate(theMat, opts, strain0) < 0)
+	{
+		delete theMat;
+		return -1;
+	}
+	updateMaterialParameter(theMat, "materialState", 1.0);
+	updateMaterialParameter(theMat, "FirstCall", 0.0);
+
+	std::vector<double> path;
+	DriverResults results;
+	runCyclicPath(theMat, opts, strain0, path, results);
+
+	std::cout << "material      " << opts.matType << " (" << order << " strain components)" << std::endl;
+	std::cout << "path          " << opts.testType << ", " << (opts.stressControl ? "stress" : "strain") << " controlled, "
+		<< opts.numCycles << " cycles x " << opts.numSteps << " steps" << std::endl;
+	std::cout << "calls         " << results.numCalls << std::endl;
+	std::cout << "time          " << results.seconds * 1.0e3 << " ms, "
+		<< results.seconds * 1.0e9 / results.numCalls << " ns per setTrialStrain + getTangent (commitState included)" << std::endl;
+	if (dynamic_cast<PM4Sand *>(theMat) != 0 || dynamic_cast<PM4Silt *>(theMat) != 0)
+		std::cout << "sub-steps     " << (double)results.numSubSteps / results.numCalls << " per call, "
+			<< results.maxSubSteps << " max" << std::endl;
+	else
+		std::cout << "sub-steps     n/a" << std::endl;
+	std::cout << "allocations   " << results.numAllocations << ", "
+		<< (double)results.numAllocations / results.numCalls << " per call" << std::endl;
+	if (opts.stressControl)
+		std::cout << "not converged " << results.numNotConverged << " steps" << std::endl;
+
+	int res = writeStressPath(opts.outFile, order, path);
+
+	delete theMat;
+	return res;
+}
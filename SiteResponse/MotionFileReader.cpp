@@ -0,0 +1,215 @@
+/* ********************************************************************* **
+**                 Site Response Analysis Tool                           **
+**   -----------------------------------------------------------------   **
+**                                                                       **
+**   Developed by: Alborz Ghofrani (alborzgh@uw.edu)                     **
+**                 University of Washington                              **
+**                                                                       **
+**   Date: October 2026                                                  **
+**                                                                       **
+** ********************************************************************* */
+
+
+
+
+
+#include "MotionFileReader.h"
+#include "OPS_Globals.h"
+
+#include <string>
+#include <fstream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#if defined(WIN32) || defined(_WIN32)
+#include <process.h>
+#define getpid _getpid
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+#define MOTION_CACHE_MAGIC "SRTMOT01"
+#define MOTION_CACHE_ORDER 0x01020304
+
+int MotionFileReader::read(const char* fileName, std::vector<double>& values, int& numColumns, bool useCache)
+{
+	values.clear();
+	numColumns = 0;
+
+	struct stat fileStat;
+	if (stat(fileName, &fileStat) != 0)
+		return -1;
+	long long fileSize = (long long)fileStat.st_size;
+	long long fileTime = (long long)fileStat.st_mtime;
+
+	if (useCache && readCache(fileName, fileSize, fileTime, values, numColumns) >= 0)
+		return values.size();
+
+	if (fileSize == 0)
+		return 0;
+
+#if defined(WIN32) || defined(_WIN32)
+	// no mmap, read the whole file at once
+	std::ifstream file(fileName, std::ios::in | std::ios::binary);
+	if (!file)
+		return -1;
+	std::vector<char> data(fileSize);
+	file.read(&data[0], fileSize);
+	parse(&data[0], file.gcount(), values, numColumns);
+#else
+	int fd = open(fileName, O_RDONLY);
+	if (fd < 0)
+		return -1;
+	void* data = mmap(0, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED)
+		return -1;
+	madvise(data, fileSize, MADV_SEQUENTIAL);
+	parse((const char*)data, fileSize, values, numColumns);
+	munmap(data, fileSize);
+#endif
+
+	if (useCache)
+		writeCache(fileName, fileSize, fileTime, values, numColumns);
+
+	return values.size();
+}
+
+int MotionFileReader::parse(const char* data, long long size, std::vector<double>& values, int& numColumns)
+{
+	const char* p = data;
+	const char* end = data + size;
+	char token[64];
+
+	while (p < end)
+	{
+		// skip the blanks at the start of the line, then comments and empty lines
+		while (p < end && (*p == ' ' || *p == '\t'))
+			p++;
+		if (p < end && (*p == '%' || *p == '#' || *p == '\n' || *p == '\r'))
+		{
+			while (p < end && *p != '\n')
+				p++;
+			p++;
+			continue;
+		}
+
+		// the numbers of the line
+		int numOnLine = 0;
+		while (p < end && *p != '\n')
+		{
+			if (*p == ' ' || *p == '\t' || *p == '\r' || *p == ',')
+			{
+				p++;
+				continue;
+			}
+
+			// the file is not terminated, strtod gets a copy of the token
+			const char* tokenEnd = p;
+			while (tokenEnd < end && *tokenEnd != ' ' && *tokenEnd != '\t' && *tokenEnd != '\r' && *tokenEnd != '\n' && *tokenEnd != ',')
+				tokenEnd++;
+			int length = tokenEnd - p;
+			if (length >= (int)sizeof(token))
+				return values.size();
+			memcpy(token, p, length);
+			token[length] = '\0';
+
+			char* numberEnd;
+			double value = strtod(token, &numberEnd);
+			if (numberEnd == token)
+				return values.size();
+			values.push_back(value);
+			numOnLine++;
+			p = tokenEnd;
+		}
+		p++;
+
+		if (numColumns == 0)
+			numColumns = numOnLine;
+	}
+
+	return values.size();
+}
+
+int MotionFileReader::readCache(const char* fileName, long long fileSize, long long fileTime, std::vector<double>& values, int& numColumns)
+{
+	std::string cacheName = std::string(fileName) + ".srtcache";
+	std::ifstream cache(cacheName.c_str(), std::ios::in | std::ios::binary);
+	if (!cache)
+		return -1;
+
+	char magic[8];
+	int order = 0;
+	int cacheColumns = 0;
+	long long cacheSize = -1, cacheTime = -1, numValues = -1;
+	cache.read(magic, 8);
+	cache.read((char*)&order, sizeof(int));
+	cache.read((char*)&cacheColumns, sizeof(int));
+	cache.read((char*)&cacheSize, sizeof(long long));
+	cache.read((char*)&cacheTime, sizeof(long long));
+	cache.read((char*)&numValues, sizeof(long long));
+	if (!cache || strncmp(magic, MOTION_CACHE_MAGIC, 8) != 0 || order != MOTION_CACHE_ORDER ||
+		cacheSize != fileSize || cacheTime != fileTime || numValues < 0)
+		return -1;
+
+	values.resize(numValues);
+	if (numValues > 0)
+		cache.read((char*)&values[0], numValues * sizeof(double));
+	if (!cache)
+	{
+		values.clear();
+		return -1;
+	}
+
+	numColumns = cacheColumns;
+	return 0;
+}
+
+int MotionFileReader::writeCache(const char* fileName, long long fileSize, long long fileTime, const std::vector<double>& values, int numColumns)
+{
+	// written to a temporary file first, other processes may read the cache
+	char pid[32];
+	sprintf(pid, ".%d", (int)getpid());
+	std::string cacheName = std::string(fileName) + ".srtcache";
+	std::string tmpName = cacheName + pid;
+
+	std::ofstream cache(tmpName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!cache)
+	{
+		opserr << "WARNING MotionFileReader::writeCache - could not open " << tmpName.c_str() << endln;
+		return -1;
+	}
+
+	int order = MOTION_CACHE_ORDER;
+	long long numValues = values.size();
+	cache.write(MOTION_CACHE_MAGIC, 8);
+	cache.write((const char*)&order, sizeof(int));
+	cache.write((const char*)&numColumns, sizeof(int));
+	cache.write((const char*)&fileSize, sizeof(long long));
+	cache.write((const char*)&fileTime, sizeof(long long));
+	cache.write((const char*)&numValues, sizeof(long long));
+	if (numValues > 0)
+		cache.write((const char*)&values[0], numValues * sizeof(double));
+	cache.close();
+
+	if (!cache)
+	{
+		remove(tmpName.c_str());
+		return -1;
+	}
+
+#if defined(WIN32) || defined(_WIN32)
+	remove(cacheName.c_str());
+#endif
+	if (rename(tmpName.c_str(), cacheName.c_str()) != 0)
+	{
+		remove(tmpName.c_str());
+		return -1;
+	}
+	return 0;
+}
@@ -0,0 +1,49 @@
+/* ********************************************************************* **
+**                 Site Response Analysis Tool                           **
+**   -----------------------------------------------------------------   **
+**                                                                       **
+**   Developed by: Alborz Ghofrani (alborzgh@uw.edu)                     **
+**                 University of Washington                              **
+**                                                                       **
+**   Date: October 2026                                                  **
+**                                                                       **
+** ********************************************************************* */
+
+
+
+
+
+// Reads the numbers of a motion file (.time, .acc, .vel, .disp or a BBP
+// file) in one pass over the memory mapped file. Empty lines and lines
+// starting with '%' or '#' are skipped, and reading stops at the first
+// token that is not a number, as with the stream input of PathTimeSeries.
+//
+// With the cache on, the numbers are also written to a sidecar file,
+// fileName + ".srtcache", holding the size and modification time of the
+// motion file. Later reads of an unchanged file take the numbers from the
+// sidecar without parsing:
+//
+//   char[8] "SRTMOT01", int 0x01020304 (byte order), int numColumns,
+//   long long fileSize, long long fileTime, long long numValues,
+//   double[numValues]
+
+#ifndef MOTIONFILEREADER_H
+#define MOTIONFILEREADER_H
+
+#include <vector>
+
+class MotionFileReader
+{
+public:
+	// values gets all the numbers of the file, row after row; numColumns
+	// is the number of values on the first line with data. Returns the
+	// number of values, or -1 if the file can not be read.
+	static int read(const char* fileName, std::vector<double>& values, int& numColumns, bool useCache = false);
+
+private:
+	static int parse(const char* data, long long size, std::vector<double>& values, int& numColumns);
+	static int readCache(const char* fileName, long long fileSize, long long fileTime, std::vector<double>& values, int& numColumns);
+	static int writeCache(const char* fileName, long long fileSize, long long fileTime, const std::vector<double>& values, int numColumns);
+};
+
+#endif
@@ -14,67 +14,19 @@
 
 
 #include "outcropMotion.h"
+#include "MotionFileReader.h"
 #include <string>
-#include <fstream>
-#include <sstream>
 
 #include "Vector.h"
 
-bool fileExists(const char* fileName)
-{
-	// open the file to see if it exists
-	std::ifstream file(fileName);
-	if (file)
-		return true;
-
-	return false;
-}
-
-int readDT(const char* fileName, int& numSteps, std::vector<double>& dt)
-{
-	int res = -1;
-	numSteps = 0;
-	std::ifstream file(fileName);
-	if (file)
-	{
-		std::string line;
-		res = 1;
-		double t_n, t_n1;
-
-		// find the first non-empty line
-		while (getline(file, line))
-		{
-			// skip comment lines
-			if ((line == "") || (line[0] == '%') || (line[0] == '#'))
-				continue;
-			std::istringstream lines(line);
-			lines >> t_n;
-			break;
-		}
-
-		// count number of lines and calculate the dt for each step
-		while (getline(file, line))
-		{
-			// skip comment lines
-			if ((line == "") || (line[0] == '%') || (line[0] == '#'))
-				continue;
-			std::istringstream lines(line);
-			lines >> t_n1;
-			dt.push_back(t_n1 - t_n);
-			t_n = t_n1;
-			++numSteps;
-		}
-	}
-	return res;
-}
-
 OutcropMotion::OutcropMotion() :
 	theGroundMotion(NULL),
 	theAccSeries(),
 	theVelSeries(),
 	theDispSeries(),
 	isThisInitialized(false),
-	m_numSteps(0)
+	m_numSteps(0),
+	m_useCache(false)
 {
 
 }
@@ -85,7 +37,8 @@ OutcropMotion::OutcropMotion(const char* fName):
 	theVelSeries(),
 	theDispSeries(),
 	isThisInitialized(false),
-	m_numSteps(0)
+	m_numSteps(0),
+	m_useCache(false)
 {
 	this->setMotion(fName);
 }
@@ -95,6 +48,26 @@ OutcropMotion::~OutcropMotion()
 
 }
 
+// reads a path file for the times of the motion, NULL if it does not exist
+PathTimeSeries*
+OutcropMotion::readSeries(int tag, const char* fName, const Vector& time, double factor)
+{
+	std::vector<double> values;
+	int numColumns;
+	if (MotionFileReader::read(fName, values, numColumns, m_useCache) < 0)
+		return NULL;
+
+	if ((int)values.size() != time.Size())
+	{
+		opserr << "WARNING OutcropMotion::readSeries - " << fName << " and the time file ";
+		opserr << "do not contain the same number of points" << endln;
+		return NULL;
+	}
+
+	Vector path(&values[0], values.size());
+	return new PathTimeSeries(tag, path, time, factor, true);
+}
+
 void
 OutcropMotion::setMotion(const char* fName)
 {
@@ -107,20 +80,25 @@ OutcropMotion::setMotion(const char* fName)
 	std::string velFName = motionName + ".vel";
 	std::string dispFName = motionName + ".disp";
 
-	// check to see if the time file exists
-	if (readDT(timeFName.c_str(), m_numSteps, m_dt) > 0)
+	// the time file is read once for the dt and all the series
+	std::vector<double> times;
+	int numColumns;
+	if (MotionFileReader::read(timeFName.c_str(), times, numColumns, m_useCache) > 0)
 	{
+		m_numSteps = times.size() - 1;
+		m_dt.resize(m_numSteps);
+		for (int i = 0; i < m_numSteps; i++)
+			m_dt[i] = times[i + 1] - times[i];
+		Vector time(&times[0], times.size());
+
 		// assuming acceleration is in g's
-		if (fileExists(accFName.c_str()))
-			theAccSeries = new PathTimeSeries(1, accFName.c_str(), timeFName.c_str(), 9.81, true);
+		theAccSeries = this->readSeries(1, accFName.c_str(), time, 9.81);
 
 		// assuming velocity is in m/s
-		if (fileExists(velFName.c_str()))
-			theVelSeries = new PathTimeSeries(2, velFName.c_str(), timeFName.c_str(), 1.0, true);
+		theVelSeries = this->readSeries(2, velFName.c_str(), time, 1.0);
 
 		// assuming displcement is in m
-		if (fileExists(dispFName.c_str()))
-			theDispSeries = new PathTimeSeries(3, dispFName.c_str(), timeFName.c_str(), 1.0, true);
+		theDispSeries = this->readSeries(3, dispFName.c_str(), time, 1.0);
 
 		// create a ground motion. It's useful for UniformExcitatpon or MultipleSupport 
 		if ((theAccSeries != NULL) || (theVelSeries != NULL) || (theDispSeries != NULL))
@@ -141,50 +119,27 @@ OutcropMotion::setMotion(const char* fName)
 void                
 OutcropMotion::setBBPMotion(const char* fName, int colNum)
 {
-	Vector Path(100000);
-	Vector Time(100000);
 	m_numSteps = 0;
-	std::ifstream file(fName);
-	if (file)
+	std::vector<double> values;
+	int numColumns;
+	if (MotionFileReader::read(fName, values, numColumns, m_useCache) >= 0)
 	{
-		std::string line;
-		double t_n, t_n1;
-		double dummy;
-
-		// find the first non-empty line
-		while (getline(file, line))
+		// the time is in the first column, the velocity in cm/s in column colNum
+		int numRows = (numColumns > colNum) ? values.size() / numColumns : 0;
+		Vector Path(numRows);
+		Vector Time(numRows);
+		for (int i = 0; i < numRows; i++)
 		{
-			// skip comment lines
-			if ((line == "") || (line[0] == '%') || (line[0] == '#'))
-				continue;
-			std::istringstream lines(line);
-			lines >> t_n;
-			for (int ii = 0; ii < colNum - 1; ii++)
-				lines >> dummy;
-			lines >> Path(0);
-			break;
+			Time(i) = values[i * numColumns];
+			Path(i) = values[i * numColumns + colNum] / 100.0;
 		}
+		m_numSteps = (numRows > 0) ? numRows - 1 : 0;
+		m_dt.resize(m_numSteps);
+		for (int i = 0; i < m_numSteps; i++)
+			m_dt[i] = Time(i + 1) - Time(i);
 
-		// count number of lines and calculate the dt for each step
-		while (getline(file, line))
-		{
-			// skip comment lines
-			if ((line == "") || (line[0] == '%') || (line[0] == '#'))
-				continue;
-			std::istringstream lines(line);
-			lines >> t_n1;
-			m_dt.push_back(t_n1 - t_n);
-			t_n = t_n1;
-			++m_numSteps;
-			for (int ii = 0; ii < colNum - 1; ii++)
-				lines >> dummy;
-			lines >> dummy;
-			Path(m_numSteps) = dummy / 100.0;
-			Time(m_numSteps) = t_n1;
-		}
-		Path.resize(m_numSteps+1);
-		Time.resize(m_numSteps+1);
-		theVelSeries = new PathTimeSeries(2, Path, Time, 1.0, false);
+		if (numRows > 0)
+			theVelSeries = new PathTimeSeries(2, Path, Time, 1.0, false);
 		isThisInitialized = true;
 		
 		// create a ground motion. It's useful for UniformExcitatpon or MultipleSupport 
@@ -38,8 +38,12 @@ public:
 	int                 getNumSteps() { return m_numSteps; };
 	void                setMotion(const char* fName);
 	void                setBBPMotion(const char* fName, int colNum);
+	// keep the numbers of the motion files in binary sidecar files
+	void                setUseCache(bool useCache) { m_useCache = useCache; };
 
 private:
+	PathTimeSeries* readSeries(int tag, const char* fName, const Vector& time, double factor);
+
 	PathTimeSeries* theAccSeries;
 	PathTimeSeries* theVelSeries;
 	PathTimeSeries* theDispSeries;
@@ -47,6 +51,7 @@ private:
 
 	bool isThisInitialized;
 	int  m_numSteps;
+	bool m_useCache;
 	std::vector<double> m_dt;
 };
 
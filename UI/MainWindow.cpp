@@ -23,6 +23,7 @@
 
 #include <QFileInfo>
 #include <QMessageBox>
+#include <QStatusBar>
 
 
 #include <iostream>
@@ -307,19 +308,17 @@ MainWindow::MainWindow(QWidget *parent) :
     ui->groupBox_Mesh->setVisible(false);
 
 
-    // opensees
-
-
-    openseesProcess = new QProcess(this);
-    //connect(openseesProcess, SIGNAL(readyReadStandardOutput()),this,SLOT(onOpenSeesFinished()));
-    connect(openseesProcess, SIGNAL(readyReadStandardError()),this,SLOT(onOpenSeesFinished()));
-
-
-
 }
 
 MainWindow::~MainWindow()
 {
+    // let a running analysis stop before the window goes away
+    if (analysisThread != nullptr)
+    {
+        analysisWorker->stop();
+        analysisThread->quit();
+        analysisThread->wait();
+    }
     delete ui;
 }
 
@@ -667,6 +666,7 @@ void MainWindow::on_reBtn_clicked()
     {
         std::ofstream o(file_name.toStdString());
         o << std::setw(4) << root << std::endl;
+        analysisConfigFile = QFileInfo(file_name).absoluteFilePath();
     } else {
         QMessageBox::information(this, "error", "Failed to get file name.");
     }
@@ -695,28 +695,57 @@ void MainWindow::on_reBtn_clicked()
 
 void MainWindow::on_runBtn_clicked()
 {
-    //SiteResponse srt;
-    openseesProcess->start("/Users/simcenter/Codes/OpenSees/bin/opensees",QStringList()<<"/Users/simcenter/Codes/SimCenter/SiteResponseTool/bin/model.tcl");
-    openseesErrCount = 1;
+    if (analysisThread != nullptr)
+        return; // an analysis is running
+
+    // run the analysis in-process on a worker thread, the signals are queued to this thread
+    analysisThread = new QThread(this);
+    // the configuration written by on_reBtn_clicked(), the layers are in it
+    if (analysisConfigFile.isEmpty())
+        analysisConfigFile = QFileInfo("SRT.json").absoluteFilePath();
+    QString motionFile = ui->tabWidget->widget(0)->findChild<QLineEdit*>("GMPath")->text();
+    analysisWorker = new SiteResponse(analysisConfigFile, QString(), motionFile);
+    analysisWorker->moveToThread(analysisThread);
+
+    connect(analysisThread, SIGNAL(started()), analysisWorker, SLOT(run()));
+    connect(analysisWorker, SIGNAL(progress(AnalysisProgress)), this, SLOT(onAnalysisProgress(AnalysisProgress)));
+    connect(analysisWorker, SIGNAL(finished(int)), this, SLOT(onAnalysisFinished(int)));
+    connect(analysisWorker, SIGNAL(finished(int)), analysisThread, SLOT(quit()));
+    connect(analysisThread, SIGNAL(finished()), analysisWorker, SLOT(deleteLater()));
+    connect(analysisThread, SIGNAL(finished()), analysisThread, SLOT(deleteLater()));
+
+    ui->runBtn->setEnabled(false);
+    statusBar()->show();
+    analysisThread->start();
+
     emit runBtnClicked(dinoView);
 }
 
-void MainWindow::onOpenSeesFinished()
+void MainWindow::onAnalysisProgress(const AnalysisProgress &progress)
 {
+    statusBar()->showMessage(QString("Step %1/%2, time %3 s, %4 ms/step, %5 iterations, %6 failed sub-steps")
+                             .arg(progress.step).arg(progress.numSteps)
+                             .arg(progress.time, 0, 'f', 3)
+                             .arg(1000.0 * progress.stepTime, 0, 'f', 1)
+                             .arg(progress.numIterations)
+                             .arg(progress.numFailedSubSteps));
+}
 
-    QString str_err = openseesProcess->readAllStandardError();
+void MainWindow::onAnalysisFinished(int result)
+{
+    analysisThread = nullptr;
+    analysisWorker = nullptr;
+    ui->runBtn->setEnabled(true);
 
-    if(openseesErrCount==1)
+    if (result == 0)
     {
-        if(str_err.contains("Site response analysis is finished."))
-        {
-            QMessageBox::information(this,tr("OpenSees Information"), "Analysis is done.", tr("OK."));
-            qDebug() << "opensees says:" << str_err;
-            openseesErrCount = 2;
-            theTabManager->getTab()->setCurrentIndex(2);
-        }
+        statusBar()->showMessage("Analysis is done.");
+        QMessageBox::information(this,tr("OpenSees Information"), "Analysis is done.", tr("OK."));
+        theTabManager->getTab()->setCurrentIndex(2);
+    } else {
+        statusBar()->showMessage("Analysis failed.");
+        QMessageBox::warning(this,tr("OpenSees Information"), "Analysis failed, see the log file.", tr("OK."));
     }
-
 }
 
 json MainWindow::createMaterial(int tag, std::string matType, std::string parameters)
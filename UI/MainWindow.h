@@ -6,8 +6,9 @@
 #include <QQuickView>
 #include "Mesher.h"
 #include "ElementModel.h"
-#include <QProcess>
+#include <QThread>
 #include "TabManager.h"
+#include "SiteResponse.h"
 
 #include <nlohmann/json.hpp>
 using json = nlohmann::json;
@@ -61,7 +62,8 @@ private slots:
     void refresh();
 
     ElementModel* getElementModel()const;
-    void onOpenSeesFinished();
+    void onAnalysisProgress(const AnalysisProgress &progress);
+    void onAnalysisFinished(int result);
 
 signals:
     void gwtChanged(const QString &newGWT);
@@ -75,7 +77,6 @@ private:
     int meshViewWidth = 200;
     int layerTableWidth = 630;
     int layerTableHeight = 500;//320;
-    int openseesErrCount = 0;
 public:
     QWidget *plotContainer;
     QWidget *matContainer;
@@ -83,7 +84,9 @@ public:
     Mesher* mesher;
     QQuickView *meshView;
     ElementModel* elementModel;
-    QProcess* openseesProcess;
+    QThread* analysisThread = nullptr;
+    SiteResponse* analysisWorker = nullptr;
+    QString analysisConfigFile;  // absolute path of the SRT.json written last
     TabManager* theTabManager;
 
 };
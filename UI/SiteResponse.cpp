@@ -16,58 +16,80 @@
 #include "OPS_Stream.h"
 
 #include <QDebug>
+#include <QElapsedTimer>
 
 // these must be defined here!!
 StandardStream sserr;
 FileStream ferr("log");
-OPS_Stream *opserrPtr = &ferr;
-OPS_Stream *opsoutPtr = &sserr;
+thread_local OPS_Stream *opserrPtr = &ferr;
+thread_local OPS_Stream *opsoutPtr = &sserr;
 
 
-SiteResponse::SiteResponse()
+SiteResponse::SiteResponse(const QString &configFile, const QString &layersFile,
+                           const QString &motionFile, QObject *parent) :
+    QObject(parent),
+    configFile(configFile.toStdString()),
+    layersFile(layersFile.toStdString()),
+    motionFile(motionFile.toStdString()),
+    stopRequested(false)
 {
+    qRegisterMetaType<AnalysisProgress>("AnalysisProgress");
+}
 
-    //./siteresponse ../test/siteLayering.loc -bbp ../test/9130326.nwhp.vel.bbp out thisLog
-    // read the layering file
-    std::string layersFN("/Users/simcenter/Codes/SimCenter/SiteResponseTool/test/siteLayering.loc");
-    std::string bbpOName(".");
-    SiteLayering siteLayers(layersFN.c_str());
-    int t = siteLayers.getNumLayers();
+void SiteResponse::run()
+{
+    stopRequested = false;
 
+    // read the layering file
+    SiteLayering siteLayers;
+    if (!layersFile.empty())
+        siteLayers.readFromFile(layersFile.c_str());
 
-    // read the motion
+    // read the motion, bbp or opensees style
     OutcropMotion motionX;
-    OutcropMotion motionZ;
-
-    int inputStyle = 2; // bbp=1 opensees=2
+    if (motionFile.size() > 4 && motionFile.compare(motionFile.size() - 4, 4, ".bbp") == 0)
+        motionX.setBBPMotion(motionFile.c_str(), 1);
+    else
+        motionX.setMotion(motionFile.c_str());
 
-
-
-    if (inputStyle == 1)
+    // SiteResponseModel exits the process without a motion
+    if (!motionX.isInitialized())
     {
-        std::string bbpFName("/Users/simcenter/Codes/SimCenter/SiteResponseTool/test/9130326.nwhp.vel.bbp");
-        bbpOName = std::string("out");
-        std::string bbpLName = std::string("thisLog");
-        //ferr.setFile(bbpLName.c_str(), APPEND);
-        // read bbp style motion
-        motionX.setBBPMotion(bbpFName.c_str(), 1);
-        //motionZ.setBBPMotion(bbpFName.c_str(), 2);
+        opserr << "WARNING SiteResponse::run - can not read the motion " << motionFile.c_str() << endln;
+        emit finished(-1);
+        return;
     }
-    else {
-        std::string bbpLName = "Log";
 
-        std::string motionXFN("/Users/simcenter/Codes/SimCenter/SiteResponseTool/test/RSN766_G02_000_VEL");
-        motionX.setMotion(motionXFN.c_str());
-        bbpOName = "out";
+    // the output goes next to the configuration
+    std::string outDir = "out";
+    size_t pos = configFile.find_last_of("/\\");
+    if (pos != std::string::npos)
+        outDir = configFile.substr(0, pos + 1) + outDir;
 
-    }
+    // signals to the GUI thread are queued, the analysis does not wait for
+    // them; at most one every progressInterval, and the last step, so that
+    // the GUI thread is not flooded on fast models
+    QElapsedTimer sinceLastProgress;
+    sinceLastProgress.start();
 
     //SiteResponseModel model(siteLayers, "3D", &motionX, &motionZ);
     SiteResponseModel model(siteLayers, "2D", &motionX);
-    model.setOutputDir(bbpOName);
+    model.setOutputDir(outDir);
+    model.setConfigFile(configFile);
+    model.setStopFlag(&stopRequested);
+    model.setProgressCallback([this, &sinceLastProgress](const AnalysisProgress &p) {
+        if (p.step == p.numSteps || sinceLastProgress.elapsed() >= progressInterval)
+        {
+            emit progress(p);
+            sinceLastProgress.restart();
+        }
+        return !stopRequested;
+    });
     //model.runTotalStressModel();
-    model.buildEffectiveStressModel2D();
+    int result = model.buildEffectiveStressModel2D();
     //model.runEffectiveStressModel2D();
+
+    emit finished(result);
 }
 
 
@@ -77,4 +99,3 @@ SiteResponse::~SiteResponse()
 {
 
 }
-
@@ -1,19 +1,45 @@
 #ifndef SITERESPONSE_H
 #define SITERESPONSE_H
 
-class SiteResponse {
+#include <QObject>
+#include <QMetaType>
+#include <atomic>
+#include <string>
 
-public:
-	SiteResponse();
-	~SiteResponse();
+#include "EffectiveFEModel.h"
 
+Q_DECLARE_METATYPE(AnalysisProgress)
 
+// runs SiteResponseModel in-process; move it to a QThread and call run()
+class SiteResponse : public QObject
+{
+    Q_OBJECT
 
-	
-private:
+public:
+    // configFile is the SRT.json written by MainWindow, motionFile the input
+    // motion (.bbp or OpenSees style). The layers come from configFile, an
+    // empty layersFile gives an empty SiteLayering.
+    SiteResponse(const QString &configFile, const QString &layersFile,
+                 const QString &motionFile, QObject *parent = nullptr);
+    ~SiteResponse();
 
+    // thread safe, the analysis stops after the current step
+    void stop() { stopRequested = true; }
 
+public slots:
+    void run();
+
+signals:
+    void progress(const AnalysisProgress &progress);
+    void finished(int result);
+
+private:
+    std::string configFile;
+    std::string layersFile;
+    std::string motionFile;
+    std::atomic<bool> stopRequested;
 
+    static const int progressInterval = 100; // [ms] between progress signals
 };
 
 #endif